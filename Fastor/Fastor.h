@@ -18,6 +18,8 @@
 #include "simd_math/simd_math.h"
 #include "tensor/Tensor.h"
 #include "tensor/TensorMap.h"
+#include "tensor/SymmetricTensor.h"
+#include "tensor/StructuredTensor.h"
 #include "tensor/TensorIO.h"
 #include "tensor/TensorFunctions.h"
 #include "tensor/AbstractTensorFunctions.h"
@@ -25,6 +27,8 @@
 #include "tensor_algebra/network_einsum.h"
 #include "tensor_algebra/einsum_explicit.h"
 #include "tensor_algebra/abstract_contraction.h"
+#include "tensor_algebra/runtime_einsum.h"
+#include "tensor/SymbolicTensor.h"
 #include "expressions/expressions.h"
 #include "backend/voigt.h"
 
@@ -3,22 +3,32 @@
 
 
 #include "Fastor/backend/adjoint.h"
+#include "Fastor/backend/cholfact.h"
 #include "Fastor/backend/cofactor.h"
 #include "Fastor/backend/cyclic_0.h"
 #include "Fastor/backend/determinant.h"
 #include "Fastor/backend/doublecontract.h"
 #include "Fastor/backend/dyadic.h"
+#include "Fastor/backend/eigh.h"
+#include "Fastor/backend/expm.h"
 #include "Fastor/backend/inner.h"
 #include "Fastor/backend/inverse.h"
 #include "Fastor/backend/lufact.h"
+#include "Fastor/backend/lufact_blocked.h"
 #include "Fastor/backend/lut_inverse.h"
 #include "Fastor/backend/matmul/matmul.h"
 #include "Fastor/backend/matmul/tmatmul.h"
 #include "Fastor/backend/norm.h"
 #include "Fastor/backend/outer.h"
+#include "Fastor/backend/scatter_add.h"
+#include "Fastor/backend/solve_batch.h"
+#include "Fastor/backend/structured.h"
+#include "Fastor/backend/svd.h"
+#include "Fastor/backend/symmetric.h"
 #include "Fastor/backend/tensor_cross.h"
 #include "Fastor/backend/trace.h"
 #include "Fastor/backend/transpose/transpose.h"
+#include "Fastor/backend/trsm.h"
 
 #endif // BACKEND_H
 
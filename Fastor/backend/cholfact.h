@@ -0,0 +1,35 @@
+#ifndef CHOLFACT_H
+#define CHOLFACT_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/config/config.h"
+#include "Fastor/backend/trsm.h"
+#include <cmath>
+
+namespace Fastor {
+
+// In-place Cholesky factorisation A = L * L^T of a real symmetric positive definite matrix.
+// Only the lower triangle of a is referenced and it is overwritten by L, the strictly upper
+// part is left untouched. Every entry of L is formed by a dot product of two contiguous rows
+// of the already computed factor. Returns 0 on success or k+1 if the leading minor of order
+// k+1 is not positive definite, in which case the factorisation is incomplete
+template<typename T, size_t M>
+FASTOR_INLINE size_t _cholfact(T *FASTOR_RESTRICT a) {
+    for (size_t j=0; j<M; ++j) {
+        const T ajj = a[j*M+j] - internal::_trsv_dot(&a[j*M],&a[j*M],j);
+        if (!(ajj > T(0))) {
+            return j+1;
+        }
+        const T ljj = std::sqrt(ajj);
+        const T inv_ljj = T(1) / ljj;
+        a[j*M+j] = ljj;
+        for (size_t i=j+1; i<M; ++i) {
+            a[i*M+j] = (a[i*M+j] - internal::_trsv_dot(&a[i*M],&a[j*M],j))*inv_ljj;
+        }
+    }
+    return 0;
+}
+
+} // end of namespace Fastor
+
+#endif // CHOLFACT_H
@@ -0,0 +1,388 @@
+#ifndef EIGH_H
+#define EIGH_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/config/config.h"
+#include "Fastor/simd_vector/extintrin.h"
+#include "Fastor/simd_vector/SIMDVector.h"
+#include "Fastor/simd_math/simd_math.h"
+#include <cmath>
+#include <limits>
+
+namespace Fastor {
+
+// Symmetric eigen-decomposition kernels A = V * diag(w) * V^T. Eigenvalues are
+// returned in ascending order and the eigenvectors are the columns of V.
+// The kernels in internal are written generically over the value type V which can
+// either be a scalar or a SIMDVector in which case a batch of matrices (one per lane)
+// is decomposed at once. All the per lane decisions are made through select
+//----------------------------------------------------------------------------------------------------------------//
+namespace internal {
+
+/* Jacobi rotation [c s; -s c] that annihilates the off-diagonal entry of the symmetric 2x2 block [app apq; apq aqq] */
+template<typename T, typename V>
+FASTOR_INLINE void _jacobi_rotation(const V &app, const V &apq, const V &aqq, V &c, V &s, V &t) {
+    using std::abs;
+    using std::sqrt;
+    using std::max;
+    // Scale to avoid under/overflow
+    const V d      = aqq - app;
+    const V two_pq = T(2)*apq;
+    const V inv_mx = T(1) / max(max(abs(d),abs(two_pq)),V(std::numeric_limits<T>::min()));
+    const V dn     = d*inv_mx;
+    const V an     = two_pq*inv_mx;
+    const V sgn    = select(d < T(0), V(T(-1)), V(T(1)));
+    t = sgn*an / (abs(dn) + sqrt(dn*dn + an*an) + std::numeric_limits<T>::min());
+    c = T(1) / sqrt(T(1) + t*t);
+    s = t*c;
+}
+
+/* Closed-form 2x2 - a single Jacobi rotation */
+template<typename T, typename V>
+FASTOR_INLINE void _eigh22_kernel(const V &a00, const V &a01, const V &a11, V (&w)[2], V (&v)[4]) {
+    V c, s, t;
+    _jacobi_rotation<T>(a00, a01, a11, c, s, t);
+    const V mu0 = a00 - t*a01;
+    const V mu1 = a11 + t*a01;
+    const auto swap = mu0 > mu1;
+    w[0] = select(swap, mu1, mu0);
+    w[1] = select(swap, mu0, mu1);
+    v[0] = select(swap, s, c);
+    v[1] = select(swap, c, s);
+    v[2] = select(swap, c, V(-s));
+    v[3] = select(swap, V(-s), c);
+}
+
+/* Closed-form 3x3. The matrix is shifted by its mean eigenvalue and scaled by its largest entry.
+   The eigenvalues are computed from the trigonometric solution of the characteristic cubic and
+   the eigenvector of the extreme eigenvalue that is best separated from the rest is obtained
+   from the cross products of the rows of B - lambda I. The remaining (possibly degenerate) pair
+   is found by a Jacobi rotation on the deflated 2x2 problem in the orthogonal complement, which
+   keeps the eigenvectors accurate and orthogonal for repeated eigenvalues. Only the upper
+   triangular part of the matrix is referenced. Returns a mask that is set where the residual
+   of the deflation vector is not acceptable and the caller should fall back to cyclic Jacobi
+*/
+template<typename T, typename V>
+FASTOR_INLINE auto _eigh33_kernel(const V &a00, const V &a01, const V &a02, const V &a11, const V &a12, const V &a22,
+    V (&w)[3], V (&v)[9]) -> decltype(V() > T(0)) {
+    using std::abs;
+    using std::sqrt;
+    using std::max;
+    using std::cos;
+    using std::sin;
+    using std::atan2;
+
+    constexpr T tiny = std::numeric_limits<T>::min();
+
+    // Shift and scale
+    const V shift = (a00 + a11 + a22) * T(1./3.);
+    V b00 = a00 - shift;
+    V b11 = a11 - shift;
+    V b22 = a22 - shift;
+    const V scale = max(max(max(abs(b00),abs(b11)),max(abs(b22),abs(a01))),max(abs(a02),abs(a12)));
+    const V inv_scale = T(1) / max(scale,V(tiny));
+    b00 *= inv_scale;
+    b11 *= inv_scale;
+    b22 *= inv_scale;
+    const V b01 = a01*inv_scale;
+    const V b02 = a02*inv_scale;
+    const V b12 = a12*inv_scale;
+
+    // Characteristic polynomial of the traceless B: lambda^3 + c1 lambda - c0 = 0
+    const V b01s = b01*b01;
+    const V b02s = b02*b02;
+    const V b12s = b12*b12;
+    const V c1 = b00*b11 + b00*b22 + b11*b22 - (b01s + b02s + b12s);
+    const V c0 = b22*b01s + b00*b12s + b11*b02s - b00*b11*b22 - T(2)*b02*b01*b12;
+    const V p  = T(-3)*c1;
+    const V q  = T(-13.5)*c0;
+    V phi = T(27)*(T(0.25)*c1*c1*(p - c1) + c0*(q + T(6.75)*c0));
+    phi = T(1./3.)*atan2(sqrt(abs(phi)), q);
+    const V sqrt_p = sqrt(abs(p));
+    const V cc = sqrt_p*cos(phi);
+    const V ss = T(0.57735026918962576451)*sqrt_p*sin(phi);
+    const V lmid = T(-1./3.)*cc;
+    const V lmax = lmid + cc;
+    const V lmin = lmid - ss;
+    const V lmed = lmid + ss;
+
+    // Pick the extreme eigenvalue with the larger gap
+    const auto sep_min = (lmed - lmin) >= (lmax - lmed);
+    V lam = select(sep_min, lmin, lmax);
+
+    // Its eigenvector is the largest cross product of the rows of B - lambda I
+    const V r00 = b00 - lam;
+    const V r11 = b11 - lam;
+    const V r22 = b22 - lam;
+    const V x01 = b01*b12 - b02*r11, y01 = b02*b01 - r00*b12, z01 = r00*r11 - b01s;
+    const V x02 = b01*r22 - b02*b12, y02 = b02s    - r00*r22, z02 = r00*b12 - b01*b02;
+    const V x12 = r11*r22 - b12s   , y12 = b12*b02 - b01*r22, z12 = b01*b12 - r11*b02;
+    const V n01 = x01*x01 + y01*y01 + z01*z01;
+    const V n02 = x02*x02 + y02*y02 + z02*z02;
+    const V n12 = x12*x12 + y12*y12 + z12*z12;
+
+    const auto m1 = n01 >= n02;
+    V xb = select(m1, x01, x02);
+    V yb = select(m1, y01, y02);
+    V zb = select(m1, z01, z02);
+    V nb = select(m1, n01, n02);
+    const auto m2 = nb >= n12;
+    xb = select(m2, xb, x12);
+    yb = select(m2, yb, y12);
+    zb = select(m2, zb, z12);
+    nb = select(m2, nb, n12);
+
+    // B vanishes only if A is a multiple of identity in which case any unit vector will do
+    const auto degenerate = nb <= tiny;
+    const V inv_nb = T(1) / sqrt(max(nb,V(tiny)));
+    const V v0x = select(degenerate, V(T(1)), V(xb*inv_nb));
+    const V v0y = select(degenerate, V(T(0)), V(yb*inv_nb));
+    const V v0z = select(degenerate, V(T(0)), V(zb*inv_nb));
+
+    // Rayleigh quotient and residual of the deflation vector
+    const V bvx = b00*v0x + b01*v0y + b02*v0z;
+    const V bvy = b01*v0x + b11*v0y + b12*v0z;
+    const V bvz = b02*v0x + b12*v0y + b22*v0z;
+    lam = v0x*bvx + v0y*bvy + v0z*bvz;
+    const V rx = bvx - lam*v0x;
+    const V ry = bvy - lam*v0y;
+    const V rz = bvz - lam*v0z;
+    const auto fallback = (rx*rx + ry*ry + rz*rz) > std::numeric_limits<T>::epsilon();
+
+    // Orthonormal complement [U, W] of v0
+    const auto mx = abs(v0x) > abs(v0y);
+    const V invx = T(1) / sqrt(max(V(v0x*v0x + v0z*v0z),V(tiny)));
+    const V invy = T(1) / sqrt(max(V(v0y*v0y + v0z*v0z),V(tiny)));
+    const V ux = select(mx, V(-v0z*invx), V(T(0)));
+    const V uy = select(mx, V(T(0)), V(v0z*invy));
+    const V uz = select(mx, V(v0x*invx), V(-v0y*invy));
+    const V wx = v0y*uz - v0z*uy;
+    const V wy = v0z*ux - v0x*uz;
+    const V wz = v0x*uy - v0y*ux;
+
+    // Deflated 2x2 problem
+    const V bux = b00*ux + b01*uy + b02*uz;
+    const V buy = b01*ux + b11*uy + b12*uz;
+    const V buz = b02*ux + b12*uy + b22*uz;
+    const V bwx = b00*wx + b01*wy + b02*wz;
+    const V bwy = b01*wx + b11*wy + b12*wz;
+    const V bwz = b02*wx + b12*wy + b22*wz;
+    const V m00 = ux*bux + uy*buy + uz*buz;
+    const V m01 = wx*bux + wy*buy + wz*buz;
+    const V m11 = wx*bwx + wy*bwy + wz*bwz;
+
+    V c, s, t;
+    _jacobi_rotation<T>(m00, m01, m11, c, s, t);
+    const V mu0 = m00 - t*m01;
+    const V mu1 = m11 + t*m01;
+    const V p0x = c*ux - s*wx, p0y = c*uy - s*wy, p0z = c*uz - s*wz;
+    const V p1x = s*ux + c*wx, p1y = s*uy + c*wy, p1z = s*uz + c*wz;
+    const auto swap = mu0 > mu1;
+    const V lo  = select(swap, mu1, mu0);
+    const V hi  = select(swap, mu0, mu1);
+    const V lox = select(swap, p1x, p0x), loy = select(swap, p1y, p0y), loz = select(swap, p1z, p0z);
+    const V hix = select(swap, p0x, p1x), hiy = select(swap, p0y, p1y), hiz = select(swap, p0z, p1z);
+
+    // Assemble in ascending order and undo the shift and scale
+    w[0] = select(sep_min, lam, lo)*scale + shift;
+    w[1] = select(sep_min, lo, hi )*scale + shift;
+    w[2] = select(sep_min, hi, lam)*scale + shift;
+
+    v[0] = select(sep_min, v0x, lox);
+    v[3] = select(sep_min, v0y, loy);
+    v[6] = select(sep_min, v0z, loz);
+    v[1] = select(sep_min, lox, hix);
+    v[4] = select(sep_min, loy, hiy);
+    v[7] = select(sep_min, loz, hiz);
+    v[2] = select(sep_min, hix, v0x);
+    v[5] = select(sep_min, hiy, v0y);
+    v[8] = select(sep_min, hiz, v0z);
+
+    return fallback;
+}
+
+/* Cyclic Jacobi on a full symmetric matrix stored in a. a is overwritten */
+template<typename T, size_t N, typename V>
+FASTOR_HINT_INLINE void _eigh_jacobi_kernel(V *FASTOR_RESTRICT a, V *FASTOR_RESTRICT w, V *FASTOR_RESTRICT v) {
+
+    constexpr T eps = std::numeric_limits<T>::epsilon();
+    constexpr size_t max_sweeps = 50;
+
+    for (size_t i=0; i<N; ++i) {
+        for (size_t j=0; j<N; ++j) {
+            v[i*N+j] = i==j ? T(1) : T(0);
+        }
+    }
+
+    for (size_t sweep=0; sweep<max_sweeps; ++sweep) {
+        V off(T(0)), dia(T(0));
+        for (size_t p=0; p<N; ++p) {
+            dia += a[p*N+p]*a[p*N+p];
+            for (size_t q=p+1; q<N; ++q) {
+                off += a[p*N+q]*a[p*N+q];
+            }
+        }
+        if (!any_of(off > eps*eps*dia)) break;
+
+        for (size_t p=0; p<N; ++p) {
+            for (size_t q=p+1; q<N; ++q) {
+                V c, s, t;
+                _jacobi_rotation<T>(a[p*N+p], a[p*N+q], a[q*N+q], c, s, t);
+                for (size_t r=0; r<N; ++r) {
+                    const V arp = a[r*N+p];
+                    const V arq = a[r*N+q];
+                    a[r*N+p] = c*arp - s*arq;
+                    a[r*N+q] = s*arp + c*arq;
+                }
+                for (size_t r=0; r<N; ++r) {
+                    const V apr = a[p*N+r];
+                    const V aqr = a[q*N+r];
+                    a[p*N+r] = c*apr - s*aqr;
+                    a[q*N+r] = s*apr + c*aqr;
+                }
+                a[p*N+q] = T(0);
+                a[q*N+p] = T(0);
+                for (size_t r=0; r<N; ++r) {
+                    const V vrp = v[r*N+p];
+                    const V vrq = v[r*N+q];
+                    v[r*N+p] = c*vrp - s*vrq;
+                    v[r*N+q] = s*vrp + c*vrq;
+                }
+            }
+        }
+    }
+
+    for (size_t i=0; i<N; ++i) {
+        w[i] = a[i*N+i];
+    }
+
+    // Sort ascending - odd-even transposition so that it remains branch-free across lanes
+    for (size_t i=0; i<N; ++i) {
+        for (size_t j=i%2; j+1<N; j+=2) {
+            const auto swap = w[j] > w[j+1];
+            const V wj = w[j];
+            w[j]   = select(swap, w[j+1], wj);
+            w[j+1] = select(swap, wj, w[j+1]);
+            for (size_t r=0; r<N; ++r) {
+                const V vj = v[r*N+j];
+                v[r*N+j]   = select(swap, v[r*N+j+1], vj);
+                v[r*N+j+1] = select(swap, vj, v[r*N+j+1]);
+            }
+        }
+    }
+}
+
+} // internal
+//----------------------------------------------------------------------------------------------------------------//
+
+
+
+// Cyclic Jacobi - any size. Only the upper triangular part of a is referenced
+template<typename T, size_t N>
+FASTOR_INLINE void _eigh_jacobi(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT w, T *FASTOR_RESTRICT v) {
+    T b[N*N];
+    for (size_t i=0; i<N; ++i) {
+        for (size_t j=i; j<N; ++j) {
+            b[i*N+j] = a[i*N+j];
+            b[j*N+i] = a[i*N+j];
+        }
+    }
+    internal::_eigh_jacobi_kernel<T,N>(b,w,v);
+}
+
+
+// Closed-form 1x1, 2x2 and 3x3 - the small sizes of EigCompType::Simple. Bigger
+// matrices are reduced through HHQL [see unary_eigh_op.h] or _eigh_jacobi
+template<typename T, size_t N, enable_if_t_<is_equal_v_<N,1>, bool> = false>
+FASTOR_INLINE void _eigh(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT w, T *FASTOR_RESTRICT v) {
+    *w = *a;
+    *v = 1;
+}
+
+template<typename T, size_t N, enable_if_t_<is_equal_v_<N,2>, bool> = false>
+FASTOR_INLINE void _eigh(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT w, T *FASTOR_RESTRICT v) {
+    T _w[2], _v[4];
+    internal::_eigh22_kernel<T>(a[0],a[1],a[3],_w,_v);
+    w[0] = _w[0]; w[1] = _w[1];
+    v[0] = _v[0]; v[1] = _v[1]; v[2] = _v[2]; v[3] = _v[3];
+}
+
+template<typename T, size_t N, enable_if_t_<is_equal_v_<N,3>, bool> = false>
+FASTOR_INLINE void _eigh(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT w, T *FASTOR_RESTRICT v) {
+    T _w[3], _v[9];
+    const bool fallback = internal::_eigh33_kernel<T>(a[0],a[1],a[2],a[4],a[5],a[8],_w,_v);
+    if (fallback) {
+        _eigh_jacobi<T,3>(a,w,v);
+        return;
+    }
+    for (size_t i=0; i<3; ++i) w[i] = _w[i];
+    for (size_t i=0; i<9; ++i) v[i] = _v[i];
+}
+
+
+
+// Batched closed-form 2x2 and 3x3 - nbatch contiguous row-major matrices
+// are decomposed SIMDVector::Size matrices at a time, one matrix per lane
+//----------------------------------------------------------------------------------------------------------------//
+template<typename T, size_t N, enable_if_t_<is_equal_v_<N,1>, bool> = false>
+FASTOR_INLINE void _eigh_batch(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT w, T *FASTOR_RESTRICT v, size_t nbatch) {
+    for (size_t k=0; k<nbatch; ++k) {
+        _eigh<T,N>(&a[k*N*N],&w[k*N],&v[k*N*N]);
+    }
+}
+
+template<typename T, size_t N, enable_if_t_<is_equal_v_<N,2>, bool> = false>
+FASTOR_INLINE void _eigh_batch(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT w, T *FASTOR_RESTRICT v, size_t nbatch) {
+    using V = SIMDVector<T,DEFAULT_ABI>;
+    constexpr int NN = int(N*N);
+    size_t k = 0;
+    for (; k < ROUND_DOWN(nbatch,V::Size); k+=V::Size) {
+        V a00, a01, a11;
+        vector_setter(a00,a,int(k)*NN  ,NN);
+        vector_setter(a01,a,int(k)*NN+1,NN);
+        vector_setter(a11,a,int(k)*NN+3,NN);
+        V _w[2], _v[4];
+        internal::_eigh22_kernel<T>(a00,a01,a11,_w,_v);
+        for (int i=0; i<int(N); ++i)  data_setter(w,_w[i],int(k)*int(N)+i,int(N));
+        for (int i=0; i<NN; ++i)      data_setter(v,_v[i],int(k)*NN+i,NN);
+    }
+    for (; k<nbatch; ++k) {
+        _eigh<T,N>(&a[k*N*N],&w[k*N],&v[k*N*N]);
+    }
+}
+
+template<typename T, size_t N, enable_if_t_<is_equal_v_<N,3>, bool> = false>
+FASTOR_INLINE void _eigh_batch(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT w, T *FASTOR_RESTRICT v, size_t nbatch) {
+    using V = SIMDVector<T,DEFAULT_ABI>;
+    constexpr int NN = int(N*N);
+    size_t k = 0;
+    for (; k < ROUND_DOWN(nbatch,V::Size); k+=V::Size) {
+        V a00, a01, a02, a11, a12, a22;
+        vector_setter(a00,a,int(k)*NN  ,NN);
+        vector_setter(a01,a,int(k)*NN+1,NN);
+        vector_setter(a02,a,int(k)*NN+2,NN);
+        vector_setter(a11,a,int(k)*NN+4,NN);
+        vector_setter(a12,a,int(k)*NN+5,NN);
+        vector_setter(a22,a,int(k)*NN+8,NN);
+        V _w[3], _v[9];
+        const auto fallback = internal::_eigh33_kernel<T>(a00,a01,a02,a11,a12,a22,_w,_v);
+        for (int i=0; i<int(N); ++i)  data_setter(w,_w[i],int(k)*int(N)+i,int(N));
+        for (int i=0; i<NN; ++i)      data_setter(v,_v[i],int(k)*NN+i,NN);
+        // Only the flagged lanes take the slow path
+        if (any_of(fallback)) {
+            bool lanes[V::Size];
+            fallback.store(lanes);
+            for (size_t l=0; l<V::Size; ++l) {
+                if (lanes[l]) _eigh_jacobi<T,N>(&a[(k+l)*N*N],&w[(k+l)*N],&v[(k+l)*N*N]);
+            }
+        }
+    }
+    for (; k<nbatch; ++k) {
+        _eigh<T,N>(&a[k*N*N],&w[k*N],&v[k*N*N]);
+    }
+}
+//----------------------------------------------------------------------------------------------------------------//
+
+} // end of namespace Fastor
+
+#endif // EIGH_H
@@ -0,0 +1,189 @@
+#ifndef EXPM_H
+#define EXPM_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/config/config.h"
+#include "Fastor/backend/matmul/matmul.h"
+#include "Fastor/backend/inverse.h"
+#include "Fastor/backend/lufact_blocked.h"
+#include "Fastor/backend/trsm.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Fastor {
+
+namespace internal {
+
+/* Coefficients of the [m/m] Pade approximants to the exponential and the largest
+   1-norms theta_m for which they are accurate to unit roundoff without scaling,
+   N. J. Higham, The scaling and squaring method for the matrix exponential revisited,
+   SIAM J. Matrix Anal. Appl. 26(4), 2005. Single precision stops at degree 7
+*/
+template<size_t m>
+FASTOR_INLINE double expm_pade_coefficient(size_t k) {
+    static constexpr double b3[]  = {120., 60., 12., 1.};
+    static constexpr double b5[]  = {30240., 15120., 3360., 420., 30., 1.};
+    static constexpr double b7[]  = {17297280., 8648640., 1995840., 277200., 25200., 1512., 56., 1.};
+    static constexpr double b9[]  = {17643225600., 8821612800., 2075673600., 302702400., 30270240.,
+                                     2162160., 110880., 3960., 90., 1.};
+    static constexpr double b13[] = {64764752532480000., 32382376266240000., 7771770303897600.,
+                                     1187353796428800., 129060195264000., 10559470521600.,
+                                     670442572800., 33522128640., 1323241920., 40840800., 960960.,
+                                     16380., 182., 1.};
+    return m==3 ? b3[k] : m==5 ? b5[k] : m==7 ? b7[k] : m==9 ? b9[k] : b13[k];
+}
+
+template<typename T> struct expm_theta;
+template<> struct expm_theta<double> {
+    static constexpr size_t max_degree = 13;
+    static FASTOR_INLINE double value(size_t m) {
+        return m==3 ? 1.495585217958292e-2 : m==5 ? 2.539398330063230e-1 :
+               m==7 ? 9.504178996162932e-1 : m==9 ? 2.097847961257068e+0 : 5.371920351148152e+0;
+    }
+};
+template<> struct expm_theta<float> {
+    static constexpr size_t max_degree = 7;
+    static FASTOR_INLINE float value(size_t m) {
+        return m==3 ? 4.258730016922831e-1f : m==5 ? 1.880152677804762e+0f : 3.925724783138660e+0f;
+    }
+};
+
+template<typename T, size_t M>
+FASTOR_INLINE T _expm_norm1(const T *FASTOR_RESTRICT a) {
+    T nrm = 0;
+    for (size_t j=0; j<M; ++j) {
+        T col = 0;
+        for (size_t i=0; i<M; ++i) col += std::abs(a[i*M+j]);
+        nrm = std::max(nrm,col);
+    }
+    return nrm;
+}
+
+/* out = alpha * x + out */
+template<typename T, size_t M>
+FASTOR_INLINE void _expm_axpy(T alpha, const T *FASTOR_RESTRICT x, T *FASTOR_RESTRICT out) {
+    for (size_t i=0; i<M*M; ++i) out[i] += alpha*x[i];
+}
+template<typename T, size_t M>
+FASTOR_INLINE void _expm_eye(T alpha, T *FASTOR_RESTRICT out) {
+    std::fill(out,out+M*M,T(0));
+    for (size_t i=0; i<M; ++i) out[i*M+i] = alpha;
+}
+
+/* Odd [U] and even [V] parts of the degree m Pade numerator, m = 3, 5, 7, 9 */
+template<typename T, size_t M, size_t m>
+FASTOR_INLINE void _expm_pade_uv(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT u, T *FASTOR_RESTRICT v) {
+    constexpr size_t MM = M*M;
+    T a2[MM], pw[MM], tmp[MM], su[MM];
+    _matmul<T,M,M,M>(a,a,a2);
+    _expm_eye<T,M>(T(expm_pade_coefficient<m>(1)),su);
+    _expm_eye<T,M>(T(expm_pade_coefficient<m>(0)),v);
+    std::copy(a2,a2+MM,pw);
+    for (size_t k=2; k<=m; k+=2) {
+        if (k > 2) {
+            _matmul<T,M,M,M>(pw,a2,tmp);
+            std::copy(tmp,tmp+MM,pw);
+        }
+        _expm_axpy<T,M>(T(expm_pade_coefficient<m>(k+1)),pw,su);
+        _expm_axpy<T,M>(T(expm_pade_coefficient<m>(k)),pw,v);
+    }
+    _matmul<T,M,M,M>(a,su,u);
+}
+
+/* Degree 13 evaluated with the minimal number of products using A^2, A^4 and A^6 */
+template<typename T, size_t M>
+FASTOR_INLINE void _expm_pade13_uv(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT u, T *FASTOR_RESTRICT v) {
+    constexpr size_t MM = M*M;
+    T a2[MM], a4[MM], a6[MM], tmp[MM], su[MM];
+    _matmul<T,M,M,M>(a,a,a2);
+    _matmul<T,M,M,M>(a2,a2,a4);
+    _matmul<T,M,M,M>(a4,a2,a6);
+    const auto b = [](size_t k) { return T(expm_pade_coefficient<13>(k)); };
+
+    for (size_t i=0; i<MM; ++i) tmp[i] = b(13)*a6[i] + b(11)*a4[i] + b(9)*a2[i];
+    _matmul<T,M,M,M>(a6,tmp,su);
+    for (size_t i=0; i<MM; ++i) su[i] += b(7)*a6[i] + b(5)*a4[i] + b(3)*a2[i];
+    for (size_t i=0; i<M; ++i) su[i*M+i] += b(1);
+    _matmul<T,M,M,M>(a,su,u);
+
+    for (size_t i=0; i<MM; ++i) tmp[i] = b(12)*a6[i] + b(10)*a4[i] + b(8)*a2[i];
+    _matmul<T,M,M,M>(a6,tmp,v);
+    for (size_t i=0; i<MM; ++i) v[i] += b(6)*a6[i] + b(4)*a4[i] + b(2)*a2[i];
+    for (size_t i=0; i<M; ++i) v[i*M+i] += b(0);
+}
+
+/* p <- q^{-1} * p. Small matrices use the hand-optimised inverses */
+template<typename T, size_t M, enable_if_t_<is_less_equal_v_<M,4>, bool> = false>
+FASTOR_INLINE void _expm_solve(T *FASTOR_RESTRICT q, T *FASTOR_RESTRICT p) {
+    T invq[M*M], out[M*M];
+    _inverse<T,M>(q,invq);
+    _matmul<T,M,M,M>(invq,p,out);
+    std::copy(out,out+M*M,p);
+}
+template<typename T, size_t M, enable_if_t_<is_greater_v_<M,4>, bool> = false>
+FASTOR_INLINE void _expm_solve(T *FASTOR_RESTRICT q, T *FASTOR_RESTRICT p) {
+    size_t perm[M];
+    T tmp[M*M];
+    _lufact_blocked<T,M>(q,perm);
+    for (size_t i=0; i<M; ++i) {
+        std::copy(&p[perm[i]*M],&p[(perm[i]+1)*M],&tmp[i*M]);
+    }
+    _trsm<T,M,M,UpLoType::UniLower>(q,tmp);
+    _trsm<T,M,M,UpLoType::Upper>(q,tmp);
+    std::copy(tmp,tmp+M*M,p);
+}
+
+} // internal
+
+
+// Matrix exponential of a general square matrix by scaling and squaring with
+// Pade approximants [Higham 2005]. The degree of the approximant is chosen from
+// the 1-norm of a and the matrix is only scaled when the highest degree is not
+// accurate enough. All products go through the size-specialised _matmul kernels
+//----------------------------------------------------------------------------------------------------------------//
+template<typename T, size_t M>
+FASTOR_INLINE void _expm(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT out) {
+    using theta = internal::expm_theta<T>;
+    constexpr size_t MM = M*M;
+    T u[MM], v[MM];
+
+    const T nrm = internal::_expm_norm1<T,M>(a);
+    int s = 0;
+    if      (nrm <= theta::value(3)) internal::_expm_pade_uv<T,M,3>(a,u,v);
+    else if (nrm <= theta::value(5)) internal::_expm_pade_uv<T,M,5>(a,u,v);
+    else if (theta::max_degree == 7 || nrm <= theta::value(7)) {
+        s = std::max(0,int(std::ceil(std::log2(nrm/theta::value(7)))));
+        T as[MM];
+        const T scale = std::ldexp(T(1),-s);
+        for (size_t i=0; i<MM; ++i) as[i] = scale*a[i];
+        internal::_expm_pade_uv<T,M,7>(as,u,v);
+    }
+    else if (nrm <= theta::value(9)) internal::_expm_pade_uv<T,M,9>(a,u,v);
+    else {
+        s = std::max(0,int(std::ceil(std::log2(nrm/theta::value(13)))));
+        T as[MM];
+        const T scale = std::ldexp(T(1),-s);
+        for (size_t i=0; i<MM; ++i) as[i] = scale*a[i];
+        internal::_expm_pade13_uv<T,M>(as,u,v);
+    }
+
+    // r = (v - u)^{-1} * (v + u)
+    for (size_t i=0; i<MM; ++i) {
+        const T ui = u[i], vi = v[i];
+        u[i] = vi - ui;
+        v[i] = vi + ui;
+    }
+    internal::_expm_solve<T,M>(u,v);
+
+    // undo the scaling by repeated squaring
+    for (int k=0; k<s; ++k) {
+        _matmul<T,M,M,M>(v,v,u);
+        std::copy(u,u+MM,v);
+    }
+    std::copy(v,v+MM,out);
+}
+//----------------------------------------------------------------------------------------------------------------//
+
+} // end of namespace Fastor
+
+#endif // EXPM_H
@@ -0,0 +1,197 @@
+#ifndef LUFACT_BLOCKED_H
+#define LUFACT_BLOCKED_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/config/config.h"
+#include "Fastor/simd_vector/extintrin.h"
+#include "Fastor/simd_vector/SIMDVector.h"
+#include "Fastor/backend/matmul/matmul.h"
+#include "Fastor/backend/trsm.h"
+#include <cmath>
+#include <algorithm>
+#include <vector>
+
+namespace Fastor {
+
+// Blocked right-looking LU factorisation with partial pivoting for larger matrices.
+// The factorisation is computed in-place in LAPACK's getrf layout: the strictly lower
+// part of a holds L (with implicit unit diagonal) and the upper part holds U. Each step
+// factorises a panel of columns with an unblocked algorithm, solves for the block row of U
+// and updates the trailing matrix with a single GEMM through _matmul. perm is the row
+// permutation vector such that row i of P*A is row perm[i] of A. The packed panels of the
+// trailing update live in one heap workspace of lu_workspace_size<T,M>() elements that is
+// reused by every step, so large matrices do not put their packing buffers on the stack
+//----------------------------------------------------------------------------------------------------------------//
+namespace internal {
+
+/* Panel width of the blocked LU - a panel row spans a few SIMD registers */
+template<typename T>
+struct lu_panel_width {
+    static constexpr size_t value = 8UL*SIMDVector<T,DEFAULT_ABI>::Size > 64UL ? 64UL : 8UL*SIMDVector<T,DEFAULT_ABI>::Size;
+};
+
+/* Elements of the workspace - U12 and the packed block of L21 and its product with U12
+   for the first and largest trailing update */
+template<typename T, size_t M>
+constexpr size_t lu_workspace_size() {
+    return M > lu_panel_width<T>::value ?
+        lu_panel_width<T>::value*(2*(M - lu_panel_width<T>::value) + lu_panel_width<T>::value) : 0;
+}
+
+/* a[row0:row0+RB, C:M] -= L21[row0:row0+RB,:] * U12 through matmul */
+template<typename T, size_t M, size_t NB, size_t C, size_t RB, enable_if_t_<is_equal_v_<RB,0>,bool> = false>
+FASTOR_INLINE void _lu_trailing_gemm(T *FASTOR_RESTRICT, const T *FASTOR_RESTRICT, size_t, T *FASTOR_RESTRICT) {}
+
+template<typename T, size_t M, size_t NB, size_t C, size_t RB, enable_if_t_<is_greater_v_<RB,0>,bool> = false>
+FASTOR_INLINE void _lu_trailing_gemm(T *FASTOR_RESTRICT a, const T *FASTOR_RESTRICT u12, size_t row0, T *FASTOR_RESTRICT work) {
+    constexpr size_t R = M - C;
+    T *FASTOR_RESTRICT l21 = work;
+    T *FASTOR_RESTRICT tmp = work + RB*NB;
+    for (size_t i=0; i<RB; ++i) {
+        std::copy_n(&a[(row0+i)*M+C-NB],NB,&l21[i*NB]);
+    }
+    _matmul<T,RB,NB,R>(l21,u12,tmp);
+    using V = SIMDVector<T,DEFAULT_ABI>;
+    for (size_t i=0; i<RB; ++i) {
+        T *FASTOR_RESTRICT arow = &a[(row0+i)*M+C];
+        const T *FASTOR_RESTRICT trow = &tmp[i*R];
+        size_t j = 0;
+        for (; j < ROUND_DOWN(R,V::Size); j+=V::Size) {
+            (V(&arow[j],false) - V(&trow[j],false)).store(&arow[j],false);
+        }
+        for (; j < R; ++j) {
+            arow[j] -= trow[j];
+        }
+    }
+}
+
+/* Solve for the block row of U and update the trailing matrix. Kept out of line so that
+   the unrolled steps do not grow into one huge function */
+template<typename T, size_t M, size_t NB, size_t K, enable_if_t_<is_equal_v_<M-K-NB,0>,bool> = false>
+FASTOR_INLINE void _lu_trailing_update(T *FASTOR_RESTRICT, T *FASTOR_RESTRICT) {}
+
+template<typename T, size_t M, size_t NB, size_t K, enable_if_t_<is_greater_v_<M-K-NB,0>,bool> = false>
+FASTOR_NOINLINE void _lu_trailing_update(T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT work) {
+    constexpr size_t C = K + NB;
+    constexpr size_t R = M - C;
+
+    // U12 = L11^(-1) * A12
+    for (size_t i=K+1; i<C; ++i) {
+        for (size_t k=K; k<i; ++k) {
+            _row_update(a[i*M+k],&a[k*M+C],&a[i*M+C],R);
+        }
+    }
+
+    // A22 -= L21 * U12
+    T *FASTOR_RESTRICT u12 = work;
+    for (size_t k=0; k<NB; ++k) {
+        std::copy_n(&a[(K+k)*M+C],R,&u12[k*R]);
+    }
+    constexpr size_t RB = NB;
+    size_t i = 0;
+    for (; i + RB <= R; i+=RB) {
+        _lu_trailing_gemm<T,M,NB,C,RB>(a,u12,C+i,work+NB*R);
+    }
+    _lu_trailing_gemm<T,M,NB,C,R % RB>(a,u12,C+i,work+NB*R);
+}
+
+template<typename T, size_t M, size_t NB, size_t K, bool Pivot>
+struct blocked_lu_impl {
+    static FASTOR_INLINE void Do(T *FASTOR_RESTRICT a, size_t *FASTOR_RESTRICT perm, T *FASTOR_RESTRICT work) {
+        constexpr size_t nb = NB < M - K ? NB : M - K;
+
+        // Unblocked factorisation of the panel a[K:M,K:K+nb].
+        // Row interchanges are applied to entire rows
+        for (size_t j=K; j<K+nb; ++j) {
+            FASTOR_IF_CONSTEXPR(Pivot) {
+                size_t p = j;
+                auto maxval = std::abs(a[j*M+j]);
+                for (size_t i=j+1; i<M; ++i) {
+                    const auto val = std::abs(a[i*M+j]);
+                    if (val > maxval) {
+                        maxval = val;
+                        p = i;
+                    }
+                }
+                if (p != j) {
+                    std::swap_ranges(&a[j*M],&a[j*M+M],&a[p*M]);
+                    std::swap(perm[j],perm[p]);
+                }
+            }
+            const T ajj = a[j*M+j];
+            // Exactly singular - leave the column as is
+            if (ajj != T(0)) {
+                const T inv_ajj = T(1) / ajj;
+                for (size_t i=j+1; i<M; ++i) {
+                    a[i*M+j] *= inv_ajj;
+                }
+            }
+            for (size_t i=j+1; i<M; ++i) {
+                _row_update(a[i*M+j],&a[j*M+j+1],&a[i*M+j+1],K+nb-j-1);
+            }
+        }
+
+        _lu_trailing_update<T,M,nb,K>(a,work);
+        blocked_lu_impl<T,M,NB,K+nb,Pivot>::Do(a,perm,work);
+    }
+};
+
+template<typename T, size_t M, size_t NB, bool Pivot>
+struct blocked_lu_impl<T,M,NB,M,Pivot> {
+    static FASTOR_INLINE void Do(T *FASTOR_RESTRICT, size_t *FASTOR_RESTRICT, T *FASTOR_RESTRICT) {}
+};
+
+} // internal
+//----------------------------------------------------------------------------------------------------------------//
+
+
+// work holds at least internal::lu_workspace_size<T,M>() elements and can be reused across factorisations
+template<typename T, size_t M, bool Pivot = true>
+FASTOR_INLINE void _lufact_blocked(T *FASTOR_RESTRICT a, size_t *FASTOR_RESTRICT perm, T *FASTOR_RESTRICT work) {
+    for (size_t i=0; i<M; ++i) perm[i] = i;
+    internal::blocked_lu_impl<T,M,internal::lu_panel_width<T>::value,0,Pivot>::Do(a,perm,work);
+}
+
+template<typename T, size_t M, bool Pivot = true>
+FASTOR_INLINE void _lufact_blocked(T *FASTOR_RESTRICT a, size_t *FASTOR_RESTRICT perm) {
+    std::vector<T> work(internal::lu_workspace_size<T,M>());
+    _lufact_blocked<T,M,Pivot>(a,perm,work.data());
+}
+
+namespace internal {
+
+/* Sign (parity) of a permutation vector p of length M - (-1)^(number of even length cycles) */
+template<size_t M>
+FASTOR_INLINE int permutation_sign(const size_t *FASTOR_RESTRICT p) {
+    bool visited[M] = {};
+    int sign = 1;
+    for (size_t i = 0; i < M; ++i) {
+        if (visited[i]) continue;
+        size_t length = 0;
+        for (size_t j = i; !visited[j]; j = p[j]) {
+            visited[j] = true;
+            ++length;
+        }
+        if (length % 2UL == 0)
+            sign = -sign;
+    }
+    return sign;
+}
+
+} // internal
+
+// Determinant from the in-place factorisation of a
+template<typename T, size_t M>
+FASTOR_INLINE T _lufact_blocked_determinant(T *FASTOR_RESTRICT a) {
+    size_t perm[M];
+    _lufact_blocked<T,M>(a,perm);
+    T det = T(internal::permutation_sign<M>(perm));
+    for (size_t i=0; i<M; ++i) {
+        det *= a[i*M+i];
+    }
+    return det;
+}
+
+} // end of namespace Fastor
+
+#endif // LUFACT_BLOCKED_H
@@ -0,0 +1,89 @@
+#ifndef MATMUL_DYNAMIC_H
+#define MATMUL_DYNAMIC_H
+
+#include "Fastor/config/config.h"
+#include "Fastor/simd_vector/SIMDVector.h"
+#include <algorithm>
+
+namespace Fastor {
+
+namespace internal {
+
+// Rows and columns of the panel of b that is swept by all rows of a before moving on. A
+// double panel is 128KB so it stays in L2 while it is reused. The number of columns is a
+// multiple of the widest SIMD pair so only the last panel of a row has tails
+constexpr size_t matmul_dynamic_kblock = 128;
+constexpr size_t matmul_dynamic_nblock = 128;
+
+/* out[:,0:nb] = a[:,0:kb] * b[0:kb,0:nb] [+ out[:,0:nb] if accumulate] where a, b and out
+   are blocks of row-major matrices of row strides lda, ldb and ldo. Each output row is built
+   SIMD-width columns at a time with the accumulator kept in a register over the kb loop
+*/
+template<typename T>
+FASTOR_HINT_INLINE void _matmul_dynamic_panel(size_t M, size_t kb, size_t nb, size_t lda, size_t ldb, size_t ldo,
+    const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b, T * FASTOR_RESTRICT out, bool accumulate) {
+    using V = SIMDVector<T,DEFAULT_ABI>;
+    constexpr size_t S = V::Size;
+    const size_t N2S = nb / (2*S) * (2*S);
+    const size_t NS  = nb / S * S;
+    for (size_t i=0; i<M; ++i) {
+        const T *a_row = &a[i*lda];
+        T *out_row = &out[i*ldo];
+        size_t j=0;
+        for (; j<N2S; j+=2*S) {
+            V acc0(T(0)), acc1(T(0));
+            if (accumulate) {
+                acc0.load(&out_row[j],false);
+                acc1.load(&out_row[j+S],false);
+            }
+            for (size_t k=0; k<kb; ++k) {
+                const V aik(a_row[k]);
+                acc0 = fmadd(aik,V(&b[k*ldb+j],false),acc0);
+                acc1 = fmadd(aik,V(&b[k*ldb+j+S],false),acc1);
+            }
+            acc0.store(&out_row[j],false);
+            acc1.store(&out_row[j+S],false);
+        }
+        for (; j<NS; j+=S) {
+            V acc(T(0));
+            if (accumulate) acc.load(&out_row[j],false);
+            for (size_t k=0; k<kb; ++k) {
+                acc = fmadd(V(a_row[k]),V(&b[k*ldb+j],false),acc);
+            }
+            acc.store(&out_row[j],false);
+        }
+        for (; j<nb; ++j) {
+            T acc = accumulate ? out_row[j] : T(0);
+            for (size_t k=0; k<kb; ++k) {
+                acc += a_row[k]*b[k*ldb+j];
+            }
+            out_row[j] = acc;
+        }
+    }
+}
+
+/* out = a * b for row-major a [M x K] and b [K x N] whose sizes are only known at runtime.
+   b is swept in panels of matmul_dynamic_kblock x matmul_dynamic_nblock, the first panel
+   down K stores into out and the later ones add to it
+*/
+template<typename T>
+FASTOR_HINT_INLINE void _matmul_dynamic(size_t M, size_t K, size_t N,
+    const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b, T * FASTOR_RESTRICT out) {
+    if (K == 0) {
+        std::fill(out,out+M*N,T(0));
+        return;
+    }
+    for (size_t jj=0; jj<N; jj+=matmul_dynamic_nblock) {
+        const size_t nb = std::min(matmul_dynamic_nblock,N-jj);
+        for (size_t kk=0; kk<K; kk+=matmul_dynamic_kblock) {
+            const size_t kb = std::min(matmul_dynamic_kblock,K-kk);
+            _matmul_dynamic_panel(M,kb,nb,K,N,N,&a[kk],&b[kk*N+jj],&out[jj],kk!=0);
+        }
+    }
+}
+
+} // internal
+
+} // end of namespace Fastor
+
+#endif // MATMUL_DYNAMIC_H
@@ -0,0 +1,218 @@
+#ifndef MATMUL_EPILOGUE_H
+#define MATMUL_EPILOGUE_H
+
+#include "Fastor/config/config.h"
+#include "Fastor/meta/meta.h"
+#include "Fastor/simd_vector/SIMDVector.h"
+#include "Fastor/backend/matmul/matmul.h"
+
+namespace Fastor {
+
+namespace internal {
+
+/* Epilogues of a matrix product. Every entry of the product is handed to the epilogue
+   while it is still in a register together with its flat index in the output, and
+   the value the epilogue returns is what gets stored. eval works on a SIMD vector of
+   consecutive entries and eval_s on a single entry. An epilogue that reads another
+   buffer at the same index [c in axpby] may be given the output itself as every
+   entry is read before it is overwritten
+*/
+//-----------------------------------------------------------------------------------------------------------
+template<typename T>
+struct matmul_epilogue_scale {
+    T alpha;
+    template<typename V>
+    FASTOR_INLINE V eval(const V &acc, size_t) const {return V(alpha)*acc;}
+    FASTOR_INLINE T eval_s(T acc, size_t) const {return alpha*acc;}
+};
+
+template<typename T>
+struct matmul_epilogue_axpby {
+    T alpha;
+    T beta;
+    const T *c;
+    template<typename V>
+    FASTOR_INLINE V eval(const V &acc, size_t idx) const {return fmadd(V(alpha),acc,V(beta)*V(&c[idx],false));}
+    FASTOR_INLINE T eval_s(T acc, size_t idx) const {return alpha*acc + beta*c[idx];}
+};
+
+template<typename T>
+struct matmul_epilogue_mul {
+    const T *c;
+    template<typename V>
+    FASTOR_INLINE V eval(const V &acc, size_t idx) const {return V(&c[idx],false)*acc;}
+    FASTOR_INLINE T eval_s(T acc, size_t idx) const {return c[idx]*acc;}
+};
+
+template<typename T>
+struct matmul_epilogue_div {
+    const T *c;
+    template<typename V>
+    FASTOR_INLINE V eval(const V &acc, size_t idx) const {return V(&c[idx],false)/acc;}
+    FASTOR_INLINE T eval_s(T acc, size_t idx) const {return c[idx]/acc;}
+};
+
+struct matmul_epilogue_identity {
+    template<typename V>
+    FASTOR_INLINE V eval(const V &acc, size_t) const {return acc;}
+    template<typename T>
+    FASTOR_INLINE T eval_s(T acc, size_t) const {return acc;}
+};
+
+// Element-wise function applied after another epilogue. Fun has to be callable
+// on both SIMDVector and scalar arguments
+template<typename Fun, typename Inner = matmul_epilogue_identity>
+struct matmul_epilogue_unary {
+    Fun fun;
+    Inner inner;
+    template<typename V>
+    FASTOR_INLINE V eval(const V &acc, size_t idx) const {return fun(inner.eval(acc,idx));}
+    template<typename T>
+    FASTOR_INLINE T eval_s(T acc, size_t idx) const {return fun(inner.eval_s(acc,idx));}
+};
+//-----------------------------------------------------------------------------------------------------------
+
+
+// A tile of RB rows and CB SIMD vectors of columns of out = a * b, starting at out(i,j)
+template<typename T, typename V, size_t K, size_t N, size_t RB, size_t CB, typename Epilogue>
+FASTOR_INLINE void _matmul_epilogue_tile(const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b, T *out,
+    size_t i, size_t j, const Epilogue &ep) {
+    V c_ij[RB*CB];
+    for (size_t k=0; k<K; ++k) {
+        V bmm[CB];
+        for (size_t n=0; n<CB; ++n) {
+            bmm[n].load(&b[k*N+j+n*V::Size],false);
+        }
+        for (size_t r=0; r<RB; ++r) {
+            const V amm(a[(i+r)*K+k]);
+            for (size_t n=0; n<CB; ++n) {
+                c_ij[r*CB+n] = fmadd(amm,bmm[n],c_ij[r*CB+n]);
+            }
+        }
+    }
+    for (size_t r=0; r<RB; ++r) {
+        for (size_t n=0; n<CB; ++n) {
+            const size_t idx = (i+r)*N+j+n*V::Size;
+            ep.eval(c_ij[r*CB+n],idx).store(&out[idx],false);
+        }
+    }
+}
+
+// The columns of RB rows that do not fill a SIMD vector
+template<typename T, size_t K, size_t N, size_t RB, typename Epilogue>
+FASTOR_INLINE void _matmul_epilogue_tile_s(const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b, T *out,
+    size_t i, size_t j, const Epilogue &ep) {
+    for (; j<N; ++j) {
+        T c_ij[RB] = {};
+        for (size_t k=0; k<K; ++k) {
+            for (size_t r=0; r<RB; ++r) {
+                c_ij[r] += a[(i+r)*K+k]*b[k*N+j];
+            }
+        }
+        for (size_t r=0; r<RB; ++r) {
+            out[(i+r)*N+j] = ep.eval_s(c_ij[r],(i+r)*N+j);
+        }
+    }
+}
+
+template<typename T, typename V, size_t K, size_t N, size_t RB, typename Epilogue>
+FASTOR_INLINE void _matmul_epilogue_rows(const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b, T *out,
+    size_t i, const Epilogue &ep) {
+    constexpr size_t N2S = N / (2*V::Size) * (2*V::Size);
+    constexpr size_t NS  = N / V::Size * V::Size;
+    size_t j=0;
+    for (; j<N2S; j+=2*V::Size) {
+        _matmul_epilogue_tile<T,V,K,N,RB,2>(a,b,out,i,j,ep);
+    }
+    for (; j<NS; j+=V::Size) {
+        _matmul_epilogue_tile<T,V,K,N,RB,1>(a,b,out,i,j,ep);
+    }
+    _matmul_epilogue_tile_s<T,K,N,RB>(a,b,out,i,j,ep);
+}
+
+
+/* out = ep(in) in one pass, for results that are not computed by a GEMM. in and out may
+   be the same buffer
+*/
+template<typename T, size_t Size, typename Epilogue, enable_if_t_<is_primitive_v_<T>,bool> = false>
+FASTOR_INLINE void _apply_epilogue(const T *in, T *out, const Epilogue &ep) {
+    using V = SIMDVector<T,DEFAULT_ABI>;
+    constexpr size_t ROUND = ROUND_DOWN(Size,V::Size);
+    size_t i=0;
+    for (; i<ROUND; i+=V::Size) {
+        ep.eval(V(&in[i],false),i).store(&out[i],false);
+    }
+    for (; i<Size; ++i) {
+        out[i] = ep.eval_s(in[i],i);
+    }
+}
+template<typename T, size_t Size, typename Epilogue, enable_if_t_<!is_primitive_v_<T>,bool> = false>
+FASTOR_INLINE void _apply_epilogue(const T *in, T *out, const Epilogue &ep) {
+    for (size_t i=0; i<Size; ++i) {
+        out[i] = ep.eval_s(in[i],i);
+    }
+}
+
+
+// Rows per tile, as many as the accumulators of two SIMD columns fit in the register file
+#ifdef FASTOR_AVX512F_IMPL
+#define FASTOR_MATMUL_EPILOGUE_ROWS 8
+#else
+#define FASTOR_MATMUL_EPILOGUE_ROWS 4
+#endif
+
+/* Whether _matmul has a kernel of its own for the M x K x N product of T, the specialised
+   square kernels or BLAS above FASTOR_BLAS_SWITCH_MATRIX_SIZE, that beats the epilogue
+   kernel even with the extra pass over out */
+template<typename T, size_t M, size_t K, size_t N>
+struct matmul_has_dedicated_kernel {
+    static constexpr bool value =
+        (M!=K && M==N && (M==2UL || M==3UL || M==4UL || M==8UL) && (is_same_v_<T,float> || is_same_v_<T,double>))
+#if defined(FASTOR_USE_LIBXSMM) || defined(FASTOR_USE_MKL)
+        || is_greater<M*N*K/internal::meta_cube<FASTOR_BLAS_SWITCH_MATRIX_SIZE>::value,1>::value
+#endif
+        ;
+};
+
+template<typename T, size_t M, size_t K, size_t N>
+struct matmul_epilogue_in_registers {
+    static constexpr bool value = is_primitive_v_<T> && (N >= SIMDVector<T,DEFAULT_ABI>::Size) &&
+        !matmul_has_dedicated_kernel<T,M,K,N>::value;
+};
+
+/* out = ep(a * b) for row-major a [M x K] and b [K x N]. The product is accumulated in
+   registers over tiles of two SIMD vectors of columns and the epilogue is applied before
+   the single store of every entry, so scaling, accumulating into an existing output or
+   applying an activation does not need another pass over out. Products narrower than a
+   SIMD vector, non-primitive types and products that _matmul has a dedicated kernel for
+   go through _matmul and a temporary instead
+*/
+template<typename T, size_t M, size_t K, size_t N, typename Epilogue,
+         enable_if_t_<matmul_epilogue_in_registers<T,M,K,N>::value,bool> = false>
+FASTOR_HINT_INLINE void _matmul_epilogue(const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b, T *out, const Epilogue &ep) {
+    using V = SIMDVector<T,DEFAULT_ABI>;
+    constexpr size_t RB = FASTOR_MATMUL_EPILOGUE_ROWS;
+    constexpr size_t MRB = M / RB * RB;
+    size_t i=0;
+    for (; i<MRB; i+=RB) {
+        _matmul_epilogue_rows<T,V,K,N,RB>(a,b,out,i,ep);
+    }
+    for (; i<M; ++i) {
+        _matmul_epilogue_rows<T,V,K,N,1>(a,b,out,i,ep);
+    }
+}
+
+template<typename T, size_t M, size_t K, size_t N, typename Epilogue,
+         enable_if_t_<!matmul_epilogue_in_registers<T,M,K,N>::value,bool> = false>
+FASTOR_INLINE void _matmul_epilogue(const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b, T *out, const Epilogue &ep) {
+    FASTOR_ARCH_ALIGN T tmp[M*N];
+    _matmul<T,M,K,N>(a,b,tmp);
+    _apply_epilogue<T,M*N>(tmp,out,ep);
+}
+
+
+} // internal
+
+} // end of namespace Fastor
+
+#endif // MATMUL_EPILOGUE_H
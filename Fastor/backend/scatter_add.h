@@ -0,0 +1,94 @@
+#ifndef SCATTER_ADD_H
+#define SCATTER_ADD_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/config/config.h"
+#include "Fastor/simd_vector/extintrin.h"
+#include "Fastor/simd_vector/SIMDVector.h"
+#include <array>
+
+namespace Fastor {
+
+namespace internal {
+
+// Adds a SIMD vector of values to the elements of target at inds. Indices can repeat
+// in which case the lanes that hit the same element are applied one after the other,
+// otherwise all but one of their updates would be lost
+template<typename T, typename ABI, size_t N>
+FASTOR_INLINE void _scatter_add_vec(T *FASTOR_RESTRICT target, const std::array<int,N> &inds, const SIMDVector<T,ABI> &vec) {
+    if (has_index_conflict(inds)) {
+        T tmp[N];
+        vec.store(tmp,false);
+        for (FASTOR_INDEX j=0; j<N; ++j) {
+            target[inds[j]] += tmp[j];
+        }
+        return;
+    }
+    SIMDVector<T,ABI> _vec;
+    vector_setter(_vec,target,inds);
+    _vec += vec;
+    data_setter(target,_vec,inds);
+}
+
+// With AVX512CD the conflicts are resolved in registers. vpconflict gives every lane the
+// lanes before it with the same index, the nearest of which is the link of the lane. Each
+// chain of lanes sharing an index is then summed in log2(Size) steps by pointer jumping,
+// after which the last lane of every chain holds the total of the chain. Overlapping lanes
+// of a scatter are written in order so the totals are the ones that land in target
+#if defined(FASTOR_AVX512F_IMPL) && defined(FASTOR_AVX512CD_IMPL)
+FASTOR_INLINE void _scatter_add_vec(float *FASTOR_RESTRICT target, const std::array<int,16> &inds, const SIMDVector<float,simd_abi::avx512> &vec) {
+    const __m512i idx  = _mm512_loadu_si512(inds.data());
+    const __m512i zero = _mm512_setzero_si512();
+    __m512i link = _mm512_sub_epi32(_mm512_set1_epi32(31),_mm512_lzcnt_epi32(_mm512_conflict_epi32(idx)));
+    __mmask16 active = _mm512_cmpge_epi32_mask(link,zero);
+    __m512 vals = vec.value;
+    while (active) {
+        vals   = _mm512_mask_add_ps(vals,active,vals,_mm512_permutexvar_ps(link,vals));
+        link   = _mm512_mask_permutexvar_epi32(link,active,link,link);
+        active = _mm512_mask_cmpge_epi32_mask(active,link,zero);
+    }
+    vals = _mm512_add_ps(vals,_mm512_i32gather_ps(idx,target,4));
+    _mm512_i32scatter_ps(target,idx,vals,4);
+}
+FASTOR_INLINE void _scatter_add_vec(double *FASTOR_RESTRICT target, const std::array<int,8> &inds, const SIMDVector<double,simd_abi::avx512> &vec) {
+    const __m256i idx  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(inds.data()));
+    const __m512i zero = _mm512_setzero_si512();
+    __m512i link = _mm512_sub_epi64(_mm512_set1_epi64(63),_mm512_lzcnt_epi64(_mm512_conflict_epi64(_mm512_cvtepi32_epi64(idx))));
+    __mmask8 active = _mm512_cmpge_epi64_mask(link,zero);
+    __m512d vals = vec.value;
+    while (active) {
+        vals   = _mm512_mask_add_pd(vals,active,vals,_mm512_permutexvar_pd(link,vals));
+        link   = _mm512_mask_permutexvar_epi64(link,active,link,link);
+        active = _mm512_mask_cmpge_epi64_mask(active,link,zero);
+    }
+    vals = _mm512_add_pd(vals,_mm512_i32gather_pd(idx,target,8));
+    _mm512_i32scatter_pd(target,idx,vals,8);
+}
+#endif
+
+// target[indices[i]] += values[i] for i < n, where indices can repeat
+template<typename T, typename Int>
+FASTOR_INLINE void _scatter_add(T *FASTOR_RESTRICT target, const Int *FASTOR_RESTRICT indices, const T *FASTOR_RESTRICT values, size_t n) {
+    using V = choose_best_simd_vector_t<T>;
+    constexpr size_t Size = V::Size;
+    std::array<int,Size> inds;
+    const size_t nvec = n - n % Size;
+    size_t i = 0;
+    for (; i<nvec; i+=Size) {
+        for (size_t j=0; j<Size; ++j) {
+            inds[j] = int(indices[i+j]);
+        }
+        V vec; vec.load(&values[i],false);
+        _scatter_add_vec(target,inds,vec);
+    }
+    for (; i<n; ++i) {
+        target[indices[i]] += values[i];
+    }
+}
+
+} // internal
+
+} // end of namespace Fastor
+
+
+#endif // SCATTER_ADD_H
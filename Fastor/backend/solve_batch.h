@@ -0,0 +1,87 @@
+#ifndef SOLVE_BATCH_H
+#define SOLVE_BATCH_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/config/config.h"
+#include "Fastor/simd_vector/extintrin.h"
+#include "Fastor/simd_vector/SIMDVector.h"
+#include "Fastor/simd_math/simd_math.h"
+#include <algorithm>
+#include <cmath>
+
+namespace Fastor {
+
+namespace internal {
+
+// Gaussian elimination with partial pivoting on a single N x N system held in
+// registers. U is either a scalar or a SIMDVector in which case every lane holds
+// an independent system. Pivoting is branch-free: each row below the diagonal is
+// compared against the current pivot row and the two rows are exchanged with a
+// select on the comparison mask in the lanes where the candidate is larger in
+// magnitude. After the sweep the pivot row holds the largest entry of the column
+// in every lane. The solution overwrites b
+template<typename T, typename U, size_t N>
+FASTOR_INLINE void _solve_batch_kernel(U *FASTOR_RESTRICT a, U *FASTOR_RESTRICT b) {
+    using std::abs;
+    for (size_t k=0; k<N; ++k) {
+        for (size_t i=k+1; i<N; ++i) {
+            const auto swap = abs(a[i*N+k]) > abs(a[k*N+k]);
+            for (size_t j=k; j<N; ++j) {
+                const U akj = a[k*N+j], aij = a[i*N+j];
+                a[k*N+j] = select(swap,aij,akj);
+                a[i*N+j] = select(swap,akj,aij);
+            }
+            const U bk = b[k], bi = b[i];
+            b[k] = select(swap,bi,bk);
+            b[i] = select(swap,bk,bi);
+        }
+        const U inv_pivot = U(T(1)) / a[k*N+k];
+        for (size_t i=k+1; i<N; ++i) {
+            const U f = a[i*N+k]*inv_pivot;
+            for (size_t j=k+1; j<N; ++j) {
+                a[i*N+j] -= f*a[k*N+j];
+            }
+            b[i] -= f*b[k];
+        }
+    }
+    for (size_t i=N; i-- > 0;) {
+        U acc = b[i];
+        for (size_t j=i+1; j<N; ++j) {
+            acc -= a[i*N+j]*b[j];
+        }
+        b[i] = acc / a[i*N+i];
+    }
+}
+
+} // internal
+
+
+// Solves a batch of nbatch independent N x N systems a[k] * x[k] = b[k] stored
+// contiguously one after the other. V::Size systems are interleaved across the
+// lanes of SIMD registers so every lane solves its own system and the remaining
+// systems are solved one at a time with the same kernel
+//----------------------------------------------------------------------------------------------------------------//
+template<typename T, size_t N>
+FASTOR_INLINE void _solve_batch(const T *FASTOR_RESTRICT a, const T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT x, size_t nbatch) {
+    using V = SIMDVector<T,DEFAULT_ABI>;
+    constexpr int NN = int(N*N);
+    size_t k = 0;
+    for (; k < ROUND_DOWN(nbatch,V::Size); k+=V::Size) {
+        V _a[N*N], _b[N];
+        for (int i=0; i<NN; ++i)      vector_setter(_a[i],a,int(k)*NN+i,NN);
+        for (int i=0; i<int(N); ++i)  vector_setter(_b[i],b,int(k)*int(N)+i,int(N));
+        internal::_solve_batch_kernel<T,V,N>(_a,_b);
+        for (int i=0; i<int(N); ++i)  data_setter(x,_b[i],int(k)*int(N)+i,int(N));
+    }
+    for (; k<nbatch; ++k) {
+        T _a[N*N];
+        std::copy(&a[k*N*N],&a[(k+1)*N*N],_a);
+        std::copy(&b[k*N],&b[(k+1)*N],&x[k*N]);
+        internal::_solve_batch_kernel<T,T,N>(_a,&x[k*N]);
+    }
+}
+//----------------------------------------------------------------------------------------------------------------//
+
+} // end of namespace Fastor
+
+#endif // SOLVE_BATCH_H
@@ -0,0 +1,190 @@
+#ifndef STRUCTURED_H
+#define STRUCTURED_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/config/config.h"
+#include "Fastor/backend/inverse.h"
+#include "Fastor/backend/matmul/matmul.h"
+#include "Fastor/backend/lufact_blocked.h"
+#include "Fastor/backend/trsm.h"
+#include <algorithm>
+#include <vector>
+
+namespace Fastor {
+
+// Diagonal matrices - only the M diagonal entries d are stored
+//----------------------------------------------------------------------------------------------------------------//
+/* out = diag(d) * b for an M x N matrix b, every row of b is scaled */
+template<typename T, size_t M, size_t N>
+FASTOR_INLINE void _diag_matmul(const T *FASTOR_RESTRICT d, const T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT out) {
+    for (size_t i=0; i<M; ++i) {
+        const T di = d[i];
+        for (size_t j=0; j<N; ++j) out[i*N+j] = di*b[i*N+j];
+    }
+}
+
+/* out = a * diag(d) for an M x N matrix a, every column of a is scaled */
+template<typename T, size_t M, size_t N>
+FASTOR_INLINE void _matmul_diag(const T *FASTOR_RESTRICT a, const T *FASTOR_RESTRICT d, T *FASTOR_RESTRICT out) {
+    for (size_t i=0; i<M; ++i) {
+        for (size_t j=0; j<N; ++j) out[i*N+j] = a[i*N+j]*d[j];
+    }
+}
+
+/* out = diag(d)^{-1} * b, the reciprocals are formed once per row */
+template<typename T, size_t M, size_t N>
+FASTOR_INLINE void _diag_solve(const T *FASTOR_RESTRICT d, const T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT out) {
+    for (size_t i=0; i<M; ++i) {
+        const T inv_di = T(1)/d[i];
+        for (size_t j=0; j<N; ++j) out[i*N+j] = inv_di*b[i*N+j];
+    }
+}
+//----------------------------------------------------------------------------------------------------------------//
+
+
+// Banded matrices with KL sub- and KU super-diagonals. Row i holds the W = KL+KU+1
+// entries a_ij for j = i-KL..i+KU at a[i*W + j-i+KL]. The slots falling outside the
+// matrix in the first and last rows are padding and never referenced
+//----------------------------------------------------------------------------------------------------------------//
+namespace internal {
+template<size_t N, size_t KL, size_t KU>
+struct band_index {
+    static constexpr size_t width = KL+KU+1;
+    static constexpr size_t size = N*width;
+    static constexpr FASTOR_INLINE size_t idx(size_t i, size_t j) {
+        return i*width + j + KL - i;
+    }
+    static constexpr FASTOR_INLINE bool in_band(size_t i, size_t j) {
+        return j + KL >= i && j <= i + KU;
+    }
+    static constexpr FASTOR_INLINE size_t first(size_t i) {
+        return i > KL ? i-KL : 0;
+    }
+    static constexpr FASTOR_INLINE size_t last(size_t i) {
+        return i+KU+1 < N ? i+KU+1 : N;
+    }
+};
+} // internal
+
+/* out = a * b for banded a and an N x P matrix b - O(N*P*(KL+KU+1)) */
+template<typename T, size_t N, size_t KL, size_t KU, size_t P>
+FASTOR_INLINE void _band_matmul(const T *FASTOR_RESTRICT a, const T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT out) {
+    using B = internal::band_index<N,KL,KU>;
+    std::fill(out,out+N*P,T(0));
+    for (size_t i=0; i<N; ++i) {
+        for (size_t k=B::first(i); k<B::last(i); ++k) {
+            const T aik = a[B::idx(i,k)];
+            for (size_t j=0; j<P; ++j) out[i*P+j] += aik*b[k*P+j];
+        }
+    }
+}
+
+/* In-place LU factorisation without pivoting. Without row exchanges the factors keep
+   the bandwidth of a so the cost is O(N*KL*KU) - the tridiagonal case is the Thomas
+   algorithm. Intended for diagonally dominant or symmetric positive definite matrices
+*/
+template<typename T, size_t N, size_t KL, size_t KU>
+FASTOR_INLINE void _band_lufact(T *FASTOR_RESTRICT a) {
+    using B = internal::band_index<N,KL,KU>;
+    for (size_t k=0; k<N; ++k) {
+        const T inv_pivot = T(1)/a[B::idx(k,k)];
+        const size_t ilast = std::min(N,k+KL+1);
+        const size_t jlast = B::last(k);
+        for (size_t i=k+1; i<ilast; ++i) {
+            const T l = a[B::idx(i,k)]*inv_pivot;
+            a[B::idx(i,k)] = l;
+            for (size_t j=k+1; j<jlast; ++j) a[B::idx(i,j)] -= l*a[B::idx(k,j)];
+        }
+    }
+}
+
+/* b <- U^{-1} L^{-1} b for the factors from _band_lufact and an N x P matrix b */
+template<typename T, size_t N, size_t KL, size_t KU, size_t P>
+FASTOR_INLINE void _band_lusolve(const T *FASTOR_RESTRICT lu, T *FASTOR_RESTRICT b) {
+    using B = internal::band_index<N,KL,KU>;
+    for (size_t i=1; i<N; ++i) {
+        for (size_t k=B::first(i); k<i; ++k) {
+            const T lik = lu[B::idx(i,k)];
+            for (size_t j=0; j<P; ++j) b[i*P+j] -= lik*b[k*P+j];
+        }
+    }
+    for (size_t i=N; i-- > 0;) {
+        for (size_t k=i+1; k<B::last(i); ++k) {
+            const T uik = lu[B::idx(i,k)];
+            for (size_t j=0; j<P; ++j) b[i*P+j] -= uik*b[k*P+j];
+        }
+        const T inv_uii = T(1)/lu[B::idx(i,i)];
+        for (size_t j=0; j<P; ++j) b[i*P+j] *= inv_uii;
+    }
+}
+//----------------------------------------------------------------------------------------------------------------//
+
+
+// Block diagonal matrices of N/B dense B x B blocks stored one after the other
+//----------------------------------------------------------------------------------------------------------------//
+/* out = a * b for block diagonal a and an N x P matrix b, block k only touches
+   the rows k*B..(k+1)*B-1 of b which are contiguous
+*/
+template<typename T, size_t N, size_t B, size_t P>
+FASTOR_INLINE void _blockdiag_matmul(const T *FASTOR_RESTRICT a, const T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT out) {
+    for (size_t k=0; k<N/B; ++k) {
+        _matmul<T,B,B,P>(&a[k*B*B],&b[k*B*P],&out[k*B*P]);
+    }
+}
+
+/* Inverse of each block. Small blocks use the hand-optimised inverses */
+template<typename T, size_t N, size_t B, enable_if_t_<is_less_equal_v_<B,4>, bool> = false>
+FASTOR_INLINE void _blockdiag_inverse(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT out) {
+    for (size_t k=0; k<N/B; ++k) {
+        _inverse<T,B>(&a[k*B*B],&out[k*B*B]);
+    }
+}
+template<typename T, size_t N, size_t B, enable_if_t_<is_greater_v_<B,4>, bool> = false>
+FASTOR_INLINE void _blockdiag_inverse(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT out) {
+    T lu[B*B];
+    size_t perm[B];
+    std::vector<T> work(internal::lu_workspace_size<T,B>());
+    for (size_t k=0; k<N/B; ++k) {
+        std::copy(&a[k*B*B],&a[(k+1)*B*B],lu);
+        _lufact_blocked<T,B>(lu,perm,work.data());
+        T *x = &out[k*B*B];
+        std::fill(x,x+B*B,T(0));
+        for (size_t i=0; i<B; ++i) x[i*B+perm[i]] = T(1);
+        _trsm<T,B,B,UpLoType::UniLower>(lu,x);
+        _trsm<T,B,B,UpLoType::Upper>(lu,x);
+    }
+}
+
+/* out = a^{-1} * b, each block solves its own rows of b */
+template<typename T, size_t N, size_t B, size_t P>
+FASTOR_INLINE void _blockdiag_solve(const T *FASTOR_RESTRICT a, const T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT out) {
+    T lu[B*B];
+    size_t perm[B];
+    std::vector<T> work(internal::lu_workspace_size<T,B>());
+    for (size_t k=0; k<N/B; ++k) {
+        std::copy(&a[k*B*B],&a[(k+1)*B*B],lu);
+        _lufact_blocked<T,B>(lu,perm,work.data());
+        T *x = &out[k*B*P];
+        for (size_t i=0; i<B; ++i) {
+            std::copy(&b[(k*B+perm[i])*P],&b[(k*B+perm[i]+1)*P],&x[i*P]);
+        }
+        _trsm<T,B,P,UpLoType::UniLower>(lu,x);
+        _trsm<T,B,P,UpLoType::Upper>(lu,x);
+    }
+}
+
+template<typename T, size_t N, size_t B>
+FASTOR_INLINE T _blockdiag_determinant(const T *FASTOR_RESTRICT a) {
+    T lu[B*B];
+    T det = 1;
+    for (size_t k=0; k<N/B; ++k) {
+        std::copy(&a[k*B*B],&a[(k+1)*B*B],lu);
+        det *= _lufact_blocked_determinant<T,B>(lu);
+    }
+    return det;
+}
+//----------------------------------------------------------------------------------------------------------------//
+
+} // end of namespace Fastor
+
+#endif // STRUCTURED_H
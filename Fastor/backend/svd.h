@@ -0,0 +1,265 @@
+#ifndef SVD_H
+#define SVD_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/config/config.h"
+#include "Fastor/simd_vector/extintrin.h"
+#include "Fastor/simd_vector/SIMDVector.h"
+#include "Fastor/simd_math/simd_math.h"
+#include "Fastor/backend/eigh.h"
+#include <cmath>
+#include <limits>
+
+namespace Fastor {
+
+// Fast 3x3 singular value and polar decomposition kernels in the spirit of
+// McAdams et. al. "Computing the singular value decomposition of 3x3 matrices
+// with minimal branching and elementary floating point operations": the right
+// singular vectors are the eigenvectors of A^T * A (found here with the closed-form
+// symmetric eigen kernel instead of the quaternion Jacobi sweeps), and the left
+// singular vectors and singular values follow from a Givens QR of A * V. As with
+// eigh the kernels are generic over scalars and SIMDVectors
+//----------------------------------------------------------------------------------------------------------------//
+namespace internal {
+
+/* Givens rotation [c s; -s c] that zeros b in [a; b] */
+template<typename T, typename V>
+FASTOR_INLINE void _givens_rotation(const V &a, const V &b, V &c, V &s) {
+    using std::sqrt;
+    using std::max;
+    constexpr T tiny = std::numeric_limits<T>::min();
+    const V rho2 = a*a + b*b;
+    const auto small = rho2 <= tiny;
+    const V inv_rho = T(1) / sqrt(max(rho2,V(tiny)));
+    c = select(small, V(T(1)), V(a*inv_rho));
+    s = select(small, V(T(0)), V(b*inv_rho));
+}
+
+/* Apply the Givens rotation to rows p and q of the 3x3 matrices b and q */
+template<typename T, size_t P, size_t Q, size_t Col, typename V>
+FASTOR_INLINE void _givens_qr_step(V (&b)[9], V (&q)[9]) {
+    V c, s;
+    _givens_rotation<T>(b[P*3+Col], b[Q*3+Col], c, s);
+    for (size_t j=0; j<3; ++j) {
+        const V bp = b[P*3+j], bq = b[Q*3+j];
+        b[P*3+j] = c*bp + s*bq;
+        b[Q*3+j] = c*bq - s*bp;
+        const V qp = q[P*3+j], qq = q[Q*3+j];
+        q[P*3+j] = c*qp + s*qq;
+        q[Q*3+j] = c*qq - s*qp;
+    }
+}
+
+/* Given the (scaled) matrix a and the eigenvectors of a^T*a in ascending order
+   build the signed SVD a = u * diag(s) * v^T with u and v proper rotations,
+   s[0] >= s[1] >= |s[2]| and s[2] carrying the sign of det(a) */
+template<typename T, typename V>
+FASTOR_INLINE void _svd33_from_eigenvectors(const V (&a)[9], const V (&ev)[9], V (&u)[9], V (&s)[3], V (&v)[9]) {
+
+    // Descending order
+    for (size_t i=0; i<3; ++i) {
+        v[i*3  ] = ev[i*3+2];
+        v[i*3+1] = ev[i*3+1];
+        v[i*3+2] = ev[i*3  ];
+    }
+    // Make v a proper rotation
+    const V detv = v[0]*(v[4]*v[8] - v[5]*v[7]) - v[1]*(v[3]*v[8] - v[5]*v[6]) + v[2]*(v[3]*v[7] - v[4]*v[6]);
+    const auto neg = detv < T(0);
+    v[2] = select(neg, V(-v[2]), v[2]);
+    v[5] = select(neg, V(-v[5]), v[5]);
+    v[8] = select(neg, V(-v[8]), v[8]);
+
+    // b = a * v
+    V b[9];
+    for (size_t i=0; i<3; ++i) {
+        for (size_t j=0; j<3; ++j) {
+            b[i*3+j] = a[i*3]*v[j] + a[i*3+1]*v[3+j] + a[i*3+2]*v[6+j];
+        }
+    }
+
+    // QR of b by Givens rotations - q accumulates the rotations applied to rows
+    V q[9];
+    for (size_t i=0; i<3; ++i) {
+        for (size_t j=0; j<3; ++j) {
+            q[i*3+j] = i==j ? T(1) : T(0);
+        }
+    }
+    _givens_qr_step<T,0,1,0>(b,q);
+    _givens_qr_step<T,0,2,0>(b,q);
+    _givens_qr_step<T,1,2,1>(b,q);
+
+    s[0] = b[0];
+    s[1] = b[4];
+    s[2] = b[8];
+    for (size_t i=0; i<3; ++i) {
+        for (size_t j=0; j<3; ++j) {
+            u[i*3+j] = q[j*3+i];
+        }
+    }
+}
+
+/* Signed 3x3 SVD kernel. Returns the fallback mask of the eigen kernel */
+template<typename T, typename V>
+FASTOR_INLINE auto _svd33_kernel(const V (&a)[9], V (&u)[9], V (&s)[3], V (&v)[9]) -> decltype(V() > T(0)) {
+    using std::abs;
+    using std::max;
+
+    // Scale to avoid under/overflow in a^T*a
+    V scale = abs(a[0]);
+    for (size_t i=1; i<9; ++i) scale = max(scale,abs(a[i]));
+    const V inv_scale = T(1) / max(scale,V(std::numeric_limits<T>::min()));
+    V an[9];
+    for (size_t i=0; i<9; ++i) an[i] = a[i]*inv_scale;
+
+    const V s00 = an[0]*an[0] + an[3]*an[3] + an[6]*an[6];
+    const V s01 = an[0]*an[1] + an[3]*an[4] + an[6]*an[7];
+    const V s02 = an[0]*an[2] + an[3]*an[5] + an[6]*an[8];
+    const V s11 = an[1]*an[1] + an[4]*an[4] + an[7]*an[7];
+    const V s12 = an[1]*an[2] + an[4]*an[5] + an[7]*an[8];
+    const V s22 = an[2]*an[2] + an[5]*an[5] + an[8]*an[8];
+
+    V w[3], ev[9];
+    const auto fallback = _eigh33_kernel<T>(s00,s01,s02,s11,s12,s22,w,ev);
+    _svd33_from_eigenvectors<T>(an,ev,u,s,v);
+    for (size_t i=0; i<3; ++i) s[i] *= scale;
+    return fallback;
+}
+
+/* Scalar signed 3x3 SVD with the cyclic Jacobi fallback for a^T*a */
+template<typename T>
+FASTOR_INLINE void _svd33_signed(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT u, T *FASTOR_RESTRICT s, T *FASTOR_RESTRICT v) {
+    T _a[9], _u[9], _s[3], _v[9];
+    for (size_t i=0; i<9; ++i) _a[i] = a[i];
+    const bool fallback = _svd33_kernel<T>(_a,_u,_s,_v);
+    if (fallback) {
+        T scale = std::abs(a[0]);
+        for (size_t i=1; i<9; ++i) scale = std::max(scale,std::abs(a[i]));
+        const T inv_scale = T(1) / std::max(scale,std::numeric_limits<T>::min());
+        for (size_t i=0; i<9; ++i) _a[i] = a[i]*inv_scale;
+        T ata[9], w[3], ev[9];
+        for (size_t i=0; i<3; ++i) {
+            for (size_t j=0; j<3; ++j) {
+                ata[i*3+j] = _a[i]*_a[j] + _a[3+i]*_a[3+j] + _a[6+i]*_a[6+j];
+            }
+        }
+        _eigh_jacobi<T,3>(ata,w,ev);
+        _svd33_from_eigenvectors<T>(_a,ev,_u,_s,_v);
+        for (size_t i=0; i<3; ++i) _s[i] *= scale;
+    }
+    for (size_t i=0; i<9; ++i) { u[i] = _u[i]; v[i] = _v[i]; }
+    for (size_t i=0; i<3; ++i) s[i] = _s[i];
+}
+
+/* Turn the signed SVD in to the conventional one with non-negative singular values */
+template<typename T, typename V>
+FASTOR_INLINE void _svd33_unsign(V (&u)[9], V (&s)[3]) {
+    const auto neg = s[2] < T(0);
+    s[2] = select(neg, V(-s[2]), s[2]);
+    u[2] = select(neg, V(-u[2]), u[2]);
+    u[5] = select(neg, V(-u[5]), u[5]);
+    u[8] = select(neg, V(-u[8]), u[8]);
+}
+
+/* Polar decomposition a = r * h from the SVD: r = u * v^T and h = v * diag(s) * v^T */
+template<typename T, typename V>
+FASTOR_INLINE void _polar33_from_svd(const V (&u)[9], const V (&s)[3], const V (&v)[9], V (&r)[9], V (&h)[9]) {
+    for (size_t i=0; i<3; ++i) {
+        for (size_t j=0; j<3; ++j) {
+            r[i*3+j] = u[i*3]*v[j*3] + u[i*3+1]*v[j*3+1] + u[i*3+2]*v[j*3+2];
+            h[i*3+j] = v[i*3]*s[0]*v[j*3] + v[i*3+1]*s[1]*v[j*3+1] + v[i*3+2]*s[2]*v[j*3+2];
+        }
+    }
+}
+
+} // internal
+//----------------------------------------------------------------------------------------------------------------//
+
+
+
+// 3x3 SVD a = u * diag(s) * v^T with s non-negative and in descending order
+template<typename T, size_t N, enable_if_t_<is_equal_v_<N,3>, bool> = false>
+FASTOR_INLINE void _svd(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT u, T *FASTOR_RESTRICT s, T *FASTOR_RESTRICT v) {
+    T _u[9], _s[3];
+    internal::_svd33_signed(a,_u,_s,v);
+    internal::_svd33_unsign<T>(_u,_s);
+    for (size_t i=0; i<9; ++i) u[i] = _u[i];
+    for (size_t i=0; i<3; ++i) s[i] = _s[i];
+}
+
+// 3x3 polar decomposition a = r * h with r orthogonal and h symmetric positive
+// semi-definite. r is a proper rotation if det(a) > 0
+template<typename T, size_t N, enable_if_t_<is_equal_v_<N,3>, bool> = false>
+FASTOR_INLINE void _polar(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT r, T *FASTOR_RESTRICT h) {
+    T u[9], s[3], v[9];
+    internal::_svd33_signed(a,u,s,v);
+    internal::_svd33_unsign<T>(u,s);
+    T _r[9], _h[9];
+    internal::_polar33_from_svd<T>(u,s,v,_r,_h);
+    for (size_t i=0; i<9; ++i) { r[i] = _r[i]; h[i] = _h[i]; }
+}
+
+
+
+// Batched 3x3 SVD and polar decomposition - nbatch contiguous row-major
+// matrices are decomposed SIMDVector::Size matrices at a time, one matrix per lane
+//----------------------------------------------------------------------------------------------------------------//
+template<typename T, size_t N, enable_if_t_<is_equal_v_<N,3>, bool> = false>
+FASTOR_INLINE void _svd_batch(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT u, T *FASTOR_RESTRICT s, T *FASTOR_RESTRICT v, size_t nbatch) {
+    using V = SIMDVector<T,DEFAULT_ABI>;
+    constexpr int NN = int(N*N);
+    size_t k = 0;
+    for (; k < ROUND_DOWN(nbatch,V::Size); k+=V::Size) {
+        V _a[9], _u[9], _s[3], _v[9];
+        for (int i=0; i<NN; ++i) vector_setter(_a[i],a,int(k)*NN+i,NN);
+        const auto fallback = internal::_svd33_kernel<T>(_a,_u,_s,_v);
+        internal::_svd33_unsign<T>(_u,_s);
+        for (int i=0; i<int(N); ++i) data_setter(s,_s[i],int(k)*int(N)+i,int(N));
+        for (int i=0; i<NN; ++i) {
+            data_setter(u,_u[i],int(k)*NN+i,NN);
+            data_setter(v,_v[i],int(k)*NN+i,NN);
+        }
+        if (any_of(fallback)) {
+            bool lanes[V::Size];
+            fallback.store(lanes);
+            for (size_t l=0; l<V::Size; ++l) {
+                if (lanes[l]) _svd<T,N>(&a[(k+l)*N*N],&u[(k+l)*N*N],&s[(k+l)*N],&v[(k+l)*N*N]);
+            }
+        }
+    }
+    for (; k<nbatch; ++k) {
+        _svd<T,N>(&a[k*N*N],&u[k*N*N],&s[k*N],&v[k*N*N]);
+    }
+}
+
+template<typename T, size_t N, enable_if_t_<is_equal_v_<N,3>, bool> = false>
+FASTOR_INLINE void _polar_batch(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT r, T *FASTOR_RESTRICT h, size_t nbatch) {
+    using V = SIMDVector<T,DEFAULT_ABI>;
+    constexpr int NN = int(N*N);
+    size_t k = 0;
+    for (; k < ROUND_DOWN(nbatch,V::Size); k+=V::Size) {
+        V _a[9], _u[9], _s[3], _v[9], _r[9], _h[9];
+        for (int i=0; i<NN; ++i) vector_setter(_a[i],a,int(k)*NN+i,NN);
+        const auto fallback = internal::_svd33_kernel<T>(_a,_u,_s,_v);
+        internal::_svd33_unsign<T>(_u,_s);
+        internal::_polar33_from_svd<T>(_u,_s,_v,_r,_h);
+        for (int i=0; i<NN; ++i) {
+            data_setter(r,_r[i],int(k)*NN+i,NN);
+            data_setter(h,_h[i],int(k)*NN+i,NN);
+        }
+        if (any_of(fallback)) {
+            bool lanes[V::Size];
+            fallback.store(lanes);
+            for (size_t l=0; l<V::Size; ++l) {
+                if (lanes[l]) _polar<T,N>(&a[(k+l)*N*N],&r[(k+l)*N*N],&h[(k+l)*N*N]);
+            }
+        }
+    }
+    for (; k<nbatch; ++k) {
+        _polar<T,N>(&a[k*N*N],&r[k*N*N],&h[k*N*N]);
+    }
+}
+//----------------------------------------------------------------------------------------------------------------//
+
+} // end of namespace Fastor
+
+#endif // SVD_H
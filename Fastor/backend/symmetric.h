@@ -0,0 +1,232 @@
+#ifndef SYMMETRIC_H
+#define SYMMETRIC_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/config/config.h"
+#include "Fastor/backend/inverse.h"
+#include "Fastor/backend/lufact_blocked.h"
+#include "Fastor/backend/trsm.h"
+#include <algorithm>
+
+namespace Fastor {
+
+namespace internal {
+
+/* Packed storage of a symmetric M x M matrix in Voigt order - the diagonal first
+   followed by the strictly upper triangle row by row, i.e. 11, 22, 33, 12, 13, 23
+   for M = 3. Off-diagonal components appear twice in the full matrix which is
+   accounted for by weight when contracting packed vectors
+*/
+template<size_t M>
+struct sym_index {
+    static constexpr size_t size = M*(M+1)/2;
+    static constexpr FASTOR_INLINE size_t idx(size_t i, size_t j) {
+        return i==j ? i : (i<j ? M + i*M - i*(i+1)/2 + j-i-1 : M + j*M - j*(j+1)/2 + i-j-1);
+    }
+    static constexpr FASTOR_INLINE size_t weight(size_t I) {
+        return I < M ? 1 : 2;
+    }
+};
+
+/* Storage of a minor symmetric 4th order tensor as an N x N Voigt matrix, N = M(M+1)/2.
+   With major symmetry as well only the upper triangle of the Voigt matrix is kept
+*/
+template<size_t M, bool MajorSym>
+struct msym_index {
+    static constexpr size_t N = sym_index<M>::size;
+    static constexpr size_t size = MajorSym ? sym_index<N>::size : N*N;
+    static constexpr FASTOR_INLINE size_t idx(size_t I, size_t J) {
+        return MajorSym ? sym_index<N>::idx(I,J) : I*N+J;
+    }
+};
+
+} // internal
+
+
+// Symmetric 2nd order tensors in packed storage
+//----------------------------------------------------------------------------------------------------------------//
+/* a : b of two packed symmetric tensors */
+template<typename T, size_t M>
+FASTOR_INLINE T _sym_doublecontract(const T *FASTOR_RESTRICT a, const T *FASTOR_RESTRICT b) {
+    T diag = 0, offdiag = 0;
+    for (size_t I=0; I<M; ++I) diag += a[I]*b[I];
+    for (size_t I=M; I<internal::sym_index<M>::size; ++I) offdiag += a[I]*b[I];
+    return diag + T(2)*offdiag;
+}
+
+/* out = a * b for packed symmetric a and b, the product is a general matrix */
+template<typename T, size_t M>
+FASTOR_INLINE void _sym_matmul(const T *FASTOR_RESTRICT a, const T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT out) {
+    using S = internal::sym_index<M>;
+    for (size_t i=0; i<M; ++i) {
+        for (size_t j=0; j<M; ++j) {
+            T acc = 0;
+            for (size_t k=0; k<M; ++k) acc += a[S::idx(i,k)]*b[S::idx(k,j)];
+            out[i*M+j] = acc;
+        }
+    }
+}
+
+/* out = a * b for packed symmetric a and a general M x N matrix b */
+template<typename T, size_t M, size_t N>
+FASTOR_INLINE void _sym_matmul_general(const T *FASTOR_RESTRICT a, const T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT out) {
+    using S = internal::sym_index<M>;
+    std::fill(out,out+M*N,T(0));
+    for (size_t i=0; i<M; ++i) {
+        for (size_t k=0; k<M; ++k) {
+            const T aik = a[S::idx(i,k)];
+            for (size_t j=0; j<N; ++j) out[i*N+j] += aik*b[k*N+j];
+        }
+    }
+}
+
+template<typename T, size_t M, enable_if_t_<is_equal_v_<M,1>, bool> = false>
+FASTOR_INLINE T _sym_determinant(const T *FASTOR_RESTRICT a) {
+    return a[0];
+}
+template<typename T, size_t M, enable_if_t_<is_equal_v_<M,2>, bool> = false>
+FASTOR_INLINE T _sym_determinant(const T *FASTOR_RESTRICT a) {
+    return a[0]*a[1] - a[2]*a[2];
+}
+template<typename T, size_t M, enable_if_t_<is_equal_v_<M,3>, bool> = false>
+FASTOR_INLINE T _sym_determinant(const T *FASTOR_RESTRICT a) {
+    // a = [a11, a22, a33, a12, a13, a23]
+    return a[0]*(a[1]*a[2] - a[5]*a[5]) - a[3]*(a[3]*a[2] - a[5]*a[4]) + a[4]*(a[3]*a[5] - a[1]*a[4]);
+}
+template<typename T, size_t M, enable_if_t_<is_greater_v_<M,3>, bool> = false>
+FASTOR_INLINE T _sym_determinant(const T *FASTOR_RESTRICT a) {
+    using S = internal::sym_index<M>;
+    T lu[M*M];
+    for (size_t i=0; i<M; ++i)
+        for (size_t j=0; j<M; ++j)
+            lu[i*M+j] = a[S::idx(i,j)];
+    return _lufact_blocked_determinant<T,M>(lu);
+}
+
+/* Inverse of a packed symmetric matrix is symmetric - only the 6 distinct cofactors
+   are formed for M = 3. Larger matrices are unpacked and inverted with LU
+*/
+template<typename T, size_t M, enable_if_t_<is_equal_v_<M,1>, bool> = false>
+FASTOR_INLINE void _sym_inverse(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT out) {
+    out[0] = T(1)/a[0];
+}
+template<typename T, size_t M, enable_if_t_<is_equal_v_<M,2>, bool> = false>
+FASTOR_INLINE void _sym_inverse(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT out) {
+    const T inv_det = T(1)/_sym_determinant<T,2>(a);
+    out[0] =  a[1]*inv_det;
+    out[1] =  a[0]*inv_det;
+    out[2] = -a[2]*inv_det;
+}
+template<typename T, size_t M, enable_if_t_<is_equal_v_<M,3>, bool> = false>
+FASTOR_INLINE void _sym_inverse(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT out) {
+    const T c11 = a[1]*a[2] - a[5]*a[5];
+    const T c22 = a[0]*a[2] - a[4]*a[4];
+    const T c33 = a[0]*a[1] - a[3]*a[3];
+    const T c12 = a[4]*a[5] - a[3]*a[2];
+    const T c13 = a[3]*a[5] - a[4]*a[1];
+    const T c23 = a[3]*a[4] - a[0]*a[5];
+    const T inv_det = T(1)/(a[0]*c11 + a[3]*c12 + a[4]*c13);
+    out[0] = c11*inv_det;
+    out[1] = c22*inv_det;
+    out[2] = c33*inv_det;
+    out[3] = c12*inv_det;
+    out[4] = c13*inv_det;
+    out[5] = c23*inv_det;
+}
+template<typename T, size_t M, enable_if_t_<is_greater_v_<M,3>, bool> = false>
+FASTOR_INLINE void _sym_inverse(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT out) {
+    using S = internal::sym_index<M>;
+    T lu[M*M], x[M*M];
+    size_t perm[M];
+    for (size_t i=0; i<M; ++i)
+        for (size_t j=0; j<M; ++j)
+            lu[i*M+j] = a[S::idx(i,j)];
+    _lufact_blocked<T,M>(lu,perm);
+    std::fill(x,x+M*M,T(0));
+    for (size_t i=0; i<M; ++i) x[i*M+perm[i]] = T(1);
+    _trsm<T,M,M,UpLoType::UniLower>(lu,x);
+    _trsm<T,M,M,UpLoType::Upper>(lu,x);
+    for (size_t i=0; i<M; ++i)
+        for (size_t j=i; j<M; ++j)
+            out[S::idx(i,j)] = T(0.5)*(x[i*M+j] + x[j*M+i]);
+}
+//----------------------------------------------------------------------------------------------------------------//
+
+
+// Minor symmetric 4th order tensors in Voigt storage
+//----------------------------------------------------------------------------------------------------------------//
+/* out_ij = C_ijkl s_kl */
+template<typename T, size_t M, bool MajorSym>
+FASTOR_INLINE void _msym_doublecontract_sym(const T *FASTOR_RESTRICT c, const T *FASTOR_RESTRICT s, T *FASTOR_RESTRICT out) {
+    using S = internal::sym_index<M>;
+    using C = internal::msym_index<M,MajorSym>;
+    constexpr size_t N = S::size;
+    T ws[N];
+    for (size_t J=0; J<N; ++J) ws[J] = T(S::weight(J))*s[J];
+    for (size_t I=0; I<N; ++I) {
+        T acc = 0;
+        for (size_t J=0; J<N; ++J) acc += c[C::idx(I,J)]*ws[J];
+        out[I] = acc;
+    }
+}
+
+/* out_kl = s_ij C_ijkl */
+template<typename T, size_t M, bool MajorSym>
+FASTOR_INLINE void _sym_doublecontract_msym(const T *FASTOR_RESTRICT s, const T *FASTOR_RESTRICT c, T *FASTOR_RESTRICT out) {
+    using S = internal::sym_index<M>;
+    using C = internal::msym_index<M,MajorSym>;
+    constexpr size_t N = S::size;
+    std::fill(out,out+N,T(0));
+    for (size_t I=0; I<N; ++I) {
+        const T wsI = T(S::weight(I))*s[I];
+        for (size_t J=0; J<N; ++J) out[J] += wsI*c[C::idx(I,J)];
+    }
+}
+
+/* out_ijkl = A_ijmn B_mnkl, the result is minor symmetric only */
+template<typename T, size_t M, bool MajorSymA, bool MajorSymB>
+FASTOR_INLINE void _msym_doublecontract(const T *FASTOR_RESTRICT a, const T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT out) {
+    using S  = internal::sym_index<M>;
+    using CA = internal::msym_index<M,MajorSymA>;
+    using CB = internal::msym_index<M,MajorSymB>;
+    constexpr size_t N = S::size;
+    std::fill(out,out+N*N,T(0));
+    for (size_t I=0; I<N; ++I) {
+        for (size_t K=0; K<N; ++K) {
+            const T aIK = T(S::weight(K))*a[CA::idx(I,K)];
+            for (size_t J=0; J<N; ++J) out[I*N+J] += aIK*b[CB::idx(K,J)];
+        }
+    }
+}
+
+/* Inverse on the space of symmetric 2nd order tensors, C : X = X : C = I^sym.
+   In Voigt form with W = diag(1,..,1,2,..,2) this is X = W^{-1} C^{-1} W^{-1}
+*/
+template<typename T, size_t M, bool MajorSym>
+FASTOR_INLINE void _msym_inverse(const T *FASTOR_RESTRICT c, T *FASTOR_RESTRICT out) {
+    using S = internal::sym_index<M>;
+    using C = internal::msym_index<M,MajorSym>;
+    constexpr size_t N = S::size;
+    T lu[N*N], x[N*N];
+    size_t perm[N];
+    for (size_t I=0; I<N; ++I)
+        for (size_t J=0; J<N; ++J)
+            lu[I*N+J] = c[C::idx(I,J)];
+    _lufact_blocked<T,N>(lu,perm);
+    // C Y = P^T W^{-1}
+    std::fill(x,x+N*N,T(0));
+    for (size_t I=0; I<N; ++I) x[I*N+perm[I]] = T(1)/T(S::weight(perm[I]));
+    _trsm<T,N,N,UpLoType::UniLower>(lu,x);
+    _trsm<T,N,N,UpLoType::Upper>(lu,x);
+    for (size_t I=0; I<N; ++I) {
+        const T inv_w = T(1)/T(S::weight(I));
+        for (size_t J=MajorSym ? I : 0; J<N; ++J) {
+            out[C::idx(I,J)] = MajorSym ? T(0.5)*(inv_w*x[I*N+J] + x[J*N+I]/T(S::weight(J))) : inv_w*x[I*N+J];
+        }
+    }
+}
+//----------------------------------------------------------------------------------------------------------------//
+
+} // end of namespace Fastor
+
+#endif // SYMMETRIC_H
@@ -442,6 +442,120 @@ FASTOR_INLINE void _transpose_dispatch<double,8,8>(const double * FASTOR_RESTRIC
 } // internal
 //----------------------------------------------------------------------------------------------------------//
 
+
+
+// Strided tile transposes out[j*LDO+i] = a[i*LDA+j] for a Size x Size tile. These are the
+// in-register building blocks of the blocked N-dimensional permute
+//----------------------------------------------------------------------------------------------------------//
+namespace internal {
+template<typename T>
+struct transpose_tile {
+    static constexpr size_t Size = 4;
+    template<size_t LDA, size_t LDO>
+    static FASTOR_INLINE void Do(const T * FASTOR_RESTRICT a, T * FASTOR_RESTRICT out) {
+        for (size_t j=0; j<Size; ++j)
+            for (size_t i=0; i<Size; ++i)
+                out[j*LDO+i] = a[i*LDA+j];
+    }
+};
+
+#ifdef FASTOR_AVX_IMPL
+template<>
+struct transpose_tile<float> {
+    static constexpr size_t Size = 8;
+    template<size_t LDA, size_t LDO>
+    static FASTOR_INLINE void Do(const float * FASTOR_RESTRICT a, float * FASTOR_RESTRICT out) {
+        __m256 row1 = _mm256_loadu_ps(a);
+        __m256 row2 = _mm256_loadu_ps(a+LDA);
+        __m256 row3 = _mm256_loadu_ps(a+2*LDA);
+        __m256 row4 = _mm256_loadu_ps(a+3*LDA);
+        __m256 row5 = _mm256_loadu_ps(a+4*LDA);
+        __m256 row6 = _mm256_loadu_ps(a+5*LDA);
+        __m256 row7 = _mm256_loadu_ps(a+6*LDA);
+        __m256 row8 = _mm256_loadu_ps(a+7*LDA);
+        _MM_TRANSPOSE8_PS(row1, row2, row3, row4, row5, row6, row7, row8);
+        _mm256_storeu_ps(out, row1);
+        _mm256_storeu_ps(out+LDO, row2);
+        _mm256_storeu_ps(out+2*LDO, row3);
+        _mm256_storeu_ps(out+3*LDO, row4);
+        _mm256_storeu_ps(out+4*LDO, row5);
+        _mm256_storeu_ps(out+5*LDO, row6);
+        _mm256_storeu_ps(out+6*LDO, row7);
+        _mm256_storeu_ps(out+7*LDO, row8);
+    }
+};
+#elif defined(FASTOR_SSE2_IMPL)
+template<>
+struct transpose_tile<float> {
+    static constexpr size_t Size = 4;
+    template<size_t LDA, size_t LDO>
+    static FASTOR_INLINE void Do(const float * FASTOR_RESTRICT a, float * FASTOR_RESTRICT out) {
+        __m128 row1 = _mm_loadu_ps(a);
+        __m128 row2 = _mm_loadu_ps(a+LDA);
+        __m128 row3 = _mm_loadu_ps(a+2*LDA);
+        __m128 row4 = _mm_loadu_ps(a+3*LDA);
+        _MM_TRANSPOSE4_PS(row1, row2, row3, row4);
+        _mm_storeu_ps(out, row1);
+        _mm_storeu_ps(out+LDO, row2);
+        _mm_storeu_ps(out+2*LDO, row3);
+        _mm_storeu_ps(out+3*LDO, row4);
+    }
+};
+#endif
+
+#ifdef FASTOR_AVX_IMPL
+template<>
+struct transpose_tile<double> {
+    static constexpr size_t Size = 4;
+    template<size_t LDA, size_t LDO>
+    static FASTOR_INLINE void Do(const double * FASTOR_RESTRICT a, double * FASTOR_RESTRICT out) {
+        __m256d row1 = _mm256_loadu_pd(a);
+        __m256d row2 = _mm256_loadu_pd(a+LDA);
+        __m256d row3 = _mm256_loadu_pd(a+2*LDA);
+        __m256d row4 = _mm256_loadu_pd(a+3*LDA);
+        _MM_TRANSPOSE4_PD(row1, row2, row3, row4);
+        _mm256_storeu_pd(out, row1);
+        _mm256_storeu_pd(out+LDO, row2);
+        _mm256_storeu_pd(out+2*LDO, row3);
+        _mm256_storeu_pd(out+3*LDO, row4);
+    }
+};
+#elif defined(FASTOR_SSE2_IMPL)
+template<>
+struct transpose_tile<double> {
+    static constexpr size_t Size = 2;
+    template<size_t LDA, size_t LDO>
+    static FASTOR_INLINE void Do(const double * FASTOR_RESTRICT a, double * FASTOR_RESTRICT out) {
+        __m128d row1 = _mm_loadu_pd(a);
+        __m128d row2 = _mm_loadu_pd(a+LDA);
+        _mm_storeu_pd(out, _mm_unpacklo_pd(row1,row2));
+        _mm_storeu_pd(out+LDO, _mm_unpackhi_pd(row1,row2));
+    }
+};
+#endif
+
+/* Transpose an M x N block with row strides LDA and LDO tile by tile, the
+   edges that do not fill a whole tile are done element by element */
+template<typename T, size_t M, size_t N, size_t LDA, size_t LDO>
+FASTOR_INLINE void _transpose_strided(const T * FASTOR_RESTRICT a, T * FASTOR_RESTRICT out) {
+    constexpr size_t S = transpose_tile<T>::Size;
+    constexpr size_t MS = M / S * S;
+    constexpr size_t NS = N / S * S;
+    for (size_t i=0; i<MS; i+=S) {
+        for (size_t j=0; j<NS; j+=S) {
+            transpose_tile<T>::template Do<LDA,LDO>(a+i*LDA+j, out+j*LDO+i);
+        }
+        for (size_t j=NS; j<N; ++j)
+            for (size_t ii=i; ii<i+S; ++ii)
+                out[j*LDO+ii] = a[ii*LDA+j];
+    }
+    for (size_t j=0; j<N; ++j)
+        for (size_t i=MS; i<M; ++i)
+            out[j*LDO+i] = a[i*LDA+j];
+}
+} // internal
+//----------------------------------------------------------------------------------------------------------//
+
 }
 
 #endif // TRANSPOSE_H
@@ -0,0 +1,200 @@
+#ifndef TRSM_H
+#define TRSM_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/meta/tensor_meta.h"
+#include "Fastor/config/config.h"
+#include "Fastor/simd_vector/extintrin.h"
+#include "Fastor/simd_vector/SIMDVector.h"
+
+namespace Fastor {
+
+// Triangular solves - forward and backward substitution for a single (TRSV) or multiple (TRSM)
+// right hand sides. The coefficient matrix a is M x M row-major and only its triangular part
+// given by UpLoType is referenced. UniLower/UniUpper assume an implicit unit diagonal so that
+// the packed LU factors [getrf layout] can be used directly. The right hand sides are overwritten
+// with the solution. TRSM is vectorised over the columns of the right hand side, each row of the
+// solution being formed as a linear combination of the previously solved rows
+//----------------------------------------------------------------------------------------------------------------//
+namespace internal {
+
+template<typename UpLo>
+struct is_lower_triangular {
+    static constexpr bool value = is_same_v_<UpLo,UpLoType::Lower> || is_same_v_<UpLo,UpLoType::UniLower>;
+};
+template<typename UpLo>
+struct is_unit_triangular {
+    static constexpr bool value = is_same_v_<UpLo,UpLoType::UniLower> || is_same_v_<UpLo,UpLoType::UniUpper>;
+};
+template<typename UpLo>
+struct is_triangular {
+    static constexpr bool value = is_lower_triangular<UpLo>::value || is_same_v_<UpLo,UpLoType::Upper> ||
+        is_same_v_<UpLo,UpLoType::UniUpper>;
+};
+
+/* y[0:n] -= alpha * x[0:n] */
+template<typename T>
+FASTOR_INLINE void _row_update(const T alpha, const T *FASTOR_RESTRICT x, T *FASTOR_RESTRICT y, size_t n) {
+    using V = SIMDVector<T,DEFAULT_ABI>;
+    const V valpha(alpha);
+    size_t j = 0;
+    for (; j < ROUND_DOWN(n,V::Size); j+=V::Size) {
+        const V vx(&x[j],false);
+        const V vy(&y[j],false);
+        fnmadd(valpha,vx,vy).store(&y[j],false);
+    }
+    for (; j < n; ++j) {
+        y[j] -= alpha*x[j];
+    }
+}
+
+/* y[0:n] *= alpha */
+template<typename T>
+FASTOR_INLINE void _row_scale(const T alpha, T *FASTOR_RESTRICT y, size_t n) {
+    using V = SIMDVector<T,DEFAULT_ABI>;
+    const V valpha(alpha);
+    size_t j = 0;
+    for (; j < ROUND_DOWN(n,V::Size); j+=V::Size) {
+        (V(&y[j],false)*valpha).store(&y[j],false);
+    }
+    for (; j < n; ++j) {
+        y[j] *= alpha;
+    }
+}
+
+/* sum(a[0:n] * x[0:n]) */
+template<typename T>
+FASTOR_INLINE T _trsv_dot(const T *FASTOR_RESTRICT a, const T *FASTOR_RESTRICT x, size_t n) {
+    using V = SIMDVector<T,DEFAULT_ABI>;
+    V vacc;
+    size_t k = 0;
+    for (; k < ROUND_DOWN(n,V::Size); k+=V::Size) {
+        vacc = fmadd(V(&a[k],false),V(&x[k],false),vacc);
+    }
+    T acc = vacc.sum();
+    for (; k < n; ++k) {
+        acc += a[k]*x[k];
+    }
+    return acc;
+}
+
+/* Solve row i of the right hand side against rows [kfirst,klast) of the already computed solution */
+template<typename T, size_t M, size_t N, bool UnitDiag>
+FASTOR_INLINE void _trsm_row(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT b, size_t i, size_t kfirst, size_t klast) {
+    using V = SIMDVector<T,DEFAULT_ABI>;
+    const T inv_aii = UnitDiag ? T(1) : T(1) / a[i*M+i];
+    size_t j = 0;
+    for (; j < ROUND_DOWN(N,V::Size); j+=V::Size) {
+        V acc(&b[i*N+j],false);
+        for (size_t k=kfirst; k<klast; ++k) {
+            acc = fnmadd(V(a[i*M+k]),V(&b[k*N+j],false),acc);
+        }
+        FASTOR_IF_CONSTEXPR(!UnitDiag) acc *= V(inv_aii);
+        acc.store(&b[i*N+j],false);
+    }
+    for (; j < N; ++j) {
+        T acc = b[i*N+j];
+        for (size_t k=kfirst; k<klast; ++k) {
+            acc -= a[i*M+k]*b[k*N+j];
+        }
+        FASTOR_IF_CONSTEXPR(!UnitDiag) acc *= inv_aii;
+        b[i*N+j] = acc;
+    }
+}
+
+} // internal
+//----------------------------------------------------------------------------------------------------------------//
+
+
+// Single right hand side
+template<typename T, size_t M, typename UpLo,
+    enable_if_t_<internal::is_lower_triangular<UpLo>::value,bool> = false>
+FASTOR_INLINE void _trsv(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT b) {
+    constexpr bool UnitDiag = internal::is_unit_triangular<UpLo>::value;
+    for (size_t i=0; i<M; ++i) {
+        const T value = b[i] - internal::_trsv_dot(&a[i*M],b,i);
+        b[i] = UnitDiag ? value : value / a[i*M+i];
+    }
+}
+
+template<typename T, size_t M, typename UpLo,
+    enable_if_t_<!internal::is_lower_triangular<UpLo>::value,bool> = false>
+FASTOR_INLINE void _trsv(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT b) {
+    constexpr bool UnitDiag = internal::is_unit_triangular<UpLo>::value;
+    for (size_t i=M; i-- > 0;) {
+        const T value = b[i] - internal::_trsv_dot(&a[i*M+i+1],&b[i+1],M-i-1);
+        b[i] = UnitDiag ? value : value / a[i*M+i];
+    }
+}
+
+// Multiple right hand sides - b is M x N
+template<typename T, size_t M, size_t N, typename UpLo,
+    enable_if_t_<internal::is_lower_triangular<UpLo>::value,bool> = false>
+FASTOR_INLINE void _trsm(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT b) {
+    FASTOR_IF_CONSTEXPR(N==1) { _trsv<T,M,UpLo>(a,b); return; }
+    for (size_t i=0; i<M; ++i) {
+        internal::_trsm_row<T,M,N,internal::is_unit_triangular<UpLo>::value>(a,b,i,0,i);
+    }
+}
+
+template<typename T, size_t M, size_t N, typename UpLo,
+    enable_if_t_<!internal::is_lower_triangular<UpLo>::value,bool> = false>
+FASTOR_INLINE void _trsm(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT b) {
+    FASTOR_IF_CONSTEXPR(N==1) { _trsv<T,M,UpLo>(a,b); return; }
+    for (size_t i=M; i-- > 0;) {
+        internal::_trsm_row<T,M,N,internal::is_unit_triangular<UpLo>::value>(a,b,i,i+1,M);
+    }
+}
+
+
+// Transposed solves A^T * x = b with the same storage of A. These are row oriented [axpy] so the
+// triangle of A is still traversed contiguously
+template<typename T, size_t M, typename UpLo,
+    enable_if_t_<internal::is_lower_triangular<UpLo>::value,bool> = false>
+FASTOR_INLINE void _trsv_trans(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT b) {
+    constexpr bool UnitDiag = internal::is_unit_triangular<UpLo>::value;
+    for (size_t i=M; i-- > 0;) {
+        FASTOR_IF_CONSTEXPR(!UnitDiag) b[i] /= a[i*M+i];
+        internal::_row_update(b[i],&a[i*M],b,i);
+    }
+}
+
+template<typename T, size_t M, typename UpLo,
+    enable_if_t_<!internal::is_lower_triangular<UpLo>::value,bool> = false>
+FASTOR_INLINE void _trsv_trans(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT b) {
+    constexpr bool UnitDiag = internal::is_unit_triangular<UpLo>::value;
+    for (size_t i=0; i<M; ++i) {
+        FASTOR_IF_CONSTEXPR(!UnitDiag) b[i] /= a[i*M+i];
+        internal::_row_update(b[i],&a[i*M+i+1],&b[i+1],M-i-1);
+    }
+}
+
+template<typename T, size_t M, size_t N, typename UpLo,
+    enable_if_t_<internal::is_lower_triangular<UpLo>::value,bool> = false>
+FASTOR_INLINE void _trsm_trans(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT b) {
+    FASTOR_IF_CONSTEXPR(N==1) { _trsv_trans<T,M,UpLo>(a,b); return; }
+    constexpr bool UnitDiag = internal::is_unit_triangular<UpLo>::value;
+    for (size_t i=M; i-- > 0;) {
+        FASTOR_IF_CONSTEXPR(!UnitDiag) internal::_row_scale(T(1)/a[i*M+i],&b[i*N],N);
+        for (size_t k=0; k<i; ++k) {
+            internal::_row_update(a[i*M+k],&b[i*N],&b[k*N],N);
+        }
+    }
+}
+
+template<typename T, size_t M, size_t N, typename UpLo,
+    enable_if_t_<!internal::is_lower_triangular<UpLo>::value,bool> = false>
+FASTOR_INLINE void _trsm_trans(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT b) {
+    FASTOR_IF_CONSTEXPR(N==1) { _trsv_trans<T,M,UpLo>(a,b); return; }
+    constexpr bool UnitDiag = internal::is_unit_triangular<UpLo>::value;
+    for (size_t i=0; i<M; ++i) {
+        FASTOR_IF_CONSTEXPR(!UnitDiag) internal::_row_scale(T(1)/a[i*M+i],&b[i*N],N);
+        for (size_t k=i+1; k<M; ++k) {
+            internal::_row_update(a[i*M+k],&b[i*N],&b[k*N],N);
+        }
+    }
+}
+
+} // end of namespace Fastor
+
+#endif // TRSM_H
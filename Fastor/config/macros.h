@@ -107,6 +107,53 @@ SOFTWARE.
 #define FASTOR_BLAS_SWITCH_MATRIX_SIZE 16
 #endif
 
+// Tiling of 2D view assignments
+//------------------------------------------------------------------------------------------------//
+// Width [in bytes] of the column tiles that long rows of a 2D view are assigned in, 0 for
+// whole rows. Worth setting [to about the size of L2] only if a few rows of the view do not
+// fit in the last level cache
+#ifndef FASTOR_VIEW_TILE_BYTES
+#define FASTOR_VIEW_TILE_BYTES 0
+#endif
+// Number of threads the rows of a 2D view assignment are split over, 1 for none
+#ifndef FASTOR_VIEW_ASSIGN_THREADS
+#define FASTOR_VIEW_ASSIGN_THREADS 1
+#endif
+// Smallest 2D view [in elements] that is assigned on multiple threads
+#ifndef FASTOR_VIEW_ASSIGN_THREAD_THRESHOLD
+#define FASTOR_VIEW_ASSIGN_THREAD_THRESHOLD 65536
+#endif
+//------------------------------------------------------------------------------------------------//
+
+// Contraction ordering of tensor networks
+//------------------------------------------------------------------------------------------------//
+// What the order minimises: flops, the largest intermediate or flops plus FASTOR_OPMIN_MEMORY_WEIGHT
+// times the elements of all intermediates
+#define FASTOR_OPMIN_FLOPS 0
+#define FASTOR_OPMIN_MEMORY 1
+#define FASTOR_OPMIN_WEIGHTED 2
+#ifndef FASTOR_OPMIN_OBJECTIVE
+#define FASTOR_OPMIN_OBJECTIVE FASTOR_OPMIN_FLOPS
+#endif
+#ifndef FASTOR_OPMIN_MEMORY_WEIGHT
+#define FASTOR_OPMIN_MEMORY_WEIGHT 1
+#endif
+// Largest intermediate [in bytes] allowed, 0 for no limit
+#ifndef FASTOR_OPMIN_MAX_INTERMEDIATE
+#define FASTOR_OPMIN_MAX_INTERMEDIATE 0
+#endif
+// Report the order of every static network as a compiler warning
+//#define FASTOR_OPMIN_REPORT
+//------------------------------------------------------------------------------------------------//
+
+// Runtime einsum
+//------------------------------------------------------------------------------------------------//
+// Plans [with their temporaries] a thread caches per kind of contraction before emptying the cache
+#ifndef FASTOR_RUNTIME_EINSUM_CACHE_SIZE
+#define FASTOR_RUNTIME_EINSUM_CACHE_SIZE 64
+#endif
+//------------------------------------------------------------------------------------------------//
+
 // FASTOR_NIL
 //------------------------------------------------------------------------------------------------//
 #define FASTOR_NIL 0
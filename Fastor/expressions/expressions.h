@@ -12,6 +12,9 @@
 #include "Fastor/expressions/unary_ops/unary_math_ops.h"
 #include "Fastor/expressions/unary_ops/unary_bool_ops.h"
 #include "Fastor/expressions/linalg_ops/linalg_ops.h"
+#include "Fastor/expressions/linalg_ops/binary_einsum_op.h"
+#include "Fastor/expressions/linalg_ops/network_einsum_op.h"
+#include "Fastor/expressions/linalg_ops/binary_matmul_epilogue.h"
 
 #include "Fastor/expressions/views/tensor_fixed_views_1d.h"
 #include "Fastor/expressions/views/tensor_fixed_views_2d.h"
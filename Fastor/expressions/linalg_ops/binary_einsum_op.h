@@ -0,0 +1,138 @@
+#ifndef BINARY_EINSUM_OP_H
+#define BINARY_EINSUM_OP_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/meta/einsum_meta.h"
+#include "Fastor/simd_vector/SIMDVector.h"
+#include "Fastor/backend/matmul/matmul_epilogue.h"
+#include "Fastor/tensor/AbstractTensor.h"
+#include "Fastor/tensor/TensorTraits.h"
+#include "Fastor/expressions/expression_traits.h"
+#include "Fastor/tensor_algebra/einsum.h"
+
+
+namespace Fastor {
+
+/* A by-pair einsum that is not evaluated until it is assigned, like BinaryMatMulOp for
+   matmul. The contraction is evaluated directly into the tensor it is assigned to, and
+   compound assignments and element-wise expressions of it are applied in the epilogue of
+   the contraction [see matmul_epilogue.h and binary_matmul_epilogue.h]. Built by lazy_einsum
+   [see network_einsum_op.h]
+*/
+template<class Index_I, class Index_J, typename TLhs, typename TRhs, size_t DIM0>
+struct BinaryEinsumOp: public AbstractTensor<BinaryEinsumOp<Index_I, Index_J, TLhs, TRhs, DIM0>,DIM0> {
+    using lhs_expr_type = expression_t<TLhs>;
+    using rhs_expr_type = expression_t<TRhs>;
+    using lhs_type = typename TLhs::result_type;
+    using rhs_type = typename TRhs::result_type;
+    using scalar_type = typename lhs_type::scalar_type;
+    using simd_vector_type = typename lhs_type::simd_vector_type;
+    using simd_abi_type = typename simd_vector_type::abi_type;
+    // the indices of the result
+    using index_type = typename get_resuling_index<Index_I,Index_J,lhs_type,rhs_type>::type;
+    using result_type = decltype(einsum<Index_I,Index_J>(std::declval<const lhs_type&>(),std::declval<const rhs_type&>()));
+    using dims_type = typename put_dims_in_Index<result_type>::type;
+    static constexpr FASTOR_INDEX Dimension = DIM0;
+    static constexpr FASTOR_INDEX rank() {return DIM0;}
+
+    FASTOR_INLINE BinaryEinsumOp(lhs_expr_type inlhs, rhs_expr_type inrhs) : _lhs(inlhs), _rhs(inrhs) {
+        static_assert(einsum_index_checker<typename concat_<Index_I,Index_J>::type>::value,
+                      "INDICES FOR EINSUM FUNCTION CANNOT APPEAR MORE THAN TWICE. USE INNER INSTEAD");
+    }
+
+    constexpr FASTOR_INLINE FASTOR_INDEX size() const {return result_type::size();}
+    constexpr FASTOR_INLINE FASTOR_INDEX dimension(FASTOR_INDEX i) const {return dims_type::values[i];}
+
+    constexpr FASTOR_INLINE lhs_expr_type lhs() const {return _lhs;}
+    constexpr FASTOR_INLINE rhs_expr_type rhs() const {return _rhs;}
+
+private:
+    lhs_expr_type _lhs;
+    rhs_expr_type _rhs;
+};
+
+template<class Index_I, class Index_J, typename TLhs, typename TRhs, size_t DIM0>
+struct scalar_type_finder<BinaryEinsumOp<Index_I,Index_J,TLhs,TRhs,DIM0>> {
+    using type = typename BinaryEinsumOp<Index_I,Index_J,TLhs,TRhs,DIM0>::scalar_type;
+};
+template<class Index_I, class Index_J, typename TLhs, typename TRhs, size_t DIM0>
+struct tensor_type_finder<BinaryEinsumOp<Index_I,Index_J,TLhs,TRhs,DIM0>> {
+    using type = typename BinaryEinsumOp<Index_I,Index_J,TLhs,TRhs,DIM0>::result_type;
+};
+
+
+
+namespace internal {
+
+// The operands of a lazy einsum, evaluated if they are not tensors
+template<typename Expr, enable_if_t_<is_tensor_v<Expr>,bool> = false>
+FASTOR_INLINE const Expr& einsum_operand(const Expr &expr) {return expr;}
+template<typename Expr, enable_if_t_<!is_tensor_v<Expr>,bool> = false>
+FASTOR_INLINE typename Expr::result_type einsum_operand(const Expr &expr) {return typename Expr::result_type(expr);}
+
+template<typename T, size_t ... Rest, typename Expr, enable_if_t_<is_tensor_v<Expr>,bool> = false>
+FASTOR_INLINE bool einsum_alias(const Tensor<T,Rest...> &dst, const Expr &expr) {return dst.data() == expr.data();}
+template<typename T, size_t ... Rest, typename Expr, enable_if_t_<!is_tensor_v<Expr>,bool> = false>
+FASTOR_INLINE bool einsum_alias(const Tensor<T,Rest...> &, const Expr &) {return false;}
+
+// dst = ep(src). The contraction is evaluated into a temporary if dst is one of its operands
+template<typename T, size_t ... Rest, class Index_I, class Index_J, typename TLhs, typename TRhs, size_t DIM, typename Epilogue>
+FASTOR_INLINE void einsum_epilogue_assign(Tensor<T,Rest...> &dst, const BinaryEinsumOp<Index_I,Index_J,TLhs,TRhs,DIM> &src, const Epilogue &ep) {
+    using result_type = typename BinaryEinsumOp<Index_I,Index_J,TLhs,TRhs,DIM>::result_type;
+    static_assert(result_type::size() == Tensor<T,Rest...>::size(), "TENSOR SIZE MISMATCH");
+    const auto &a = einsum_operand(src.lhs().self());
+    const auto &b = einsum_operand(src.rhs().self());
+    if (einsum_alias(dst,src.lhs().self()) || einsum_alias(dst,src.rhs().self())) {
+        Tensor<T,Rest...> tmp;
+        einsum_epilogue_dispatcher<Index_I,Index_J>(a,b,tmp.data(),ep);
+        dst = tmp;
+        return;
+    }
+    einsum_epilogue_dispatcher<Index_I,Index_J>(a,b,dst.data(),ep);
+}
+
+} // internal
+
+
+
+// assignments
+template<typename T, size_t ... Rest, class Index_I, class Index_J, typename TLhs, typename TRhs, size_t DIM>
+FASTOR_INLINE void assign(Tensor<T,Rest...> &dst, const BinaryEinsumOp<Index_I,Index_J,TLhs,TRhs,DIM> &src) {
+    internal::einsum_epilogue_assign(dst,src,internal::matmul_epilogue_identity{});
+}
+template<typename T, size_t ... Rest, class Index_I, class Index_J, typename TLhs, typename TRhs, size_t DIM>
+FASTOR_INLINE void assign_add(Tensor<T,Rest...> &dst, const BinaryEinsumOp<Index_I,Index_J,TLhs,TRhs,DIM> &src) {
+    internal::einsum_epilogue_assign(dst,src,internal::matmul_epilogue_axpby<T>{T(1),T(1),dst.data()});
+}
+template<typename T, size_t ... Rest, class Index_I, class Index_J, typename TLhs, typename TRhs, size_t DIM>
+FASTOR_INLINE void assign_sub(Tensor<T,Rest...> &dst, const BinaryEinsumOp<Index_I,Index_J,TLhs,TRhs,DIM> &src) {
+    internal::einsum_epilogue_assign(dst,src,internal::matmul_epilogue_axpby<T>{T(-1),T(1),dst.data()});
+}
+template<typename T, size_t ... Rest, class Index_I, class Index_J, typename TLhs, typename TRhs, size_t DIM>
+FASTOR_INLINE void assign_mul(Tensor<T,Rest...> &dst, const BinaryEinsumOp<Index_I,Index_J,TLhs,TRhs,DIM> &src) {
+    internal::einsum_epilogue_assign(dst,src,internal::matmul_epilogue_mul<T>{dst.data()});
+}
+template<typename T, size_t ... Rest, class Index_I, class Index_J, typename TLhs, typename TRhs, size_t DIM>
+FASTOR_INLINE void assign_div(Tensor<T,Rest...> &dst, const BinaryEinsumOp<Index_I,Index_J,TLhs,TRhs,DIM> &src) {
+    internal::einsum_epilogue_assign(dst,src,internal::matmul_epilogue_div<T>{dst.data()});
+}
+
+// assignments to anything other than a tensor go through the result
+#define FASTOR_MAKE_BINARY_EINSUM_ASSIGNMENT(ASSIGN_TYPE)\
+template<typename Derived, size_t DIM, class Index_I, class Index_J, typename TLhs, typename TRhs, size_t OtherDIM>\
+FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const BinaryEinsumOp<Index_I,Index_J,TLhs,TRhs,OtherDIM> &src) {\
+    using result_type = typename BinaryEinsumOp<Index_I,Index_J,TLhs,TRhs,OtherDIM>::result_type;\
+    const result_type tmp(src);\
+    assign ##ASSIGN_TYPE (dst.self(), tmp);\
+}\
+
+FASTOR_MAKE_BINARY_EINSUM_ASSIGNMENT(    )
+FASTOR_MAKE_BINARY_EINSUM_ASSIGNMENT(_add)
+FASTOR_MAKE_BINARY_EINSUM_ASSIGNMENT(_sub)
+FASTOR_MAKE_BINARY_EINSUM_ASSIGNMENT(_mul)
+FASTOR_MAKE_BINARY_EINSUM_ASSIGNMENT(_div)
+
+} // end of namespace Fastor
+
+
+#endif // BINARY_EINSUM_OP_H
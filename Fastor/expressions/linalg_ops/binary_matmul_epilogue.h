@@ -0,0 +1,286 @@
+#ifndef BINARY_MATMUL_EPILOGUE_H
+#define BINARY_MATMUL_EPILOGUE_H
+
+#include "Fastor/backend/matmul/matmul_epilogue.h"
+#include "Fastor/expressions/binary_ops/binary_arithmetic_ops.h"
+#include "Fastor/expressions/unary_ops/unary_math_ops.h"
+#include "Fastor/expressions/linalg_ops/linalg_ops.h"
+#include "Fastor/expressions/linalg_ops/binary_einsum_op.h"
+#include "Fastor/expressions/linalg_ops/network_einsum_op.h"
+
+
+namespace Fastor {
+
+/* Element-wise expressions of a matrix product that are evaluated in the epilogue of
+   the product kernel instead of materialising the product first. Recognised are
+
+        alpha*(A%B),  (A%B)*alpha,
+        alpha*(A%B) +- beta*C,  beta*C +- alpha*(A%B)   [C a tensor, either scale optional]
+        f(any of the above)                             [f a unary math function]
+
+   when they are assigned to a tensor. C may be the tensor that is assigned to. A%B
+   can also be a lazy einsum [see binary_einsum_op.h], whose epilogue is applied in
+   registers when its last contraction maps to a GEMM and in one pass otherwise
+*/
+namespace internal {
+
+// The operands of the product, evaluated if they are not tensors
+template<typename Expr, enable_if_t_<is_tensor_v<Expr>,bool> = false>
+FASTOR_INLINE const Expr& matmul_fused_operand(const Expr &expr) {return expr;}
+template<typename Expr, enable_if_t_<!is_tensor_v<Expr>,bool> = false>
+FASTOR_INLINE typename Expr::result_type matmul_fused_operand(const Expr &expr) {return typename Expr::result_type(expr);}
+
+template<typename T, size_t ... Rest, typename Expr, enable_if_t_<is_tensor_v<Expr>,bool> = false>
+FASTOR_INLINE bool matmul_fused_alias(const Tensor<T,Rest...> &dst, const Expr &expr) {return dst.data() == expr.data();}
+template<typename T, size_t ... Rest, typename Expr, enable_if_t_<!is_tensor_v<Expr>,bool> = false>
+FASTOR_INLINE bool matmul_fused_alias(const Tensor<T,Rest...> &, const Expr &) {return false;}
+
+
+// The tensor added to the product, with its scale
+template<typename Expr>
+struct matmul_fused_addend {
+    static constexpr bool value = false;
+};
+template<typename T, size_t ... Rest>
+struct matmul_fused_addend<Tensor<T,Rest...>> {
+    static constexpr bool value = true;
+    static FASTOR_INLINE T beta(const Tensor<T,Rest...> &) {return T(1);}
+    static FASTOR_INLINE const T* data(const Tensor<T,Rest...> &expr) {return expr.data();}
+};
+template<typename TLhs, typename TRhs, size_t DIM>
+struct matmul_fused_addend<BinaryMulOp<TLhs,TRhs,DIM>> {
+    static constexpr bool is_left_scaled  = is_primitive_v_<TLhs> && is_tensor_v<TRhs>;
+    static constexpr bool is_right_scaled = is_tensor_v<TLhs> && is_primitive_v_<TRhs>;
+    static constexpr bool value = is_left_scaled || is_right_scaled;
+    using tensor_type = conditional_t_<is_left_scaled,TRhs,TLhs>;
+    using T = typename scalar_type_finder<tensor_type>::type;
+    template<bool LS = is_left_scaled, enable_if_t_<LS,bool> = false>
+    static FASTOR_INLINE T beta(const BinaryMulOp<TLhs,TRhs,DIM> &expr) {return T(expr.lhs());}
+    template<bool LS = is_left_scaled, enable_if_t_<!LS,bool> = false>
+    static FASTOR_INLINE T beta(const BinaryMulOp<TLhs,TRhs,DIM> &expr) {return T(expr.rhs());}
+    template<bool LS = is_left_scaled, enable_if_t_<LS,bool> = false>
+    static FASTOR_INLINE const T* data(const BinaryMulOp<TLhs,TRhs,DIM> &expr) {return expr.rhs().data();}
+    template<bool LS = is_left_scaled, enable_if_t_<!LS,bool> = false>
+    static FASTOR_INLINE const T* data(const BinaryMulOp<TLhs,TRhs,DIM> &expr) {return expr.lhs().data();}
+};
+
+
+// An expression of a product that can be evaluated in its epilogue. is_scaled marks
+// the products that can still be the product term of an axpby. The products are matmul
+// and lazy einsum expressions
+template<typename Expr>
+struct matmul_fusion {
+    static constexpr bool value = false;
+    static constexpr bool is_scaled = false;
+    static constexpr bool is_product = false;
+};
+
+template<typename Expr>
+struct matmul_fusion_product {
+    using expr_type = Expr;
+    using matmul_type = expr_type;
+    using T = typename expr_type::scalar_type;
+    using epilogue_type = matmul_epilogue_scale<T>;
+    static constexpr bool value = true;
+    static constexpr bool is_scaled = true;
+    static constexpr bool is_product = true;
+    static FASTOR_INLINE matmul_type matmul(const expr_type &expr) {return expr;}
+    static FASTOR_INLINE epilogue_type epilogue(const expr_type &) {return {T(1)};}
+};
+
+template<typename TLhs, typename TRhs, size_t DIM>
+struct matmul_fusion<BinaryMatMulOp<TLhs,TRhs,DIM>> : matmul_fusion_product<BinaryMatMulOp<TLhs,TRhs,DIM>> {};
+template<class Index_I, class Index_J, typename TLhs, typename TRhs, size_t DIM>
+struct matmul_fusion<BinaryEinsumOp<Index_I,Index_J,TLhs,TRhs,DIM>> : matmul_fusion_product<BinaryEinsumOp<Index_I,Index_J,TLhs,TRhs,DIM>> {};
+template<class Indices, class Operands, size_t DIM>
+struct matmul_fusion<NetworkEinsumOp<Indices,Operands,DIM>> : matmul_fusion_product<NetworkEinsumOp<Indices,Operands,DIM>> {};
+
+// alpha*(A%B) and (A%B)*alpha
+template<typename TProduct, typename TScale, bool ScaleFirst, typename Expr,
+         bool = is_primitive_v_<TScale> && matmul_fusion<TProduct>::is_product>
+struct matmul_fusion_scale : matmul_fusion<void> {};
+
+template<typename TProduct, typename TScale, bool ScaleFirst, typename Expr>
+struct matmul_fusion_scale<TProduct,TScale,ScaleFirst,Expr,true> {
+    using expr_type = Expr;
+    using matmul_type = TProduct;
+    using T = typename matmul_type::scalar_type;
+    using epilogue_type = matmul_epilogue_scale<T>;
+    static constexpr bool value = true;
+    static constexpr bool is_scaled = true;
+    static constexpr bool is_product = false;
+    template<bool SF = ScaleFirst, enable_if_t_<SF,bool> = false>
+    static FASTOR_INLINE matmul_type matmul(const expr_type &expr) {return expr.rhs();}
+    template<bool SF = ScaleFirst, enable_if_t_<!SF,bool> = false>
+    static FASTOR_INLINE matmul_type matmul(const expr_type &expr) {return expr.lhs();}
+    template<bool SF = ScaleFirst, enable_if_t_<SF,bool> = false>
+    static FASTOR_INLINE epilogue_type epilogue(const expr_type &expr) {return {T(expr.lhs())};}
+    template<bool SF = ScaleFirst, enable_if_t_<!SF,bool> = false>
+    static FASTOR_INLINE epilogue_type epilogue(const expr_type &expr) {return {T(expr.rhs())};}
+};
+
+template<typename TLhs, typename TRhs, size_t DIM>
+struct matmul_fusion<BinaryMulOp<TLhs,TRhs,DIM>> :
+    conditional_t_<is_primitive_v_<TLhs>,
+        matmul_fusion_scale<TRhs,TLhs,true,BinaryMulOp<TLhs,TRhs,DIM>>,
+        matmul_fusion_scale<TLhs,TRhs,false,BinaryMulOp<TLhs,TRhs,DIM>>> {};
+
+// alpha*(A%B) + beta*C with the product on either side and SIGN applied to the right operand
+template<typename TProduct, typename TAddend, bool ProductFirst, int SIGN, typename Expr,
+         bool = matmul_fusion<TProduct>::is_scaled && matmul_fused_addend<TAddend>::value>
+struct matmul_fusion_axpby : matmul_fusion<void> {};
+
+template<typename TProduct, typename TAddend, bool ProductFirst, int SIGN, typename Expr>
+struct matmul_fusion_axpby<TProduct,TAddend,ProductFirst,SIGN,Expr,true> {
+    using expr_type = Expr;
+    using matmul_type = typename matmul_fusion<TProduct>::matmul_type;
+    using T = typename matmul_type::scalar_type;
+    using epilogue_type = matmul_epilogue_axpby<T>;
+    static constexpr bool value = true;
+    static constexpr bool is_scaled = false;
+    static constexpr bool is_product = false;
+    template<bool PF = ProductFirst, enable_if_t_<PF,bool> = false>
+    static FASTOR_INLINE matmul_type matmul(const expr_type &expr) {return matmul_fusion<TProduct>::matmul(expr.lhs());}
+    template<bool PF = ProductFirst, enable_if_t_<!PF,bool> = false>
+    static FASTOR_INLINE matmul_type matmul(const expr_type &expr) {return matmul_fusion<TProduct>::matmul(expr.rhs());}
+    template<bool PF = ProductFirst, enable_if_t_<PF,bool> = false>
+    static FASTOR_INLINE epilogue_type epilogue(const expr_type &expr) {
+        return {matmul_fusion<TProduct>::epilogue(expr.lhs()).alpha,
+                T(SIGN)*matmul_fused_addend<TAddend>::beta(expr.rhs()),
+                matmul_fused_addend<TAddend>::data(expr.rhs())};
+    }
+    template<bool PF = ProductFirst, enable_if_t_<!PF,bool> = false>
+    static FASTOR_INLINE epilogue_type epilogue(const expr_type &expr) {
+        return {T(SIGN)*matmul_fusion<TProduct>::epilogue(expr.rhs()).alpha,
+                matmul_fused_addend<TAddend>::beta(expr.lhs()),
+                matmul_fused_addend<TAddend>::data(expr.lhs())};
+    }
+};
+
+template<typename TLhs, typename TRhs, size_t DIM>
+struct matmul_fusion<BinaryAddOp<TLhs,TRhs,DIM>> :
+    conditional_t_<matmul_fusion<TLhs>::is_scaled,
+        matmul_fusion_axpby<TLhs,TRhs,true,1,BinaryAddOp<TLhs,TRhs,DIM>>,
+        matmul_fusion_axpby<TRhs,TLhs,false,1,BinaryAddOp<TLhs,TRhs,DIM>>> {};
+
+template<typename TLhs, typename TRhs, size_t DIM>
+struct matmul_fusion<BinarySubOp<TLhs,TRhs,DIM>> :
+    conditional_t_<matmul_fusion<TLhs>::is_scaled,
+        matmul_fusion_axpby<TLhs,TRhs,true,-1,BinarySubOp<TLhs,TRhs,DIM>>,
+        matmul_fusion_axpby<TRhs,TLhs,false,-1,BinarySubOp<TLhs,TRhs,DIM>>> {};
+
+
+// dst = ep(product)
+template<typename T, size_t ... Rest, typename TLhs, typename TRhs, size_t DIM, typename Epilogue>
+FASTOR_INLINE void matmul_fused_product_assign(Tensor<T,Rest...> &dst, const BinaryMatMulOp<TLhs,TRhs,DIM> &product, const Epilogue &ep) {
+    const auto &a = matmul_fused_operand(product.lhs().self());
+    const auto &b = matmul_fused_operand(product.rhs().self());
+    if (matmul_fused_alias(dst,product.lhs().self()) || matmul_fused_alias(dst,product.rhs().self())) {
+        Tensor<T,Rest...> tmp;
+        matmul_epilogue_dispatcher(a,b,tmp,ep);
+        dst = tmp;
+        return;
+    }
+    matmul_epilogue_dispatcher(a,b,dst,ep);
+}
+template<typename T, size_t ... Rest, class Index_I, class Index_J, typename TLhs, typename TRhs, size_t DIM, typename Epilogue>
+FASTOR_INLINE void matmul_fused_product_assign(Tensor<T,Rest...> &dst, const BinaryEinsumOp<Index_I,Index_J,TLhs,TRhs,DIM> &product, const Epilogue &ep) {
+    einsum_epilogue_assign(dst,product,ep);
+}
+template<typename T, size_t ... Rest, class Indices, class Operands, size_t DIM, typename Epilogue>
+FASTOR_INLINE void matmul_fused_product_assign(Tensor<T,Rest...> &dst, const NetworkEinsumOp<Indices,Operands,DIM> &product, const Epilogue &ep) {
+    einsum_epilogue_assign(dst,product,ep);
+}
+
+template<typename T, size_t ... Rest, typename Expr>
+FASTOR_INLINE void matmul_fused_assign(Tensor<T,Rest...> &dst, const Expr &src) {
+    using fusion = matmul_fusion<Expr>;
+    const typename fusion::matmul_type product = fusion::matmul(src);
+    matmul_fused_product_assign(dst,product,fusion::epilogue(src));
+}
+
+} // internal
+
+
+// assignments
+template<typename T, size_t ... Rest, typename TLhs, typename TRhs, size_t DIM,
+         enable_if_t_<internal::matmul_fusion<BinaryMulOp<TLhs,TRhs,DIM>>::value,bool> = false>
+FASTOR_INLINE void assign(Tensor<T,Rest...> &dst, const BinaryMulOp<TLhs,TRhs,DIM> &src) {
+    internal::matmul_fused_assign(dst,src);
+}
+template<typename T, size_t ... Rest, typename TLhs, typename TRhs, size_t DIM,
+         enable_if_t_<internal::matmul_fusion<BinaryAddOp<TLhs,TRhs,DIM>>::value,bool> = false>
+FASTOR_INLINE void assign(Tensor<T,Rest...> &dst, const BinaryAddOp<TLhs,TRhs,DIM> &src) {
+    internal::matmul_fused_assign(dst,src);
+}
+template<typename T, size_t ... Rest, typename TLhs, typename TRhs, size_t DIM,
+         enable_if_t_<internal::matmul_fusion<BinarySubOp<TLhs,TRhs,DIM>>::value,bool> = false>
+FASTOR_INLINE void assign(Tensor<T,Rest...> &dst, const BinarySubOp<TLhs,TRhs,DIM> &src) {
+    internal::matmul_fused_assign(dst,src);
+}
+
+// assignments add/sub of a scaled product accumulate into dst in the epilogue
+template<typename T, size_t ... Rest, typename TLhs, typename TRhs, size_t DIM,
+         enable_if_t_<internal::matmul_fusion<BinaryMulOp<TLhs,TRhs,DIM>>::value,bool> = false>
+FASTOR_INLINE void assign_add(Tensor<T,Rest...> &dst, const BinaryMulOp<TLhs,TRhs,DIM> &src) {
+    assign(dst, BinaryAddOp<BinaryMulOp<TLhs,TRhs,DIM>,Tensor<T,Rest...>,DIM>(src,dst));
+}
+template<typename T, size_t ... Rest, typename TLhs, typename TRhs, size_t DIM,
+         enable_if_t_<internal::matmul_fusion<BinaryMulOp<TLhs,TRhs,DIM>>::value,bool> = false>
+FASTOR_INLINE void assign_sub(Tensor<T,Rest...> &dst, const BinaryMulOp<TLhs,TRhs,DIM> &src) {
+    assign(dst, BinarySubOp<Tensor<T,Rest...>,BinaryMulOp<TLhs,TRhs,DIM>,DIM>(dst,src));
+}
+
+
+// f(expression of a product)
+#define FASTOR_MAKE_MATMUL_UNARY_EPILOGUE(SIMD_OP, SCALAR_OP, NAME)\
+namespace internal {\
+struct matmul_epilogue_fn_ ##NAME {\
+    template<typename T, typename ABI>\
+    FASTOR_INLINE SIMDVector<T,ABI> operator()(const SIMDVector<T,ABI> &x) const {return SIMD_OP(x);}\
+    template<typename T>\
+    FASTOR_INLINE T operator()(T x) const {return SCALAR_OP(x);}\
+};\
+template<typename Expr, size_t DIM, bool = matmul_fusion<Expr>::value>\
+struct matmul_fusion_ ##NAME : matmul_fusion<void> {};\
+template<typename Expr, size_t DIM>\
+struct matmul_fusion_ ##NAME<Expr,DIM,true> {\
+    using expr_type = Unary ##NAME ## Op<Expr,DIM>;\
+    using matmul_type = typename matmul_fusion<Expr>::matmul_type;\
+    using epilogue_type = matmul_epilogue_unary<matmul_epilogue_fn_ ##NAME, typename matmul_fusion<Expr>::epilogue_type>;\
+    static constexpr bool value = true;\
+    static constexpr bool is_scaled = false;\
+    static constexpr bool is_product = false;\
+    static FASTOR_INLINE matmul_type matmul(const expr_type &expr) {return matmul_fusion<Expr>::matmul(expr.expr());}\
+    static FASTOR_INLINE epilogue_type epilogue(const expr_type &expr) {\
+        return {matmul_epilogue_fn_ ##NAME{}, matmul_fusion<Expr>::epilogue(expr.expr())};\
+    }\
+};\
+template<typename Expr, size_t DIM>\
+struct matmul_fusion<Unary ##NAME ## Op<Expr,DIM>> : matmul_fusion_ ##NAME<Expr,DIM> {};\
+}\
+template<typename T, size_t ... Rest, typename Expr, size_t DIM,\
+         enable_if_t_<internal::matmul_fusion<Unary ##NAME ## Op<Expr,DIM>>::value,bool> = false>\
+FASTOR_INLINE void assign(Tensor<T,Rest...> &dst, const Unary ##NAME ## Op<Expr,DIM> &src) {\
+    internal::matmul_fused_assign(dst,src);\
+}\
+
+FASTOR_MAKE_MATMUL_UNARY_EPILOGUE(-,     -,          Sub  )
+FASTOR_MAKE_MATMUL_UNARY_EPILOGUE(abs,   std::abs,   Abs  )
+FASTOR_MAKE_MATMUL_UNARY_EPILOGUE(sqrt,  std::sqrt,  Sqrt )
+FASTOR_MAKE_MATMUL_UNARY_EPILOGUE(exp,   std::exp,   Exp  )
+FASTOR_MAKE_MATMUL_UNARY_EPILOGUE(expm1, std::expm1, Expm1)
+FASTOR_MAKE_MATMUL_UNARY_EPILOGUE(log,   std::log,   Log  )
+FASTOR_MAKE_MATMUL_UNARY_EPILOGUE(log1p, std::log1p, Log1p)
+FASTOR_MAKE_MATMUL_UNARY_EPILOGUE(sin,   std::sin,   Sin  )
+FASTOR_MAKE_MATMUL_UNARY_EPILOGUE(cos,   std::cos,   Cos  )
+FASTOR_MAKE_MATMUL_UNARY_EPILOGUE(atan,  std::atan,  Atan )
+FASTOR_MAKE_MATMUL_UNARY_EPILOGUE(sinh,  std::sinh,  Sinh )
+FASTOR_MAKE_MATMUL_UNARY_EPILOGUE(cosh,  std::cosh,  Cosh )
+FASTOR_MAKE_MATMUL_UNARY_EPILOGUE(tanh,  std::tanh,  Tanh )
+FASTOR_MAKE_MATMUL_UNARY_EPILOGUE(erf,   std::erf,   Erf  )
+
+} // end of namespace Fastor
+
+
+#endif // BINARY_MATMUL_EPILOGUE_H
@@ -5,6 +5,7 @@
 #include "Fastor/simd_vector/SIMDVector.h"
 #include "Fastor/backend/inner.h"
 #include "Fastor/backend/matmul/matmul.h"
+#include "Fastor/backend/matmul/matmul_epilogue.h"
 #include "Fastor/tensor/AbstractTensor.h"
 #include "Fastor/tensor/Aliasing.h"
 #include "Fastor/tensor/TensorTraits.h"
@@ -68,40 +69,27 @@ operator %(const AbstractTensor<TLhs,DIM0> &lhs, const AbstractTensor<TRhs,DIM1>
 
 // helper dispatcher functions
 namespace internal {
-// till streaming gemm is implemented
+// c = alpha * a * b + beta * c with the scaling and accumulation applied in registers
+// before the product is stored [see matmul_epilogue.h]
 template<typename T, size_t M, size_t K, size_t N>
 FASTOR_INLINE
 void _gemm(const T alpha, const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b, const T beta, T * FASTOR_RESTRICT c) {
-
-    FASTOR_ARCH_ALIGN T tmp[M*N];
     if (beta == 0) {
-        // non-streaming
-        _matmul<T,M,K,N>(a,b,tmp);
-        for (size_t i = 0; i<M*N; ++i)
-            c[i] = alpha * tmp[i];
+        _matmul_epilogue<T,M,K,N>(a,b,c,matmul_epilogue_scale<T>{alpha});
     }
     else {
-        // streaming
-        _matmul<T,M,K,N>(a,b,tmp);
-        for (size_t i = 0; i<M*N; ++i)
-            c[i] = alpha * tmp[i] + beta*c[i];
+        _matmul_epilogue<T,M,K,N>(a,b,c,matmul_epilogue_axpby<T>{alpha,beta,c});
     }
 }
 template<typename T, size_t M, size_t K, size_t N>
 FASTOR_INLINE
 void _gemm_mul(const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b, T * FASTOR_RESTRICT c) {
-    FASTOR_ARCH_ALIGN T tmp[M*N];
-    _matmul<T,M,K,N>(a,b,tmp);
-    for (size_t i = 0; i<M*N; ++i)
-        c[i] *= tmp[i];
+    _matmul_epilogue<T,M,K,N>(a,b,c,matmul_epilogue_mul<T>{c});
 }
 template<typename T, size_t M, size_t K, size_t N>
 FASTOR_INLINE
 void _gemm_div(const T * FASTOR_RESTRICT a, const T * FASTOR_RESTRICT b, T * FASTOR_RESTRICT c) {
-    FASTOR_ARCH_ALIGN T tmp[M*N];
-    _matmul<T,M,K,N>(a,b,tmp);
-    for (size_t i = 0; i<M*N; ++i)
-        c[i] /= tmp[i];
+    _matmul_epilogue<T,M,K,N>(a,b,c,matmul_epilogue_div<T>{c});
 }
 
 
@@ -167,6 +155,20 @@ FASTOR_INLINE void matmul_dispatcher_div(const Tensor<T,J> &a, const Tensor<T,J,
     _gemm_div<T,1,J,K>(a.data(),b.data(),out.data());
 }
 
+// matmul - matvec overloads with an epilogue applied in registers [see matmul_epilogue.h]
+template<typename T, size_t I, size_t J, size_t K, typename Epilogue>
+FASTOR_INLINE void matmul_epilogue_dispatcher(const Tensor<T,I,J> &a, const Tensor<T,J,K> &b, Tensor<T,I,K> &out, const Epilogue &ep) {
+    _matmul_epilogue<T,I,J,K>(a.data(),b.data(),out.data(),ep);
+}
+template<typename T, size_t I, size_t J, typename Epilogue>
+FASTOR_INLINE void matmul_epilogue_dispatcher(const Tensor<T,I,J> &a, const Tensor<T,J> &b, Tensor<T,I> &out, const Epilogue &ep) {
+    _matmul_epilogue<T,I,J,1>(a.data(),b.data(),out.data(),ep);
+}
+template<typename T, size_t J, size_t K, typename Epilogue>
+FASTOR_INLINE void matmul_epilogue_dispatcher(const Tensor<T,J> &a, const Tensor<T,J,K> &b, Tensor<T,K> &out, const Epilogue &ep) {
+    _matmul_epilogue<T,1,J,K>(a.data(),b.data(),out.data(),ep);
+}
+
 } // internal
 
 
@@ -199,6 +201,31 @@ FASTOR_INLINE Tensor<T,K> matmul(const Tensor<T,J> &a, const Tensor<T,J,K> &b) {
 }
 
 
+// matmul with an element-wise function applied to the product before it is stored,
+// for instance an activation. fun is called on SIMDVector and scalar arguments
+template<typename T, size_t I, size_t J, size_t K, typename Fun,
+         enable_if_t_<!is_tensor_v<Fun>,bool> = false>
+FASTOR_INLINE Tensor<T,I,K> matmul(const Tensor<T,I,J> &a, const Tensor<T,J,K> &b, const Fun &fun) {
+    Tensor<T,I,K> out;
+    internal::matmul_epilogue_dispatcher(a,b,out,internal::matmul_epilogue_unary<Fun>{fun,{}});
+    return out;
+}
+template<typename T, size_t I, size_t J, typename Fun,
+         enable_if_t_<!is_tensor_v<Fun>,bool> = false>
+FASTOR_INLINE Tensor<T,I> matmul(const Tensor<T,I,J> &a, const Tensor<T,J> &b, const Fun &fun) {
+    Tensor<T,I> out;
+    internal::matmul_epilogue_dispatcher(a,b,out,internal::matmul_epilogue_unary<Fun>{fun,{}});
+    return out;
+}
+template<typename T, size_t J, size_t K, typename Fun,
+         enable_if_t_<!is_tensor_v<Fun>,bool> = false>
+FASTOR_INLINE Tensor<T,K> matmul(const Tensor<T,J> &a, const Tensor<T,J,K> &b, const Fun &fun) {
+    Tensor<T,K> out;
+    internal::matmul_epilogue_dispatcher(a,b,out,internal::matmul_epilogue_unary<Fun>{fun,{}});
+    return out;
+}
+
+
 // Generic matmul function for AbstractTensor types are provided here
 template<typename Derived0, size_t DIM0, typename Derived1, size_t DIM1,
     enable_if_t_<is_less_equal_v_<DIM0,2> && is_less_equal_v_<DIM1,2>
@@ -2,6 +2,7 @@
 #define BINARY_SOLVE_OP_H
 
 #include "Fastor/meta/meta.h"
+#include "Fastor/backend/solve_batch.h"
 #include "Fastor/simd_vector/SIMDVector.h"
 #include "Fastor/tensor/AbstractTensor.h"
 #include "Fastor/tensor/TensorTraits.h"
@@ -63,6 +64,52 @@ FASTOR_INLINE Tensor<T,I,J> solve(const Tensor<T,I,I> &A, const Tensor<T,I,J> &B
 
 
 
+namespace internal {
+
+template<SolveCompType SType, typename T, size_t N,
+    enable_if_t_<N <= 12 && std::is_floating_point<T>::value,bool> = false>
+FASTOR_INLINE void solve_batch_dispatcher(const T *FASTOR_RESTRICT a, const T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT x, size_t nbatch) {
+    _solve_batch<T,N>(a,b,x,nbatch);
+}
+template<SolveCompType SType, typename T, size_t N,
+    enable_if_t_<!(N <= 12 && std::is_floating_point<T>::value),bool> = false>
+FASTOR_INLINE void solve_batch_dispatcher(const T *FASTOR_RESTRICT a, const T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT x, size_t nbatch) {
+    for (size_t k=0; k<nbatch; ++k) {
+        TensorMap<const T,N,N> ai(a+k*N*N);
+        TensorMap<const T,N> bi(b+k*N);
+        Tensor<T,N> xi = solve<SType>(ai,bi);
+        std::copy(xi.data(),xi.data()+N,x+k*N);
+    }
+}
+
+} // internal
+
+// For high order tensors - batch of systems A[k] * x[k] = b[k] with the matrices stored
+// in the last two dimensions of A and the right hand sides in the last dimension of b.
+// Small systems are solved with SIMD across the batch, one system per lane, using
+// branch-free partial pivoting. Bigger systems are solved one at a time
+template<SolveCompType SType = SolveCompType::SimpleInv,
+    typename T, size_t ... Rest, enable_if_t_<sizeof...(Rest)>=3,bool> = false>
+FASTOR_INLINE
+typename last_matrix_extracter<Tensor<T,Rest...>, typename std_ext::make_index_sequence<sizeof...(Rest)-1>::type>::type
+solve(const Tensor<T,Rest...> &A,
+    const typename last_matrix_extracter<Tensor<T,Rest...>, typename std_ext::make_index_sequence<sizeof...(Rest)-1>::type>::type &b) {
+
+    using OutTensor = typename last_matrix_extracter<Tensor<T,Rest...>,
+        typename std_ext::make_index_sequence<sizeof...(Rest)-1>::type>::type;
+    constexpr size_t remaining_product = last_matrix_extracter<Tensor<T,Rest...>,
+        typename std_ext::make_index_sequence<sizeof...(Rest)-2>::type>::remaining_product;
+
+    constexpr size_t I = get_value<sizeof...(Rest)-1,Rest...>::value;
+    constexpr size_t J = get_value<sizeof...(Rest),Rest...>::value;
+    static_assert(I==J,"THE LAST TWO DIMENSIONS OF TENSOR MUST BE THE SAME");
+
+    OutTensor x;
+    internal::solve_batch_dispatcher<SType,T,J>(A.data(),b.data(),x.data(),remaining_product);
+    return x;
+}
+
+
 // For expressions
 template<SolveCompType SType = SolveCompType::SimpleInv,
     typename TLhs, typename TRhs, size_t DIM0, size_t DIM1,
@@ -70,11 +117,11 @@ template<SolveCompType SType = SolveCompType::SimpleInv,
 FASTOR_INLINE
 conditional_t_<TRhs::result_type::dimension_t::value == 1,
     Tensor<
-        typename TLhs::scalar_type,
+        remove_all_t<typename TLhs::scalar_type>,
         get_tensor_dimension_v<0,typename TLhs::result_type>
     >,
     Tensor<
-        typename TLhs::scalar_type,
+        remove_all_t<typename TLhs::scalar_type>,
         get_tensor_dimension_v<0,typename TLhs::result_type>,
         get_tensor_dimension_v<1,typename TRhs::result_type>
     >
@@ -100,11 +147,11 @@ template<SolveCompType SType = SolveCompType::SimpleInv,
 FASTOR_INLINE
 conditional_t_<TRhs::result_type::dimension_t::value == 1,
     Tensor<
-        typename TLhs::scalar_type,
+        remove_all_t<typename TLhs::scalar_type>,
         get_tensor_dimension_v<0,typename TLhs::result_type>
     >,
     Tensor<
-        typename TLhs::scalar_type,
+        remove_all_t<typename TLhs::scalar_type>,
         get_tensor_dimension_v<0,typename TLhs::result_type>,
         get_tensor_dimension_v<1,typename TRhs::result_type>
     >
@@ -132,11 +179,11 @@ template<SolveCompType SType = SolveCompType::SimpleInv,
 FASTOR_INLINE
 conditional_t_<TRhs::result_type::dimension_t::value == 1,
     Tensor<
-        typename TLhs::scalar_type,
+        remove_all_t<typename TLhs::scalar_type>,
         get_tensor_dimension_v<0,typename TLhs::result_type>
     >,
     Tensor<
-        typename TLhs::scalar_type,
+        remove_all_t<typename TLhs::scalar_type>,
         get_tensor_dimension_v<0,typename TLhs::result_type>,
         get_tensor_dimension_v<1,typename TRhs::result_type>
     >
@@ -164,11 +211,11 @@ template<SolveCompType SType = SolveCompType::SimpleInv,
 FASTOR_INLINE
 conditional_t_<TRhs::result_type::dimension_t::value == 1,
     Tensor<
-        typename TLhs::scalar_type,
+        remove_all_t<typename TLhs::scalar_type>,
         get_tensor_dimension_v<0,typename TLhs::result_type>
     >,
     Tensor<
-        typename TLhs::scalar_type,
+        remove_all_t<typename TLhs::scalar_type>,
         get_tensor_dimension_v<0,typename TLhs::result_type>,
         get_tensor_dimension_v<1,typename TRhs::result_type>
     >
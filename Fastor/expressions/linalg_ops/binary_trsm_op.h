@@ -0,0 +1,73 @@
+#ifndef BINARY_TRSM_OP_H
+#define BINARY_TRSM_OP_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/meta/tensor_meta.h"
+#include "Fastor/backend/trsm.h"
+#include "Fastor/tensor/AbstractTensor.h"
+#include "Fastor/tensor/Tensor.h"
+#include "Fastor/tensor/TensorTraits.h"
+#include "Fastor/expressions/expression_traits.h"
+
+
+namespace Fastor {
+
+// Triangular solve functions - solve A * x = b [trsv] or A * X = B [trsm]
+// where A is triangular as specified by UpLoType [Lower, UniLower, Upper, UniUpper]
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+template<typename UpLo = UpLoType::Lower, typename T, size_t M>
+FASTOR_INLINE Tensor<T,M> trsv(const Tensor<T,M,M> &A, const Tensor<T,M> &b) {
+    static_assert(internal::is_triangular<UpLo>::value, "COEFFICIENT MATRIX OF TRIANGULAR SOLVE HAS TO BE LOWER OR UPPER TRIANGULAR");
+    Tensor<T,M> x(b);
+    _trsv<T,M,UpLo>(A.data(),x.data());
+    return x;
+}
+template<typename UpLo = UpLoType::Lower, typename T, size_t M, size_t N>
+FASTOR_INLINE Tensor<T,M,N> trsm(const Tensor<T,M,M> &A, const Tensor<T,M,N> &B) {
+    static_assert(internal::is_triangular<UpLo>::value, "COEFFICIENT MATRIX OF TRIANGULAR SOLVE HAS TO BE LOWER OR UPPER TRIANGULAR");
+    Tensor<T,M,N> X(B);
+    _trsm<T,M,N,UpLo>(A.data(),X.data());
+    return X;
+}
+// trsm with a single right hand side
+template<typename UpLo = UpLoType::Lower, typename T, size_t M>
+FASTOR_INLINE Tensor<T,M> trsm(const Tensor<T,M,M> &A, const Tensor<T,M> &b) {
+    return trsv<UpLo>(A,b);
+}
+
+#if FASTOR_CXX_VERSION >= 2014
+// trsv/trsm for generic expressions
+template<typename UpLo = UpLoType::Lower,
+    typename Derived0, size_t DIM0, typename Derived1, size_t DIM1,
+    enable_if_t_<DIM0==2 && DIM1==1 && !(is_tensor_v<Derived0> && is_tensor_v<Derived1>),bool> = 0 >
+FASTOR_INLINE
+decltype(auto)
+trsv(const AbstractTensor<Derived0,DIM0> &a, const AbstractTensor<Derived1,DIM1> &b) {
+    using lhs_type = typename Derived0::result_type;
+    using rhs_type = typename Derived1::result_type;
+    const lhs_type tmp_a(a.self());
+    const rhs_type tmp_b(b.self());
+    return trsv<UpLo>(tmp_a,tmp_b);
+}
+
+template<typename UpLo = UpLoType::Lower,
+    typename Derived0, size_t DIM0, typename Derived1, size_t DIM1,
+    enable_if_t_<DIM0==2 && is_less_equal_v_<DIM1,2> && !(is_tensor_v<Derived0> && is_tensor_v<Derived1>),bool> = 0 >
+FASTOR_INLINE
+decltype(auto)
+trsm(const AbstractTensor<Derived0,DIM0> &a, const AbstractTensor<Derived1,DIM1> &b) {
+    using lhs_type = typename Derived0::result_type;
+    using rhs_type = typename Derived1::result_type;
+    const lhs_type tmp_a(a.self());
+    const rhs_type tmp_b(b.self());
+    return trsm<UpLo>(tmp_a,tmp_b);
+}
+#endif
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+
+} // end of namespace Fastor
+
+
+#endif // BINARY_TRSM_OP_H
@@ -58,6 +58,29 @@ enum class SolveCompType : int
     SimpleLUPiv,   /* Using simple LU factorisation with pivot     */
     QR,            /* Using QR factorisation                       */
     Chol,          /* Using Cholesky factorisation                 */
+    Refined,       /* Lower precision LU with iterative refinement */
+};
+
+// Symmetric eigen-decomposition computation type
+enum class EigCompType : int
+{
+    Simple = 0,   /* Closed-form for 2x2/3x3, HHQL otherwise     */
+    Jacobi,       /* Cyclic Jacobi rotations                     */
+    HHQL,         /* Householder tridiagonalisation + QL         */
+};
+
+// Singular value decomposition computation type
+enum class SVDCompType : int
+{
+    Simple = 0,   /* Closed-form 3x3, one-sided Jacobi otherwise */
+    Jacobi,       /* One-sided Jacobi rotations                  */
+};
+
+// Matrix function [expm/logm] computation type
+enum class MatFuncCompType : int
+{
+    Pade = 0,     /* Scaling and squaring with Pade approximants */
+    Sym,          /* Eigen-decomposition of a symmetric matrix   */
 };
 
 
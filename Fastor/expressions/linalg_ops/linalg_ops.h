@@ -4,8 +4,10 @@
 #include "Fastor/expressions/linalg_ops/linalg_computation_types.h"
 
 #include "Fastor/expressions/linalg_ops/binary_matmul_op.h"
+#include "Fastor/expressions/linalg_ops/binary_trsm_op.h"
 #include "Fastor/expressions/linalg_ops/unary_piv_op.h"
 #include "Fastor/expressions/linalg_ops/unary_lu_op.h"
+#include "Fastor/expressions/linalg_ops/unary_factor_op.h"
 #include "Fastor/expressions/linalg_ops/binary_solve_op.h"
 #include "Fastor/expressions/linalg_ops/unary_trans_op.h"
 #include "Fastor/expressions/linalg_ops/unary_ctrans_op.h"
@@ -15,6 +17,9 @@
 #include "Fastor/expressions/linalg_ops/unary_trace_op.h"
 #include "Fastor/expressions/linalg_ops/unary_norm_op.h"
 #include "Fastor/expressions/linalg_ops/unary_qr_op.h"
+#include "Fastor/expressions/linalg_ops/unary_eigh_op.h"
+#include "Fastor/expressions/linalg_ops/unary_svd_op.h"
+#include "Fastor/expressions/linalg_ops/unary_expm_op.h"
 #include "Fastor/expressions/linalg_ops/unary_det_op.h"
 #include "Fastor/expressions/linalg_ops/binary_cross_op.h"
 
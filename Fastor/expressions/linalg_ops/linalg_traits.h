@@ -59,6 +59,50 @@ static constexpr bool has_binary_matmul_op_v = has_binary_matmul_op<Derived>::va
 //----------------------------------------------------------------------------------------------------------//
 
 
+// Is a lazy einsum expression
+//----------------------------------------------------------------------------------------------------------//
+template<typename Derived>
+struct is_einsum_op {
+    static constexpr bool value = false;
+};
+template<class Index_I, class Index_J, typename TLhs, typename TRhs, size_t DIM>
+struct is_einsum_op<BinaryEinsumOp<Index_I,Index_J,TLhs,TRhs,DIM>> {
+    static constexpr bool value = true;
+};
+template<class Indices, class Operands, size_t DIM>
+struct is_einsum_op<NetworkEinsumOp<Indices,Operands,DIM>> {
+    static constexpr bool value = true;
+};
+
+template<typename Derived>
+struct has_einsum_op {
+    static constexpr bool value = is_einsum_op<Derived>::value ? true : false;
+};
+template<class Index_I, class Index_J, typename TLhs, typename TRhs, size_t DIM>
+struct has_einsum_op<BinaryEinsumOp<Index_I,Index_J,TLhs,TRhs,DIM>> {
+    static constexpr bool value = true;
+};
+template<class Indices, class Operands, size_t DIM>
+struct has_einsum_op<NetworkEinsumOp<Indices,Operands,DIM>> {
+    static constexpr bool value = true;
+};
+template<template<typename,size_t> class UnaryExpr, typename Expr, size_t DIM>
+struct has_einsum_op<UnaryExpr<Expr,DIM>> {
+    static constexpr bool value = has_einsum_op<Expr>::value;
+};
+template<template<class,class,size_t> class BinaryExpr, typename TLhs, typename TRhs, size_t DIMS>
+struct has_einsum_op<BinaryExpr<TLhs,TRhs,DIMS>> {
+    static constexpr bool value = has_einsum_op<TRhs>::value || has_einsum_op<TLhs>::value;
+};
+
+// helper
+template<typename Derived>
+static constexpr bool is_einsum_op_v = is_einsum_op<Derived>::value;
+template<typename Derived>
+static constexpr bool has_einsum_op_v = has_einsum_op<Derived>::value;
+//----------------------------------------------------------------------------------------------------------//
+
+
 // Is unary trans expression
 //----------------------------------------------------------------------------------------------------------//
 template<typename Derived>
@@ -244,7 +288,8 @@ template<typename Derived>
 struct has_linalg_op {
     static constexpr bool value = has_binary_matmul_op<Derived>::value || has_unary_trans_op<Derived>::value  ||
                                   has_unary_ctrans_op<Derived>::value  || has_unary_adj_op<Derived>::value    ||
-                                  has_unary_cof_op<Derived>::value     || has_unary_inv_op<Derived>::value;
+                                  has_unary_cof_op<Derived>::value     || has_unary_inv_op<Derived>::value    ||
+                                  has_einsum_op<Derived>::value;
 };
 
 // helper
@@ -0,0 +1,319 @@
+#ifndef NETWORK_EINSUM_OP_H
+#define NETWORK_EINSUM_OP_H
+
+#include "Fastor/expressions/linalg_ops/binary_einsum_op.h"
+#include "Fastor/tensor_algebra/network_einsum.h"
+#include <tuple>
+
+
+namespace Fastor {
+
+namespace internal {
+#ifndef FASTOR_DONT_PERFORM_OP_MIN
+constexpr size_t einsum_network_max_operands = opmin_dp_max_operands;
+#else
+constexpr size_t einsum_network_max_operands = 8;
+#endif
+} // internal
+
+
+/* A lazy einsum of a network of three or more tensors. Contracted along the same order
+   as einsum of the network [see network_contraction.h] with the last by-pair contraction
+   evaluated directly into the tensor it is assigned to
+*/
+template<class Indices, class Operands, size_t DIM0>
+struct NetworkEinsumOp;
+
+template<class ... Indices, typename ... Operands, size_t DIM0>
+struct NetworkEinsumOp<std::tuple<Indices...>,std::tuple<Operands...>,DIM0>:
+    public AbstractTensor<NetworkEinsumOp<std::tuple<Indices...>,std::tuple<Operands...>,DIM0>,DIM0> {
+    using operands_type = std::tuple<expression_t<Operands>...>;
+    using tensor_types = std::tuple<typename Operands::result_type...>;
+    using scalar_type = typename std::tuple_element<0,tensor_types>::type::scalar_type;
+    using simd_vector_type = typename std::tuple_element<0,tensor_types>::type::simd_vector_type;
+    using simd_abi_type = typename simd_vector_type::abi_type;
+#ifndef FASTOR_DONT_PERFORM_OP_MIN
+    using network_type = network_path_contraction<std::tuple<Indices...>,tensor_types>;
+    using result_type = decltype(network_type::contract(std::declval<const typename Operands::result_type&>()...));
+#else
+    using result_type = decltype(einsum<Indices...>(std::declval<const typename Operands::result_type&>()...));
+#endif
+    using dims_type = typename put_dims_in_Index<result_type>::type;
+    static constexpr FASTOR_INDEX Dimension = DIM0;
+    static constexpr FASTOR_INDEX rank() {return DIM0;}
+
+    FASTOR_INLINE NetworkEinsumOp(const operands_type &inops) : _operands(inops) {
+        static_assert(sizeof...(Operands) <= internal::einsum_network_max_operands, "TOO MANY TENSORS IN NETWORK FOR LAZY EINSUM");
+        static_assert(einsum_index_checker<typename concat_<Indices...>::type>::value,
+                      "INDICES FOR EINSUM FUNCTION CANNOT APPEAR MORE THAN TWICE. USE CONTRACTION INSTEAD");
+    }
+
+    constexpr FASTOR_INLINE FASTOR_INDEX size() const {return result_type::size();}
+    constexpr FASTOR_INLINE FASTOR_INDEX dimension(FASTOR_INDEX i) const {return dims_type::values[i];}
+
+    constexpr FASTOR_INLINE const operands_type& operands() const {return _operands;}
+
+private:
+    operands_type _operands;
+};
+
+template<class Indices, class Operands, size_t DIM0>
+struct scalar_type_finder<NetworkEinsumOp<Indices,Operands,DIM0>> {
+    using type = typename NetworkEinsumOp<Indices,Operands,DIM0>::scalar_type;
+};
+template<class Indices, class Operands, size_t DIM0>
+struct tensor_type_finder<NetworkEinsumOp<Indices,Operands,DIM0>> {
+    using type = typename NetworkEinsumOp<Indices,Operands,DIM0>::result_type;
+};
+
+
+
+namespace internal {
+
+template<typename T, size_t ... Rest, typename ... Exprs>
+FASTOR_INLINE bool einsum_alias_any(const Tensor<T,Rest...> &dst, const Exprs& ... exprs) {
+    const bool aliases[] = {false, einsum_alias(dst,exprs)...};
+    for (bool alias : aliases) {
+        if (alias) return true;
+    }
+    return false;
+}
+
+template<class ... Indices, typename ... Operands, size_t DIM, typename Epilogue, size_t ... ss>
+FASTOR_INLINE void einsum_network_epilogue(typename NetworkEinsumOp<std::tuple<Indices...>,std::tuple<Operands...>,DIM>::scalar_type *out,
+    const NetworkEinsumOp<std::tuple<Indices...>,std::tuple<Operands...>,DIM> &src, const Epilogue &ep, std_ext::index_sequence<ss...>) {
+#ifndef FASTOR_DONT_PERFORM_OP_MIN
+    using network_type = typename NetworkEinsumOp<std::tuple<Indices...>,std::tuple<Operands...>,DIM>::network_type;
+    network_type::contract_epilogue(out,ep,einsum_operand(std::get<ss>(src.operands()).self())...);
+#else
+    using T = typename NetworkEinsumOp<std::tuple<Indices...>,std::tuple<Operands...>,DIM>::scalar_type;
+    using result_type = typename NetworkEinsumOp<std::tuple<Indices...>,std::tuple<Operands...>,DIM>::result_type;
+    const result_type res = einsum<Indices...>(einsum_operand(std::get<ss>(src.operands()).self())...);
+    _apply_epilogue<T,result_type::size()>(res.data(),out,ep);
+#endif
+}
+
+template<typename T, size_t ... Rest, class ... Indices, typename ... Operands, size_t DIM, size_t ... ss>
+FASTOR_INLINE bool einsum_network_alias(const Tensor<T,Rest...> &dst,
+    const NetworkEinsumOp<std::tuple<Indices...>,std::tuple<Operands...>,DIM> &src, std_ext::index_sequence<ss...>) {
+    return einsum_alias_any(dst,std::get<ss>(src.operands()).self()...);
+}
+
+// dst = ep(src). The network is evaluated into a temporary if dst is one of its operands
+template<typename T, size_t ... Rest, class ... Indices, typename ... Operands, size_t DIM, typename Epilogue>
+FASTOR_INLINE void einsum_epilogue_assign(Tensor<T,Rest...> &dst, const NetworkEinsumOp<std::tuple<Indices...>,std::tuple<Operands...>,DIM> &src, const Epilogue &ep) {
+    using result_type = typename NetworkEinsumOp<std::tuple<Indices...>,std::tuple<Operands...>,DIM>::result_type;
+    using seq = typename std_ext::make_index_sequence<sizeof...(Operands)>::type;
+    static_assert(result_type::size() == Tensor<T,Rest...>::size(), "TENSOR SIZE MISMATCH");
+    if (einsum_network_alias(dst,src,seq{})) {
+        Tensor<T,Rest...> tmp;
+        einsum_network_epilogue(tmp.data(),src,ep,seq{});
+        dst = tmp;
+        return;
+    }
+    einsum_network_epilogue(dst.data(),src,ep,seq{});
+}
+
+} // internal
+
+
+
+// assignments
+template<typename T, size_t ... Rest, class Indices, class Operands, size_t DIM>
+FASTOR_INLINE void assign(Tensor<T,Rest...> &dst, const NetworkEinsumOp<Indices,Operands,DIM> &src) {
+    internal::einsum_epilogue_assign(dst,src,internal::matmul_epilogue_identity{});
+}
+template<typename T, size_t ... Rest, class Indices, class Operands, size_t DIM>
+FASTOR_INLINE void assign_add(Tensor<T,Rest...> &dst, const NetworkEinsumOp<Indices,Operands,DIM> &src) {
+    internal::einsum_epilogue_assign(dst,src,internal::matmul_epilogue_axpby<T>{T(1),T(1),dst.data()});
+}
+template<typename T, size_t ... Rest, class Indices, class Operands, size_t DIM>
+FASTOR_INLINE void assign_sub(Tensor<T,Rest...> &dst, const NetworkEinsumOp<Indices,Operands,DIM> &src) {
+    internal::einsum_epilogue_assign(dst,src,internal::matmul_epilogue_axpby<T>{T(-1),T(1),dst.data()});
+}
+template<typename T, size_t ... Rest, class Indices, class Operands, size_t DIM>
+FASTOR_INLINE void assign_mul(Tensor<T,Rest...> &dst, const NetworkEinsumOp<Indices,Operands,DIM> &src) {
+    internal::einsum_epilogue_assign(dst,src,internal::matmul_epilogue_mul<T>{dst.data()});
+}
+template<typename T, size_t ... Rest, class Indices, class Operands, size_t DIM>
+FASTOR_INLINE void assign_div(Tensor<T,Rest...> &dst, const NetworkEinsumOp<Indices,Operands,DIM> &src) {
+    internal::einsum_epilogue_assign(dst,src,internal::matmul_epilogue_div<T>{dst.data()});
+}
+
+// assignments to anything other than a tensor go through the result
+#define FASTOR_MAKE_NETWORK_EINSUM_ASSIGNMENT(ASSIGN_TYPE)\
+template<typename Derived, size_t DIM, class Indices, class Operands, size_t OtherDIM>\
+FASTOR_INLINE void assign ##ASSIGN_TYPE (AbstractTensor<Derived,DIM> &dst, const NetworkEinsumOp<Indices,Operands,OtherDIM> &src) {\
+    using result_type = typename NetworkEinsumOp<Indices,Operands,OtherDIM>::result_type;\
+    const result_type tmp(src);\
+    assign ##ASSIGN_TYPE (dst.self(), tmp);\
+}\
+
+FASTOR_MAKE_NETWORK_EINSUM_ASSIGNMENT(    )
+FASTOR_MAKE_NETWORK_EINSUM_ASSIGNMENT(_add)
+FASTOR_MAKE_NETWORK_EINSUM_ASSIGNMENT(_sub)
+FASTOR_MAKE_NETWORK_EINSUM_ASSIGNMENT(_mul)
+FASTOR_MAKE_NETWORK_EINSUM_ASSIGNMENT(_div)
+
+
+
+
+/* lazy_einsum builds the network of its operands. Operands that are lazy einsums
+   themselves are spliced into the network as long as it does not get larger than
+   einsum_network_max_operands, so a chain of lazy einsums is ordered and contracted as
+   one network instead of pair after pair. The indices of a spliced operand are renamed,
+   its free indices to the indices it is given in the outer einsum and its contracted
+   indices to ones that are not used anywhere else
+*/
+namespace internal {
+
+template<size_t N>
+constexpr size_t einsum_label_count(const std::array<size_t,N> &labels, size_t label) {
+    size_t count = 0;
+    for (size_t i=0; i<N; ++i) {
+        count += labels[i] == label ? 1 : 0;
+    }
+    return count;
+}
+template<size_t N>
+constexpr size_t einsum_no_of_free_labels(const std::array<size_t,N> &labels) {
+    size_t count = 0;
+    for (size_t i=0; i<N; ++i) {
+        count += einsum_label_count(labels,labels[i]) == 1 ? 1 : 0;
+    }
+    return count;
+}
+template<size_t N>
+constexpr size_t einsum_free_label(const std::array<size_t,N> &labels, size_t which) {
+    for (size_t i=0; i<N; ++i) {
+        if (einsum_label_count(labels,labels[i]) == 1) {
+            if (which == 0) return labels[i];
+            --which;
+        }
+    }
+    return 0;
+}
+template<size_t N>
+constexpr size_t einsum_max_label(const std::array<size_t,N> &labels) {
+    size_t max_label = 0;
+    for (size_t i=0; i<N; ++i) {
+        max_label = labels[i] > max_label ? labels[i] : max_label;
+    }
+    return max_label;
+}
+template<size_t N>
+constexpr size_t einsum_relabel(size_t label, const std::array<size_t,N> &free, const std::array<size_t,N> &outer, size_t offset) {
+    for (size_t i=0; i<N; ++i) {
+        if (free[i] == label) return outer[i];
+    }
+    return offset + label;
+}
+
+// The indices that appear once in a network, in the order they appear. These are the
+// indices of its result
+template<class All, class Seq = typename std_ext::make_index_sequence<einsum_no_of_free_labels(All::values)>::type>
+struct einsum_free_labels;
+template<size_t ... All, size_t ... ss>
+struct einsum_free_labels<Index<All...>,std_ext::index_sequence<ss...>> {
+    using type = Index<einsum_free_label(Index<All...>::values,ss)...>;
+};
+
+template<class Idx, class Free, class Outer, size_t Offset>
+struct einsum_relabel_index;
+template<size_t ... Idx, class Free, class Outer, size_t Offset>
+struct einsum_relabel_index<Index<Idx...>,Free,Outer,Offset> {
+    static_assert(Free::Size == Outer::Size, "INDICES FOR LAZY EINSUM OPERAND DO NOT MATCH ITS RANK");
+    using type = Index<einsum_relabel(Idx,Free::values,Outer::values,Offset)...>;
+};
+
+
+// An operand as a network of its own
+template<class Outer, typename Expr, size_t Offset, bool Splice>
+struct einsum_subnetwork {
+    using indices = std::tuple<Outer>;
+    using operands = std::tuple<Expr>;
+    using labels = Index<>;
+    static constexpr size_t size = 1;
+    static FASTOR_INLINE std::tuple<expression_t<Expr>> get(const Expr &expr) {return std::tuple<expression_t<Expr>>(expr);}
+};
+template<class Outer, class Index_I, class Index_J, typename TLhs, typename TRhs, size_t DIM, size_t Offset>
+struct einsum_subnetwork<Outer,BinaryEinsumOp<Index_I,Index_J,TLhs,TRhs,DIM>,Offset,true> {
+    using free = typename einsum_free_labels<typename concat_<Index_I,Index_J>::type>::type;
+    using indices = std::tuple<typename einsum_relabel_index<Index_I,free,Outer,Offset>::type,
+                               typename einsum_relabel_index<Index_J,free,Outer,Offset>::type>;
+    using operands = std::tuple<TLhs,TRhs>;
+    using labels = typename concat_<Index_I,Index_J>::type;
+    static constexpr size_t size = 2;
+    static FASTOR_INLINE std::tuple<expression_t<TLhs>,expression_t<TRhs>> get(const BinaryEinsumOp<Index_I,Index_J,TLhs,TRhs,DIM> &expr) {
+        return std::tuple<expression_t<TLhs>,expression_t<TRhs>>(expr.lhs(),expr.rhs());
+    }
+};
+template<class Outer, class ... Indices, typename ... Operands, size_t DIM, size_t Offset>
+struct einsum_subnetwork<Outer,NetworkEinsumOp<std::tuple<Indices...>,std::tuple<Operands...>,DIM>,Offset,true> {
+    using free = typename einsum_free_labels<typename concat_<Indices...>::type>::type;
+    using indices = std::tuple<typename einsum_relabel_index<Indices,free,Outer,Offset>::type...>;
+    using operands = std::tuple<Operands...>;
+    using labels = typename concat_<Indices...>::type;
+    static constexpr size_t size = sizeof...(Operands);
+    static FASTOR_INLINE std::tuple<expression_t<Operands>...> get(const NetworkEinsumOp<std::tuple<Indices...>,std::tuple<Operands...>,DIM> &expr) {
+        return expr.operands();
+    }
+};
+
+
+template<class Indices, class Operands, size_t DIM, bool IsPair = std::tuple_size<Operands>::value == 2>
+struct lazy_einsum_type {
+    using type = NetworkEinsumOp<Indices,Operands,DIM>;
+    template<class Ops>
+    static FASTOR_INLINE type make(const Ops &ops) {return type(ops);}
+};
+template<class Index_I, class Index_J, typename TLhs, typename TRhs, size_t DIM>
+struct lazy_einsum_type<std::tuple<Index_I,Index_J>,std::tuple<TLhs,TRhs>,DIM,true> {
+    using type = BinaryEinsumOp<Index_I,Index_J,TLhs,TRhs,DIM>;
+    template<class Ops>
+    static FASTOR_INLINE type make(const Ops &ops) {return type(std::get<0>(ops),std::get<1>(ops));}
+};
+
+template<class Indices, class Exprs, class Seq = typename std_ext::make_index_sequence<std::tuple_size<Exprs>::value>::type>
+struct lazy_einsum_network;
+
+template<class ... Indices, typename ... Exprs, size_t ... ks>
+struct lazy_einsum_network<std::tuple<Indices...>,std::tuple<Exprs...>,std_ext::index_sequence<ks...>> {
+    static_assert(sizeof...(Indices)==sizeof...(Exprs), "NUMBER OF INDICES AND OPERANDS FOR LAZY EINSUM DO NOT MATCH");
+
+    static constexpr size_t spliced_size = pack_add<einsum_subnetwork<Indices,Exprs,0,true>::size...>::value;
+    static constexpr bool splice = spliced_size <= einsum_network_max_operands;
+    // renamed indices of operand k start at base + k*stride
+    static constexpr size_t base = einsum_max_label(concat_<Index<>,Indices...>::type::values) + 1;
+    static constexpr size_t stride = einsum_max_label(concat_<Index<>,
+        typename einsum_subnetwork<Indices,Exprs,0,true>::labels...>::type::values) + 1;
+
+    using indices = decltype(std::tuple_cat(std::declval<typename einsum_subnetwork<Indices,Exprs,base+ks*stride,splice>::indices>()...));
+    using operands = decltype(std::tuple_cat(std::declval<typename einsum_subnetwork<Indices,Exprs,base+ks*stride,splice>::operands>()...));
+    using all_indices = typename concat_<Index<>,Indices...>::type;
+    static constexpr size_t rank = einsum_no_of_free_labels(all_indices::values);
+    using builder = lazy_einsum_type<indices,operands,rank>;
+    using type = typename builder::type;
+
+    static FASTOR_INLINE type make(const Exprs & ... exprs) {
+        return builder::make(std::tuple_cat(einsum_subnetwork<Indices,Exprs,base+ks*stride,splice>::get(exprs)...));
+    }
+};
+
+} // internal
+
+
+/* lazy_einsum<Index_I,Index_J,...>(a,b,...) is einsum of any expressions that is not
+   evaluated until it is assigned [see BinaryEinsumOp and NetworkEinsumOp]
+*/
+template<class ... Indices, typename ... Derived, size_t ... DIMS>
+FASTOR_INLINE typename internal::lazy_einsum_network<std::tuple<Indices...>,std::tuple<Derived...>>::type
+lazy_einsum(const AbstractTensor<Derived,DIMS> & ... ops) {
+    static_assert(sizeof...(Derived) >= 2, "LAZY EINSUM NEEDS AT LEAST TWO OPERANDS. USE EINSUM INSTEAD");
+    return internal::lazy_einsum_network<std::tuple<Indices...>,std::tuple<Derived...>>::make(ops.self()...);
+}
+
+} // end of namespace Fastor
+
+
+#endif // NETWORK_EINSUM_OP_H
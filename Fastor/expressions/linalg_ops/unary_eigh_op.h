@@ -0,0 +1,347 @@
+#ifndef UNARY_EIGH_OP_H
+#define UNARY_EIGH_OP_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/backend/eigh.h"
+#include "Fastor/simd_vector/SIMDVector.h"
+#include "Fastor/tensor/AbstractTensor.h"
+#include "Fastor/tensor/Tensor.h"
+#include "Fastor/tensor/TensorTraits.h"
+#include "Fastor/expressions/expression_traits.h"
+#include "Fastor/expressions/linalg_ops/linalg_computation_types.h"
+
+
+namespace Fastor {
+
+namespace internal {
+
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+/* Householder tridiagonalisation followed by the implicit QL algorithm [HHQL]
+   for symmetric matrices of any size. This is derived from the Algol procedures
+   tred2 and tql2 by Bowdler, Martin, Reinsch, and Wilkinson, Handbook for Auto.
+   Comp., Vol.ii-Linear Algebra, and the corresponding Fortran subroutines in
+   EISPACK via JAMA. Only the upper triangular part of A is referenced
+*/
+template<typename T, size_t M>
+FASTOR_HINT_INLINE void eigh_hhql_dispatcher(const Tensor<T,M,M> &A, Tensor<T,M> &w, Tensor<T,M,M> &V) {
+
+    constexpr int n = int(M);
+    T d[M], e[M];
+
+    for (int i=0; i<n; ++i) {
+        for (int j=i; j<n; ++j) {
+            V(i,j) = A(i,j);
+            V(j,i) = A(i,j);
+        }
+    }
+
+    // Householder reduction to tridiagonal form
+    for (int j = 0; j < n; j++) {
+        d[j] = V(n-1,j);
+    }
+    for (int i = n-1; i > 0; i--) {
+        // Scale to avoid under/overflow
+        T scale = 0;
+        T h = 0;
+        for (int k = 0; k < i; k++) {
+            scale += std::abs(d[k]);
+        }
+        if (scale == T(0)) {
+            e[i] = d[i-1];
+            for (int j = 0; j < i; j++) {
+                d[j] = V(i-1,j);
+                V(i,j) = 0;
+                V(j,i) = 0;
+            }
+        }
+        else {
+            // Generate Householder vector
+            for (int k = 0; k < i; k++) {
+                d[k] /= scale;
+                h += d[k] * d[k];
+            }
+            T f = d[i-1];
+            T g = sqrts(h);
+            if (f > 0) {
+                g = -g;
+            }
+            e[i] = scale * g;
+            h = h - f * g;
+            d[i-1] = f - g;
+            for (int j = 0; j < i; j++) {
+                e[j] = 0;
+            }
+
+            // Apply similarity transformation to remaining columns
+            for (int j = 0; j < i; j++) {
+                f = d[j];
+                V(j,i) = f;
+                g = e[j] + V(j,j) * f;
+                for (int k = j+1; k <= i-1; k++) {
+                    g += V(k,j) * d[k];
+                    e[k] += V(k,j) * f;
+                }
+                e[j] = g;
+            }
+            f = 0;
+            for (int j = 0; j < i; j++) {
+                e[j] /= h;
+                f += e[j] * d[j];
+            }
+            const T hh = f / (h + h);
+            for (int j = 0; j < i; j++) {
+                e[j] -= hh * d[j];
+            }
+            for (int j = 0; j < i; j++) {
+                f = d[j];
+                g = e[j];
+                for (int k = j; k <= i-1; k++) {
+                    V(k,j) -= (f * e[k] + g * d[k]);
+                }
+                d[j] = V(i-1,j);
+                V(i,j) = 0;
+            }
+        }
+        d[i] = h;
+    }
+
+    // Accumulate transformations
+    for (int i = 0; i < n-1; i++) {
+        V(n-1,i) = V(i,i);
+        V(i,i) = 1;
+        const T h = d[i+1];
+        if (h != T(0)) {
+            for (int k = 0; k <= i; k++) {
+                d[k] = V(k,i+1) / h;
+            }
+            for (int j = 0; j <= i; j++) {
+                T g = 0;
+                for (int k = 0; k <= i; k++) {
+                    g += V(k,i+1) * V(k,j);
+                }
+                for (int k = 0; k <= i; k++) {
+                    V(k,j) -= g * d[k];
+                }
+            }
+        }
+        for (int k = 0; k <= i; k++) {
+            V(k,i+1) = 0;
+        }
+    }
+    for (int j = 0; j < n; j++) {
+        d[j] = V(n-1,j);
+        V(n-1,j) = 0;
+    }
+    V(n-1,n-1) = 1;
+    e[0] = 0;
+
+    // Symmetric tridiagonal QL
+    for (int i = 1; i < n; i++) {
+        e[i-1] = e[i];
+    }
+    e[n-1] = 0;
+
+    constexpr T eps = std::numeric_limits<T>::epsilon();
+    constexpr int max_iter = 30*n;
+    T f = 0;
+    T tst1 = 0;
+    for (int l = 0; l < n; l++) {
+        // Find small subdiagonal element
+        tst1 = std::max(tst1,std::abs(d[l]) + std::abs(e[l]));
+        int m = l;
+        while (m < n-1) {
+            if (std::abs(e[m]) <= eps*tst1) {
+                break;
+            }
+            m++;
+        }
+
+        // If m == l, d[l] is an eigenvalue, otherwise iterate
+        if (m > l) {
+            int iter = 0;
+            do {
+                iter++;
+                // Compute implicit shift
+                T g = d[l];
+                T p = (d[l+1] - g) / (T(2) * e[l]);
+                T r = std::hypot(p,T(1));
+                if (p < 0) {
+                    r = -r;
+                }
+                d[l] = e[l] / (p + r);
+                d[l+1] = e[l] * (p + r);
+                const T dl1 = d[l+1];
+                T h = g - d[l];
+                for (int i = l+2; i < n; i++) {
+                    d[i] -= h;
+                }
+                f += h;
+
+                // Implicit QL transformation
+                p = d[m];
+                T c = 1;
+                T c2 = c;
+                T c3 = c;
+                const T el1 = e[l+1];
+                T s = 0;
+                T s2 = 0;
+                for (int i = m-1; i >= l; i--) {
+                    c3 = c2;
+                    c2 = c;
+                    s2 = s;
+                    g = c * e[i];
+                    h = c * p;
+                    r = std::hypot(p,e[i]);
+                    e[i+1] = s * r;
+                    s = e[i] / r;
+                    c = p / r;
+                    p = c * d[i] - s * g;
+                    d[i+1] = h + s * (c * g + s * d[i]);
+
+                    // Accumulate transformation
+                    for (int k = 0; k < n; k++) {
+                        h = V(k,i+1);
+                        V(k,i+1) = s * V(k,i) + c * h;
+                        V(k,i) = c * V(k,i) - s * h;
+                    }
+                }
+                p = -s * s2 * c3 * el1 * e[l] / dl1;
+                e[l] = s * p;
+                d[l] = c * p;
+
+            // Check for convergence
+            } while (std::abs(e[l]) > eps*tst1 && iter < max_iter);
+        }
+        d[l] = d[l] + f;
+        e[l] = 0;
+    }
+
+    // Sort eigenvalues and corresponding vectors
+    for (int i = 0; i < n-1; i++) {
+        int k = i;
+        T p = d[i];
+        for (int j = i+1; j < n; j++) {
+            if (d[j] < p) {
+                k = j;
+                p = d[j];
+            }
+        }
+        if (k != i) {
+            d[k] = d[i];
+            d[i] = p;
+            for (int j = 0; j < n; j++) {
+                p = V(j,i);
+                V(j,i) = V(j,k);
+                V(j,k) = p;
+            }
+        }
+    }
+
+    for (int i = 0; i < n; i++) {
+        w(i) = d[i];
+    }
+}
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+
+
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+template<EigCompType EigType, typename T, size_t M,
+    enable_if_t_<EigType == EigCompType::Jacobi,bool> = false>
+FASTOR_INLINE void eigh_dispatcher(const Tensor<T,M,M> &A, Tensor<T,M> &w, Tensor<T,M,M> &V) {
+    _eigh_jacobi<T,M>(A.data(),w.data(),V.data());
+}
+
+template<EigCompType EigType, typename T, size_t M,
+    enable_if_t_<EigType == EigCompType::HHQL || (EigType == EigCompType::Simple && is_greater_v_<M,3>),bool> = false>
+FASTOR_INLINE void eigh_dispatcher(const Tensor<T,M,M> &A, Tensor<T,M> &w, Tensor<T,M,M> &V) {
+    eigh_hhql_dispatcher(A,w,V);
+}
+
+template<EigCompType EigType, typename T, size_t M,
+    enable_if_t_<EigType == EigCompType::Simple && is_less_equal_v_<M,3>,bool> = false>
+FASTOR_INLINE void eigh_dispatcher(const Tensor<T,M,M> &A, Tensor<T,M> &w, Tensor<T,M,M> &V) {
+    _eigh<T,M>(A.data(),w.data(),V.data());
+}
+
+template<EigCompType EigType, typename T, size_t M,
+    enable_if_t_<EigType == EigCompType::Simple && is_less_equal_v_<M,3>,bool> = false>
+FASTOR_INLINE void eigh_batch_dispatcher(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT w, T *FASTOR_RESTRICT v, size_t nbatch) {
+    _eigh_batch<T,M>(a,w,v,nbatch);
+}
+template<EigCompType EigType, typename T, size_t M,
+    enable_if_t_<!(EigType == EigCompType::Simple && is_less_equal_v_<M,3>),bool> = false>
+FASTOR_INLINE void eigh_batch_dispatcher(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT w, T *FASTOR_RESTRICT v, size_t nbatch) {
+    Tensor<T,M> wi;
+    Tensor<T,M,M> vi;
+    for (size_t k=0; k<nbatch; ++k) {
+        const Tensor<T,M,M> ai = TensorMap<const T,M,M>(a+k*M*M);
+        eigh_dispatcher<EigType>(ai,wi,vi);
+        std::copy(wi.data(),wi.data()+M,w+k*M);
+        std::copy(vi.data(),vi.data()+M*M,v+k*M*M);
+    }
+}
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+
+} // internal
+
+
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+// Symmetric eigen-decomposition A = V * diag(w) * V^T with the eigenvalues
+// w sorted in ascending order and the eigenvectors stored as the columns of V.
+// Only the upper triangular part of A is referenced
+template<EigCompType EigType = EigCompType::Simple, typename Expr, size_t DIM0, typename T, size_t M,
+    enable_if_t_<is_tensor_v<Expr>,bool> = false>
+FASTOR_INLINE
+void
+eigh(const AbstractTensor<Expr,DIM0> &src, Tensor<T,M> &w, Tensor<T,M,M> &V) {
+    static_assert(std::is_floating_point<T>::value, "EIGEN-DECOMPOSITION IS ONLY SUPPORTED FOR FLOATING POINT TENSORS");
+    internal::eigh_dispatcher<EigType>(src.self(),w,V);
+}
+
+template<EigCompType EigType = EigCompType::Simple, typename Expr, size_t DIM0, typename T, size_t M,
+    enable_if_t_<!is_tensor_v<Expr>,bool> = false>
+FASTOR_INLINE
+void
+eigh(const AbstractTensor<Expr,DIM0> &src, Tensor<T,M> &w, Tensor<T,M,M> &V) {
+    static_assert(std::is_floating_point<T>::value, "EIGEN-DECOMPOSITION IS ONLY SUPPORTED FOR FLOATING POINT TENSORS");
+    typename Expr::result_type A(src.self());
+    internal::eigh_dispatcher<EigType>(A,w,V);
+}
+
+
+// For high order tensors - batch of matrices stored in the last two dimensions.
+// The closed-form 2x2/3x3 kernels are vectorised across the matrices
+template<EigCompType EigType = EigCompType::Simple,
+    typename T, size_t ... Rest, enable_if_t_<sizeof...(Rest)>=3,bool> = false>
+FASTOR_INLINE
+void
+eigh(const Tensor<T,Rest...> &A,
+    typename last_matrix_extracter<Tensor<T,Rest...>, typename std_ext::make_index_sequence<sizeof...(Rest)-1>::type>::type &w,
+    Tensor<T,Rest...> &V) {
+
+    static_assert(std::is_floating_point<T>::value, "EIGEN-DECOMPOSITION IS ONLY SUPPORTED FOR FLOATING POINT TENSORS");
+    constexpr size_t remaining_product = last_matrix_extracter<Tensor<T,Rest...>,
+        typename std_ext::make_index_sequence<sizeof...(Rest)-2>::type>::remaining_product;
+
+    constexpr size_t I = get_value<sizeof...(Rest)-1,Rest...>::value;
+    constexpr size_t J = get_value<sizeof...(Rest),Rest...>::value;
+    static_assert(I==J,"THE LAST TWO DIMENSIONS OF TENSOR MUST BE THE SAME");
+
+    const T *a_data = A.data();
+    T *w_data = w.data();
+    T *v_data = V.data();
+
+    internal::eigh_batch_dispatcher<EigType,T,J>(a_data,w_data,v_data,remaining_product);
+}
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+
+} // end of namespace Fastor
+
+
+#endif // UNARY_EIGH_OP_H
@@ -0,0 +1,206 @@
+#ifndef UNARY_EXPM_OP_H
+#define UNARY_EXPM_OP_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/backend/expm.h"
+#include "Fastor/backend/eigh.h"
+#include "Fastor/tensor/AbstractTensor.h"
+#include "Fastor/tensor/Tensor.h"
+#include "Fastor/tensor/TensorTraits.h"
+#include "Fastor/expressions/expression_traits.h"
+#include "Fastor/expressions/linalg_ops/linalg_computation_types.h"
+#include "Fastor/expressions/linalg_ops/unary_eigh_op.h"
+#include <algorithm>
+#include <cmath>
+
+
+namespace Fastor {
+
+namespace internal {
+
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+/* out = V * diag(f(w)) * V^T for the eigenpairs of a symmetric matrix. The function
+   values are expected to have been applied to w already
+*/
+template<typename T, size_t M>
+FASTOR_INLINE void sym_function_reconstruct(const T *FASTOR_RESTRICT w, const T *FASTOR_RESTRICT v, T *FASTOR_RESTRICT out) {
+    for (size_t i=0; i<M; ++i) {
+        for (size_t j=i; j<M; ++j) {
+            T acc = 0;
+            for (size_t k=0; k<M; ++k) {
+                acc += v[i*M+k]*w[k]*v[j*M+k];
+            }
+            out[i*M+j] = acc;
+            out[j*M+i] = acc;
+        }
+    }
+}
+
+template<typename T>
+FASTOR_INLINE void sym_exp_eigenvalues(T *w, size_t n) {
+    for (size_t i=0; i<n; ++i) w[i] = std::exp(w[i]);
+}
+template<typename T>
+FASTOR_INLINE void sym_log_eigenvalues(T *w, size_t n) {
+    for (size_t i=0; i<n; ++i) {
+        FASTOR_ASSERT(w[i] > T(0), "LOGARITHM OF A MATRIX WITH NON-POSITIVE EIGENVALUES IS NOT DEFINED");
+        w[i] = std::log(w[i]);
+    }
+}
+
+template<MatFuncCompType FType, typename T, size_t M,
+    enable_if_t_<FType == MatFuncCompType::Pade,bool> = false>
+FASTOR_INLINE void expm_dispatcher(const Tensor<T,M,M> &A, Tensor<T,M,M> &out) {
+    _expm<T,M>(A.data(),out.data());
+}
+template<MatFuncCompType FType, typename T, size_t M,
+    enable_if_t_<FType == MatFuncCompType::Sym,bool> = false>
+FASTOR_INLINE void expm_dispatcher(const Tensor<T,M,M> &A, Tensor<T,M,M> &out) {
+    Tensor<T,M> w;
+    Tensor<T,M,M> V;
+    eigh_dispatcher<EigCompType::Simple>(A,w,V);
+    sym_exp_eigenvalues(w.data(),M);
+    sym_function_reconstruct<T,M>(w.data(),V.data(),out.data());
+}
+
+template<MatFuncCompType FType, typename T, size_t M>
+FASTOR_INLINE void logm_dispatcher(const Tensor<T,M,M> &A, Tensor<T,M,M> &out) {
+    Tensor<T,M> w;
+    Tensor<T,M,M> V;
+    eigh_dispatcher<EigCompType::Simple>(A,w,V);
+    sym_log_eigenvalues(w.data(),M);
+    sym_function_reconstruct<T,M>(w.data(),V.data(),out.data());
+}
+
+/* Batches of symmetric 2x2/3x3 matrices use the eigen-decomposition vectorised across
+   the batch, processed in chunks so that the eigenpairs stay on the stack
+*/
+template<MatFuncCompType FType, typename T, size_t M, typename Fun,
+    enable_if_t_<FType == MatFuncCompType::Sym && is_less_equal_v_<M,3>,bool> = false>
+FASTOR_INLINE void sym_function_batch(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT out, size_t nbatch, Fun f) {
+    constexpr size_t chunk = 64;
+    T w[chunk*M], v[chunk*M*M];
+    for (size_t k0=0; k0<nbatch; k0+=chunk) {
+        const size_t n = std::min(chunk,nbatch-k0);
+        _eigh_batch<T,M>(&a[k0*M*M],w,v,n);
+        f(w,n*M);
+        for (size_t k=0; k<n; ++k) {
+            sym_function_reconstruct<T,M>(&w[k*M],&v[k*M*M],&out[(k0+k)*M*M]);
+        }
+    }
+}
+template<MatFuncCompType FType, typename T, size_t M, typename Fun,
+    enable_if_t_<!(FType == MatFuncCompType::Sym && is_less_equal_v_<M,3>),bool> = false>
+FASTOR_INLINE void sym_function_batch(const T *FASTOR_RESTRICT a, T *FASTOR_RESTRICT out, size_t nbatch, Fun f) {
+    Tensor<T,M,M> A;
+    Tensor<T,M> w;
+    Tensor<T,M,M> V;
+    for (size_t k=0; k<nbatch; ++k) {
+        std::copy(a+k*M*M,a+(k+1)*M*M,A.data());
+        eigh_dispatcher<EigCompType::Simple>(A,w,V);
+        f(w.data(),M);
+        sym_function_reconstruct<T,M>(w.data(),V.data(),&out[k*M*M]);
+    }
+}
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+
+} // internal
+
+
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+// Matrix exponential. The default computes the exponential of a general square matrix
+// by scaling and squaring with Pade approximants [MatFuncCompType::Pade]. For symmetric
+// matrices [MatFuncCompType::Sym] it is evaluated on the eigenvalues, in closed-form
+// for 2x2/3x3 and only the upper triangular part of A is referenced
+template<MatFuncCompType FType = MatFuncCompType::Pade, typename T, size_t M>
+FASTOR_INLINE Tensor<T,M,M> expm(const Tensor<T,M,M> &A) {
+    static_assert(std::is_floating_point<T>::value, "MATRIX EXPONENTIAL IS ONLY SUPPORTED FOR FLOATING POINT TENSORS");
+    Tensor<T,M,M> out;
+    internal::expm_dispatcher<FType>(A,out);
+    return out;
+}
+
+// Matrix logarithm of a symmetric positive definite matrix [MatFuncCompType::Sym]
+// e.g. the Hencky strain from the right Cauchy-Green tensor 0.5*logm(C).
+// Only the upper triangular part of A is referenced
+template<MatFuncCompType FType = MatFuncCompType::Sym, typename T, size_t M>
+FASTOR_INLINE Tensor<T,M,M> logm(const Tensor<T,M,M> &A) {
+    static_assert(std::is_floating_point<T>::value, "MATRIX LOGARITHM IS ONLY SUPPORTED FOR FLOATING POINT TENSORS");
+    static_assert(FType == MatFuncCompType::Sym, "MATRIX LOGARITHM IS ONLY SUPPORTED FOR SYMMETRIC POSITIVE DEFINITE MATRICES");
+    Tensor<T,M,M> out;
+    internal::logm_dispatcher<FType>(A,out);
+    return out;
+}
+
+template<MatFuncCompType FType = MatFuncCompType::Pade, typename Expr, size_t DIM0,
+    enable_if_t_<!is_tensor_v<Expr> && DIM0==2,bool> = false>
+FASTOR_INLINE typename Expr::result_type expm(const AbstractTensor<Expr,DIM0> &src) {
+    const typename Expr::result_type A(src.self());
+    return expm<FType>(A);
+}
+
+template<MatFuncCompType FType = MatFuncCompType::Sym, typename Expr, size_t DIM0,
+    enable_if_t_<!is_tensor_v<Expr> && DIM0==2,bool> = false>
+FASTOR_INLINE typename Expr::result_type logm(const AbstractTensor<Expr,DIM0> &src) {
+    const typename Expr::result_type A(src.self());
+    return logm<FType>(A);
+}
+
+
+// For high order tensors - batch of matrices stored in the last two dimensions
+template<MatFuncCompType FType = MatFuncCompType::Pade,
+    typename T, size_t ... Rest, enable_if_t_<sizeof...(Rest)>=3,bool> = false>
+FASTOR_INLINE Tensor<T,Rest...> expm(const Tensor<T,Rest...> &A) {
+
+    static_assert(std::is_floating_point<T>::value, "MATRIX EXPONENTIAL IS ONLY SUPPORTED FOR FLOATING POINT TENSORS");
+    constexpr size_t remaining_product = last_matrix_extracter<Tensor<T,Rest...>,
+        typename std_ext::make_index_sequence<sizeof...(Rest)-2>::type>::remaining_product;
+
+    constexpr size_t I = get_value<sizeof...(Rest)-1,Rest...>::value;
+    constexpr size_t J = get_value<sizeof...(Rest),Rest...>::value;
+    static_assert(I==J,"THE LAST TWO DIMENSIONS OF TENSOR MUST BE THE SAME");
+
+    Tensor<T,Rest...> out;
+    const T *a_data = A.data();
+    T *out_data = out.data();
+
+    FASTOR_IF_CONSTEXPR(FType == MatFuncCompType::Pade) {
+        for (size_t i=0; i<remaining_product; ++i) {
+            _expm<T,J>(a_data+i*J*J,out_data+i*J*J);
+        }
+    }
+    else {
+        internal::sym_function_batch<FType,T,J>(a_data,out_data,remaining_product,
+            [](T *w, size_t n) { internal::sym_exp_eigenvalues(w,n); });
+    }
+    return out;
+}
+
+template<MatFuncCompType FType = MatFuncCompType::Sym,
+    typename T, size_t ... Rest, enable_if_t_<sizeof...(Rest)>=3,bool> = false>
+FASTOR_INLINE Tensor<T,Rest...> logm(const Tensor<T,Rest...> &A) {
+
+    static_assert(std::is_floating_point<T>::value, "MATRIX LOGARITHM IS ONLY SUPPORTED FOR FLOATING POINT TENSORS");
+    static_assert(FType == MatFuncCompType::Sym, "MATRIX LOGARITHM IS ONLY SUPPORTED FOR SYMMETRIC POSITIVE DEFINITE MATRICES");
+    constexpr size_t remaining_product = last_matrix_extracter<Tensor<T,Rest...>,
+        typename std_ext::make_index_sequence<sizeof...(Rest)-2>::type>::remaining_product;
+
+    constexpr size_t I = get_value<sizeof...(Rest)-1,Rest...>::value;
+    constexpr size_t J = get_value<sizeof...(Rest),Rest...>::value;
+    static_assert(I==J,"THE LAST TWO DIMENSIONS OF TENSOR MUST BE THE SAME");
+
+    Tensor<T,Rest...> out;
+    internal::sym_function_batch<FType,T,J>(A.data(),out.data(),remaining_product,
+        [](T *w, size_t n) { internal::sym_log_eigenvalues(w,n); });
+    return out;
+}
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+
+} // end of namespace Fastor
+
+
+#endif // UNARY_EXPM_OP_H
@@ -0,0 +1,545 @@
+#ifndef UNARY_FACTOR_OP_H
+#define UNARY_FACTOR_OP_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/backend/lufact_blocked.h"
+#include "Fastor/backend/cholfact.h"
+#include "Fastor/backend/trsm.h"
+#include "Fastor/tensor/AbstractTensor.h"
+#include "Fastor/tensor/Tensor.h"
+#include "Fastor/tensor/TensorTraits.h"
+#include "Fastor/expressions/expression_traits.h"
+#include "Fastor/expressions/linalg_ops/linalg_computation_types.h"
+#include "Fastor/expressions/linalg_ops/unary_piv_op.h"
+#include "Fastor/expressions/linalg_ops/binary_matmul_op.h"
+#include <complex>
+#include <limits>
+
+
+namespace Fastor {
+
+// Factorisation objects - the factors of a matrix are computed once and held in packed form so
+// that they can be reused for any number of subsequent solves, each costing O(N^2)
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+namespace internal {
+
+/* 1-norm of a matrix i.e. the maximum absolute column sum */
+template<typename T, size_t M, typename R = remove_all_t<decltype(std::abs(T()))>>
+FASTOR_INLINE R matrix_norm1(const Tensor<T,M,M> &A) {
+    using std::abs;
+    Tensor<R,M> colsum(0);
+    for (size_t i=0; i<M; ++i) {
+        for (size_t j=0; j<M; ++j) {
+            colsum(j) += abs(A(i,j));
+        }
+    }
+    R value = 0;
+    for (size_t j=0; j<M; ++j) {
+        value = colsum(j) > value ? colsum(j) : value;
+    }
+    return value;
+}
+
+/* Sign of x for the estimator below - x/|x| for complex values [LAPACK's zlacn2] */
+template<typename T, enable_if_t_<!is_complex_v_<T>,bool> = false>
+FASTOR_INLINE T norm1_sign(const T &x) {return x >= T(0) ? T(1) : T(-1);}
+template<typename T, enable_if_t_<is_complex_v_<T>,bool> = false>
+FASTOR_INLINE T norm1_sign(const T &x) {return std::abs(x) == 0 ? T(1) : x / std::abs(x);}
+template<typename T, enable_if_t_<!is_complex_v_<T>,bool> = false>
+FASTOR_INLINE T norm1_conj(const T &x) {return x;}
+template<typename T, enable_if_t_<is_complex_v_<T>,bool> = false>
+FASTOR_INLINE T norm1_conj(const T &x) {return std::conj(x);}
+
+/* Estimate of the 1-norm of A^(-1) given a factorisation F of A that can solve with both A and A^T.
+   This is Higham's refinement of Hager's method [LAPACK's xLACN2] - a few steps of a gradient
+   ascent over the unit 1-norm ball followed by a test against an alternating sign vector, which
+   guards against the cases where the ascent converges to a poor local maximum. The estimate never
+   exceeds the exact value and is almost always within a factor of 3 of it. For complex matrices
+   the ascent direction needs A^H which is solved for as conj(A^T) on the conjugated sign vector
+*/
+template<typename T, size_t M, typename Factor, typename R = remove_all_t<decltype(std::abs(T()))>>
+FASTOR_INLINE R inverse_norm1_estimate(const Factor &F) {
+    using std::abs;
+    constexpr size_t max_iter = 5;
+
+    Tensor<T,M> x(T(1)/T(M));
+    F.solve_inplace(x);
+    FASTOR_IF_CONSTEXPR(M==1) return abs(x(0));
+
+    R estimate = 0;
+    Tensor<T,M> xi;
+    for (size_t i=0; i<M; ++i) {
+        estimate += abs(x(i));
+        xi(i) = norm1_sign(x(i));
+    }
+
+    auto argmax_abs = [](const Tensor<T,M> &z) {
+        size_t j = 0;
+        for (size_t i=1; i<M; ++i) {
+            if (abs(z(i)) > abs(z(j))) j = i;
+        }
+        return j;
+    };
+
+    Tensor<T,M> z;
+    for (size_t i=0; i<M; ++i) z(i) = norm1_conj(xi(i));
+    F.solve_transpose_inplace(z);
+    size_t j = argmax_abs(z);
+
+    for (size_t iter=1; iter<max_iter; ++iter) {
+        x.zeros();
+        x(j) = T(1);
+        F.solve_inplace(x);
+
+        const R estimate_old = estimate;
+        estimate = 0;
+        bool repeated = true;
+        for (size_t i=0; i<M; ++i) {
+            estimate += abs(x(i));
+            const T sign = norm1_sign(x(i));
+            repeated = repeated && sign == xi(i);
+            xi(i) = sign;
+        }
+        // Converged - the sign vector repeats or the estimate stopped increasing
+        if (repeated || estimate <= estimate_old) {
+            estimate = estimate > estimate_old ? estimate : estimate_old;
+            break;
+        }
+
+        for (size_t i=0; i<M; ++i) z(i) = norm1_conj(xi(i));
+        F.solve_transpose_inplace(z);
+        const size_t jlast = j;
+        j = argmax_abs(z);
+        if (abs(z(jlast)) == abs(z(j))) break;
+    }
+
+    // Alternating sign vector test
+    for (size_t i=0; i<M; ++i) {
+        x(i) = (i % 2 == 0 ? T(1) : T(-1)) * (T(1) + T(R(i) / R(M-1)));
+    }
+    F.solve_inplace(x);
+    R altsum = 0;
+    for (size_t i=0; i<M; ++i) {
+        altsum += abs(x(i));
+    }
+    altsum = R(2) * altsum / R(3*M);
+    return altsum > estimate ? altsum : estimate;
+}
+
+/* Adapter to estimate the condition number from the unpacked outputs of lu */
+template<typename T, size_t M>
+struct lu_factors_ref {
+    const Tensor<T,M,M> &L;
+    const Tensor<T,M,M> &U;
+    const Tensor<size_t,M> *p;
+
+    FASTOR_INLINE void solve_inplace(Tensor<T,M> &b) const {
+        if (p) {
+            const Tensor<T,M> tmp(b);
+            for (size_t i=0; i<M; ++i) {
+                b(i) = tmp((*p)(i));
+            }
+        }
+        _trsv<T,M,UpLoType::UniLower>(L.data(),b.data());
+        _trsv<T,M,UpLoType::Upper>(U.data(),b.data());
+    }
+    FASTOR_INLINE void solve_transpose_inplace(Tensor<T,M> &b) const {
+        _trsv_trans<T,M,UpLoType::Upper>(U.data(),b.data());
+        _trsv_trans<T,M,UpLoType::UniLower>(L.data(),b.data());
+        if (p) {
+            const Tensor<T,M> tmp(b);
+            for (size_t i=0; i<M; ++i) {
+                b((*p)(i)) = tmp(i);
+            }
+        }
+    }
+};
+
+} // internal
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+
+
+
+
+/* LU factorisation with partial pivoting P * A = L * U held in packed form */
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+template<typename T, size_t M>
+class LUFactor {
+public:
+    using scalar_type = T;
+
+    LUFactor() = default;
+    LUFactor(const Tensor<T,M,M> &A) { factorise(A); }
+    template<typename Derived, size_t DIM, enable_if_t_<!is_tensor_v<Derived>,bool> = false>
+    LUFactor(const AbstractTensor<Derived,DIM> &src) { factorise(Tensor<T,M,M>(src.self())); }
+
+    // (Re-)factorise
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE void factorise(const Tensor<T,M,M> &A) {
+        _LU = A;
+        _anorm = internal::matrix_norm1(A);
+        _lufact_blocked<T,M>(_LU.data(),_perm.data());
+        _info = 0;
+        for (size_t i=0; i<M; ++i) {
+            if (_LU(i,i) == T(0)) {
+                _info = i+1;
+                break;
+            }
+        }
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Solve A * x = b
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE void solve_inplace(Tensor<T,M> &b) const {
+        const Tensor<T,M> tmp(b);
+        for (size_t i=0; i<M; ++i) {
+            b(i) = tmp(_perm(i));
+        }
+        _trsv<T,M,UpLoType::UniLower>(_LU.data(),b.data());
+        _trsv<T,M,UpLoType::Upper>(_LU.data(),b.data());
+    }
+    template<size_t N>
+    FASTOR_INLINE void solve_inplace(Tensor<T,M,N> &B) const {
+        apply_pivot_inplace(B,_perm);
+        _trsm<T,M,N,UpLoType::UniLower>(_LU.data(),B.data());
+        _trsm<T,M,N,UpLoType::Upper>(_LU.data(),B.data());
+    }
+    template<size_t ... Rest>
+    FASTOR_INLINE Tensor<T,Rest...> solve(const Tensor<T,Rest...> &b) const {
+        Tensor<T,Rest...> x(b);
+        solve_inplace(x);
+        return x;
+    }
+    template<typename Derived, size_t DIM, enable_if_t_<!is_tensor_v<Derived>,bool> = false>
+    FASTOR_INLINE typename Derived::result_type solve(const AbstractTensor<Derived,DIM> &b) const {
+        typename Derived::result_type x(b.self());
+        solve_inplace(x);
+        return x;
+    }
+
+    // Solve A^T * x = b
+    FASTOR_INLINE void solve_transpose_inplace(Tensor<T,M> &b) const {
+        _trsv_trans<T,M,UpLoType::Upper>(_LU.data(),b.data());
+        _trsv_trans<T,M,UpLoType::UniLower>(_LU.data(),b.data());
+        const Tensor<T,M> tmp(b);
+        for (size_t i=0; i<M; ++i) {
+            b(_perm(i)) = tmp(i);
+        }
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Properties of A
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE T determinant() const {
+        T value = T(internal::permutation_sign(_perm));
+        for (size_t i=0; i<M; ++i) {
+            value *= _LU(i,i);
+        }
+        return value;
+    }
+    /* Reciprocal condition number of A in the 1-norm [estimate]. Returns 0 for exactly singular matrices */
+    FASTOR_INLINE remove_all_t<decltype(std::abs(T()))> rcond() const {
+        using R = remove_all_t<decltype(std::abs(T()))>;
+        if (_info != 0 || _anorm == 0) return R(0);
+        return R(1) / (_anorm * internal::inverse_norm1_estimate<T,M>(*this));
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Access to the factors
+    //----------------------------------------------------------------------------------------------------------//
+    /* The packed factors - strictly lower part of L [with implicit unit diagonal] and upper part of U */
+    FASTOR_INLINE const Tensor<T,M,M>& factors() const { return _LU; }
+    /* The permutation vector - row i of P * A is row perm(i) of A */
+    FASTOR_INLINE const Tensor<size_t,M>& pivots() const { return _perm; }
+    /* Zero if the factorisation is non-singular, otherwise k+1 if U(k,k) is exactly zero */
+    FASTOR_INLINE size_t info() const { return _info; }
+    //----------------------------------------------------------------------------------------------------------//
+
+private:
+    Tensor<T,M,M> _LU;
+    Tensor<size_t,M> _perm;
+    remove_all_t<decltype(std::abs(T()))> _anorm = 0;
+    size_t _info = 0;
+};
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+
+
+
+
+/* Cholesky factorisation A = L * L^T of a symmetric positive definite matrix held in packed form */
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+template<typename T, size_t M>
+class CholeskyFactor {
+public:
+    using scalar_type = T;
+    static_assert(!is_complex_v_<T>, "CHOLESKY FACTORISATION IS ONLY AVAILABLE FOR REAL MATRICES");
+
+    CholeskyFactor() = default;
+    CholeskyFactor(const Tensor<T,M,M> &A) { factorise(A); }
+    template<typename Derived, size_t DIM, enable_if_t_<!is_tensor_v<Derived>,bool> = false>
+    CholeskyFactor(const AbstractTensor<Derived,DIM> &src) { factorise(Tensor<T,M,M>(src.self())); }
+
+    // (Re-)factorise - only the lower triangle of A is referenced. Check info() for
+    // whether A is positive definite, the factors are incomplete if it is not
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE void factorise(const Tensor<T,M,M> &A) {
+        _L = A;
+        _anorm = internal::matrix_norm1(A);
+        _info = _cholfact<T,M>(_L.data());
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Solve A * x = b
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE void solve_inplace(Tensor<T,M> &b) const {
+        _trsv<T,M,UpLoType::Lower>(_L.data(),b.data());
+        _trsv_trans<T,M,UpLoType::Lower>(_L.data(),b.data());
+    }
+    template<size_t N>
+    FASTOR_INLINE void solve_inplace(Tensor<T,M,N> &B) const {
+        _trsm<T,M,N,UpLoType::Lower>(_L.data(),B.data());
+        _trsm_trans<T,M,N,UpLoType::Lower>(_L.data(),B.data());
+    }
+    template<size_t ... Rest>
+    FASTOR_INLINE Tensor<T,Rest...> solve(const Tensor<T,Rest...> &b) const {
+        Tensor<T,Rest...> x(b);
+        solve_inplace(x);
+        return x;
+    }
+    template<typename Derived, size_t DIM, enable_if_t_<!is_tensor_v<Derived>,bool> = false>
+    FASTOR_INLINE typename Derived::result_type solve(const AbstractTensor<Derived,DIM> &b) const {
+        typename Derived::result_type x(b.self());
+        solve_inplace(x);
+        return x;
+    }
+
+    // A is symmetric
+    FASTOR_INLINE void solve_transpose_inplace(Tensor<T,M> &b) const {
+        solve_inplace(b);
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Properties of A
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE T determinant() const {
+        T value = 1;
+        for (size_t i=0; i<M; ++i) {
+            value *= _L(i,i);
+        }
+        return value*value;
+    }
+    /* Reciprocal condition number of A in the 1-norm [estimate]. Returns 0 if A is not positive definite */
+    FASTOR_INLINE T rcond() const {
+        if (_info != 0 || _anorm == 0) return T(0);
+        return T(1) / (_anorm * internal::inverse_norm1_estimate<T,M>(*this));
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Access to the factors
+    //----------------------------------------------------------------------------------------------------------//
+    /* The packed factor - lower part holds L, the strictly upper part is not referenced */
+    FASTOR_INLINE const Tensor<T,M,M>& factors() const { return _L; }
+    /* Zero if A is positive definite, otherwise k+1 if the leading minor of order k+1 is not */
+    FASTOR_INLINE size_t info() const { return _info; }
+    //----------------------------------------------------------------------------------------------------------//
+
+private:
+    Tensor<T,M,M> _L;
+    T _anorm = 0;
+    size_t _info = 0;
+};
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+
+
+
+
+// Factorise functions
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+template<typename T, size_t M>
+FASTOR_INLINE LUFactor<T,M> lu_factor(const Tensor<T,M,M> &A) {
+    return LUFactor<T,M>(A);
+}
+template<typename Expr, size_t DIM0, enable_if_t_<!is_tensor_v<Expr> && DIM0==2,bool> = false>
+FASTOR_INLINE LUFactor<typename Expr::scalar_type,get_tensor_dimension_v<0,typename Expr::result_type>>
+lu_factor(const AbstractTensor<Expr,DIM0> &src) {
+    const typename Expr::result_type A(src.self());
+    return lu_factor(A);
+}
+
+template<typename T, size_t M>
+FASTOR_INLINE CholeskyFactor<T,M> cholesky_factor(const Tensor<T,M,M> &A) {
+    return CholeskyFactor<T,M>(A);
+}
+template<typename Expr, size_t DIM0, enable_if_t_<!is_tensor_v<Expr> && DIM0==2,bool> = false>
+FASTOR_INLINE CholeskyFactor<typename Expr::scalar_type,get_tensor_dimension_v<0,typename Expr::result_type>>
+cholesky_factor(const AbstractTensor<Expr,DIM0> &src) {
+    const typename Expr::result_type A(src.self());
+    return cholesky_factor(A);
+}
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+
+
+
+
+// Condition number estimate
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+/* Reciprocal condition number of A in the 1-norm [estimate] from the outputs of lu. A value close to
+   machine epsilon or below means that solve and inverse results for A cannot be trusted */
+template<typename T, size_t M, typename R = remove_all_t<decltype(std::abs(T()))>>
+FASTOR_INLINE R rcond(const Tensor<T,M,M> &A, const Tensor<T,M,M> &L, const Tensor<T,M,M> &U, const Tensor<size_t,M> &p) {
+    const R anorm = internal::matrix_norm1(A);
+    for (size_t i=0; i<M; ++i) {
+        if (U(i,i) == T(0)) return R(0);
+    }
+    if (anorm == R(0)) return R(0);
+    return R(1) / (anorm * internal::inverse_norm1_estimate<T,M>(internal::lu_factors_ref<T,M>{L,U,&p}));
+}
+template<typename T, size_t M, typename R = remove_all_t<decltype(std::abs(T()))>>
+FASTOR_INLINE R rcond(const Tensor<T,M,M> &A, const Tensor<T,M,M> &L, const Tensor<T,M,M> &U) {
+    const R anorm = internal::matrix_norm1(A);
+    for (size_t i=0; i<M; ++i) {
+        if (U(i,i) == T(0)) return R(0);
+    }
+    if (anorm == R(0)) return R(0);
+    return R(1) / (anorm * internal::inverse_norm1_estimate<T,M>(internal::lu_factors_ref<T,M>{L,U,nullptr}));
+}
+template<typename T, size_t M, typename R = remove_all_t<decltype(std::abs(T()))>>
+FASTOR_INLINE R rcond(const Tensor<T,M,M> &A) {
+    return lu_factor(A).rcond();
+}
+template<typename Expr, size_t DIM0, enable_if_t_<!is_tensor_v<Expr> && DIM0==2,bool> = false>
+FASTOR_INLINE remove_all_t<decltype(std::abs(typename Expr::scalar_type()))> rcond(const AbstractTensor<Expr,DIM0> &src) {
+    const typename Expr::result_type A(src.self());
+    return rcond(A);
+}
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+
+
+
+
+// Mixed precision solve with iterative refinement
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+namespace internal {
+
+template<typename T>
+struct lower_precision { using type = T; };
+template<>
+struct lower_precision<double> { using type = float; };
+template<>
+struct lower_precision<std::complex<double>> { using type = std::complex<float>; };
+
+/* Whether every entry of A is representable [does not overflow] in the lower precision LT */
+template<typename LT, typename T, size_t ... Rest>
+FASTOR_INLINE bool is_representable_in(const Tensor<T,Rest...> &A) {
+    using std::abs;
+    using LR = remove_all_t<decltype(abs(LT()))>;
+    const auto bound = std::numeric_limits<LR>::max();
+    for (size_t i=0; i<A.size(); ++i) {
+        const T value = A.data()[i];
+        if (!(abs(std::real(value)) <= bound && abs(std::imag(value)) <= bound)) return false;
+    }
+    return true;
+}
+
+/* A is factorised in lower precision [twice the SIMD width] and the solution is refined with residuals
+   computed in the working precision until it is accurate to working precision [LAPACK's xsgesv].
+   If A, B or a residual overflow the lower precision or refinement does not converge - A is too
+   ill-conditioned for the lower precision - the system is solved with an LU factorisation in the
+   working precision instead
+*/
+template<typename T, size_t M, size_t ... Rest>
+FASTOR_INLINE Tensor<T,M,Rest...> refined_solve(const Tensor<T,M,M> &A, const Tensor<T,M,Rest...> &B) {
+    using std::abs;
+    using std::sqrt;
+    using LT = typename lower_precision<T>::type;
+    using R  = remove_all_t<decltype(abs(T()))>;
+    constexpr size_t max_iter = 30;
+    constexpr size_t N = pack_prod<1,Rest...>::value;
+
+    if (!is_representable_in<LT>(A) || !is_representable_in<LT>(B)) {
+        return lu_factor(A).solve(B);
+    }
+
+    const LUFactor<LT,M> F(A.template cast<LT>());
+    Tensor<T,M,Rest...> X;
+    if (F.info() == 0) {
+        X = F.solve(B.template cast<LT>()).template cast<T>();
+
+        // Stopping criterion ||r|| <= ||x|| * ||A|| * eps * sqrt(M) in the max norm
+        R anorm = 0;
+        for (size_t i=0; i<M; ++i) {
+            R rowsum = 0;
+            for (size_t j=0; j<M; ++j) rowsum += abs(A(i,j));
+            anorm = rowsum > anorm ? rowsum : anorm;
+        }
+        const R tol = anorm * std::numeric_limits<R>::epsilon() * sqrt(R(M));
+
+        for (size_t iter=0; iter<=max_iter; ++iter) {
+            const Tensor<T,M,Rest...> Res = B - matmul(A,X);
+            bool converged = true;
+            for (size_t j=0; j<N; ++j) {
+                R xnorm = 0, rnorm = 0;
+                for (size_t i=0; i<M; ++i) {
+                    xnorm = abs(X.data()[i*N+j]) > xnorm ? abs(X.data()[i*N+j]) : xnorm;
+                    rnorm = abs(Res.data()[i*N+j]) > rnorm ? abs(Res.data()[i*N+j]) : rnorm;
+                }
+                converged = converged && rnorm <= xnorm * tol;
+            }
+            if (converged) return X;
+            if (iter == max_iter || !is_representable_in<LT>(Res)) break;
+            X += F.solve(Res.template cast<LT>()).template cast<T>();
+        }
+    }
+    return lu_factor(A).solve(B);
+}
+
+} // internal
+
+template<SolveCompType SType = SolveCompType::SimpleInv, typename T, size_t M,
+    enable_if_t_< SType == SolveCompType::Refined, bool> = false>
+FASTOR_INLINE Tensor<T,M> solve(const Tensor<T,M,M> &A, const Tensor<T,M> &b) {
+    return internal::refined_solve(A,b);
+}
+template<SolveCompType SType = SolveCompType::SimpleInv, typename T, size_t M, size_t N,
+    enable_if_t_< SType == SolveCompType::Refined, bool> = false>
+FASTOR_INLINE Tensor<T,M,N> solve(const Tensor<T,M,M> &A, const Tensor<T,M,N> &B) {
+    return internal::refined_solve(A,B);
+}
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+
+
+
+
+// Solving linear system of equations using Cholesky factorisation
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+template<SolveCompType SType = SolveCompType::SimpleInv, typename T, size_t M,
+    enable_if_t_< SType == SolveCompType::Chol, bool> = false>
+FASTOR_INLINE Tensor<T,M> solve(const Tensor<T,M,M> &A, const Tensor<T,M> &b) {
+    return cholesky_factor(A).solve(b);
+}
+template<SolveCompType SType = SolveCompType::SimpleInv, typename T, size_t M, size_t N,
+    enable_if_t_< SType == SolveCompType::Chol, bool> = false>
+FASTOR_INLINE Tensor<T,M,N> solve(const Tensor<T,M,M> &A, const Tensor<T,M,N> &B) {
+    return cholesky_factor(A).solve(B);
+}
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+
+} // end of namespace Fastor
+
+
+#endif // UNARY_FACTOR_OP_H
@@ -4,6 +4,8 @@
 #include "Fastor/meta/meta.h"
 #include "Fastor/backend/inner.h"
 #include "Fastor/backend/lufact.h"
+#include "Fastor/backend/lufact_blocked.h"
+#include "Fastor/backend/trsm.h"
 #include "Fastor/simd_vector/SIMDVector.h"
 #include "Fastor/tensor/AbstractTensor.h"
 #include "Fastor/tensor/Aliasing.h"
@@ -19,264 +21,6 @@ namespace Fastor {
 
 namespace internal {
 
-/* Compile time recursive loop with inner for forward substitution of b/B given the lower unitriangular matrix L.
-    The following meta functions implements L * y = b for single or multiple right sides
-*/
-//-----------------------------------------------------------------------------------------------------------//
-//-----------------------------------------------------------------------------------------------------------//
-template <size_t from, size_t to>
-struct forward_subs_impl {
-
-    template<typename T, size_t M>
-    static FASTOR_INLINE void do_single_rhs(const Tensor<T,M,M> &L, const Tensor<T,M> &b, Tensor<T,M> &y) {
-        y(from) = b(from) -  _inner<T,from>(&L.data()[from*M],y.data());
-        forward_subs_impl<from+1,to>::do_single_rhs(L, b, y);
-    }
-    template<typename T, size_t M>
-    static FASTOR_INLINE void do_single_rhs_pivot(const Tensor<T,M,M> &L, const Tensor<T,M> &b, const Tensor<size_t,M> &p, Tensor<T,M> &y) {
-        y(from) = b(p(from)) -  _inner<T,from>(&L.data()[from*M],y.data());
-        forward_subs_impl<from+1,to>::do_single_rhs_pivot(L, b, p, y);
-    }
-
-    template<typename T, size_t M, size_t N>
-    static FASTOR_INLINE void do_multi_rhs(const size_t j, const Tensor<T,M,M> &L, const Tensor<T,M,N> &B, Tensor<T,M> &y, Tensor<T,M,N> &X) {
-        y(from) = B(from,j) - _inner<T,from>(&L.data()[from*M],y.data());
-        X(from,j) = y(from);
-        forward_subs_impl<from+1,to>::do_multi_rhs(j, L, B, y, X);
-    }
-
-    template<typename T, size_t M, size_t N>
-    static FASTOR_INLINE void do_multi_rhs_pivot(const size_t j, const Tensor<T,M,M> &L, const Tensor<T,M,N> &B,
-            const Tensor<size_t,M> &p, Tensor<T,M> &y, Tensor<T,M,N> &X) {
-        y(from) = B(p(from),j) - _inner<T,from>(&L.data()[from*M],y.data());
-        X(from,j) = y(from);
-        forward_subs_impl<from+1,to>::do_multi_rhs_pivot(j, L, B, p, y, X);
-    }
-};
-template <size_t from>
-struct forward_subs_impl<from,from> {
-
-    template<typename T, size_t M>
-    static FASTOR_INLINE void do_single_rhs(const Tensor<T,M,M> &L, const Tensor<T,M> &b, Tensor<T,M> &y) {
-        y(from) = b(from) -  _inner<T,from>(&L.data()[from*M],y.data());
-    }
-    template<typename T, size_t M>
-    static FASTOR_INLINE void do_single_rhs_pivot(const Tensor<T,M,M> &L, const Tensor<T,M> &b, const Tensor<size_t,M> &p, Tensor<T,M> &y) {
-        y(from) = b(p(from)) -  _inner<T,from>(&L.data()[from*M],y.data());
-    }
-
-    template<typename T, size_t M, size_t N>
-    static FASTOR_INLINE void do_multi_rhs(const size_t j, const Tensor<T,M,M> &L, const Tensor<T,M,N> &B, Tensor<T,M> &y, Tensor<T,M,N> &X) {
-        y(from) = B(from,j) - _inner<T,from>(&L.data()[from*M],y.data());
-        X(from,j) = y(from);
-    }
-    template<typename T, size_t M, size_t N>
-    static FASTOR_INLINE void do_multi_rhs_pivot(const size_t j, const Tensor<T,M,M> &L, const Tensor<T,M,N> &B,
-            const Tensor<size_t,M> &p, Tensor<T,M> &y, Tensor<T,M,N> &X) {
-        y(from) = B(p(from),j) - _inner<T,from>(&L.data()[from*M],y.data());
-        X(from,j) = y(from);
-    }
-};
-
-template<typename T, size_t M>
-FASTOR_INLINE Tensor<T,M> forward_subs(const Tensor<T,M,M> &L, const Tensor<T,M> &b) {
-
-    Tensor<T,M> y(0);
-
-    forward_subs_impl<0,M-1>::do_single_rhs(L, b, y);
-#if 0
-    // The run-time loop version
-    // Solve for L * y = b
-    for (size_t i=0; i< M; ++i) {
-        T value = 0;
-        for (size_t k=0; k<i; ++k) {
-            value += L(i,k)*y(k);
-        }
-        y(i) = b(i) - value;
-    }
-#endif
-    return y;
-}
-template<typename T, size_t M, size_t N>
-FASTOR_INLINE Tensor<T,M,N> forward_subs(const Tensor<T,M,M> &L, const Tensor<T,M,N> &B) {
-
-    // We keep a separate output tensor X from y [y is columns of X]
-    // to avoid strided access in X for the inner product
-    Tensor<T,M,N> X;
-
-    for (size_t j=0; j < N; ++j) {
-        Tensor<T,M> y(0);
-        forward_subs_impl<0,M-1>::do_multi_rhs(j, L, B, y, X);
-    }
-#if 0
-    // The run-time loop version - X needs to be zeroed out for this version
-    for (size_t j=0; j < N; ++j) {
-        Tensor<T,M> y(0);
-        // Solve for L * y = b
-        for (size_t i=0; i< M; ++i) {
-            T value = 0;
-            for (size_t k=0; k<i; ++k) {
-                value += L(i,k)*y(k);
-            }
-            y(i) = B(i,j) - value;
-            X(i,j) = y(i);
-        }
-    }
-#endif
-    return X;
-}
-template<typename T, size_t M>
-FASTOR_INLINE Tensor<T,M> forward_subs(const Tensor<T,M,M> &L, const Tensor<size_t,M> &p, const Tensor<T,M> &b) {
-
-    Tensor<T,M> y(0);
-
-    forward_subs_impl<0,M-1>::do_single_rhs_pivot(L, b, p, y);
-#if 0
-    // The run-time loop version
-    // Solve for L * y = b
-    for (size_t i=0; i< M; ++i) {
-        T value = 0;
-        for (size_t k=0; k<i; ++k) {
-            value += L(i,k)*y(k);
-        }
-        y(i) = b(p(i)) - value;
-    }
-#endif
-    return y;
-}
-template<typename T, size_t M, size_t N>
-FASTOR_INLINE Tensor<T,M,N> forward_subs(const Tensor<T,M,M> &L, const Tensor<size_t,M> &p, const Tensor<T,M,N> &B) {
-
-    // We keep a separate output tensor X from y [y is columns of X]
-    // to avoid strided access in X for the inner product
-    Tensor<T,M,N> X;
-
-    for (size_t j=0; j < N; ++j) {
-        Tensor<T,M> y(0);
-        forward_subs_impl<0,M-1>::do_multi_rhs_pivot(j, L, B, p, y, X);
-    }
-#if 0
-    // The run-time loop version - X needs to be zeroed out for this version
-    for (size_t j=0; j < N; ++j) {
-        Tensor<T,M> y(0);
-        // Solve for L * y = b
-        for (size_t i=0; i< M; ++i) {
-            T value = 0;
-            for (size_t k=0; k<i; ++k) {
-                value += L(i,k)*y(k);
-            }
-            y(i) = B(p(i),j) - value;
-            X(i,j) = y(i);
-        }
-    }
-#endif
-    return X;
-}
-//-----------------------------------------------------------------------------------------------------------//
-//-----------------------------------------------------------------------------------------------------------//
-
-
-
-
-/* Compile time recursive loop with inner for backward substitution of y/Y given the upper triangular matrix U.
-    The following meta functions implements U * x = y for single or multiple right sides
-*/
-//-----------------------------------------------------------------------------------------------------------//
-//-----------------------------------------------------------------------------------------------------------//
-template <int from, int to>
-struct backward_subs_impl {
-
-    template<typename T, size_t M>
-    static FASTOR_INLINE void do_single_rhs(const Tensor<T,M,M> &U, const Tensor<T,M> &y, Tensor<T,M> &x) {
-        constexpr int idx = (int)M - from;
-        const T value = _inner<T,idx>(&U.data()[from*M+from],&x.data()[from]);
-        x(from) = ( y(from) - value) / U(from, from);
-        backward_subs_impl<from-1,to>::do_single_rhs(U, y, x);
-    }
-
-    template<typename T, size_t M, size_t N>
-    static FASTOR_INLINE void do_multi_rhs(const size_t j, const Tensor<T,M,M> &U, const Tensor<T,M,N> &Y, Tensor<T,M> &x, Tensor<T,M,N> &X) {
-        constexpr int idx = (int)M - from;
-        const T value = _inner<T,idx>(&U.data()[from*M+from],&x.data()[from]);
-        x(from) = ( Y(from,j) - value ) / U(from, from);
-        X(from,j) = x(from);
-        backward_subs_impl<from-1,to>::do_multi_rhs(j, U, Y, x, X);
-    }
-};
-
-template <>
-struct backward_subs_impl<0,0> {
-
-    template<typename T, size_t M>
-    static FASTOR_INLINE void do_single_rhs(const Tensor<T,M,M> &U, const Tensor<T,M> &y, Tensor<T,M> &x) {
-        constexpr int idx = (int)M;
-        const T value = _inner<T,idx>(&U.data()[0*M+0],&x.data()[0]);
-        x(0) = ( y(0) - value) / U(0, 0);
-    }
-
-    template<typename T, size_t M, size_t N>
-    static FASTOR_INLINE void do_multi_rhs(const size_t j, const Tensor<T,M,M> &U, const Tensor<T,M,N> &Y, Tensor<T,M> &x, Tensor<T,M,N> &X) {
-        constexpr int idx = (int)M;
-        const T value = _inner<T,idx>(&U.data()[0*M+0],&x.data()[0]);
-        x(0) = ( Y(0,j) - value ) / U(0, 0);
-        X(0,j) = x(0);
-    }
-};
-
-template<typename T, size_t M>
-FASTOR_INLINE Tensor<T,M> backward_subs(const Tensor<T,M,M> &U, const Tensor<T,M> &y) {
-
-    // We keep a separate output tensor X from x [x is columns of X]
-    // to avoid strided access in X for the inner product
-    Tensor<T,M> x(0);
-    backward_subs_impl<int(M)-1,0>::do_single_rhs(U, y, x);
-#if 0
-    // The run-time loop version
-    // Solve for of U * x = y
-    for (int i= int(M) - 1; i>=0; --i) {
-        T value = 0;
-        for (int k=i; k<int(M); ++k) {
-            value += U(i,k)*x(k);
-        }
-        x(i) = (y(i) - value) / U(i, i);
-    }
-#endif
-    return x;
-}
-
-template<typename T, size_t M, size_t N>
-FASTOR_INLINE Tensor<T,M,N> backward_subs(const Tensor<T,M,M> &U, const Tensor<T,M,N> &Y) {
-
-    // We keep a separate output tensor X from x [x is columns of X]
-    // to avoid strided access in X for the inner product
-    Tensor<T,M,N> X;
-
-    for (size_t j=0; j < N; ++j) {
-        Tensor<T,M> x(0);
-        backward_subs_impl<int(M)-1,0>::do_multi_rhs(j, U, Y, x, X);
-    }
-#if 0
-    // The run-time loop version - X needs to be zeroed out for this version
-    Tensor<T,M,N> X(0);
-    for (size_t j=0; j < 1; ++j) {
-        // Solve for of U * x = y
-        for (int i= int(M) - 1; i>=0; --i) {
-            T value = 0;
-            for (int k=i; k<int(M); ++k) {
-                value += U(i,k)*X(k,j);
-            }
-            X(i,j) = (Y(i,j) - value) / U(i, i);
-        }
-    }
-#endif
-    return X;
-}
-
-//-----------------------------------------------------------------------------------------------------------//
-//-----------------------------------------------------------------------------------------------------------//
-
-
-
 /* Simple LU factorisation without pivoting */
 //-----------------------------------------------------------------------------------------------------------//
 //-----------------------------------------------------------------------------------------------------------//
@@ -462,129 +206,61 @@ FASTOR_INLINE void lu_block_dispatcher(const Tensor<T,M,M>& A, Tensor<T,M,M>& L,
     _lufact<T,M>(A.data(),L.data(),U.data());
 }
 
-template <typename T, size_t M, enable_if_t_<is_greater_v_<M,8> && is_less_equal_v_<M,32>,bool> = false>
+template <typename T, size_t M, enable_if_t_<is_greater_v_<M,8> && is_less_v_<M,16>,bool> = false>
 FASTOR_INLINE void lu_block_dispatcher(const Tensor<T,M,M>& A, Tensor<T,M,M>& L, Tensor<T,M,M>& U) {
     recursive_lu_dispatcher(A, L, U);
 }
 
-template <typename T, size_t M, enable_if_t_<is_greater_v_<M,32> && is_less_equal_v_<M,64>,bool> = false>
-FASTOR_INLINE void lu_block_dispatcher(const Tensor<T,M,M>& A, Tensor<T,M,M>& L, Tensor<T,M,M>& U) {
-
-    // We will compute LU decomposition block-wise assuming that A11 and A22 are invertible
-    //
-    // [A11 A12]   [L11    0] [U11 U12]
-    // [A21 A22]   [L21  L22] [0   U22]
-    //
-    // This results in
-    //
-    // A11 = L11 * U11
-    // A12 = L11 * U12
-    // A21 = L21 * U11
-    // A22 = L21 * U12 - L22 * U22
-    //
-    // Hence we need to do LU factorisation once for A11 and once for A22
-
-    // This is to avoid odd sizes for instance for size 35 we would
-    // want to do 35 = 16 + 19 rather than 35 = 32 + 3 if the start size was 32
-    constexpr size_t N = (M / 8UL * 8UL) / 2UL; // start size
-    Tensor<T,N  ,N  > A11 = A(fseq<0,N>(),fseq<0,N>());
-    Tensor<T,N  ,M-N> A12 = A(fseq<0,N>(),fseq<N,M>());
-    Tensor<T,M-N,  N> A21 = A(fseq<N,M>(),fseq<0,N>());
-    Tensor<T,M-N,M-N> A22 = A(fseq<N,M>(),fseq<N,M>());
-
-    Tensor<T,N,N> L11(0), U11(0);
-    lu_block_dispatcher(A11, L11, U11);
-
-    // Solve for U12 = {L11}^(-1)*A12
-    Tensor<T,N  ,M-N> U12 = tmatmul<UpLoType::Lower,UpLoType::General>(tinverse<InvCompType::SimpleInv, UpLoType::UniLower>(L11),A12);
-    // Solve for L21 = A21*{U11}^(-1)
-    Tensor<T,M-N,  N> L21 = tmatmul<UpLoType::General,UpLoType::Upper>(A21,tinverse<InvCompType::SimpleInv, UpLoType::Upper>(U11));
-
-    Tensor<T,M-N,M-N> S   = A22 - matmul(L21,U12);
-
-    Tensor<T,M-N,M-N> L22(0), U22(0);
-    lu_block_dispatcher(S, L22, U22);
-
-    L(fseq<0,N>(),fseq<0,N>()) = L11;
-    // L(fseq<0,N>(),fseq<N,M>()) = 0;
-    L(fseq<N,M>(),fseq<0,N>()) = L21;
-    L(fseq<N,M>(),fseq<N,M>()) = L22;
-
-    U(fseq<0,N>(),fseq<0,N>()) = U11;
-    U(fseq<0,N>(),fseq<N,M>()) = U12;
-    // U(fseq<N,M>(),fseq<0,N>()) = 0;
-    U(fseq<N,M>(),fseq<N,M>()) = U22;
-}
-
-// Conditional dispatch
-namespace useless {
-template <typename T, size_t M, enable_if_t_<is_greater_v_<M,0> && is_less_equal_v_<M,64>,bool> = false>
-FASTOR_INLINE void lu_block_simple_dispatcher(const Tensor<T,M,M>& A, Tensor<T,M,M>& L, Tensor<T,M,M>& U) {
-    lu_block_dispatcher(A, L, U);
-    return;
+/* For sizes 16 and above a right-looking blocked LU is used where each
+    step factorises a panel of columns and updates the trailing matrix with
+    a single matmul. See backend/lufact_blocked.h. The factorisation is done
+    in place in U which is then split into L and U
+*/
+template <typename T, size_t M, bool Pivot>
+FASTOR_INLINE void lu_blocked_dispatcher(const Tensor<T,M,M>& A, Tensor<T,M,M>& L, Tensor<T,M,M>& U, Tensor<size_t,M>& P) {
+    U = A;
+    _lufact_blocked<T,M,Pivot>(U.data(),P.data());
+    for (size_t i=0; i<M; ++i) {
+        for (size_t j=0; j<i; ++j) {
+            L(i,j) = U(i,j);
+            U(i,j) = 0;
+        }
+        L(i,i) = 1;
+        for (size_t j=i+1; j<M; ++j) {
+            L(i,j) = 0;
+        }
+    }
 }
-template <typename T, size_t M, enable_if_t_<is_greater_v_<M,64>,bool> = false>
-FASTOR_INLINE void lu_block_simple_dispatcher(const Tensor<T,M,M>& A, Tensor<T,M,M>& L, Tensor<T,M,M>& U) {
-    // lu_simple_dispatcher(A, L, U);
-    recursive_lu_dispatcher(A, L, U);
-    return;
+
+template <typename T, size_t M, enable_if_t_<is_greater_equal_v_<M,16>,bool> = false>
+FASTOR_INLINE void lu_block_dispatcher(const Tensor<T,M,M>& A, Tensor<T,M,M>& L, Tensor<T,M,M>& U) {
+    Tensor<size_t,M> P;
+    lu_blocked_dispatcher<T,M,false>(A, L, U, P);
 }
-} // useless
 
-/* For sizes greater than 64 we tile differently to avoid too many recursions
+/* Block LU factorisation with pivoting. For small sizes the rows are pivoted once
+    upfront and the unpivoted kernels are used. From size 16 onwards the blocked LU
+    with true partial pivoting is used
 */
-template <typename T, size_t M, enable_if_t_<is_greater_v_<M,64>,bool> = false>
-FASTOR_INLINE void lu_block_dispatcher(const Tensor<T,M,M>& A, Tensor<T,M,M>& L, Tensor<T,M,M>& U) {
+template <typename T, size_t M, enable_if_t_<is_less_v_<M,16>,bool> = false>
+FASTOR_INLINE void lu_block_piv_dispatcher(const Tensor<T,M,M>& A, Tensor<T,M,M>& L, Tensor<T,M,M>& U, Tensor<size_t,M>& P) {
+    pivot_inplace(A,P);
+    auto pA(apply_pivot(A,P));
+    lu_block_dispatcher(pA,L,U);
+}
 
-    // We will compute LU decomposition block-wise assuming that A11 and A22 are invertible
-    //
-    // [A11 A12]   [L11    0] [U11 U12]
-    // [A21 A22]   [L21  L22] [0   U22]
-    //
-    // This results in
-    //
-    // A11 = L11 * U11
-    // A12 = L11 * U12
-    // A21 = L21 * U11
-    // A22 = L21 * U12 - L22 * U22
-    //
-    // Hence we need to do LU factorisation once for A11 and once for A22
-
-    // This is to avoid odd sizes for instance for size 65 we would
-    // want to do 65 = 32 + 33 rather than 65 = 64 + 1 if the start size was 64
-    constexpr size_t N = (M / 16UL * 16UL) / 2UL; // start size
-    Tensor<T,N  ,N  > A11 = A(fseq<0,N>(),fseq<0,N>());
-    Tensor<T,N  ,M-N> A12 = A(fseq<0,N>(),fseq<N,M>());
-    Tensor<T,M-N,  N> A21 = A(fseq<N,M>(),fseq<0,N>());
-    Tensor<T,M-N,M-N> A22 = A(fseq<N,M>(),fseq<N,M>());
-
-    Tensor<T,N,N> L11(0), U11(0);
-    useless::lu_block_simple_dispatcher(A11, L11, U11);
-
-    // Solve for U12 = {L11}^(-1)*A12
-    Tensor<T,N  ,M-N> U12 = tmatmul<UpLoType::Lower,UpLoType::General>(tinverse<InvCompType::SimpleInv, UpLoType::UniLower>(L11),A12);
-    // Ideally use forward_subs but its iterative nature makes it less efficient than tmatmul
-    // Tensor<T,N  ,M-N> U12 = forward_subs(L11,A12);
-    // Solve for L21 = A21*{U11}^(-1)
-    Tensor<T,M-N,  N> L21 = tmatmul<UpLoType::General,UpLoType::Upper>(A21,tinverse<InvCompType::SimpleInv, UpLoType::Upper>(U11));
-    // Not quite performant as we can't avoid the matmul here
-    // Tensor<T,N  ,N  > I; I.eye2();
-    // Tensor<T,M-N,  N> L21 = matmul(A21, backward_subs(U11, I));
-
-    Tensor<T,M-N,M-N> S   = A22 - matmul(L21,U12);
-
-    Tensor<T,M-N,M-N> L22(0), U22(0);
-    useless::lu_block_simple_dispatcher(S, L22, U22);
-
-    L(fseq<0,N>(),fseq<0,N>()) = L11;
-    // L(fseq<0,N>(),fseq<N,M>()) = 0;
-    L(fseq<N,M>(),fseq<0,N>()) = L21;
-    L(fseq<N,M>(),fseq<N,M>()) = L22;
-
-    U(fseq<0,N>(),fseq<0,N>()) = U11;
-    U(fseq<0,N>(),fseq<N,M>()) = U12;
-    // U(fseq<N,M>(),fseq<0,N>()) = 0;
-    U(fseq<N,M>(),fseq<N,M>()) = U22;
+template <typename T, size_t M, enable_if_t_<is_greater_equal_v_<M,16>,bool> = false>
+FASTOR_INLINE void lu_block_piv_dispatcher(const Tensor<T,M,M>& A, Tensor<T,M,M>& L, Tensor<T,M,M>& U, Tensor<size_t,M>& P) {
+    lu_blocked_dispatcher<T,M,true>(A, L, U, P);
+}
+
+template <typename T, size_t M>
+FASTOR_INLINE void lu_block_piv_dispatcher(const Tensor<T,M,M>& A, Tensor<T,M,M>& L, Tensor<T,M,M>& U, Tensor<T,M,M>& P) {
+    Tensor<size_t,M> p;
+    lu_block_piv_dispatcher(A,L,U,p);
+    P.fill(0);
+    for (size_t i = 0; i < M; ++i)
+        P(i, p(i)) = 1;
 }
 //-----------------------------------------------------------------------------------------------------------//
 //-----------------------------------------------------------------------------------------------------------//
@@ -623,9 +299,7 @@ void
 lu(const AbstractTensor<Expr,DIM0> &src, Tensor<T,M,M>& L, Tensor<T,M,M>& U, Tensor<size_t,M>& P) {
     L.fill(0);
     U.fill(0);
-    pivot_inplace(src.self(),P);
-    auto A(apply_pivot(src.self(),P));
-    internal::lu_block_dispatcher(A,L,U);
+    internal::lu_block_piv_dispatcher(src.self(),L,U,P);
 }
 template<LUCompType LUType = LUCompType::BlockLU, typename Expr, size_t DIM0, typename T, size_t M,
     enable_if_t_<!is_tensor_v<Expr> && LUType == LUCompType::BlockLUPiv,bool> = false>
@@ -635,10 +309,7 @@ lu(const AbstractTensor<Expr,DIM0> &src, Tensor<T,M,M>& L, Tensor<T,M,M>& U, Ten
     L.fill(0);
     U.fill(0);
     typename Expr::result_type A(src.self());
-    pivot_inplace(A,P);
-    // Modify A as A is a temporary anyway
-    apply_pivot_inplace(A,P);
-    internal::lu_block_dispatcher(A,L,U);
+    internal::lu_block_piv_dispatcher(A,L,U,P);
 }
 
 // BlockLU - matrix pivot
@@ -649,9 +320,7 @@ void
 lu(const AbstractTensor<Expr,DIM0> &src, Tensor<T,M,M>& L, Tensor<T,M,M>& U, Tensor<T,M,M>& P) {
     L.fill(0);
     U.fill(0);
-    pivot_inplace(src.self(),P);
-    auto A(apply_pivot(src.self(),P));
-    internal::lu_block_dispatcher(A,L,U);
+    internal::lu_block_piv_dispatcher(src.self(),L,U,P);
 }
 template<LUCompType LUType = LUCompType::BlockLU, typename Expr, size_t DIM0, typename T, size_t M,
     enable_if_t_<!is_tensor_v<Expr> && LUType == LUCompType::BlockLUPiv,bool> = false>
@@ -661,10 +330,7 @@ lu(const AbstractTensor<Expr,DIM0> &src, Tensor<T,M,M>& L, Tensor<T,M,M>& U, Ten
     L.fill(0);
     U.fill(0);
     typename Expr::result_type A(src.self());
-    pivot_inplace(A,P);
-    // Modify A as A is a temporary anyway
-    apply_pivot_inplace(A,P);
-    internal::lu_block_dispatcher(A,L,U);
+    internal::lu_block_piv_dispatcher(A,L,U,P);
 }
 //-----------------------------------------------------------------------------------------------------------//
 //-----------------------------------------------------------------------------------------------------------//
@@ -752,20 +418,21 @@ namespace internal {
 template<typename T, size_t M>
 FASTOR_INLINE Tensor<T,M,M> get_lu_inverse(const Tensor<T,M,M> &L, const Tensor<T,M,M> &U) {
     // We will solve for multiple RHS [B = I]
-    // Loop over columns of B = I
-    Tensor<T,M,M> I; I.eye2();
-    Tensor<T,M,M> Y = forward_subs(L, I);
-    Tensor<T,M,M> X = backward_subs(U, Y);
+    Tensor<T,M,M> X; X.eye2();
+    _trsm<T,M,M,UpLoType::UniLower>(L.data(),X.data());
+    _trsm<T,M,M,UpLoType::Upper>(U.data(),X.data());
     return X;
 }
 
 template<typename T, size_t M>
-FASTOR_INLINE Tensor<T,M,M> get_lu_inverse(Tensor<T,M,M> &L, const Tensor<T,M,M> &U, const Tensor<size_t,M> &p) {
-    // We will solve for multiple RHS [B = I]
-    // Loop over columns of B = I
-    Tensor<T,M,M> I; I.eye2();
-    Tensor<T,M,M> Y = forward_subs(L, p, I);
-    Tensor<T,M,M> X = backward_subs(U, Y);
+FASTOR_INLINE Tensor<T,M,M> get_lu_inverse(const Tensor<T,M,M> &L, const Tensor<T,M,M> &U, const Tensor<size_t,M> &p) {
+    // We will solve for multiple RHS [B = P * I]
+    Tensor<T,M,M> X(0);
+    for (size_t i=0; i<M; ++i) {
+        X(i,p(i)) = T(1);
+    }
+    _trsm<T,M,M,UpLoType::UniLower>(L.data(),X.data());
+    _trsm<T,M,M,UpLoType::Upper>(U.data(),X.data());
     return X;
 }
 //-----------------------------------------------------------------------------------------------------------//
@@ -828,30 +495,37 @@ namespace internal {
 
 template<typename T, size_t M>
 FASTOR_INLINE Tensor<T,M> get_lu_solve(const Tensor<T,M,M> &L, const Tensor<T,M,M> &U, const Tensor<T,M> &b) {
-    Tensor<T,M> y = forward_subs(L, b);
-    Tensor<T,M> x = backward_subs(U, y);
+    Tensor<T,M> x(b);
+    _trsv<T,M,UpLoType::UniLower>(L.data(),x.data());
+    _trsv<T,M,UpLoType::Upper>(U.data(),x.data());
     return x;
 }
 
 template<typename T, size_t M>
-FASTOR_INLINE Tensor<T,M> get_lu_solve(Tensor<T,M,M> &L, const Tensor<T,M,M> &U, const Tensor<size_t,M> &p, const Tensor<T,M> &b) {
-    Tensor<T,M> y = forward_subs(L, p, b);
-    Tensor<T,M> x = backward_subs(U, y);
+FASTOR_INLINE Tensor<T,M> get_lu_solve(const Tensor<T,M,M> &L, const Tensor<T,M,M> &U, const Tensor<size_t,M> &p, const Tensor<T,M> &b) {
+    Tensor<T,M> x;
+    for (size_t i=0; i<M; ++i) {
+        x(i) = b(p(i));
+    }
+    _trsv<T,M,UpLoType::UniLower>(L.data(),x.data());
+    _trsv<T,M,UpLoType::Upper>(U.data(),x.data());
     return x;
 }
 
 // Multiple RHS
 template<typename T, size_t M, size_t N>
 FASTOR_INLINE Tensor<T,M,N> get_lu_solve(const Tensor<T,M,M> &L, const Tensor<T,M,M> &U, const Tensor<T,M,N> &B) {
-    Tensor<T,M,N> Y = forward_subs(L, B);
-    Tensor<T,M,N> X = backward_subs(U, Y);
+    Tensor<T,M,N> X(B);
+    _trsm<T,M,N,UpLoType::UniLower>(L.data(),X.data());
+    _trsm<T,M,N,UpLoType::Upper>(U.data(),X.data());
     return X;
 }
 
 template<typename T, size_t M, size_t N>
 FASTOR_INLINE Tensor<T,M,N> get_lu_solve(const Tensor<T,M,M> &L, const Tensor<T,M,M> &U, const Tensor<size_t,M> &p, const Tensor<T,M,N> &B) {
-    Tensor<T,M,N> Y = forward_subs(L, p, B);
-    Tensor<T,M,N> X = backward_subs(U, Y);
+    Tensor<T,M,N> X(apply_pivot(B,p));
+    _trsm<T,M,N,UpLoType::UniLower>(L.data(),X.data());
+    _trsm<T,M,N,UpLoType::Upper>(U.data(),X.data());
     return X;
 }
 //-----------------------------------------------------------------------------------------------------------//
@@ -954,11 +628,10 @@ FASTOR_INLINE Tensor<T,M,N> solve(const Tensor<T,M,M> &A, const Tensor<T,M,N> &B
 template<DetCompType DetType = DetCompType::Simple, typename T, size_t M,
     enable_if_t_<DetType == DetCompType::LU,bool> = false>
 FASTOR_INLINE T determinant(const Tensor<T,M,M> &A) {
-    int nswaps = internal::count_swaps(A) % 2UL == 0 ? 1 : -1;
     Tensor<T,M,M> L, U;
     Tensor<size_t,M> p;
     lu<LUCompType::BlockLUPiv>(A, L, U, p);
-    return product(diag(U)) * nswaps;
+    return product(diag(U)) * internal::permutation_sign(p);
 }
 //-----------------------------------------------------------------------------------------------------------//
 //-----------------------------------------------------------------------------------------------------------//
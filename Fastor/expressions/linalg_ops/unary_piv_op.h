@@ -17,20 +17,10 @@ namespace Fastor {
 
 namespace internal {
 
-template<typename T, size_t M, size_t N>
-FASTOR_INLINE size_t count_swaps(const Tensor<T,M,N>& A) {
-    size_t count = 0;
-    for (size_t j = 0; j < M; ++j) {
-        size_t max_index = j;
-        for (size_t i = j; i < M; ++i) {
-            // std::abs is necessary only for complex valued numbers
-            if (std::abs(A(i, j)) > std::abs(A(max_index, j)))
-                max_index = i;
-        }
-        if (j != max_index)
-            count++;
-    }
-    return count;
+/* Sign (parity) of a permutation vector - (-1)^(number of even length cycles) */
+template<size_t M>
+FASTOR_INLINE int permutation_sign(const Tensor<size_t,M>& p) {
+    return permutation_sign<M>(p.data());
 }
 
 }
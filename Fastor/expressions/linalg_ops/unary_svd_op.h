@@ -0,0 +1,307 @@
+#ifndef UNARY_SVD_OP_H
+#define UNARY_SVD_OP_H
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/backend/svd.h"
+#include "Fastor/backend/transpose/transpose.h"
+#include "Fastor/simd_vector/SIMDVector.h"
+#include "Fastor/tensor/AbstractTensor.h"
+#include "Fastor/tensor/Tensor.h"
+#include "Fastor/tensor/TensorTraits.h"
+#include "Fastor/expressions/expression_traits.h"
+#include "Fastor/expressions/linalg_ops/linalg_computation_types.h"
+
+
+namespace Fastor {
+
+namespace internal {
+
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+/* One-sided (Hestenes) Jacobi SVD for M >= N. Pairs of columns of A are
+   rotated until they are mutually orthogonal; the rotations accumulate in V,
+   the column norms are the singular values and the normalised columns are the
+   left singular vectors. Unlike the methods that go through A^T * A this gives
+   small singular values to high relative accuracy
+*/
+template<typename T, size_t M, size_t N>
+FASTOR_HINT_INLINE void svd_jacobi_dispatcher(const Tensor<T,M,N> &A, Tensor<T,M,N> &U, Tensor<T,N> &S, Tensor<T,N,N> &V) {
+
+    static_assert(M>=N, "ONE-SIDED JACOBI SVD REQUIRES THE NUMBER OF ROWS TO BE GREATER OR EQUAL TO THE NUMBER OF COLUMNS");
+
+    constexpr T eps  = std::numeric_limits<T>::epsilon();
+    constexpr T tiny = std::numeric_limits<T>::min();
+    constexpr size_t max_sweeps = 60;
+
+    U = A;
+    V.eye2();
+
+    for (size_t sweep=0; sweep<max_sweeps; ++sweep) {
+        bool rotated = false;
+        for (size_t p=0; p<N; ++p) {
+            for (size_t q=p+1; q<N; ++q) {
+                T alpha = 0, beta = 0, gamma = 0;
+                for (size_t k=0; k<M; ++k) {
+                    alpha += U(k,p)*U(k,p);
+                    beta  += U(k,q)*U(k,q);
+                    gamma += U(k,p)*U(k,q);
+                }
+                if (std::abs(gamma) <= eps*sqrts(alpha*beta)) continue;
+                rotated = true;
+
+                T c, s, t;
+                _jacobi_rotation<T>(alpha, gamma, beta, c, s, t);
+                for (size_t k=0; k<M; ++k) {
+                    const T ukp = U(k,p);
+                    const T ukq = U(k,q);
+                    U(k,p) = c*ukp - s*ukq;
+                    U(k,q) = s*ukp + c*ukq;
+                }
+                for (size_t k=0; k<N; ++k) {
+                    const T vkp = V(k,p);
+                    const T vkq = V(k,q);
+                    V(k,p) = c*vkp - s*vkq;
+                    V(k,q) = s*vkp + c*vkq;
+                }
+            }
+        }
+        if (!rotated) break;
+    }
+
+    for (size_t j=0; j<N; ++j) {
+        T sj = 0;
+        for (size_t k=0; k<M; ++k) {
+            sj += U(k,j)*U(k,j);
+        }
+        sj = sqrts(sj);
+        S(j) = sj;
+        if (sj > tiny) {
+            for (size_t k=0; k<M; ++k) {
+                U(k,j) /= sj;
+            }
+        }
+    }
+
+    // Sort singular values in descending order
+    for (size_t i=0; i<N; ++i) {
+        size_t k = i;
+        for (size_t j=i+1; j<N; ++j) {
+            if (S(j) > S(k)) k = j;
+        }
+        if (k != i) {
+            std::swap(S(i),S(k));
+            for (size_t j=0; j<M; ++j) std::swap(U(j,i),U(j,k));
+            for (size_t j=0; j<N; ++j) std::swap(V(j,i),V(j,k));
+        }
+    }
+
+    // Complete the left singular vectors of the zero singular values
+    // to an orthonormal set
+    for (size_t j=0; j<N; ++j) {
+        if (S(j) > tiny) continue;
+        for (size_t e=0; e<M; ++e) {
+            T x[M];
+            for (size_t k=0; k<M; ++k) x[k] = k==e ? T(1) : T(0);
+            for (size_t i=0; i<j; ++i) {
+                const T dot = U(e,i);
+                for (size_t k=0; k<M; ++k) x[k] -= dot*U(k,i);
+            }
+            T nx = 0;
+            for (size_t k=0; k<M; ++k) nx += x[k]*x[k];
+            nx = sqrts(nx);
+            if (nx > T(0.5)) {
+                for (size_t k=0; k<M; ++k) U(k,j) = x[k] / nx;
+                break;
+            }
+        }
+    }
+}
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+
+
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+template<SVDCompType SVDType, typename T, size_t M, size_t N,
+    enable_if_t_<!(SVDType == SVDCompType::Simple && is_equal_v_<M,3> && is_equal_v_<N,3>) && is_greater_equal_v_<M,N>,bool> = false>
+FASTOR_INLINE void svd_dispatcher(const Tensor<T,M,N> &A, Tensor<T,M,N> &U, Tensor<T,N> &S, Tensor<T,N,N> &V) {
+    svd_jacobi_dispatcher(A,U,S,V);
+}
+
+template<SVDCompType SVDType, typename T, size_t M, size_t N,
+    enable_if_t_<is_less_v_<M,N>,bool> = false>
+FASTOR_INLINE void svd_dispatcher(const Tensor<T,M,N> &A, Tensor<T,M,M> &U, Tensor<T,M> &S, Tensor<T,N,M> &V) {
+    // A^T = V * S * U^T
+    Tensor<T,N,M> At;
+    _transpose<T,M,N>(A.data(),At.data());
+    svd_jacobi_dispatcher(At,V,S,U);
+}
+
+template<SVDCompType SVDType, typename T, size_t M, size_t N,
+    enable_if_t_<SVDType == SVDCompType::Simple && is_equal_v_<M,3> && is_equal_v_<N,3>,bool> = false>
+FASTOR_INLINE void svd_dispatcher(const Tensor<T,M,N> &A, Tensor<T,M,N> &U, Tensor<T,N> &S, Tensor<T,N,N> &V) {
+    _svd<T,M>(A.data(),U.data(),S.data(),V.data());
+}
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+
+
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+template<SVDCompType SVDType, typename T, size_t M,
+    enable_if_t_<!(SVDType == SVDCompType::Simple && is_equal_v_<M,3>),bool> = false>
+FASTOR_INLINE void polar_dispatcher(const Tensor<T,M,M> &A, Tensor<T,M,M> &R, Tensor<T,M,M> &H) {
+    Tensor<T,M,M> U, V;
+    Tensor<T,M> S;
+    svd_jacobi_dispatcher(A,U,S,V);
+    for (size_t i=0; i<M; ++i) {
+        for (size_t j=0; j<M; ++j) {
+            T rij = 0, hij = 0;
+            for (size_t k=0; k<M; ++k) {
+                rij += U(i,k)*V(j,k);
+                hij += V(i,k)*S(k)*V(j,k);
+            }
+            R(i,j) = rij;
+            H(i,j) = hij;
+        }
+    }
+}
+
+template<SVDCompType SVDType, typename T, size_t M,
+    enable_if_t_<SVDType == SVDCompType::Simple && is_equal_v_<M,3>,bool> = false>
+FASTOR_INLINE void polar_dispatcher(const Tensor<T,M,M> &A, Tensor<T,M,M> &R, Tensor<T,M,M> &H) {
+    _polar<T,M>(A.data(),R.data(),H.data());
+}
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+
+} // internal
+
+
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+// Thin singular value decomposition A = U * diag(S) * V^T of an MxN matrix with
+// K = min(M,N) non-negative singular values S in descending order
+template<SVDCompType SVDType = SVDCompType::Simple, typename Expr, size_t DIM0, typename T, size_t M, size_t N, size_t K,
+    enable_if_t_<is_tensor_v<Expr>,bool> = false>
+FASTOR_INLINE
+void
+svd(const AbstractTensor<Expr,DIM0> &src, Tensor<T,M,K> &U, Tensor<T,K> &S, Tensor<T,N,K> &V) {
+    static_assert(std::is_floating_point<T>::value, "SVD IS ONLY SUPPORTED FOR FLOATING POINT TENSORS");
+    static_assert(K == (M < N ? M : N), "THE NUMBER OF SINGULAR VALUES SHOULD BE MIN(M,N)");
+    internal::svd_dispatcher<SVDType>(src.self(),U,S,V);
+}
+
+template<SVDCompType SVDType = SVDCompType::Simple, typename Expr, size_t DIM0, typename T, size_t M, size_t N, size_t K,
+    enable_if_t_<!is_tensor_v<Expr>,bool> = false>
+FASTOR_INLINE
+void
+svd(const AbstractTensor<Expr,DIM0> &src, Tensor<T,M,K> &U, Tensor<T,K> &S, Tensor<T,N,K> &V) {
+    static_assert(std::is_floating_point<T>::value, "SVD IS ONLY SUPPORTED FOR FLOATING POINT TENSORS");
+    static_assert(K == (M < N ? M : N), "THE NUMBER OF SINGULAR VALUES SHOULD BE MIN(M,N)");
+    typename Expr::result_type A(src.self());
+    internal::svd_dispatcher<SVDType>(A,U,S,V);
+}
+
+
+// Polar decomposition A = R * H of a square matrix with R orthogonal and H
+// symmetric positive semi-definite. For deformation gradients (det(A) > 0)
+// R is the rotation and H the right stretch tensor
+template<SVDCompType SVDType = SVDCompType::Simple, typename Expr, size_t DIM0, typename T, size_t M,
+    enable_if_t_<is_tensor_v<Expr>,bool> = false>
+FASTOR_INLINE
+void
+polar(const AbstractTensor<Expr,DIM0> &src, Tensor<T,M,M> &R, Tensor<T,M,M> &H) {
+    static_assert(std::is_floating_point<T>::value, "POLAR DECOMPOSITION IS ONLY SUPPORTED FOR FLOATING POINT TENSORS");
+    internal::polar_dispatcher<SVDType>(src.self(),R,H);
+}
+
+template<SVDCompType SVDType = SVDCompType::Simple, typename Expr, size_t DIM0, typename T, size_t M,
+    enable_if_t_<!is_tensor_v<Expr>,bool> = false>
+FASTOR_INLINE
+void
+polar(const AbstractTensor<Expr,DIM0> &src, Tensor<T,M,M> &R, Tensor<T,M,M> &H) {
+    static_assert(std::is_floating_point<T>::value, "POLAR DECOMPOSITION IS ONLY SUPPORTED FOR FLOATING POINT TENSORS");
+    typename Expr::result_type A(src.self());
+    internal::polar_dispatcher<SVDType>(A,R,H);
+}
+
+
+// For high order tensors - batch of square matrices stored in the last two
+// dimensions. The closed-form 3x3 kernels are vectorised across the matrices
+template<SVDCompType SVDType = SVDCompType::Simple,
+    typename T, size_t ... Rest, enable_if_t_<sizeof...(Rest)>=3,bool> = false>
+FASTOR_INLINE
+void
+svd(const Tensor<T,Rest...> &A,
+    Tensor<T,Rest...> &U,
+    typename last_matrix_extracter<Tensor<T,Rest...>, typename std_ext::make_index_sequence<sizeof...(Rest)-1>::type>::type &S,
+    Tensor<T,Rest...> &V) {
+
+    static_assert(std::is_floating_point<T>::value, "SVD IS ONLY SUPPORTED FOR FLOATING POINT TENSORS");
+    constexpr size_t remaining_product = last_matrix_extracter<Tensor<T,Rest...>,
+        typename std_ext::make_index_sequence<sizeof...(Rest)-2>::type>::remaining_product;
+
+    constexpr size_t I = get_value<sizeof...(Rest)-1,Rest...>::value;
+    constexpr size_t J = get_value<sizeof...(Rest),Rest...>::value;
+    static_assert(I==J,"THE LAST TWO DIMENSIONS OF TENSOR MUST BE THE SAME");
+
+    const T *a_data = A.data();
+    T *u_data = U.data();
+    T *s_data = S.data();
+    T *v_data = V.data();
+
+    FASTOR_IF_CONSTEXPR(SVDType == SVDCompType::Simple && J == 3) {
+        _svd_batch<T,3>(a_data,u_data,s_data,v_data,remaining_product);
+    }
+    else {
+        Tensor<T,J,J> a, ui, vi;
+        Tensor<T,J> si;
+        for (size_t i=0; i<remaining_product; ++i) {
+            std::copy(a_data+i*J*J,a_data+(i+1)*J*J,a.data());
+            internal::svd_dispatcher<SVDType>(a,ui,si,vi);
+            std::copy(ui.data(),ui.data()+J*J,u_data+i*J*J);
+            std::copy(si.data(),si.data()+J,s_data+i*J);
+            std::copy(vi.data(),vi.data()+J*J,v_data+i*J*J);
+        }
+    }
+}
+
+template<SVDCompType SVDType = SVDCompType::Simple,
+    typename T, size_t ... Rest, enable_if_t_<sizeof...(Rest)>=3,bool> = false>
+FASTOR_INLINE
+void
+polar(const Tensor<T,Rest...> &A, Tensor<T,Rest...> &R, Tensor<T,Rest...> &H) {
+
+    static_assert(std::is_floating_point<T>::value, "POLAR DECOMPOSITION IS ONLY SUPPORTED FOR FLOATING POINT TENSORS");
+    constexpr size_t remaining_product = last_matrix_extracter<Tensor<T,Rest...>,
+        typename std_ext::make_index_sequence<sizeof...(Rest)-2>::type>::remaining_product;
+
+    constexpr size_t I = get_value<sizeof...(Rest)-1,Rest...>::value;
+    constexpr size_t J = get_value<sizeof...(Rest),Rest...>::value;
+    static_assert(I==J,"THE LAST TWO DIMENSIONS OF TENSOR MUST BE THE SAME");
+
+    const T *a_data = A.data();
+    T *r_data = R.data();
+    T *h_data = H.data();
+
+    FASTOR_IF_CONSTEXPR(SVDType == SVDCompType::Simple && J == 3) {
+        _polar_batch<T,3>(a_data,r_data,h_data,remaining_product);
+    }
+    else {
+        Tensor<T,J,J> a, ri, hi;
+        for (size_t i=0; i<remaining_product; ++i) {
+            std::copy(a_data+i*J*J,a_data+(i+1)*J*J,a.data());
+            internal::polar_dispatcher<SVDType>(a,ri,hi);
+            std::copy(ri.data(),ri.data()+J*J,r_data+i*J*J);
+            std::copy(hi.data(),hi.data()+J*J,h_data+i*J*J);
+        }
+    }
+}
+//-----------------------------------------------------------------------------------------------------------//
+//-----------------------------------------------------------------------------------------------------------//
+
+} // end of namespace Fastor
+
+
+#endif // UNARY_SVD_OP_H
@@ -17,6 +17,15 @@ private:
     bool _does_alias = false;
 
     constexpr FASTOR_INLINE Tensor<T,Rest...> get_tensor() const {return _expr;}
+
+    // Mask of the lanes of a SIMD vector starting at i that are in the filter, reversed
+    // like the masks of maskload and maskstore
+    FASTOR_INLINE void mask(FASTOR_INDEX i, int (&maska)[Tensor<T,Rest...>::simd_vector_type::Size]) const {
+        constexpr FASTOR_INDEX _Stride = Tensor<T,Rest...>::simd_vector_type::Size;
+        const bool *_fl = fl_expr.data();
+        for (FASTOR_INDEX j=0; j<_Stride; ++j)
+            maska[_Stride-j-1] = _fl[i+j] ? -1 : 0;
+    }
 public:
     using scalar_type = T;
     using simd_vector_type = typename Tensor<T,Rest...>::simd_vector_type;
@@ -48,9 +57,19 @@ public:
             FASTOR_ASSERT(src.dimension(i)==dimension(i), "TENSOR SHAPE MISMATCH");
         }
 #endif
-        for (FASTOR_INDEX i = 0; i <size(); i++) {
+        T *_data = _expr.data();
+        FASTOR_INDEX i = 0;
+#ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
+        for (; i <ROUND_DOWN(size(),Stride); i+=Stride) {
+            int maska[Stride];
+            mask(i,maska);
+            auto _vec_other = src.template eval<T>(i);
+            maskstore(_data+i,maska,_vec_other);
+        }
+#endif
+        for (; i <size(); i++) {
             if (fl_expr.eval_s(i)) {
-                _expr.data()[i] = src.template eval_s<T>(i);
+                _data[i] = src.template eval_s<T>(i);
             }
         }
     }
@@ -70,9 +89,21 @@ public:
             FASTOR_ASSERT(src.self().dimension(i)==dimension(i), "TENSOR SHAPE MISMATCH");
         }
 #endif
-        for (FASTOR_INDEX i = 0; i <size(); i++) {
+        T *_data = _expr.data();
+        FASTOR_INDEX i = 0;
+#ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
+        FASTOR_IF_CONSTEXPR(!is_boolean_expression_v<Derived>) {
+            for (; i <ROUND_DOWN(size(),Stride); i+=Stride) {
+                int maska[Stride];
+                mask(i,maska);
+                auto _vec_other = src.self().template eval<T>(i);
+                maskstore(_data+i,maska,_vec_other);
+            }
+        }
+#endif
+        for (; i <size(); i++) {
             if (fl_expr.eval_s(i)) {
-                _expr.data()[i] = src.self().template eval_s<T>(i);
+                _data[i] = src.self().template eval_s<T>(i);
             }
         }
     }
@@ -91,9 +122,22 @@ public:
             FASTOR_ASSERT(src.self().dimension(i)==dimension(i), "TENSOR SHAPE MISMATCH");
         }
 #endif
-        for (FASTOR_INDEX i = 0; i <size(); i++) {
+        T *_data = _expr.data();
+        FASTOR_INDEX i = 0;
+#ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
+        FASTOR_IF_CONSTEXPR(!is_boolean_expression_v<Derived>) {
+            for (; i <ROUND_DOWN(size(),Stride); i+=Stride) {
+                int maska[Stride];
+                mask(i,maska);
+                simd_vector_type _vec(_data+i,false);
+                _vec += src.self().template eval<T>(i);
+                maskstore(_data+i,maska,_vec);
+            }
+        }
+#endif
+        for (; i <size(); i++) {
             if (fl_expr.eval_s(i)) {
-                _expr.data()[i] += src.self().template eval_s<T>(i);
+                _data[i] += src.self().template eval_s<T>(i);
             }
         }
     }
@@ -112,9 +156,22 @@ public:
             FASTOR_ASSERT(src.self().dimension(i)==dimension(i), "TENSOR SHAPE MISMATCH");
         }
 #endif
-        for (FASTOR_INDEX i = 0; i <size(); i++) {
+        T *_data = _expr.data();
+        FASTOR_INDEX i = 0;
+#ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
+        FASTOR_IF_CONSTEXPR(!is_boolean_expression_v<Derived>) {
+            for (; i <ROUND_DOWN(size(),Stride); i+=Stride) {
+                int maska[Stride];
+                mask(i,maska);
+                simd_vector_type _vec(_data+i,false);
+                _vec -= src.self().template eval<T>(i);
+                maskstore(_data+i,maska,_vec);
+            }
+        }
+#endif
+        for (; i <size(); i++) {
             if (fl_expr.eval_s(i)) {
-                _expr.data()[i] -= src.self().template eval_s<T>(i);
+                _data[i] -= src.self().template eval_s<T>(i);
             }
         }
     }
@@ -133,9 +190,22 @@ public:
             FASTOR_ASSERT(src.self().dimension(i)==dimension(i), "TENSOR SHAPE MISMATCH");
         }
 #endif
-        for (FASTOR_INDEX i = 0; i <size(); i++) {
+        T *_data = _expr.data();
+        FASTOR_INDEX i = 0;
+#ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
+        FASTOR_IF_CONSTEXPR(!is_boolean_expression_v<Derived>) {
+            for (; i <ROUND_DOWN(size(),Stride); i+=Stride) {
+                int maska[Stride];
+                mask(i,maska);
+                simd_vector_type _vec(_data+i,false);
+                _vec *= src.self().template eval<T>(i);
+                maskstore(_data+i,maska,_vec);
+            }
+        }
+#endif
+        for (; i <size(); i++) {
             if (fl_expr.eval_s(i)) {
-                _expr.data()[i] *= src.self().template eval_s<T>(i);
+                _data[i] *= src.self().template eval_s<T>(i);
             }
         }
     }
@@ -154,9 +224,23 @@ public:
             FASTOR_ASSERT(src.self().dimension(i)==dimension(i), "TENSOR SHAPE MISMATCH");
         }
 #endif
-        for (FASTOR_INDEX i = 0; i <size(); i++) {
+        T *_data = _expr.data();
+        FASTOR_INDEX i = 0;
+#ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
+        // integer division traps on the divisors of the lanes that are masked out
+        FASTOR_IF_CONSTEXPR(!is_boolean_expression_v<Derived> && !is_integral_v_<T>) {
+            for (; i <ROUND_DOWN(size(),Stride); i+=Stride) {
+                int maska[Stride];
+                mask(i,maska);
+                simd_vector_type _vec(_data+i,false);
+                _vec /= src.self().template eval<T>(i);
+                maskstore(_data+i,maska,_vec);
+            }
+        }
+#endif
+        for (; i <size(); i++) {
             if (fl_expr.eval_s(i)) {
-                _expr.data()[i] /= src.self().template eval_s<T>(i);
+                _data[i] /= src.self().template eval_s<T>(i);
             }
         }
     }
@@ -165,9 +249,19 @@ public:
     template<typename U=T, enable_if_t_<is_arithmetic_v_<U>,bool> = false>
     void operator=(U num) {
         T tnum = (T)num;
-        for (FASTOR_INDEX i = 0; i <size(); i++) {
+        T *_data = _expr.data();
+        FASTOR_INDEX i = 0;
+#ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
+        simd_vector_type _vec_num(tnum);
+        for (; i <ROUND_DOWN(size(),Stride); i+=Stride) {
+            int maska[Stride];
+            mask(i,maska);
+                maskstore(_data+i,maska,_vec_num);
+        }
+#endif
+        for (; i <size(); i++) {
             if (fl_expr.eval_s(i)) {
-                _expr.data()[i] = tnum;
+                _data[i] = tnum;
             }
         }
     }
@@ -175,9 +269,21 @@ public:
     template<typename U=T, enable_if_t_<is_arithmetic_v_<U>,bool> = false>
     void operator+=(U num) {
         T tnum = (T)num;
-        for (FASTOR_INDEX i = 0; i <size(); i++) {
+        T *_data = _expr.data();
+        FASTOR_INDEX i = 0;
+#ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
+        simd_vector_type _vec_num(tnum);
+        for (; i <ROUND_DOWN(size(),Stride); i+=Stride) {
+            int maska[Stride];
+            mask(i,maska);
+                simd_vector_type _vec(_data+i,false);
+                _vec += _vec_num;
+                maskstore(_data+i,maska,_vec);
+        }
+#endif
+        for (; i <size(); i++) {
             if (fl_expr.eval_s(i)) {
-                _expr.data()[i] += tnum;
+                _data[i] += tnum;
             }
         }
     }
@@ -185,9 +291,21 @@ public:
     template<typename U=T, enable_if_t_<is_arithmetic_v_<U>,bool> = false>
     void operator-=(U num) {
         T tnum = (T)num;
-        for (FASTOR_INDEX i = 0; i <size(); i++) {
+        T *_data = _expr.data();
+        FASTOR_INDEX i = 0;
+#ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
+        simd_vector_type _vec_num(tnum);
+        for (; i <ROUND_DOWN(size(),Stride); i+=Stride) {
+            int maska[Stride];
+            mask(i,maska);
+                simd_vector_type _vec(_data+i,false);
+                _vec -= _vec_num;
+                maskstore(_data+i,maska,_vec);
+        }
+#endif
+        for (; i <size(); i++) {
             if (fl_expr.eval_s(i)) {
-                _expr.data()[i] -= tnum;
+                _data[i] -= tnum;
             }
         }
     }
@@ -195,9 +313,21 @@ public:
     template<typename U=T, enable_if_t_<is_arithmetic_v_<U>,bool> = false>
     void operator*=(U num) {
         T tnum = (T)num;
-        for (FASTOR_INDEX i = 0; i <size(); i++) {
+        T *_data = _expr.data();
+        FASTOR_INDEX i = 0;
+#ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
+        simd_vector_type _vec_num(tnum);
+        for (; i <ROUND_DOWN(size(),Stride); i+=Stride) {
+            int maska[Stride];
+            mask(i,maska);
+                simd_vector_type _vec(_data+i,false);
+                _vec *= _vec_num;
+                maskstore(_data+i,maska,_vec);
+        }
+#endif
+        for (; i <size(); i++) {
             if (fl_expr.eval_s(i)) {
-                _expr.data()[i] *= tnum;
+                _data[i] *= tnum;
             }
         }
     }
@@ -205,18 +335,31 @@ public:
     template<typename U=T, enable_if_t_<is_arithmetic_v_<U> && !is_integral_v_<U>,bool> = false>
     void operator/=(U num) {
         T tnum = T(1)/(T)num;
-        for (FASTOR_INDEX i = 0; i <size(); i++) {
+        T *_data = _expr.data();
+        FASTOR_INDEX i = 0;
+#ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
+        simd_vector_type _vec_num(tnum);
+        for (; i <ROUND_DOWN(size(),Stride); i+=Stride) {
+            int maska[Stride];
+            mask(i,maska);
+                simd_vector_type _vec(_data+i,false);
+                _vec *= _vec_num;
+                maskstore(_data+i,maska,_vec);
+        }
+#endif
+        for (; i <size(); i++) {
             if (fl_expr.eval_s(i)) {
-                _expr.data()[i] *= tnum;
+                _data[i] *= tnum;
             }
         }
     }
     template<typename U=T, enable_if_t_<is_arithmetic_v_<U> && is_integral_v_<U>,bool> = false>
     void operator/=(U num) {
         T tnum = (T)num;
+        T *_data = _expr.data();
         for (FASTOR_INDEX i = 0; i <size(); i++) {
             if (fl_expr.eval_s(i)) {
-                _expr.data()[i] /= tnum;
+                _data[i] /= tnum;
             }
         }
     }
@@ -224,7 +367,13 @@ public:
 
 
     //------------------------------------------------------------------------------------//
-    template<typename U=T>
+    template<typename U=T, enable_if_t_<std::is_same<U,T>::value,bool> = false>
+    FASTOR_INLINE SIMDVector<U,simd_abi_type> eval(FASTOR_INDEX i) const {
+        int maska[Stride];
+        mask(i,maska);
+        return maskload<SIMDVector<T,simd_abi_type>>(_expr.data()+i,maska);
+    }
+    template<typename U=T, enable_if_t_<!std::is_same<U,T>::value,bool> = false>
     FASTOR_INLINE SIMDVector<U,simd_abi_type> eval(FASTOR_INDEX i) const {
         constexpr size_t _Stride = SIMDVector<T,simd_abi_type>::Size;
         SIMDVector<U,simd_abi_type> _vec;
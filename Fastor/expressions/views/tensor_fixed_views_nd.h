@@ -5,6 +5,7 @@
 #include "Fastor/tensor/Tensor.h"
 #include "Fastor/tensor/Ranges.h"
 #include "Fastor/expressions/linalg_ops/linalg_traits.h"
+#include "Fastor/expressions/views/tensor_views_strided.h"
 
 
 namespace Fastor {
@@ -125,35 +126,15 @@ public:
         return _expr.eval_s(ind);
     }
 
+    // SIMD vectors are only ever requested within a row of the view
     template<typename U=T>
     FASTOR_INLINE SIMDVector<U,simd_abi_type> teval(const std::array<int,DIMS>& as) const {
         int ind = 0;
         get_index_s<0,DIMS-1>::Do(ind, as);
-        FASTOR_IF_CONSTEXPR (_is_vectorisable) return SIMDVector<T,simd_abi_type>(&_expr.data()[ind],false);
-        else FASTOR_IF_CONSTEXPR (_is_strided_vectorisable) {
-            V _vec;
-            vector_setter(_vec,_expr.data(),ind,get_nth_pt<DIMS-1,Fseqs...>::_step);
-            return _vec;
-        }
+        FASTOR_IF_CONSTEXPR (get_nth_pt<DIMS-1,Fseqs...>::_step==1) return SIMDVector<T,simd_abi_type>(&_expr.data()[ind],false);
         else {
-
             V _vec;
-            std::array<int,V::Size> inds = {};
-            std::array<int,DIMS> as_ = as;
-            for (auto j=0; j<V::Size; ++j) {
-                get_index_v<0,DIMS-1>::Do(j, inds, as);
-
-                for(int jt = (int)DIMS-1; jt>=0; jt--)
-                {
-                  as_[jt] +=1;
-                  if(as_[jt]<_dims[jt])
-                      break;
-                  else
-                      as_[jt]=0;
-                }
-            }
-
-            vector_setter(_vec,_expr.data(),inds);
+            vector_setter(_vec,_expr.data(),ind,get_nth_pt<DIMS-1,Fseqs...>::_step);
             return _vec;
         }
     }
@@ -170,6 +151,17 @@ public:
 
     //----------------------------------------------------------------------------------------------//
 private:
+    static FASTOR_INLINE std::array<int,DIMS> _strides() {
+        std::array<int,DIMS> _s = {{int(to_positive_t<Fseqs,Rest>::_step)...}};
+        for (FASTOR_INDEX it=0; it<DIMS; ++it) _s[it] *= products_[it];
+        return _s;
+    }
+    static FASTOR_INLINE int _offset() {
+        int ind = 0;
+        get_index_s<0,DIMS-1>::Do(ind, std::array<int,DIMS>{});
+        return ind;
+    }
+
     template<size_t from, size_t to>
     struct get_index_v {
         template<size_t DIMS, size_t VSize>
@@ -289,62 +281,10 @@ public:
         }
 #endif
 
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            // constexpr FASTOR_INDEX stride = V::Size;
-            V _vec;
-            while(counter < total)
-            {
-                int ind = 0;
-                // for(int it = 0; it< DIMS; it++) {
-                //     ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                // }
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                _vec = other.template teval<T>(as);
-                _vec.store(&_data[ind],false);
-
-                counter+=V::Size;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=V::Size;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else {
-            while(counter < total)
-            {
-                int ind = 0;
-                // for(int it = 0; it< DIMS; it++) {
-                //     ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                // }
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                _data[ind] = other.template teval_s<T>(as);
-                // print(as);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] += 1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        internal::strided_view_apply<false,V>(_expr.data(),_offset(),_dims,_strides(),
+            [&](const V &, const std::array<int,DIMS> &as, int) {return other.template teval<T>(as);},
+            [&](T &_elem, const std::array<int,DIMS> &as, int) {_elem = other.template teval_s<T>(as);});
     }
     //----------------------------------------------------------------------------------------------//
 
@@ -374,97 +314,10 @@ public:
 #ifndef NDEBUG
         FASTOR_ASSERT(other_src.size()==this->size(), "TENSOR SIZE MISMATCH");
 #endif
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            while(counter < total)
-            {
-                int ind = 0;
-                // for(int it = 0; it< DIMS; it++) {
-                //     ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                // }
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                // V _vec = other_src.template eval<T>(counter);
-                V _vec = other_src.template teval<T>(as);
-                _vec.store(&_data[ind],false);
-
-                counter+=V::Size;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=V::Size;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else
-        {
-            while(counter < total)
-            {
-                int ind = 0;
-                // for(int it = 0; it< DIMS; it++) {
-                //     ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                // }
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                // _data[ind] = other_src.template eval_s<T>(counter);
-                _data[ind] = other_src.template teval_s<T>(as);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-
-            // // Generic vectorised version that takes care of the remainder scalar ops
-            // using V=SIMDVector<T,simd_abi_type>;
-            // while(counter < total)
-            // {
-            //     int ind = 0;
-            //     for(int it = 0; it< DIMS; it++) {
-            //         ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-            //     }
-            //     get_index_s<0,DIMS-1>::Do(ind, as);
-            //     if (_dims[DIMS-1] - as[DIMS-1] % V::Size == 0) {
-            //         // V _vec = other_src.template eval<T>(counter);
-            //         V _vec = other_src.template teval<T>(as);
-            //         _vec.store(&_data[ind],false);
-            //         counter+=V::Size;
-            //     }
-            //     else {
-            //         // _data[ind] = other_src.template eval_s<T>(counter);
-            //         _data[ind] = other_src.template teval_s<T>(as);
-            //         counter++;
-            //     }
-
-            //     for(jt = DIMS-1; jt>=0; jt--)
-            //     {
-            //         if (jt == _dims.size()-1) as[jt]+=V::Size;
-            //         else as[jt] +=1;
-            //         if(as[jt]<_dims[jt])
-            //             break;
-            //         else
-            //             as[jt]=0;
-            //     }
-            //     if(jt<0)
-            //         break;
-            // }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        internal::strided_view_apply<false,V>(_expr.data(),_offset(),_dims,_strides(),
+            [&](const V &, const std::array<int,DIMS> &as, int) {return other_src.template teval<T>(as);},
+            [&](T &_elem, const std::array<int,DIMS> &as, int) {_elem = other_src.template teval_s<T>(as);});
     }
     template<typename Derived, size_t OTHER_DIMS, enable_if_t_<OTHER_DIMS==DIMS && requires_evaluation_v<Derived>,bool> = false>
     FASTOR_HINT_INLINE void operator+=(const AbstractTensor<Derived,OTHER_DIMS> &other) {
@@ -490,60 +343,10 @@ public:
 #ifndef NDEBUG
         FASTOR_ASSERT(other_src.size()==this->size(), "TENSOR SIZE MISMATCH");
 #endif
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            V _vec_out;
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                // V _vec = other_src.template eval<T>(counter);
-                V _vec = other_src.template teval<T>(as);
-                _vec_out.load(&_data[ind],false);
-                _vec_out += _vec;
-                _vec_out.store(&_data[ind],false);
-
-                counter+=V::Size;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=V::Size;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else
-        {
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                // _data[ind] += other_src.template eval_s<T>(counter);
-                _data[ind] += other_src.template teval_s<T>(as);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        internal::strided_view_apply<true,V>(_expr.data(),_offset(),_dims,_strides(),
+            [&](const V &_vec, const std::array<int,DIMS> &as, int) {return _vec + other_src.template teval<T>(as);},
+            [&](T &_elem, const std::array<int,DIMS> &as, int) {_elem += other_src.template teval_s<T>(as);});
     }
 
 
@@ -571,60 +374,10 @@ public:
 #ifndef NDEBUG
         FASTOR_ASSERT(other_src.size()==this->size(), "TENSOR SIZE MISMATCH");
 #endif
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            V _vec_out;
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                // V _vec = other_src.template eval<T>(counter);
-                V _vec = other_src.template teval<T>(as);
-                _vec_out.load(&_data[ind],false);
-                _vec_out -= _vec;
-                _vec_out.store(&_data[ind],false);
-
-                counter+=V::Size;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=V::Size;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else
-        {
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                // _data[ind] -= other_src.template eval_s<T>(counter);
-                _data[ind] -= other_src.template teval_s<T>(as);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        internal::strided_view_apply<true,V>(_expr.data(),_offset(),_dims,_strides(),
+            [&](const V &_vec, const std::array<int,DIMS> &as, int) {return _vec - other_src.template teval<T>(as);},
+            [&](T &_elem, const std::array<int,DIMS> &as, int) {_elem -= other_src.template teval_s<T>(as);});
     }
 
     template<typename Derived, size_t OTHER_DIMS, enable_if_t_<OTHER_DIMS==DIMS && requires_evaluation_v<Derived>,bool> = false>
@@ -651,60 +404,10 @@ public:
 #ifndef NDEBUG
         FASTOR_ASSERT(other_src.size()==this->size(), "TENSOR SIZE MISMATCH");
 #endif
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            V _vec_out;
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                // V _vec = other_src.template eval<T>(counter);
-                V _vec = other_src.template teval<T>(as);
-                _vec_out.load(&_data[ind],false);
-                _vec_out *= _vec;
-                _vec_out.store(&_data[ind],false);
-
-                counter+=V::Size;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=V::Size;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else
-        {
-             while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                // _data[ind] *= other_src.template eval_s<T>(counter);
-                _data[ind] *= other_src.template teval_s<T>(as);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        internal::strided_view_apply<true,V>(_expr.data(),_offset(),_dims,_strides(),
+            [&](const V &_vec, const std::array<int,DIMS> &as, int) {return _vec * other_src.template teval<T>(as);},
+            [&](T &_elem, const std::array<int,DIMS> &as, int) {_elem *= other_src.template teval_s<T>(as);});
     }
 
     template<typename Derived, size_t OTHER_DIMS, enable_if_t_<OTHER_DIMS==DIMS && requires_evaluation_v<Derived>,bool> = false>
@@ -731,60 +434,10 @@ public:
 #ifndef NDEBUG
         FASTOR_ASSERT(other_src.size()==this->size(), "TENSOR SIZE MISMATCH");
 #endif
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            V _vec_out;
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                // V _vec = other_src.template eval<T>(counter);
-                V _vec = other_src.template teval<T>(as);
-                _vec_out.load(&_data[ind],false);
-                _vec_out /= _vec;
-                _vec_out.store(&_data[ind],false);
-
-                counter+=V::Size;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=V::Size;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else
-        {
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                // _data[ind] /= other_src.template eval_s<T>(counter);
-                _data[ind] /= other_src.template teval_s<T>(as);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        internal::strided_view_apply<true,V>(_expr.data(),_offset(),_dims,_strides(),
+            [&](const V &_vec, const std::array<int,DIMS> &as, int) {return _vec / other_src.template teval<T>(as);},
+            [&](T &_elem, const std::array<int,DIMS> &as, int) {_elem /= other_src.template teval_s<T>(as);});
     }
     //----------------------------------------------------------------------------------------------//
 
@@ -815,57 +468,10 @@ public:
 #ifndef NDEBUG
         FASTOR_ASSERT(other_src.size()==this->size(), "TENSOR SIZE MISMATCH");
 #endif
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                V _vec = other_src.template eval<T>(counter);
-                // V _vec = other_src.template teval<T>(as);
-                _vec.store(&_data[ind],false);
-
-                counter+=V::Size;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=V::Size;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else
-        {
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                _data[ind] = other_src.template eval_s<T>(counter);
-                // _data[ind] = other_src.template teval_s<T>(as);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        internal::strided_view_apply<false,V>(_expr.data(),_offset(),_dims,_strides(),
+            [&](const V &, const std::array<int,DIMS> &, int counter) {return other_src.template eval<T>(counter);},
+            [&](T &_elem, const std::array<int,DIMS> &, int counter) {_elem = other_src.template eval_s<T>(counter);});
     }
 
     template<typename Derived, size_t OTHER_DIMS, enable_if_t_<OTHER_DIMS!=DIMS && requires_evaluation_v<Derived>,bool> = false>
@@ -892,60 +498,10 @@ public:
 #ifndef NDEBUG
         FASTOR_ASSERT(other_src.size()==this->size(), "TENSOR SIZE MISMATCH");
 #endif
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            constexpr FASTOR_INDEX stride = V::Size;
-            V _vec_out;
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                V _vec = other_src.template eval<T>(counter);
-                // V _vec = other_src.template teval<T>(as);
-                _vec_out.load(&_data[ind],false);
-                _vec_out += _vec;
-                _vec_out.store(&_data[ind],false);
-
-                counter+=V::Size;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=stride;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else {
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                _data[ind] += other_src.template eval_s<T>(counter);
-                // _data[ind] += other_src.template teval_s<T>(as);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        internal::strided_view_apply<true,V>(_expr.data(),_offset(),_dims,_strides(),
+            [&](const V &_vec, const std::array<int,DIMS> &, int counter) {return _vec + other_src.template eval<T>(counter);},
+            [&](T &_elem, const std::array<int,DIMS> &, int counter) {_elem += other_src.template eval_s<T>(counter);});
     }
 
     template<typename Derived, size_t OTHER_DIMS, enable_if_t_<OTHER_DIMS!=DIMS && requires_evaluation_v<Derived>,bool> = false>
@@ -972,59 +528,10 @@ public:
 #ifndef NDEBUG
         FASTOR_ASSERT(other_src.size()==this->size(), "TENSOR SIZE MISMATCH");
 #endif
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            V _vec_out;
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                V _vec = other_src.template eval<T>(counter);
-                // V _vec = other_src.template teval<T>(as);
-                _vec_out.load(&_data[ind],false);
-                _vec_out -= _vec;
-                _vec_out.store(&_data[ind],false);
-
-                counter+=V::Size;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=V::Size;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else {
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                _data[ind] -= other_src.template eval_s<T>(counter);
-                // _data[ind] -= other_src.template teval_s<T>(as);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        internal::strided_view_apply<true,V>(_expr.data(),_offset(),_dims,_strides(),
+            [&](const V &_vec, const std::array<int,DIMS> &, int counter) {return _vec - other_src.template eval<T>(counter);},
+            [&](T &_elem, const std::array<int,DIMS> &, int counter) {_elem -= other_src.template eval_s<T>(counter);});
     }
 
     template<typename Derived, size_t OTHER_DIMS, enable_if_t_<OTHER_DIMS!=DIMS && requires_evaluation_v<Derived>,bool> = false>
@@ -1051,60 +558,10 @@ public:
 #ifndef NDEBUG
         FASTOR_ASSERT(other_src.size()==this->size(), "TENSOR SIZE MISMATCH");
 #endif
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            constexpr FASTOR_INDEX stride = V::Size;
-            V _vec_out;
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                V _vec = other_src.template eval<T>(counter);
-                // V _vec = other_src.template teval<T>(as);
-                _vec_out.load(&_data[ind],false);
-                _vec_out *= _vec;
-                _vec_out.store(&_data[ind],false);
-
-                counter+=V::Size;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=stride;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else {
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                _data[ind] *= other_src.template eval_s<T>(counter);
-                // _data[ind] *= other_src.template teval_s<T>(as);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        internal::strided_view_apply<true,V>(_expr.data(),_offset(),_dims,_strides(),
+            [&](const V &_vec, const std::array<int,DIMS> &, int counter) {return _vec * other_src.template eval<T>(counter);},
+            [&](T &_elem, const std::array<int,DIMS> &, int counter) {_elem *= other_src.template eval_s<T>(counter);});
     }
 
     template<typename Derived, size_t OTHER_DIMS, enable_if_t_<OTHER_DIMS!=DIMS && requires_evaluation_v<Derived>,bool> = false>
@@ -1131,60 +588,10 @@ public:
 #ifndef NDEBUG
         FASTOR_ASSERT(other_src.size()==this->size(), "TENSOR SIZE MISMATCH");
 #endif
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            constexpr FASTOR_INDEX stride = V::Size;
-            V _vec_out;
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                V _vec = other_src.template eval<T>(counter);
-                // V _vec = other_src.template teval<T>(as);
-                _vec_out.load(&_data[ind],false);
-                _vec_out /= _vec;
-                _vec_out.store(&_data[ind],false);
-
-                counter+=V::Size;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=stride;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else {
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                _data[ind] /= other_src.template eval_s<T>(counter);
-                // _data[ind] /= other_src.template teval_s<T>(as);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        internal::strided_view_apply<true,V>(_expr.data(),_offset(),_dims,_strides(),
+            [&](const V &_vec, const std::array<int,DIMS> &, int counter) {return _vec / other_src.template eval<T>(counter);},
+            [&](T &_elem, const std::array<int,DIMS> &, int counter) {_elem /= other_src.template eval_s<T>(counter);});
     }
 
     // scalar binders
@@ -1192,283 +599,51 @@ public:
     template<typename U=T, enable_if_t_<is_primitive_v_<U>,bool> = false>
     FASTOR_HINT_INLINE void operator=(U num) {
 
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            constexpr FASTOR_INDEX stride = V::Size;
-            V _vec = (T)num;
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                _vec.store(&_data[ind],false);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=stride;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else {
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                _data[ind] = (T)num;
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        const V _num = (T)num;
+        internal::strided_view_apply<false,V>(_expr.data(),_offset(),_dims,_strides(),
+            [&](const V &, const std::array<int,DIMS> &, int) {return _num;},
+            [&](T &_elem, const std::array<int,DIMS> &, int) {_elem = (T)num;});
     }
 
     template<typename U=T, enable_if_t_<is_primitive_v_<U>,bool> = false>
     FASTOR_HINT_INLINE void operator+=(U num) {
 
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            constexpr FASTOR_INDEX stride = V::Size;
-            V _vec = (T)num;
-            V _vec_out;
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                _vec_out.load(&_data[ind],false);
-                _vec_out += _vec;
-                _vec_out.store(&_data[ind],false);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=stride;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else {
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                _data[ind] += (T)num;
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        const V _num = (T)num;
+        internal::strided_view_apply<true,V>(_expr.data(),_offset(),_dims,_strides(),
+            [&](const V &_vec, const std::array<int,DIMS> &, int) {return _vec + _num;},
+            [&](T &_elem, const std::array<int,DIMS> &, int) {_elem += (T)num;});
     }
 
     template<typename U=T, enable_if_t_<is_primitive_v_<U>,bool> = false>
     FASTOR_HINT_INLINE void operator-=(U num) {
 
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            constexpr FASTOR_INDEX stride = V::Size;
-            V _vec = (T)num;
-            V _vec_out;
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                _vec_out.load(&_data[ind],false);
-                _vec_out -= _vec;
-                _vec_out.store(&_data[ind],false);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=stride;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else {
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                _data[ind] -= (T)num;
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        const V _num = (T)num;
+        internal::strided_view_apply<true,V>(_expr.data(),_offset(),_dims,_strides(),
+            [&](const V &_vec, const std::array<int,DIMS> &, int) {return _vec - _num;},
+            [&](T &_elem, const std::array<int,DIMS> &, int) {_elem -= (T)num;});
     }
 
     template<typename U=T, enable_if_t_<is_primitive_v_<U>,bool> = false>
     FASTOR_HINT_INLINE void operator*=(U num) {
 
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            constexpr FASTOR_INDEX stride = V::Size;
-            V _vec = (T)num;
-            V _vec_out;
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                _vec_out.load(&_data[ind],false);
-                _vec_out *= _vec;
-                _vec_out.store(&_data[ind],false);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=stride;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else {
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                _data[ind] *= (T)num;
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        const V _num = (T)num;
+        internal::strided_view_apply<true,V>(_expr.data(),_offset(),_dims,_strides(),
+            [&](const V &_vec, const std::array<int,DIMS> &, int) {return _vec * _num;},
+            [&](T &_elem, const std::array<int,DIMS> &, int) {_elem *= (T)num;});
     }
 
     template<typename U=T, enable_if_t_<is_primitive_v_<U>,bool> = false>
     FASTOR_HINT_INLINE void operator/=(U num) {
 
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            constexpr FASTOR_INDEX stride = V::Size;
-            V _vec = (T)num;
-            V _vec_out;
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                _vec_out.load(&_data[ind],false);
-                _vec_out /= _vec;
-                _vec_out.store(&_data[ind],false);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=stride;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else {
-            while(counter < total)
-            {
-                int ind = 0;
-                get_index_s<0,DIMS-1>::Do(ind, as);
-                _data[ind] /= (T)num;
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        const V _num = (T)num;
+        internal::strided_view_apply<true,V>(_expr.data(),_offset(),_dims,_strides(),
+            [&](const V &_vec, const std::array<int,DIMS> &, int) {return _vec / _num;},
+            [&](T &_elem, const std::array<int,DIMS> &, int) {_elem /= (T)num;});
     }
     //----------------------------------------------------------------------------------//
 
@@ -1547,35 +722,15 @@ public:
         return _expr.eval_s(ind);
     }
 
+    // SIMD vectors are only ever requested within a row of the view
     template<typename U=T>
     FASTOR_INLINE SIMDVector<U,simd_abi_type> teval(const std::array<int,DIMS>& as) const {
         int ind = 0;
         get_index_s<0,DIMS-1>::Do(ind, as);
-        FASTOR_IF_CONSTEXPR (_is_vectorisable) return SIMDVector<T,simd_abi_type>(&_expr.data()[ind],false);
-        else FASTOR_IF_CONSTEXPR (_is_strided_vectorisable) {
-            V _vec;
-            vector_setter(_vec,_expr.data(),ind,get_nth_pt<DIMS-1,Fseqs...>::_step);
-            return _vec;
-        }
+        FASTOR_IF_CONSTEXPR (get_nth_pt<DIMS-1,Fseqs...>::_step==1) return SIMDVector<T,simd_abi_type>(&_expr.data()[ind],false);
         else {
-
             V _vec;
-            std::array<int,V::Size> inds = {};
-            std::array<int,DIMS> as_ = as;
-            for (auto j=0; j<V::Size; ++j) {
-                get_index_v<0,DIMS-1>::Do(j, inds, as);
-
-                for(int jt = (int)DIMS-1; jt>=0; jt--)
-                {
-                  as_[jt] +=1;
-                  if(as_[jt]<_dims[jt])
-                      break;
-                  else
-                      as_[jt]=0;
-                }
-            }
-
-            vector_setter(_vec,_expr.data(),inds);
+            vector_setter(_vec,_expr.data(),ind,get_nth_pt<DIMS-1,Fseqs...>::_step);
             return _vec;
         }
     }
@@ -1592,6 +747,17 @@ public:
 
     //----------------------------------------------------------------------------------------------//
 private:
+    static FASTOR_INLINE std::array<int,DIMS> _strides() {
+        std::array<int,DIMS> _s = {{int(to_positive_t<Fseqs,Rest>::_step)...}};
+        for (FASTOR_INDEX it=0; it<DIMS; ++it) _s[it] *= products_[it];
+        return _s;
+    }
+    static FASTOR_INLINE int _offset() {
+        int ind = 0;
+        get_index_s<0,DIMS-1>::Do(ind, std::array<int,DIMS>{});
+        return ind;
+    }
+
     template<size_t from, size_t to>
     struct get_index_v {
         template<size_t DIMS, size_t VSize>
@@ -3,11 +3,49 @@
 
 #include "Fastor/tensor/Tensor.h"
 #include "Fastor/expressions/linalg_ops/linalg_traits.h"
+#include <algorithm>
+#include <thread>
+#include <vector>
 
 
 namespace Fastor {
 
 
+namespace internal {
+// Gather, update and scatter a SIMD vector worth of elements of a random view. Lanes
+// that hit the same element are applied one after the other instead, otherwise all but
+// one of their updates would be lost. Additions go through the scatter-add kernel which
+// sums such lanes in registers where it can [see backend/scatter_add.h]
+#define FASTOR_MAKE_RANDOM_VIEW_UPDATE(NAME, OP)\
+template<typename T, typename ABI, size_t N>\
+FASTOR_INLINE void random_view_ ##NAME (T *FASTOR_RESTRICT data, const std::array<int,N> &inds, const SIMDVector<T,ABI> &vec) {\
+    if (has_index_conflict(inds)) {\
+        T tmp[N];\
+        vec.store(tmp,false);\
+        for (FASTOR_INDEX j=0; j<N; ++j) {\
+            data[inds[j]] OP tmp[j];\
+        }\
+        return;\
+    }\
+    SIMDVector<T,ABI> _vec;\
+    vector_setter(_vec,data,inds);\
+    _vec OP vec;\
+    data_setter(data,_vec,inds);\
+}\
+
+template<typename T, typename ABI, size_t N>
+FASTOR_INLINE void random_view_add(T *FASTOR_RESTRICT data, const std::array<int,N> &inds, const SIMDVector<T,ABI> &vec) {
+    _scatter_add_vec(data,inds,vec);
+}
+template<typename T, typename ABI, size_t N>
+FASTOR_INLINE void random_view_sub(T *FASTOR_RESTRICT data, const std::array<int,N> &inds, const SIMDVector<T,ABI> &vec) {
+    _scatter_add_vec(data,inds,-vec);
+}
+FASTOR_MAKE_RANDOM_VIEW_UPDATE(mul, *=)
+FASTOR_MAKE_RANDOM_VIEW_UPDATE(div, /=)
+} // internal
+
+
 // Const versions
 //----------------------------------------------------------------------------------//
 template<typename T, size_t N, typename Int, size_t IterSize>
@@ -174,6 +212,14 @@ private:
     bool _does_alias = false;
 
     constexpr FASTOR_INLINE Tensor<T,N> get_tensor() const {return _expr;};
+
+    // Indices of the elements of _expr that a SIMD vector starting at i is written to
+    FASTOR_INLINE std::array<int,Tensor<T,N>::simd_vector_type::Size> indices(FASTOR_INDEX i) const {
+        std::array<int,Tensor<T,N>::simd_vector_type::Size> inds;
+        for (FASTOR_INDEX j=0; j<Tensor<T,N>::simd_vector_type::Size; ++j)
+            inds[j] = static_cast<int>(_expr.get_flat_index(it_expr(i+j)));
+        return inds;
+    }
 public:
     using scalar_type = T;
     using simd_vector_type = typename Tensor<T,N>::simd_vector_type;
@@ -222,9 +268,7 @@ public:
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
             auto _vec_other = other_src.template eval<T>(i);
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _expr(it_expr(i+j)) = _vec_other[j];
-            }
+            data_setter(_expr.data(),_vec_other,indices(i));
         }
         for (; i <size(); i++) {
             _expr(it_expr(i)) = other_src.template eval_s<T>(i);
@@ -273,9 +317,7 @@ public:
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
             auto _vec_other = other_src.template eval<T>(i);
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _expr(it_expr(i+j)) = _vec_other[j];
-            }
+            data_setter(_expr.data(),_vec_other,indices(i));
         }
         for (; i <size(); i++) {
             _expr(it_expr(i)) = other_src.template eval_s<T>(i);
@@ -315,9 +357,7 @@ public:
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
             auto _vec_other = other_src.template eval<T>(i);
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _expr(it_expr(i+j)) += _vec_other[j];
-            }
+            internal::random_view_add(_expr.data(),indices(i),_vec_other);
         }
         for (; i <size(); i++) {
             _expr(it_expr(i)) += other_src.template eval_s<T>(i);
@@ -357,9 +397,7 @@ public:
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
             auto _vec_other = other_src.template eval<T>(i);
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _expr(it_expr(i+j)) -= _vec_other[j];
-            }
+            internal::random_view_sub(_expr.data(),indices(i),_vec_other);
         }
         for (; i <size(); i++) {
             _expr(it_expr(i)) -= other_src.template eval_s<T>(i);
@@ -399,9 +437,7 @@ public:
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
             auto _vec_other = other_src.template eval<T>(i);
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _expr(it_expr(i+j)) *= _vec_other[j];
-            }
+            internal::random_view_mul(_expr.data(),indices(i),_vec_other);
         }
         for (; i <size(); i++) {
             _expr(it_expr(i)) *= other_src.template eval_s<T>(i);
@@ -441,9 +477,7 @@ public:
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
             auto _vec_other = other_src.template eval<T>(i);
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _expr(it_expr(i+j)) /= _vec_other[j];
-            }
+            internal::random_view_div(_expr.data(),indices(i),_vec_other);
         }
         for (; i <size(); i++) {
             _expr(it_expr(i)) /= other_src.template eval_s<T>(i);
@@ -465,9 +499,7 @@ public:
         SIMDVector<T,simd_abi_type> _vec_other(static_cast<T>(num));
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _expr(it_expr(i+j)) = _vec_other[j];
-            }
+            data_setter(_expr.data(),_vec_other,indices(i));
         }
         for (; i <size(); i++) {
             _expr(it_expr(i)) = num;
@@ -485,9 +517,7 @@ public:
         SIMDVector<T,simd_abi_type> _vec_other(static_cast<T>(num));
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _expr(it_expr(i+j)) += _vec_other[j];
-            }
+            internal::random_view_add(_expr.data(),indices(i),_vec_other);
         }
         for (; i <size(); i++) {
             _expr(it_expr(i)) += num;
@@ -505,9 +535,7 @@ public:
         SIMDVector<T,simd_abi_type> _vec_other(static_cast<T>(num));
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _expr(it_expr(i+j)) -= _vec_other[j];
-            }
+            internal::random_view_sub(_expr.data(),indices(i),_vec_other);
         }
         for (; i <size(); i++) {
             _expr(it_expr(i)) -= num;
@@ -525,9 +553,7 @@ public:
         SIMDVector<T,simd_abi_type> _vec_other(static_cast<T>(num));
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _expr(it_expr(i+j)) *= _vec_other[j];
-            }
+            internal::random_view_mul(_expr.data(),indices(i),_vec_other);
         }
         for (; i <size(); i++) {
             _expr(it_expr(i)) *= num;
@@ -546,9 +572,7 @@ public:
         SIMDVector<T,simd_abi_type> _vec_other(inum);
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _expr(it_expr(i+j)) *= _vec_other[j];
-            }
+            internal::random_view_mul(_expr.data(),indices(i),_vec_other);
         }
         for (; i <size(); i++) {
             _expr(it_expr(i)) *= inum;
@@ -566,9 +590,7 @@ public:
         SIMDVector<T,simd_abi_type> _vec_other(static_cast<T>(num));
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _expr(it_expr(i+j)) /= _vec_other[j];
-            }
+            internal::random_view_div(_expr.data(),indices(i),_vec_other);
         }
         for (; i <size(); i++) {
             _expr(it_expr(i)) /= num;
@@ -701,6 +723,14 @@ private:
     bool _does_alias = false;
 
     constexpr FASTOR_INLINE Tensor<T,Rest...> get_tensor() const {return _expr;}
+
+    // Indices of the elements of _expr that a SIMD vector starting at i is written to
+    FASTOR_INLINE std::array<int,Tensor<T,Rest...>::simd_vector_type::Size> indices(FASTOR_INDEX i) const {
+        std::array<int,Tensor<T,Rest...>::simd_vector_type::Size> inds;
+        for (FASTOR_INDEX j=0; j<Tensor<T,Rest...>::simd_vector_type::Size; ++j)
+            inds[j] = static_cast<int>(it_expr.data()[i+j]);
+        return inds;
+    }
 public:
     using scalar_type = T;
     using simd_vector_type = typename Tensor<T,Rest...>::simd_vector_type;
@@ -750,9 +780,7 @@ public:
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
             auto _vec_other = other_src.template eval<T>(i);
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _data[it_expr.data()[i+j]] = _vec_other[j];
-            }
+            data_setter(_data,_vec_other,indices(i));
         }
         for (; i <size(); i++) {
             _data[it_expr.data()[i]] = other_src.template eval_s<T>(i);
@@ -796,9 +824,7 @@ public:
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
             auto _vec_other = other_src.template eval<T>(i);
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _data[it_expr.data()[i+j]] = _vec_other[j];
-            }
+            data_setter(_data,_vec_other,indices(i));
         }
         for (; i <size(); i++) {
             _data[it_expr.data()[i]] = other_src.template eval_s<T>(i);
@@ -834,9 +860,7 @@ public:
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
             auto _vec_other = other_src.template eval<T>(i);
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _data[it_expr.data()[i+j]] += _vec_other[j];
-            }
+            internal::random_view_add(_data,indices(i),_vec_other);
         }
         for (; i <size(); i++) {
             _data[it_expr.data()[i]] += other_src.template eval_s<T>(i);
@@ -872,9 +896,7 @@ public:
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
             auto _vec_other = other_src.template eval<T>(i);
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _data[it_expr.data()[i+j]] -= _vec_other[j];
-            }
+            internal::random_view_sub(_data,indices(i),_vec_other);
         }
         for (; i <size(); i++) {
             _data[it_expr.data()[i]] -= other_src.template eval_s<T>(i);
@@ -910,9 +932,7 @@ public:
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
             auto _vec_other = other_src.template eval<T>(i);
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _data[it_expr.data()[i+j]] *= _vec_other[j];
-            }
+            internal::random_view_mul(_data,indices(i),_vec_other);
         }
         for (; i <size(); i++) {
             _data[it_expr.data()[i]] *= other_src.template eval_s<T>(i);
@@ -948,9 +968,7 @@ public:
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
             auto _vec_other = other_src.template eval<T>(i);
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _data[it_expr.data()[i+j]] /= _vec_other[j];
-            }
+            internal::random_view_div(_data,indices(i),_vec_other);
         }
         for (; i <size(); i++) {
             _data[it_expr.data()[i]] /= other_src.template eval_s<T>(i);
@@ -971,9 +989,7 @@ public:
         SIMDVector<T,simd_abi_type> _vec_other(num);
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _data[it_expr.data()[i+j]] = _vec_other[j];
-            }
+            data_setter(_data,_vec_other,indices(i));
         }
         for (; i <size(); i++) {
             _data[it_expr.data()[i]] = num;
@@ -992,9 +1008,7 @@ public:
         SIMDVector<T,simd_abi_type> _vec_other(num);
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _data[it_expr.data()[i+j]] += _vec_other[j];
-            }
+            internal::random_view_add(_data,indices(i),_vec_other);
         }
         for (; i <size(); i++) {
             _data[it_expr.data()[i]] += num;
@@ -1013,9 +1027,7 @@ public:
         SIMDVector<T,simd_abi_type> _vec_other(num);
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _data[it_expr.data()[i+j]] -= _vec_other[j];
-            }
+            internal::random_view_sub(_data,indices(i),_vec_other);
         }
         for (; i <size(); i++) {
             _data[it_expr.data()[i]] -= num;
@@ -1034,9 +1046,7 @@ public:
         SIMDVector<T,simd_abi_type> _vec_other(num);
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _data[it_expr.data()[i+j]] *= _vec_other[j];
-            }
+            internal::random_view_mul(_data,indices(i),_vec_other);
         }
         for (; i <size(); i++) {
             _data[it_expr.data()[i]] *= num;
@@ -1056,9 +1066,7 @@ public:
         SIMDVector<T,simd_abi_type> _vec_other(inum);
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _data[it_expr.data()[i+j]] *= _vec_other[j];
-            }
+            internal::random_view_mul(_data,indices(i),_vec_other);
         }
         for (; i <size(); i++) {
             _data[it_expr.data()[i]] *= inum;
@@ -1077,9 +1085,7 @@ public:
         SIMDVector<T,simd_abi_type> _vec_other((T)num);
         FASTOR_INDEX i;
         for (i = 0; i <ROUND_DOWN(size(),Stride); i+=Stride) {
-            for (auto j=0; j<SIMDVector<T,simd_abi_type>::Size; ++j) {
-                _data[it_expr.data()[i+j]] /= _vec_other[j];
-            }
+            internal::random_view_div(_data,indices(i),_vec_other);
         }
         for (; i <size(); i++) {
             _data[it_expr.data()[i]] /= num;
@@ -1144,6 +1150,113 @@ public:
 
 
 
+// Scatter-add
+//----------------------------------------------------------------------------------//
+/* Adds values to the elements of target at indices, where indices can repeat, as in the
+   assembly of element contributions into a global vector
+
+        scatter_add(F, dofs, Fe);      // F(dofs) += Fe with the repeated dofs summed up
+*/
+template<template<typename,size_t...> class TensorType0, template<typename,size_t...> class TensorType1,
+         template<typename,size_t...> class TensorType2, typename T, size_t N, typename Int, size_t ... Rest>
+FASTOR_INLINE void scatter_add(TensorType0<T,N> &target, const TensorType1<Int,Rest...> &indices, const TensorType2<T,Rest...> &values) {
+    internal::_scatter_add(target.data(),indices.data(),values.data(),pack_prod<Rest...>::value);
+}
+template<template<typename,size_t...> class TensorType0, template<typename,size_t...> class TensorType1,
+         typename T, size_t N, typename Int, size_t ... Rest, typename Derived, size_t DIM>
+FASTOR_INLINE void scatter_add(TensorType0<T,N> &target, const TensorType1<Int,Rest...> &indices, const AbstractTensor<Derived,DIM> &values) {
+    using result_type = typename Derived::result_type;
+    static_assert(result_type::size() == pack_prod<Rest...>::value, "TENSOR SIZE MISMATCH");
+    const result_type tmp(values.self());
+    internal::_scatter_add(target.data(),indices.data(),tmp.data(),pack_prod<Rest...>::value);
+}
+
+
+/* Greedy colouring of the rows of a connectivity such that no two rows of the same colour
+   share an index. Returns the rows of every colour in increasing order
+*/
+template<template<typename,size_t...> class TensorType, typename Int, size_t E, size_t M>
+FASTOR_HINT_INLINE std::vector<std::vector<size_t>> colour_elements(const TensorType<Int,E,M> &connectivity) {
+    const Int *conn = connectivity.data();
+    size_t ndofs = 0;
+    for (size_t i=0; i<E*M; ++i) {
+        ndofs = std::max(ndofs, size_t(conn[i])+1);
+    }
+
+    constexpr size_t uncoloured = size_t(-1);
+    std::vector<size_t> marks(ndofs,uncoloured);
+    std::vector<size_t> remaining(E), skipped;
+    for (size_t e=0; e<E; ++e) remaining[e] = e;
+
+    std::vector<std::vector<size_t>> colours;
+    while (!remaining.empty()) {
+        const size_t colour = colours.size();
+        colours.emplace_back();
+        skipped.clear();
+        for (size_t e : remaining) {
+            bool is_free = true;
+            for (size_t j=0; j<M; ++j) {
+                if (marks[conn[e*M+j]] == colour) {is_free = false; break;}
+            }
+            if (!is_free) {
+                skipped.push_back(e);
+                continue;
+            }
+            for (size_t j=0; j<M; ++j) {
+                marks[conn[e*M+j]] = colour;
+            }
+            colours.back().push_back(e);
+        }
+        remaining.swap(skipped);
+    }
+    return colours;
+}
+
+/* Scatter-add of the rows of values at the rows of indices with the rows of every colour
+   [see colour_elements] split over nthreads threads. Rows of the same colour share no
+   index so the threads never write to the same element. The colours are processed one
+   after the other
+*/
+template<template<typename,size_t...> class TensorType0, template<typename,size_t...> class TensorType1,
+         template<typename,size_t...> class TensorType2, typename T, size_t N, typename Int, size_t E, size_t M>
+FASTOR_HINT_INLINE void scatter_add(TensorType0<T,N> &target, const TensorType1<Int,E,M> &indices, const TensorType2<T,E,M> &values,
+                                    const std::vector<std::vector<size_t>> &colours, size_t nthreads) {
+    T *_target = target.data();
+    const Int *_indices = indices.data();
+    const T *_values = values.data();
+    auto assemble = [=](const size_t *elements, size_t nelem) {
+        for (size_t e=0; e<nelem; ++e) {
+            internal::_scatter_add(_target,&_indices[elements[e]*M],&_values[elements[e]*M],M);
+        }
+    };
+
+    nthreads = std::max(nthreads,size_t(1));
+    std::vector<std::thread> workers;
+    workers.reserve(nthreads-1);
+    for (const auto &colour : colours) {
+        const size_t nchunks = std::min(nthreads,colour.size());
+        if (nchunks < 2) {
+            assemble(colour.data(),colour.size());
+            continue;
+        }
+        // the first chunk stays on the calling thread
+        const size_t chunk = colour.size() / nchunks, rest = colour.size() % nchunks;
+        size_t start = chunk + (rest > 0);
+        for (size_t t=1; t<nchunks; ++t) {
+            const size_t len = chunk + (t < rest);
+            workers.emplace_back(assemble,colour.data()+start,len);
+            start += len;
+        }
+        assemble(colour.data(),chunk + (rest > 0));
+        for (auto &worker : workers) worker.join();
+        workers.clear();
+    }
+}
+//----------------------------------------------------------------------------------//
+
+
+
+
 }
 
 
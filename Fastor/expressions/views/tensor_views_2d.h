@@ -5,6 +5,7 @@
 #include "Fastor/tensor/Tensor.h"
 #include "Fastor/tensor/Ranges.h"
 #include "Fastor/expressions/linalg_ops/linalg_traits.h"
+#include "Fastor/expressions/views/tensor_views_tiled.h"
 
 namespace Fastor {
 
@@ -178,35 +179,35 @@ public:
 #endif
         T *FASTOR_RESTRICT _data = _expr.data();
         if (_seq1._step == 1) {
-            for (FASTOR_INDEX i = 0; i <_seq0.size(); i++) {
+            internal::tiled_view_apply<T,Stride>(_seq0.size(),_seq1.size(),[&](FASTOR_INDEX i, FASTOR_INDEX j0, FASTOR_INDEX j1) {
                 FASTOR_INDEX j;
-                for (j = 0; j <ROUND_DOWN(_seq1.size(),Stride); j+=Stride) {
+                for (j = j0; j <j0+ROUND_DOWN(j1-j0,Stride); j+=Stride) {
                     auto _vec = other_src.template eval<T>(i,j);
                     _vec.store(&_data[(_seq0._step*i+_seq0._first)*N+j+_seq1._first],false);
                 }
-                for (; j <_seq1.size(); ++j) {
+                for (; j <j1; ++j) {
                     _expr(_seq0._step*i+_seq0._first,j+_seq1._first) = other_src.template eval_s<T>(i,j);
                 }
-            }
+            });
         }
         else {
 #ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
-            for (FASTOR_INDEX i = 0; i <_seq0.size(); i++) {
+            internal::tiled_view_apply<T,Stride>(_seq0.size(),_seq1.size(),[&](FASTOR_INDEX i, FASTOR_INDEX j0, FASTOR_INDEX j1) {
                 FASTOR_INDEX j;
-                for (j = 0; j <ROUND_DOWN(_seq1.size(),Stride); j+=Stride) {
+                for (j = j0; j <j0+ROUND_DOWN(j1-j0,Stride); j+=Stride) {
                     auto _vec = other_src.template eval<T>(i,j);
                     data_setter(_data,_vec,(_seq0._step*i+_seq0._first)*N+_seq1._step*j+_seq1._first,_seq1._step);
                 }
-                for (; j <_seq1.size(); ++j) {
+                for (; j <j1; ++j) {
                     _expr(_seq0._step*i+_seq0._first,_seq1._step*j+_seq1._first) = other_src.template eval_s<T>(i,j);
                 }
-            }
+            });
 #else
-            for (FASTOR_INDEX i = 0; i <_seq0.size(); i++) {
-                for (FASTOR_INDEX j = 0; j <_seq1.size(); j++) {
+            internal::tiled_view_apply<T,Stride>(_seq0.size(),_seq1.size(),[&](FASTOR_INDEX i, FASTOR_INDEX j0, FASTOR_INDEX j1) {
+                for (FASTOR_INDEX j = j0; j <j1; j++) {
                     _expr(_seq0._step*i+_seq0._first,_seq1._step*j+_seq1._first) = other_src.template eval_s<T>(i,j);
                 }
-            }
+            });
 #endif
         }
     }
@@ -254,35 +255,35 @@ public:
             return;
         }
         if (_seq1._step == 1) {
-            for (FASTOR_INDEX i = 0; i <_seq0.size(); i++) {
+            internal::tiled_view_apply<T,Stride>(_seq0.size(),_seq1.size(),[&](FASTOR_INDEX i, FASTOR_INDEX j0, FASTOR_INDEX j1) {
                 FASTOR_INDEX j;
-                for (j = 0; j <ROUND_DOWN(_seq1.size(),Stride); j+=Stride) {
+                for (j = j0; j <j0+ROUND_DOWN(j1-j0,Stride); j+=Stride) {
                     auto _vec = other_src.template eval<T>(i,j);
                     _vec.store(&_data[(_seq0._step*i+_seq0._first)*N+j+_seq1._first],false);
                 }
-                for (; j <_seq1.size(); ++j) {
+                for (; j <j1; ++j) {
                     _expr(_seq0._step*i+_seq0._first,j+_seq1._first) = other_src.template eval_s<T>(i,j);
                 }
-            }
+            });
         }
         else {
 #ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
-            for (FASTOR_INDEX i = 0; i <_seq0.size(); i++) {
+            internal::tiled_view_apply<T,Stride>(_seq0.size(),_seq1.size(),[&](FASTOR_INDEX i, FASTOR_INDEX j0, FASTOR_INDEX j1) {
                 FASTOR_INDEX j;
-                for (j = 0; j <ROUND_DOWN(_seq1.size(),Stride); j+=Stride) {
+                for (j = j0; j <j0+ROUND_DOWN(j1-j0,Stride); j+=Stride) {
                     auto _vec = other_src.template eval<T>(i,j);
                     data_setter(_data,_vec,(_seq0._step*i+_seq0._first)*N+_seq1._step*j+_seq1._first,_seq1._step);
                 }
-                for (; j <_seq1.size(); ++j) {
+                for (; j <j1; ++j) {
                     _expr(_seq0._step*i+_seq0._first,_seq1._step*j+_seq1._first) = other_src.template eval_s<T>(i,j);
                 }
-            }
+            });
 #else
-            for (FASTOR_INDEX i = 0; i <_seq0.size(); i++) {
-                for (FASTOR_INDEX j = 0; j <_seq1.size(); j++) {
+            internal::tiled_view_apply<T,Stride>(_seq0.size(),_seq1.size(),[&](FASTOR_INDEX i, FASTOR_INDEX j0, FASTOR_INDEX j1) {
+                for (FASTOR_INDEX j = j0; j <j1; j++) {
                     _expr(_seq0._step*i+_seq0._first,_seq1._step*j+_seq1._first) = other_src.template eval_s<T>(i,j);
                 }
-            }
+            });
 #endif
         }
     }
@@ -317,35 +318,35 @@ public:
 #endif
         T *_data = _expr.data();
         if (_seq1._step == 1) {
-            for (FASTOR_INDEX i = 0; i <_seq0.size(); i++) {
+            internal::tiled_view_apply<T,Stride>(_seq0.size(),_seq1.size(),[&](FASTOR_INDEX i, FASTOR_INDEX j0, FASTOR_INDEX j1) {
                 FASTOR_INDEX j;
-                for (j = 0; j <ROUND_DOWN(_seq1.size(),Stride); j+=Stride) {
+                for (j = j0; j <j0+ROUND_DOWN(j1-j0,Stride); j+=Stride) {
                     auto _vec =  this->template eval<T>(i,j) + other_src.template eval<T>(i,j);
                     _vec.store(&_data[(_seq0._step*i+_seq0._first)*N+j+_seq1._first],false);
                 }
-                for (; j <_seq1.size(); ++j) {
+                for (; j <j1; ++j) {
                     _expr(_seq0._step*i+_seq0._first,j+_seq1._first) += other_src.template eval_s<T>(i,j);
                 }
-            }
+            });
         }
         else {
 #ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
-            for (FASTOR_INDEX i = 0; i <_seq0.size(); i++) {
+            internal::tiled_view_apply<T,Stride>(_seq0.size(),_seq1.size(),[&](FASTOR_INDEX i, FASTOR_INDEX j0, FASTOR_INDEX j1) {
                 FASTOR_INDEX j;
-                for (j = 0; j <ROUND_DOWN(_seq1.size(),Stride); j+=Stride) {
+                for (j = j0; j <j0+ROUND_DOWN(j1-j0,Stride); j+=Stride) {
                     auto _vec =  this->template eval<T>(i,j) + other_src.template eval<T>(i,j);
                     data_setter(_data,_vec,(_seq0._step*i+_seq0._first)*N+_seq1._step*j+_seq1._first,_seq1._step);
                 }
-                for (; j <_seq1.size(); ++j) {
+                for (; j <j1; ++j) {
                     _expr(_seq0._step*i+_seq0._first,_seq1._step*j+_seq1._first) += other_src.template eval_s<T>(i,j);
                 }
-            }
+            });
 #else
-            for (FASTOR_INDEX i = 0; i <_seq0.size(); i++) {
-                for (FASTOR_INDEX j = 0; j <_seq1.size(); j++) {
+            internal::tiled_view_apply<T,Stride>(_seq0.size(),_seq1.size(),[&](FASTOR_INDEX i, FASTOR_INDEX j0, FASTOR_INDEX j1) {
+                for (FASTOR_INDEX j = j0; j <j1; j++) {
                     _expr(_seq0._step*i+_seq0._first,_seq1._step*j+_seq1._first) += other_src.template eval_s<T>(i,j);
                 }
-            }
+            });
 #endif
         }
     }
@@ -380,35 +381,35 @@ public:
 #endif
         T *_data = _expr.data();
         if (_seq1._step == 1) {
-            for (FASTOR_INDEX i = 0; i <_seq0.size(); i++) {
+            internal::tiled_view_apply<T,Stride>(_seq0.size(),_seq1.size(),[&](FASTOR_INDEX i, FASTOR_INDEX j0, FASTOR_INDEX j1) {
                 FASTOR_INDEX j;
-                for (j = 0; j <ROUND_DOWN(_seq1.size(),Stride); j+=Stride) {
+                for (j = j0; j <j0+ROUND_DOWN(j1-j0,Stride); j+=Stride) {
                     auto _vec =  this->template eval<T>(i,j) - other_src.template eval<T>(i,j);
                     _vec.store(&_data[(_seq0._step*i+_seq0._first)*N+j+_seq1._first],false);
                 }
-                for (; j <_seq1.size(); ++j) {
+                for (; j <j1; ++j) {
                     _expr(_seq0._step*i+_seq0._first,j+_seq1._first) -= other_src.template eval_s<T>(i,j);
                 }
-            }
+            });
         }
         else {
 #ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
-            for (FASTOR_INDEX i = 0; i <_seq0.size(); i++) {
+            internal::tiled_view_apply<T,Stride>(_seq0.size(),_seq1.size(),[&](FASTOR_INDEX i, FASTOR_INDEX j0, FASTOR_INDEX j1) {
                 FASTOR_INDEX j;
-                for (j = 0; j <ROUND_DOWN(_seq1.size(),Stride); j+=Stride) {
+                for (j = j0; j <j0+ROUND_DOWN(j1-j0,Stride); j+=Stride) {
                     auto _vec =  this->template eval<T>(i,j) - other_src.template eval<T>(i,j);
                     data_setter(_data,_vec,(_seq0._step*i+_seq0._first)*N+_seq1._step*j+_seq1._first,_seq1._step);
                 }
-                for (; j <_seq1.size(); ++j) {
+                for (; j <j1; ++j) {
                     _expr(_seq0._step*i+_seq0._first,_seq1._step*j+_seq1._first) -= other_src.template eval_s<T>(i,j);
                 }
-            }
+            });
 #else
-            for (FASTOR_INDEX i = 0; i <_seq0.size(); i++) {
-                for (FASTOR_INDEX j = 0; j <_seq1.size(); j++) {
+            internal::tiled_view_apply<T,Stride>(_seq0.size(),_seq1.size(),[&](FASTOR_INDEX i, FASTOR_INDEX j0, FASTOR_INDEX j1) {
+                for (FASTOR_INDEX j = j0; j <j1; j++) {
                     _expr(_seq0._step*i+_seq0._first,_seq1._step*j+_seq1._first) -= other_src.template eval_s<T>(i,j);
                 }
-            }
+            });
 #endif
         }
     }
@@ -443,35 +444,35 @@ public:
 #endif
         T *_data = _expr.data();
         if (_seq1._step == 1) {
-            for (FASTOR_INDEX i = 0; i <_seq0.size(); i++) {
+            internal::tiled_view_apply<T,Stride>(_seq0.size(),_seq1.size(),[&](FASTOR_INDEX i, FASTOR_INDEX j0, FASTOR_INDEX j1) {
                 FASTOR_INDEX j;
-                for (j = 0; j <ROUND_DOWN(_seq1.size(),Stride); j+=Stride) {
+                for (j = j0; j <j0+ROUND_DOWN(j1-j0,Stride); j+=Stride) {
                     auto _vec =  this->template eval<T>(i,j) * other_src.template eval<T>(i,j);
                     _vec.store(&_data[(_seq0._step*i+_seq0._first)*N+j+_seq1._first],false);
                 }
-                for (; j <_seq1.size(); ++j) {
+                for (; j <j1; ++j) {
                     _expr(_seq0._step*i+_seq0._first,j+_seq1._first) *= other_src.template eval_s<T>(i,j);
                 }
-            }
+            });
         }
         else {
 #ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
-            for (FASTOR_INDEX i = 0; i <_seq0.size(); i++) {
+            internal::tiled_view_apply<T,Stride>(_seq0.size(),_seq1.size(),[&](FASTOR_INDEX i, FASTOR_INDEX j0, FASTOR_INDEX j1) {
                 FASTOR_INDEX j;
-                for (j = 0; j <ROUND_DOWN(_seq1.size(),Stride); j+=Stride) {
+                for (j = j0; j <j0+ROUND_DOWN(j1-j0,Stride); j+=Stride) {
                     auto _vec =  this->template eval<T>(i,j) * other_src.template eval<T>(i,j);
                     data_setter(_data,_vec,(_seq0._step*i+_seq0._first)*N+_seq1._step*j+_seq1._first,_seq1._step);
                 }
-                for (; j <_seq1.size(); ++j) {
+                for (; j <j1; ++j) {
                     _expr(_seq0._step*i+_seq0._first,_seq1._step*j+_seq1._first) *= other_src.template eval_s<T>(i,j);
                 }
-            }
+            });
 #else
-            for (FASTOR_INDEX i = 0; i <_seq0.size(); i++) {
-                for (FASTOR_INDEX j = 0; j <_seq1.size(); j++) {
+            internal::tiled_view_apply<T,Stride>(_seq0.size(),_seq1.size(),[&](FASTOR_INDEX i, FASTOR_INDEX j0, FASTOR_INDEX j1) {
+                for (FASTOR_INDEX j = j0; j <j1; j++) {
                     _expr(_seq0._step*i+_seq0._first,_seq1._step*j+_seq1._first) *= other_src.template eval_s<T>(i,j);
                 }
-            }
+            });
 #endif
         }
     }
@@ -506,35 +507,35 @@ public:
 #endif
         T *_data = _expr.data();
         if (_seq1._step == 1) {
-            for (FASTOR_INDEX i = 0; i <_seq0.size(); i++) {
+            internal::tiled_view_apply<T,Stride>(_seq0.size(),_seq1.size(),[&](FASTOR_INDEX i, FASTOR_INDEX j0, FASTOR_INDEX j1) {
                 FASTOR_INDEX j;
-                for (j = 0; j <ROUND_DOWN(_seq1.size(),Stride); j+=Stride) {
+                for (j = j0; j <j0+ROUND_DOWN(j1-j0,Stride); j+=Stride) {
                     auto _vec =  this->template eval<T>(i,j) / other_src.template eval<T>(i,j);
                     _vec.store(&_data[(_seq0._step*i+_seq0._first)*N+j+_seq1._first],false);
                 }
-                for (; j <_seq1.size(); ++j) {
+                for (; j <j1; ++j) {
                     _expr(_seq0._step*i+_seq0._first,j+_seq1._first) /= other_src.template eval_s<T>(i,j);
                 }
-            }
+            });
         }
         else {
 #ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
-            for (FASTOR_INDEX i = 0; i <_seq0.size(); i++) {
+            internal::tiled_view_apply<T,Stride>(_seq0.size(),_seq1.size(),[&](FASTOR_INDEX i, FASTOR_INDEX j0, FASTOR_INDEX j1) {
                 FASTOR_INDEX j;
-                for (j = 0; j <ROUND_DOWN(_seq1.size(),Stride); j+=Stride) {
+                for (j = j0; j <j0+ROUND_DOWN(j1-j0,Stride); j+=Stride) {
                     auto _vec =  this->template eval<T>(i,j) / other_src.template eval<T>(i,j);
                     data_setter(_data,_vec,(_seq0._step*i+_seq0._first)*N+_seq1._step*j+_seq1._first,_seq1._step);
                 }
-                for (; j <_seq1.size(); ++j) {
+                for (; j <j1; ++j) {
                     _expr(_seq0._step*i+_seq0._first,_seq1._step*j+_seq1._first) /= other_src.template eval_s<T>(i,j);
                 }
-            }
+            });
 #else
-            for (FASTOR_INDEX i = 0; i <_seq0.size(); i++) {
-                for (FASTOR_INDEX j = 0; j <_seq1.size(); j++) {
+            internal::tiled_view_apply<T,Stride>(_seq0.size(),_seq1.size(),[&](FASTOR_INDEX i, FASTOR_INDEX j0, FASTOR_INDEX j1) {
+                for (FASTOR_INDEX j = j0; j <j1; j++) {
                     _expr(_seq0._step*i+_seq0._first,_seq1._step*j+_seq1._first) /= other_src.template eval_s<T>(i,j);
                 }
-            }
+            });
 #endif
         }
     }
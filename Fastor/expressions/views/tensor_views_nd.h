@@ -5,6 +5,7 @@
 #include "Fastor/tensor/Tensor.h"
 #include "Fastor/tensor/Ranges.h"
 #include "Fastor/expressions/linalg_ops/linalg_traits.h"
+#include "Fastor/expressions/views/tensor_views_strided.h"
 
 namespace Fastor {
 
@@ -18,6 +19,8 @@ private:
     const TensorType<T,Rest...> &_expr;
     std::array<seq,sizeof...(Rest)> _seqs;
     std::array<int,DIMS> _dims;
+    std::array<int,DIMS> _strides;
+    int _offset;
     bool _is_vectorisable;
     bool _is_strided_vectorisable;
 public:
@@ -64,12 +67,23 @@ public:
             counter++;
         }
 
-        for (FASTOR_INDEX i=0; i<DIMS; ++i) _dims[i] = dimension(i);
+        _offset = 0;
+        for (FASTOR_INDEX i=0; i<DIMS; ++i) {
+            _dims[i] = dimension(i);
+            _strides[i] = products_[i]*_seqs[i]._step;
+            _offset += products_[i]*_seqs[i]._first;
+        }
         _is_vectorisable = !is_same_v_<T,bool> && _seqs[DIMS-1].size() % SIMDVector<T,simd_abi_type>::Size == 0 && (_seqs[DIMS-1]._step==1) ? true : false;
         _is_strided_vectorisable = !is_same_v_<T,bool> && _seqs[DIMS-1].size() % SIMDVector<T,simd_abi_type>::Size == 0 && (_seqs[DIMS-1]._step!=1) ? true : false;
     }
 
 
+    FASTOR_INLINE int get_flat_index(const std::array<int,DIMS>& as) const {
+        int ind = _offset;
+        for (FASTOR_INDEX it=0; it<DIMS; ++it) ind += as[it]*_strides[it];
+        return ind;
+    }
+
     template<typename U=T>
     FASTOR_INLINE SIMDVector<U,simd_abi_type> eval(FASTOR_INDEX idx) const {
 
@@ -82,10 +96,7 @@ public:
                 remaining /= _dims[n];
                 as[n] = ( int(idx+j) / remaining ) % _dims[n];
             }
-            inds[j] = 0;
-            for(int it = 0; it< DIMS; it++) {
-                inds[j] += products_[it]*as[it]*_seqs[it]._step + _seqs[it]._first*products_[it];
-            }
+            inds[j] = get_flat_index(as);
         }
         vector_setter(_vec,_expr.data(),inds);
         return _vec;
@@ -101,104 +112,34 @@ public:
             remaining /= _dims[n];
             as[n] = ( (int)idx / remaining ) % _dims[n];
         }
-        int ind = 0;
-        for(int it = 0; it< DIMS; it++) {
-            ind += products_[it]*as[it]*_seqs[it]._step + _seqs[it]._first*products_[it];
-        }
-
-        return _expr.data()[ind];
+        return _expr.data()[get_flat_index(as)];
     }
 
 
     template<typename U=T>
     FASTOR_INLINE SIMDVector<U,simd_abi_type> eval(FASTOR_INDEX idx, FASTOR_INDEX j) const {
-
-        idx += j;
-        SIMDVector<U,simd_abi_type> _vec;
-        std::array<int,DIMS> as = {};
-
-        std::array<int,SIMDVector<U,simd_abi_type>::Size> inds;
-        for (auto j=0; j<SIMDVector<U,simd_abi_type>::Size; ++j) {
-            int remaining = size();
-            for (int n = 0; n < DIMS; ++n) {
-                remaining /= _dims[n];
-                as[n] = ( int(idx+j) / remaining ) % _dims[n];
-            }
-            inds[j] = 0;
-            for(int it = 0; it< DIMS; it++) {
-                inds[j] += products_[it]*as[it]*_seqs[it]._step + _seqs[it]._first*products_[it];
-            }
-        }
-        vector_setter(_vec,_expr.data(),inds);
-        return _vec;
+        return eval<U>(idx+j);
     }
 
 
     template<typename U=T>
     FASTOR_INLINE U eval_s(FASTOR_INDEX idx, FASTOR_INDEX j) const {
-        idx += j;
-        std::array<int,DIMS> as = {};
-
-        int remaining = size();
-        for (int n = 0; n < DIMS; ++n) {
-            remaining /= _dims[n];
-            as[n] = ( (int)idx / remaining ) % _dims[n];
-        }
-        int ind = 0;
-        for(int it = 0; it< DIMS; it++) {
-            ind += products_[it]*as[it]*_seqs[it]._step + _seqs[it]._first*products_[it];
-        }
-
-        return _expr.data()[ind];
+        return eval_s<U>(idx+j);
     }
 
+    // SIMD vectors are only ever requested within a row of the view
     template<typename U=T>
     FASTOR_INLINE SIMDVector<U,simd_abi_type> teval(const std::array<int,DIMS>& as) const {
-        int ind = 0;
-        for(int it = 0; it< DIMS; it++) {
-            ind += products_[it]*as[it]*_seqs[it]._step + _seqs[it]._first*products_[it];
-        }
-        if (_is_vectorisable) return SIMDVector<T,simd_abi_type>(&_expr.data()[ind],false);
-        else if (_is_strided_vectorisable) {
-            SIMDVector<U,simd_abi_type> _vec;
-            vector_setter(_vec,_expr.data(),ind,_seqs[DIMS-1]._step);
-            return _vec;
-        }
-        else {
-            // return eval(ind);
-
-            SIMDVector<U,simd_abi_type> _vec;
-            std::array<int,SIMDVector<U,simd_abi_type>::Size> inds;
-            std::array<int,DIMS> as_ = as;
-            for (auto j=0; j<SIMDVector<U,simd_abi_type>::Size; ++j) {
-                int _sum = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    _sum += products_[it]*as_[it]*_seqs[it]._step + _seqs[it]._first*products_[it];
-                }
-                inds[j] = _sum;
-
-                for(int jt = (int)DIMS-1; jt>=0; jt--)
-                {
-                  as_[jt] +=1;
-                  if(as_[jt]<_dims[jt])
-                      break;
-                  else
-                      as_[jt]=0;
-                }
-            }
-
-            vector_setter(_vec,_expr.data(),inds);
-            return _vec;
-        }
+        const int ind = get_flat_index(as);
+        SIMDVector<U,simd_abi_type> _vec;
+        if (_strides[DIMS-1]==1) _vec.load(&_expr.data()[ind],false);
+        else vector_setter(_vec,_expr.data(),ind,_strides[DIMS-1]);
+        return _vec;
     }
 
     template<typename U=T>
     FASTOR_INLINE U teval_s(const std::array<int,DIMS>& as) const {
-        int ind = 0;
-        for(int it = 0; it< DIMS; it++) {
-            ind += products_[it]*as[it]*_seqs[it]._step + _seqs[it]._first*products_[it];
-        }
-        return _expr.data()[ind];
+        return _expr.data()[get_flat_index(as)];
     }
 };
 //----------------------------------------------------------------------------------------------//
@@ -217,6 +158,8 @@ private:
     std::array<seq,sizeof...(Rest)> _seqs;
     bool _does_alias = false;
     std::array<int,DIMS> _dims;
+    std::array<int,DIMS> _strides;
+    int _offset;
     bool _is_vectorisable;
     bool _is_strided_vectorisable;
 
@@ -272,7 +215,12 @@ public:
             counter++;
         }
 
-        for (FASTOR_INDEX i=0; i<DIMS; ++i) _dims[i] = dimension(i);
+        _offset = 0;
+        for (FASTOR_INDEX i=0; i<DIMS; ++i) {
+            _dims[i] = dimension(i);
+            _strides[i] = products_[i]*_seqs[i]._step;
+            _offset += products_[i]*_seqs[i]._first;
+        }
         _is_vectorisable = !is_same_v_<T,bool> && _seqs[DIMS-1].size() % SIMDVector<T,simd_abi_type>::Size == 0 && (_seqs[DIMS-1]._step==1) ? true : false;
         _is_strided_vectorisable = !is_same_v_<T,bool> && _seqs[DIMS-1].size() % SIMDVector<T,simd_abi_type>::Size == 0 && (_seqs[DIMS-1]._step!=1) ? true : false;
     }
@@ -302,61 +250,10 @@ public:
         }
 #endif
 
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            // constexpr FASTOR_INDEX stride = V::Size;
-            V _vec;
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                _vec = other.template teval<T>(as);
-                _vec.store(&_data[ind],false);
-
-                counter+=V::Size;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=V::Size;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else {
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                _data[ind] = other.template teval_s<T>(as);
-                // print(as);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] += 1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        internal::strided_view_apply<false,V>(_expr.data(),_offset,_dims,_strides,
+            [&](const V &, const std::array<int,DIMS> &as, int) {return other.template teval<T>(as);},
+            [&](T &_elem, const std::array<int,DIMS> &as, int) {_elem = other.template teval_s<T>(as);});
     }
     //----------------------------------------------------------------------------------//
 
@@ -386,94 +283,10 @@ public:
 #ifndef NDEBUG
         FASTOR_ASSERT(other_src.size()==this->size(), "TENSOR SIZE MISMATCH");
 #endif
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                // V _vec = other_src.template eval<T>(counter);
-                V _vec = other_src.template teval<T>(as);
-                _vec.store(&_data[ind],false);
-
-                counter+=V::Size;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=V::Size;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else
-        {
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                // _data[ind] = other_src.template eval_s<T>(counter);
-                _data[ind] = other_src.template teval_s<T>(as);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-
-            // // Generic vectorised version that takes care of the remainder scalar ops
-            // using V=SIMDVector<T,simd_abi_type>;
-            // while(counter < total)
-            // {
-            //     int ind = 0;
-            //     for(int it = 0; it< DIMS; it++) {
-            //         ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-            //     }
-            //     if (_dims[DIMS-1] - as[DIMS-1] % V::Size == 0) {
-            //         // V _vec = other_src.template eval<T>(counter);
-            //         V _vec = other_src.template teval<T>(as);
-            //         _vec.store(&_data[ind],false);
-            //         counter+=V::Size;
-            //     }
-            //     else {
-            //         // _data[ind] = other_src.template eval_s<T>(counter);
-            //         _data[ind] = other_src.template teval_s<T>(as);
-            //         counter++;
-            //     }
-
-            //     for(jt = DIMS-1; jt>=0; jt--)
-            //     {
-            //         if (jt == _dims.size()-1) as[jt]+=V::Size;
-            //         else as[jt] +=1;
-            //         if(as[jt]<_dims[jt])
-            //             break;
-            //         else
-            //             as[jt]=0;
-            //     }
-            //     if(jt<0)
-            //         break;
-            // }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        internal::strided_view_apply<false,V>(_expr.data(),_offset,_dims,_strides,
+            [&](const V &, const std::array<int,DIMS> &as, int) {return other_src.template teval<T>(as);},
+            [&](T &_elem, const std::array<int,DIMS> &as, int) {_elem = other_src.template teval_s<T>(as);});
     }
 
     template<typename Derived, size_t OTHER_DIMS, enable_if_t_<OTHER_DIMS==DIMS && requires_evaluation_v<Derived>,bool> = false>
@@ -500,64 +313,10 @@ public:
 #ifndef NDEBUG
         FASTOR_ASSERT(other_src.size()==this->size(), "TENSOR SIZE MISMATCH");
 #endif
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            V _vec_out;
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                // V _vec = other_src.template eval<T>(counter);
-                V _vec = other_src.template teval<T>(as);
-                _vec_out.load(&_data[ind],false);
-                _vec_out += _vec;
-                _vec_out.store(&_data[ind],false);
-
-                counter+=V::Size;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=V::Size;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else
-        {
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                // _data[ind] += other_src.template eval_s<T>(counter);
-                _data[ind] += other_src.template teval_s<T>(as);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        internal::strided_view_apply<true,V>(_expr.data(),_offset,_dims,_strides,
+            [&](const V &_vec, const std::array<int,DIMS> &as, int) {return _vec + other_src.template teval<T>(as);},
+            [&](T &_elem, const std::array<int,DIMS> &as, int) {_elem += other_src.template teval_s<T>(as);});
     }
 
 
@@ -585,64 +344,10 @@ public:
 #ifndef NDEBUG
         FASTOR_ASSERT(other_src.size()==this->size(), "TENSOR SIZE MISMATCH");
 #endif
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            V _vec_out;
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                // V _vec = other_src.template eval<T>(counter);
-                V _vec = other_src.template teval<T>(as);
-                _vec_out.load(&_data[ind],false);
-                _vec_out -= _vec;
-                _vec_out.store(&_data[ind],false);
-
-                counter+=V::Size;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=V::Size;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else
-        {
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                // _data[ind] -= other_src.template eval_s<T>(counter);
-                _data[ind] -= other_src.template teval_s<T>(as);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        internal::strided_view_apply<true,V>(_expr.data(),_offset,_dims,_strides,
+            [&](const V &_vec, const std::array<int,DIMS> &as, int) {return _vec - other_src.template teval<T>(as);},
+            [&](T &_elem, const std::array<int,DIMS> &as, int) {_elem -= other_src.template teval_s<T>(as);});
     }
 
     template<typename Derived, size_t OTHER_DIMS, enable_if_t_<OTHER_DIMS==DIMS && requires_evaluation_v<Derived>,bool> = false>
@@ -669,64 +374,10 @@ public:
 #ifndef NDEBUG
         FASTOR_ASSERT(other_src.size()==this->size(), "TENSOR SIZE MISMATCH");
 #endif
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            V _vec_out;
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                // V _vec = other_src.template eval<T>(counter);
-                V _vec = other_src.template teval<T>(as);
-                _vec_out.load(&_data[ind],false);
-                _vec_out *= _vec;
-                _vec_out.store(&_data[ind],false);
-
-                counter+=V::Size;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=V::Size;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else
-        {
-             while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                // _data[ind] *= other_src.template eval_s<T>(counter);
-                _data[ind] *= other_src.template teval_s<T>(as);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        internal::strided_view_apply<true,V>(_expr.data(),_offset,_dims,_strides,
+            [&](const V &_vec, const std::array<int,DIMS> &as, int) {return _vec * other_src.template teval<T>(as);},
+            [&](T &_elem, const std::array<int,DIMS> &as, int) {_elem *= other_src.template teval_s<T>(as);});
     }
 
     template<typename Derived, size_t OTHER_DIMS, enable_if_t_<OTHER_DIMS==DIMS && requires_evaluation_v<Derived>,bool> = false>
@@ -753,64 +404,10 @@ public:
 #ifndef NDEBUG
         FASTOR_ASSERT(other_src.size()==this->size(), "TENSOR SIZE MISMATCH");
 #endif
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            V _vec_out;
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                // V _vec = other_src.template eval<T>(counter);
-                V _vec = other_src.template teval<T>(as);
-                _vec_out.load(&_data[ind],false);
-                _vec_out /= _vec;
-                _vec_out.store(&_data[ind],false);
-
-                counter+=V::Size;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=V::Size;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else
-        {
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                // _data[ind] /= other_src.template eval_s<T>(counter);
-                _data[ind] /= other_src.template teval_s<T>(as);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        internal::strided_view_apply<true,V>(_expr.data(),_offset,_dims,_strides,
+            [&](const V &_vec, const std::array<int,DIMS> &as, int) {return _vec / other_src.template teval<T>(as);},
+            [&](T &_elem, const std::array<int,DIMS> &as, int) {_elem /= other_src.template teval_s<T>(as);});
     }
     //----------------------------------------------------------------------------------//
 
@@ -840,61 +437,10 @@ public:
 #ifndef NDEBUG
         FASTOR_ASSERT(other_src.size()==this->size(), "TENSOR SIZE MISMATCH");
 #endif
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                V _vec = other_src.template eval<T>(counter);
-                // V _vec = other_src.template teval<T>(as);
-                _vec.store(&_data[ind],false);
-
-                counter+=V::Size;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=V::Size;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else
-        {
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                _data[ind] = other_src.template eval_s<T>(counter);
-                // _data[ind] = other_src.template teval_s<T>(as);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        internal::strided_view_apply<false,V>(_expr.data(),_offset,_dims,_strides,
+            [&](const V &, const std::array<int,DIMS> &, int counter) {return other_src.template eval<T>(counter);},
+            [&](T &_elem, const std::array<int,DIMS> &, int counter) {_elem = other_src.template eval_s<T>(counter);});
     }
 
     template<typename Derived, size_t OTHER_DIMS, enable_if_t_<OTHER_DIMS!=DIMS && requires_evaluation_v<Derived>,bool> = false>
@@ -921,64 +467,10 @@ public:
 #ifndef NDEBUG
         FASTOR_ASSERT(other_src.size()==this->size(), "TENSOR SIZE MISMATCH");
 #endif
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            constexpr FASTOR_INDEX stride = V::Size;
-            V _vec_out;
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                V _vec = other_src.template eval<T>(counter);
-                // V _vec = other_src.template teval<T>(as);
-                _vec_out.load(&_data[ind],false);
-                _vec_out += _vec;
-                _vec_out.store(&_data[ind],false);
-
-                counter+=V::Size;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=stride;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else {
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                _data[ind] += other_src.template eval_s<T>(counter);
-                // _data[ind] += other_src.template teval_s<T>(as);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        internal::strided_view_apply<true,V>(_expr.data(),_offset,_dims,_strides,
+            [&](const V &_vec, const std::array<int,DIMS> &, int counter) {return _vec + other_src.template eval<T>(counter);},
+            [&](T &_elem, const std::array<int,DIMS> &, int counter) {_elem += other_src.template eval_s<T>(counter);});
     }
 
     template<typename Derived, size_t OTHER_DIMS, enable_if_t_<OTHER_DIMS!=DIMS && requires_evaluation_v<Derived>,bool> = false>
@@ -1005,63 +497,10 @@ public:
 #ifndef NDEBUG
         FASTOR_ASSERT(other_src.size()==this->size(), "TENSOR SIZE MISMATCH");
 #endif
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            V _vec_out;
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                V _vec = other_src.template eval<T>(counter);
-                // V _vec = other_src.template teval<T>(as);
-                _vec_out.load(&_data[ind],false);
-                _vec_out -= _vec;
-                _vec_out.store(&_data[ind],false);
-
-                counter+=V::Size;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=V::Size;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else {
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                _data[ind] -= other_src.template eval_s<T>(counter);
-                // _data[ind] -= other_src.template teval_s<T>(as);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        internal::strided_view_apply<true,V>(_expr.data(),_offset,_dims,_strides,
+            [&](const V &_vec, const std::array<int,DIMS> &, int counter) {return _vec - other_src.template eval<T>(counter);},
+            [&](T &_elem, const std::array<int,DIMS> &, int counter) {_elem -= other_src.template eval_s<T>(counter);});
     }
 
     template<typename Derived, size_t OTHER_DIMS, enable_if_t_<OTHER_DIMS!=DIMS && requires_evaluation_v<Derived>,bool> = false>
@@ -1088,64 +527,10 @@ public:
 #ifndef NDEBUG
         FASTOR_ASSERT(other_src.size()==this->size(), "TENSOR SIZE MISMATCH");
 #endif
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            constexpr FASTOR_INDEX stride = V::Size;
-            V _vec_out;
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                V _vec = other_src.template eval<T>(counter);
-                // V _vec = other_src.template teval<T>(as);
-                _vec_out.load(&_data[ind],false);
-                _vec_out *= _vec;
-                _vec_out.store(&_data[ind],false);
-
-                counter+=V::Size;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=stride;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else {
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                _data[ind] *= other_src.template eval_s<T>(counter);
-                // _data[ind] *= other_src.template teval_s<T>(as);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        internal::strided_view_apply<true,V>(_expr.data(),_offset,_dims,_strides,
+            [&](const V &_vec, const std::array<int,DIMS> &, int counter) {return _vec * other_src.template eval<T>(counter);},
+            [&](T &_elem, const std::array<int,DIMS> &, int counter) {_elem *= other_src.template eval_s<T>(counter);});
     }
 
     template<typename Derived, size_t OTHER_DIMS, enable_if_t_<OTHER_DIMS!=DIMS && requires_evaluation_v<Derived>,bool> = false>
@@ -1172,64 +557,10 @@ public:
 #ifndef NDEBUG
         FASTOR_ASSERT(other_src.size()==this->size(), "TENSOR SIZE MISMATCH");
 #endif
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            constexpr FASTOR_INDEX stride = V::Size;
-            V _vec_out;
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                V _vec = other_src.template eval<T>(counter);
-                // V _vec = other_src.template teval<T>(as);
-                _vec_out.load(&_data[ind],false);
-                _vec_out /= _vec;
-                _vec_out.store(&_data[ind],false);
-
-                counter+=V::Size;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=stride;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else {
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                _data[ind] /= other_src.template eval_s<T>(counter);
-                // _data[ind] /= other_src.template teval_s<T>(as);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        internal::strided_view_apply<true,V>(_expr.data(),_offset,_dims,_strides,
+            [&](const V &_vec, const std::array<int,DIMS> &, int counter) {return _vec / other_src.template eval<T>(counter);},
+            [&](T &_elem, const std::array<int,DIMS> &, int counter) {_elem /= other_src.template eval_s<T>(counter);});
     }
 
     // scalar binders
@@ -1237,306 +568,60 @@ public:
     template<typename U=T, enable_if_t_<is_primitive_v_<U>,bool> = false>
     FASTOR_HINT_INLINE void operator=(U num) {
 
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            constexpr FASTOR_INDEX stride = V::Size;
-            V _vec = (T)num;
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                _vec.store(&_data[ind],false);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=stride;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else {
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                _data[ind] = (T)num;
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        const V _num = (T)num;
+        internal::strided_view_apply<false,V>(_expr.data(),_offset,_dims,_strides,
+            [&](const V &, const std::array<int,DIMS> &, int) {return _num;},
+            [&](T &_elem, const std::array<int,DIMS> &, int) {_elem = (T)num;});
     }
 
     template<typename U=T, enable_if_t_<is_primitive_v_<U>,bool> = false>
     FASTOR_HINT_INLINE void operator+=(U num) {
 
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            constexpr FASTOR_INDEX stride = V::Size;
-            V _vec = (T)num;
-            V _vec_out;
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                _vec_out.load(&_data[ind],false);
-                _vec_out += _vec;
-                _vec_out.store(&_data[ind],false);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=stride;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else {
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                _data[ind] += (T)num;
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        const V _num = (T)num;
+        internal::strided_view_apply<true,V>(_expr.data(),_offset,_dims,_strides,
+            [&](const V &_vec, const std::array<int,DIMS> &, int) {return _vec + _num;},
+            [&](T &_elem, const std::array<int,DIMS> &, int) {_elem += (T)num;});
     }
 
     template<typename U=T, enable_if_t_<is_primitive_v_<U>,bool> = false>
     FASTOR_HINT_INLINE void operator-=(U num) {
 
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            constexpr FASTOR_INDEX stride = V::Size;
-            V _vec = (T)num;
-            V _vec_out;
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                _vec_out.load(&_data[ind],false);
-                _vec_out -= _vec;
-                _vec_out.store(&_data[ind],false);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=stride;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else {
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                _data[ind] -= (T)num;
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        const V _num = (T)num;
+        internal::strided_view_apply<true,V>(_expr.data(),_offset,_dims,_strides,
+            [&](const V &_vec, const std::array<int,DIMS> &, int) {return _vec - _num;},
+            [&](T &_elem, const std::array<int,DIMS> &, int) {_elem -= (T)num;});
     }
 
     template<typename U=T, enable_if_t_<is_primitive_v_<U>,bool> = false>
     FASTOR_HINT_INLINE void operator*=(U num) {
 
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            constexpr FASTOR_INDEX stride = V::Size;
-            V _vec = (T)num;
-            V _vec_out;
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                _vec_out.load(&_data[ind],false);
-                _vec_out *= _vec;
-                _vec_out.store(&_data[ind],false);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=stride;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else {
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                _data[ind] *= (T)num;
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        const V _num = (T)num;
+        internal::strided_view_apply<true,V>(_expr.data(),_offset,_dims,_strides,
+            [&](const V &_vec, const std::array<int,DIMS> &, int) {return _vec * _num;},
+            [&](T &_elem, const std::array<int,DIMS> &, int) {_elem *= (T)num;});
     }
 
     template<typename U=T, enable_if_t_<is_primitive_v_<U>,bool> = false>
     FASTOR_HINT_INLINE void operator/=(U num) {
 
-        T *_data = _expr.data();
-        std::array<int,DIMS> as = {};
-        int total = size();
-        int jt, counter = 0;
-
-        if (_is_vectorisable) {
-            using V=SIMDVector<T,simd_abi_type>;
-            constexpr FASTOR_INDEX stride = V::Size;
-            V _vec = (T)num;
-            V _vec_out;
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                _vec_out.load(&_data[ind],false);
-                _vec_out /= _vec;
-                _vec_out.store(&_data[ind],false);
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    if (jt == _dims.size()-1) as[jt]+=stride;
-                    else as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
-        else {
-            while(counter < total)
-            {
-                int ind = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    ind += products_[it]*(as[it]*_seqs[it]._step + _seqs[it]._first);
-                }
-                _data[ind] /= (T)num;
-
-                counter++;
-                for(jt = DIMS-1; jt>=0; jt--)
-                {
-                    as[jt] +=1;
-                    if(as[jt]<_dims[jt])
-                        break;
-                    else
-                        as[jt]=0;
-                }
-                if(jt<0)
-                    break;
-            }
-        }
+        using V = SIMDVector<T,simd_abi_type>;
+        const V _num = (T)num;
+        internal::strided_view_apply<true,V>(_expr.data(),_offset,_dims,_strides,
+            [&](const V &_vec, const std::array<int,DIMS> &, int) {return _vec / _num;},
+            [&](T &_elem, const std::array<int,DIMS> &, int) {_elem /= (T)num;});
     }
     //----------------------------------------------------------------------------------//
 
+    FASTOR_INLINE int get_flat_index(const std::array<int,DIMS>& as) const {
+        int ind = _offset;
+        for (FASTOR_INDEX it=0; it<DIMS; ++it) ind += as[it]*_strides[it];
+        return ind;
+    }
+
     template<typename U=T>
     FASTOR_INLINE SIMDVector<U,simd_abi_type> eval(FASTOR_INDEX idx) const {
 
@@ -1549,10 +634,7 @@ public:
                 remaining /= _dims[n];
                 as[n] = ( int(idx+j) / remaining ) % _dims[n];
             }
-            inds[j] = 0;
-            for(int it = 0; it< DIMS; it++) {
-                inds[j] += products_[it]*as[it]*_seqs[it]._step + _seqs[it]._first*products_[it];
-            }
+            inds[j] = get_flat_index(as);
         }
         vector_setter(_vec,_expr.data(),inds);
         return _vec;
@@ -1568,104 +650,34 @@ public:
             remaining /= _dims[n];
             as[n] = ( (int)idx / remaining ) % _dims[n];
         }
-        int ind = 0;
-        for(int it = 0; it< DIMS; it++) {
-            ind += products_[it]*as[it]*_seqs[it]._step + _seqs[it]._first*products_[it];
-        }
-
-        return _expr.data()[ind];
+        return _expr.data()[get_flat_index(as)];
     }
 
 
     template<typename U=T>
     FASTOR_INLINE SIMDVector<U,simd_abi_type> eval(FASTOR_INDEX idx, FASTOR_INDEX j) const {
-
-        idx += j;
-        SIMDVector<U,simd_abi_type> _vec;
-        std::array<int,DIMS> as = {};
-
-        std::array<int,SIMDVector<U,simd_abi_type>::Size> inds;
-        for (auto j=0; j<SIMDVector<U,simd_abi_type>::Size; ++j) {
-            int remaining = size();
-            for (int n = 0; n < DIMS; ++n) {
-                remaining /= _dims[n];
-                as[n] = ( int(idx+j) / remaining ) % _dims[n];
-            }
-            inds[j] = 0;
-            for(int it = 0; it< DIMS; it++) {
-                inds[j] += products_[it]*as[it]*_seqs[it]._step + _seqs[it]._first*products_[it];
-            }
-        }
-        vector_setter(_vec,_expr.data(),inds);
-        return _vec;
+        return eval<U>(idx+j);
     }
 
 
     template<typename U=T>
     FASTOR_INLINE U eval_s(FASTOR_INDEX idx, FASTOR_INDEX j) const {
-
-        idx += j;
-        std::array<int,DIMS> as = {};
-        int remaining = size();
-        for (int n = 0; n < DIMS; ++n) {
-            remaining /= _dims[n];
-            as[n] = ( (int)idx / remaining ) % _dims[n];
-        }
-        int ind = 0;
-        for(int it = 0; it< DIMS; it++) {
-            ind += products_[it]*as[it]*_seqs[it]._step + _seqs[it]._first*products_[it];
-        }
-
-        return _expr.data()[ind];
+        return eval_s<U>(idx+j);
     }
 
+    // SIMD vectors are only ever requested within a row of the view
     template<typename U=T>
     FASTOR_INLINE SIMDVector<U,simd_abi_type> teval(const std::array<int,DIMS>& as) const {
-        int ind = 0;
-        for(int it = 0; it< DIMS; it++) {
-            ind += products_[it]*as[it]*_seqs[it]._step + _seqs[it]._first*products_[it];
-        }
-        if (_is_vectorisable) return SIMDVector<T,simd_abi_type>(&_expr.data()[ind],false);
-        else if (_is_strided_vectorisable) {
-            SIMDVector<U,simd_abi_type> _vec;
-            vector_setter(_vec,_expr.data(),ind,_seqs[DIMS-1]._step);
-            return _vec;
-        }
-        else {
-            // return eval(ind);
-
-            SIMDVector<U,simd_abi_type> _vec;
-            std::array<int,SIMDVector<U,simd_abi_type>::Size> inds;
-            std::array<int,DIMS> as_ = as;
-            for (auto j=0; j<SIMDVector<U,simd_abi_type>::Size; ++j) {
-                int _sum = 0;
-                for(int it = 0; it< DIMS; it++) {
-                    _sum += products_[it]*as_[it]*_seqs[it]._step + _seqs[it]._first*products_[it];
-                }
-                inds[j] = _sum;
-
-                for(int jt = (int)DIMS-1; jt>=0; jt--)
-                {
-                  as_[jt] +=1;
-                  if(as_[jt]<_dims[jt])
-                      break;
-                  else
-                      as_[jt]=0;
-                }
-            }
-
-            vector_setter(_vec,_expr.data(),inds);
-            return _vec;
-        }
+        const int ind = get_flat_index(as);
+        SIMDVector<U,simd_abi_type> _vec;
+        if (_strides[DIMS-1]==1) _vec.load(&_expr.data()[ind],false);
+        else vector_setter(_vec,_expr.data(),ind,_strides[DIMS-1]);
+        return _vec;
     }
 
     template<typename U=T>
     FASTOR_INLINE U teval_s(const std::array<int,DIMS>& as) const {
-        int ind = 0;
-        for(int it = 0; it< DIMS; it++) {
-            ind += products_[it]*as[it]*_seqs[it]._step + _seqs[it]._first*products_[it];
-        }
-        return _expr.data()[ind];
+        return _expr.data()[get_flat_index(as)];
     }
 };
 
@@ -0,0 +1,94 @@
+#ifndef TENSOR_VIEWS_STRIDED_H
+#define TENSOR_VIEWS_STRIDED_H
+
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/simd_vector/SIMDVector.h"
+#include <array>
+
+
+namespace Fastor {
+
+namespace internal {
+
+/* Strided iteration over the elements of an nd view of a tensor in row major order.
+   The view is given by the offset of its first element in data and the extent and
+   the stride [in elements of data] of every one of its dimensions. The offset of a
+   row is carried over from the previous row, so none of the outer index arithmetic
+   is repeated in the inner loop. Every row is processed in SIMD vectors with
+   contiguous loads and stores if its stride is one [and with strided gathers and
+   scatters otherwise if FASTOR_USE_VECTORISED_EXPR_ASSIGN is defined] and the
+   remainder of the row is processed element by element
+
+   vop(vec, as, counter) returns the new SIMD vector at the index array as, where vec
+   holds the current values if LoadDst is true and counter is the flat index of as in
+   the view. sop(element, as, counter) updates a single element. Views of bool are
+   not vectorised
+*/
+template<bool LoadDst, typename V, size_t DIMS, typename VOp, typename SOp>
+FASTOR_HINT_INLINE void strided_view_apply(typename V::scalar_value_type *FASTOR_RESTRICT data, int offset,
+    const std::array<int,DIMS> &dims, const std::array<int,DIMS> &strides, VOp &&vop, SOp &&sop) {
+
+    using T = typename V::scalar_value_type;
+    constexpr int Size = V::Size;
+    const int inner = dims[DIMS-1];
+    const int step  = strides[DIMS-1];
+    const int inner_vec = is_same_v_<T,bool> ? 0 : inner - inner % Size;
+    int nrows = 1;
+    for (size_t it=0; it<DIMS-1; ++it) nrows *= dims[it];
+    if (inner == 0) return;
+
+#ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
+    std::array<int,Size> lanes;
+    for (int j=0; j<Size; ++j) lanes[j] = j*step;
+#endif
+
+    std::array<int,DIMS> as = {};
+    int counter = 0;
+    for (int row=0; row<nrows; ++row) {
+        int k = 0;
+        if (step == 1) {
+            for (; k<inner_vec; k+=Size) {
+                as[DIMS-1] = k;
+                V _vec;
+                if (LoadDst) _vec.load(&data[offset+k],false);
+                _vec = vop(_vec,as,counter+k);
+                _vec.store(&data[offset+k],false);
+            }
+        }
+#ifdef FASTOR_USE_VECTORISED_EXPR_ASSIGN
+        else {
+            std::array<int,Size> inds;
+            for (; k<inner_vec; k+=Size) {
+                as[DIMS-1] = k;
+                const int ind = offset + k*step;
+                V _vec;
+                if (LoadDst) vector_setter(_vec,data,ind,step);
+                _vec = vop(_vec,as,counter+k);
+                for (int j=0; j<Size; ++j) inds[j] = ind + lanes[j];
+                data_setter(data,_vec,inds);
+            }
+        }
+#endif
+        for (; k<inner; ++k) {
+            as[DIMS-1] = k;
+            sop(data[offset+k*step],as,counter+k);
+        }
+        counter += inner;
+
+        // next row
+        for (int jt=int(DIMS)-2; jt>=0; --jt) {
+            offset += strides[jt];
+            if (++as[jt] < dims[jt]) break;
+            offset -= strides[jt]*dims[jt];
+            as[jt] = 0;
+        }
+    }
+}
+
+} // internal
+
+} // end of namespace Fastor
+
+
+#endif // TENSOR_VIEWS_STRIDED_H
@@ -0,0 +1,75 @@
+#ifndef TENSOR_VIEWS_TILED_H
+#define TENSOR_VIEWS_TILED_H
+
+
+#include "Fastor/meta/meta.h"
+#include "Fastor/config/config.h"
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+
+namespace Fastor {
+
+namespace internal {
+
+/* Tiled traversal of a rows x cols 2D view for its assignment operators. If
+   FASTOR_VIEW_TILE_BYTES is non-zero, rows longer than that many bytes are split into
+   column tiles [rounded down to a multiple of the SIMD width] and every tile is swept
+   over all the rows before the next one is started, so that the rows of operands that
+   are shifted copies of each other, as in stencils, are still in cache when the next
+   row of the destination reads them. Row by row sweeps already reuse them as long as
+   the rows a stencil spans fit in the last level cache, so tiling is off by default
+
+   kernel(i, j0, j1) assigns the columns [j0, j1) of row i of the view. If
+   FASTOR_VIEW_ASSIGN_THREADS is greater than one, views with at least
+   FASTOR_VIEW_ASSIGN_THREAD_THRESHOLD elements are split into blocks of rows that are
+   assigned on different threads, which requires the destination not to alias any of
+   the operands [use noalias() if it does]
+*/
+template<typename T, FASTOR_INDEX Stride, typename Kernel>
+FASTOR_HINT_INLINE void tiled_view_apply(FASTOR_INDEX rows, FASTOR_INDEX cols, Kernel &&kernel) {
+
+#if FASTOR_VIEW_TILE_BYTES > 0
+    constexpr FASTOR_INDEX tile = FASTOR_VIEW_TILE_BYTES / sizeof(T) / Stride * Stride > Stride ?
+        FASTOR_VIEW_TILE_BYTES / sizeof(T) / Stride * Stride : Stride;
+#else
+    const FASTOR_INDEX tile = cols;
+#endif
+    auto sweep = [&kernel,cols,tile](FASTOR_INDEX i0, FASTOR_INDEX i1) {
+        for (FASTOR_INDEX j0 = 0; j0 < cols; j0 += tile) {
+            const FASTOR_INDEX j1 = std::min(j0 + tile, cols);
+            for (FASTOR_INDEX i = i0; i < i1; ++i) {
+                kernel(i,j0,j1);
+            }
+        }
+    };
+
+#if FASTOR_VIEW_ASSIGN_THREADS > 1
+    const FASTOR_INDEX nthreads = std::min(FASTOR_INDEX(FASTOR_VIEW_ASSIGN_THREADS),rows);
+    if (nthreads > 1 && rows*cols >= FASTOR_VIEW_ASSIGN_THREAD_THRESHOLD) {
+        std::vector<std::thread> workers;
+        workers.reserve(nthreads-1);
+        // the first block of rows stays on the calling thread
+        const FASTOR_INDEX chunk = rows / nthreads, rest = rows % nthreads;
+        FASTOR_INDEX start = chunk + (rest > 0);
+        for (FASTOR_INDEX t=1; t<nthreads; ++t) {
+            const FASTOR_INDEX len = chunk + (t < rest);
+            workers.emplace_back(sweep,start,start+len);
+            start += len;
+        }
+        sweep(0,chunk + (rest > 0));
+        for (auto &worker : workers) worker.join();
+        return;
+    }
+#endif
+
+    sweep(0,rows);
+}
+
+} // internal
+
+} // end of namespace Fastor
+
+
+#endif // TENSOR_VIEWS_TILED_H
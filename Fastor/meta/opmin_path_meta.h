@@ -0,0 +1,338 @@
+#ifndef OPMIN_PATH_META_H
+#define OPMIN_PATH_META_H
+
+#include "Fastor/config/config.h"
+#include "Fastor/meta/tensor_meta.h"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Fastor {
+
+template <FASTOR_INDEX ... All>
+struct Index;
+
+namespace internal {
+
+// Contraction order of general tensor networks
+//
+// A network of n operands is described by a bit mask of index ids per operand, the mask of
+// the indices of the result and the dimension of every index id. The intermediate of a
+// subset S of operands keeps the indices of S that are still needed outside of S and
+// contracting the intermediates of L and S\L costs the product of the dimensions of all
+// their indices [the same count as pair_flop_cost]. Up to opmin_dp_max_operands operands
+// the order is found exactly by dynamic programming over the subsets of operands, beyond
+// that a greedy pass contracts the pair that shrinks the network the most.
+// Orders are compared according to FASTOR_OPMIN_OBJECTIVE
+//      FASTOR_OPMIN_FLOPS      flops, then the largest intermediate
+//      FASTOR_OPMIN_MEMORY     the largest intermediate, then flops
+//      FASTOR_OPMIN_WEIGHTED   flops + FASTOR_OPMIN_MEMORY_WEIGHT x elements of all intermediates
+// Intermediates of more than max_intermediate elements [0 for no limit] are excluded unless
+// no order can satisfy the limit
+//------------------------------------------------------------------------------------------------------------//
+constexpr size_t opmin_dp_max_operands = 12;
+constexpr size_t opmin_max_indices = 64;
+
+/* Is the order of cost [flops, peak, written] better than [bflops, bpeak, bwritten] */
+constexpr bool opmin_is_better(int objective, double weight,
+    double flops, double peak, double written, double bflops, double bpeak, double bwritten) {
+    return objective == FASTOR_OPMIN_MEMORY ?
+                (peak < bpeak || (peak == bpeak && flops < bflops)) :
+           objective == FASTOR_OPMIN_WEIGHTED ?
+                (flops + weight*written < bflops + weight*bwritten ||
+                (flops + weight*written == bflops + weight*bwritten && peak < bpeak)) :
+                (flops < bflops || (flops == bflops && peak < bpeak));
+}
+
+constexpr size_t opmin_lowest_operand(size_t mask, size_t i=0) {
+    return (mask >> i) & 1 ? i : opmin_lowest_operand(mask, i+1);
+}
+
+/* Product of the dimensions of the indices in a mask through one table per byte of the mask */
+struct opmin_mask_product {
+    double table[8][256];
+
+    constexpr opmin_mask_product(const double *dims, size_t nidx) : table{} {
+        for (size_t b=0; b<8; ++b) {
+            for (size_t v=0; v<256; ++v) {
+                double p = 1;
+                for (size_t bit=0; bit<8; ++bit) {
+                    if (((v >> bit) & 1) && 8*b+bit < nidx) p *= dims[8*b+bit];
+                }
+                table[b][v] = p;
+            }
+        }
+    }
+
+    constexpr double operator()(uint64_t mask) const {
+        double p = 1;
+        for (size_t b=0; b<8 && mask; ++b, mask >>= 8) p *= table[b][mask & 0xFF];
+        return p;
+    }
+};
+
+
+/* Exact order for up to MaxN operands. split[S] holds the operands of the left child of the
+   last contraction of S, so the order is the binary tree rooted at the full set
+*/
+template<size_t MaxN>
+struct opmin_dp_path {
+    static constexpr size_t capacity = size_t(1) << MaxN;
+
+    size_t n;
+    uint64_t indices[capacity];  // union of the indices of every subset
+    uint64_t kept[capacity];     // indices of the intermediate of every subset
+    double size[capacity];       // number of elements of that intermediate
+    double flops[capacity];      // flops of the best order of the subset
+    double peak[capacity];       // largest intermediate of that order
+    double written[capacity];    // elements of all intermediates of that order
+    size_t split[capacity];
+    bool within_limit;
+
+    constexpr opmin_dp_path() : n(0), indices{}, kept{}, size{}, flops{}, peak{}, written{}, split{}, within_limit(true) {}
+
+    constexpr void solve(const uint64_t *operands, size_t n_, uint64_t output,
+                         const double *dims, size_t nidx, double max_intermediate,
+                         int objective = FASTOR_OPMIN_OBJECTIVE, double weight = FASTOR_OPMIN_MEMORY_WEIGHT) {
+        n = n_;
+        const size_t full = (size_t(1) << n) - 1;
+        const opmin_mask_product product(dims, nidx);
+        const double inf = std::numeric_limits<double>::infinity();
+
+        for (size_t s=1; s<=full; ++s) {
+            const size_t low = s & (~s + 1);
+            indices[s] = indices[s ^ low] | operands[opmin_lowest_operand(low)];
+        }
+        for (size_t s=1; s<=full; ++s) {
+            kept[s] = (s & (s-1)) == 0 ? indices[s] : indices[s] & (output | indices[full ^ s]);
+            size[s] = product(kept[s]);
+        }
+
+        for (int pass=0; pass<2; ++pass) {
+            const double limit = (pass == 0 && max_intermediate > 0) ? max_intermediate : inf;
+            for (size_t s=1; s<=full; ++s) {
+                split[s] = 0;
+                if ((s & (s-1)) == 0) {
+                    flops[s] = 0;
+                    peak[s] = 0;
+                    written[s] = 0;
+                    continue;
+                }
+                flops[s] = inf;
+                peak[s] = inf;
+                written[s] = inf;
+                if (s != full && size[s] > limit) continue;
+                const double own = s == full ? 0 : size[s];
+                const size_t low = s & (~s + 1);
+                // every split once: the left child holds the lowest operand of s
+                for (size_t l = (s-1) & s; l; l = (l-1) & s) {
+                    if (!(l & low)) continue;
+                    const size_t r = s ^ l;
+                    if (flops[l] == inf || flops[r] == inf) continue;
+                    const double f = flops[l] + flops[r] + product(kept[l] | kept[r]);
+                    double p = peak[l] > peak[r] ? peak[l] : peak[r];
+                    p = own > p ? own : p;
+                    const double w = written[l] + written[r] + own;
+                    if (flops[s] == inf || opmin_is_better(objective, weight, f, p, w, flops[s], peak[s], written[s])) {
+                        flops[s] = f;
+                        peak[s] = p;
+                        written[s] = w;
+                        split[s] = l;
+                    }
+                }
+            }
+            if (flops[full] != inf) break;
+            within_limit = false;
+        }
+    }
+};
+
+template<size_t MaxN>
+constexpr size_t opmin_dp_path<MaxN>::capacity;
+
+
+/* Order of a network whose labels and dimensions are known at compile time. Ranks holds the
+   number of indices of each operand, Labels and Dims their concatenated indices and sizes.
+   Indices appearing once are the indices of the result [Einstein convention]
+*/
+template<class Ranks, class Labels, class Dims, size_t MaxIntermediate = 0, int Objective = FASTOR_OPMIN_OBJECTIVE>
+struct opmin_network_path;
+
+template<size_t ... Ranks, size_t ... Labels, size_t ... Dims, size_t MaxIntermediate, int Objective>
+struct opmin_network_path<Index<Ranks...>,Index<Labels...>,Index<Dims...>,MaxIntermediate,Objective> {
+    static constexpr size_t n = sizeof...(Ranks);
+    static_assert(n <= opmin_dp_max_operands, "TOO MANY TENSORS IN NETWORK FOR COMPILE TIME CONTRACTION ORDERING");
+    static_assert(no_of_unique<Labels...>::value <= opmin_max_indices, "TOO MANY INDICES IN NETWORK FOR CONTRACTION ORDERING");
+
+    static constexpr opmin_dp_path<sizeof...(Ranks)> solve() {
+        constexpr size_t nlabels = sizeof...(Labels);
+        const size_t ranks[n] = {Ranks...};
+        const size_t labels[nlabels+1] = {Labels...,0};
+        const size_t dims[nlabels+1] = {Dims...,0};
+
+        size_t ids[nlabels+1] = {};
+        double id_dims[opmin_max_indices] = {};
+        size_t counts[opmin_max_indices] = {};
+        size_t nidx = 0;
+        for (size_t i=0; i<nlabels; ++i) {
+            size_t j = 0;
+            while (j < i && labels[j] != labels[i]) ++j;
+            ids[i] = j < i ? ids[j] : nidx++;
+            id_dims[ids[i]] = double(dims[i]);
+            ++counts[ids[i]];
+        }
+
+        uint64_t operands[n] = {};
+        for (size_t k=0, i=0; k<n; ++k) {
+            for (size_t r=0; r<ranks[k]; ++r, ++i) operands[k] |= uint64_t(1) << ids[i];
+        }
+        uint64_t output = 0;
+        for (size_t id=0; id<nidx; ++id) {
+            if (counts[id] == 1) output |= uint64_t(1) << id;
+        }
+
+        opmin_dp_path<n> path;
+        path.solve(operands, n, output, id_dims, nidx, double(MaxIntermediate), Objective, FASTOR_OPMIN_MEMORY_WEIGHT);
+        return path;
+    }
+
+    static constexpr opmin_dp_path<sizeof...(Ranks)> plan = solve();
+
+    static constexpr size_t split(size_t mask) { return plan.split[mask]; }
+    static constexpr size_t root = (size_t(1) << n) - 1;
+};
+
+template<size_t ... Ranks, size_t ... Labels, size_t ... Dims, size_t MaxIntermediate, int Objective>
+constexpr size_t opmin_network_path<Index<Ranks...>,Index<Labels...>,Index<Dims...>,MaxIntermediate,Objective>::n;
+template<size_t ... Ranks, size_t ... Labels, size_t ... Dims, size_t MaxIntermediate, int Objective>
+constexpr opmin_dp_path<sizeof...(Ranks)>
+opmin_network_path<Index<Ranks...>,Index<Labels...>,Index<Dims...>,MaxIntermediate,Objective>::plan;
+
+
+/* Compile time report of the order of a network. With FASTOR_OPMIN_REPORT defined every
+   static network calls opmin_report, whose deprecation warning spells out the order as
+   nested opmin_pair of operand numbers, its flops and its largest intermediate in bytes
+*/
+template<size_t Operand>
+struct opmin_operand {};
+template<class Left, class Right>
+struct opmin_pair {};
+
+template<class Order, size_t Flops, size_t PeakBytes>
+#ifdef FASTOR_OPMIN_REPORT
+[[deprecated("CONTRACTION ORDER OF TENSOR NETWORK")]]
+#endif
+FASTOR_INLINE void opmin_report() {}
+
+
+/* Runtime order as a sequence of pairs. Operands are numbered 0 to n-1 and the result of
+   step k is numbered n+k
+*/
+struct opmin_path {
+    std::vector<std::pair<size_t,size_t>> steps;
+    double flops;
+    double peak;
+    bool within_limit;
+};
+
+template<size_t MaxN>
+FASTOR_HINT_INLINE size_t opmin_emit_steps(const opmin_dp_path<MaxN> &dp, size_t s, opmin_path &path) {
+    if ((s & (s-1)) == 0) return opmin_lowest_operand(s);
+    const size_t l = opmin_emit_steps(dp, dp.split[s], path);
+    const size_t r = opmin_emit_steps(dp, s ^ dp.split[s], path);
+    path.steps.emplace_back(l,r);
+    return dp.n + path.steps.size() - 1;
+}
+
+/* Greedy order: contract the pair whose intermediate shrinks the network the most [or is the
+   smallest for FASTOR_OPMIN_MEMORY], pairs that share an index first, ties broken by flops
+*/
+FASTOR_HINT_INLINE opmin_path opmin_greedy_path(const std::vector<uint64_t> &operands, uint64_t output,
+    const double *dims, size_t nidx, double max_intermediate, int objective = FASTOR_OPMIN_OBJECTIVE) {
+    const opmin_mask_product product(dims, nidx);
+    const double inf = std::numeric_limits<double>::infinity();
+
+    opmin_path path;
+    path.flops = 0;
+    path.peak = 0;
+    path.within_limit = true;
+
+    std::vector<size_t> ids;
+    std::vector<uint64_t> masks(operands);
+    std::vector<size_t> counts(opmin_max_indices, 0);
+    for (size_t k=0; k<masks.size(); ++k) {
+        ids.push_back(k);
+        for (size_t id=0; id<nidx; ++id) counts[id] += (masks[k] >> id) & 1;
+    }
+
+    while (masks.size() > 1) {
+        const bool last = masks.size() == 2;
+        size_t bi = 0, bj = 1;
+        uint64_t bkept = 0;
+        bool bshared = false, bfits = false;
+        double bgain = inf, bflops = inf;
+        for (size_t i=0; i<masks.size(); ++i) {
+            for (size_t j=i+1; j<masks.size(); ++j) {
+                const uint64_t joint = masks[i] | masks[j];
+                uint64_t kept = joint & output;
+                for (size_t id=0; id<nidx; ++id) {
+                    const size_t here = ((masks[i] >> id) & 1) + ((masks[j] >> id) & 1);
+                    if (((joint >> id) & 1) && counts[id] > here) kept |= uint64_t(1) << id;
+                }
+                const double size = product(kept);
+                const bool shared = (masks[i] & masks[j]) != 0;
+                const bool fits = last || max_intermediate <= 0 || size <= max_intermediate;
+                const double gain = objective == FASTOR_OPMIN_MEMORY ? size : size - product(masks[i]) - product(masks[j]);
+                const double f = product(joint);
+                const bool better = fits != bfits ? fits : shared != bshared ? shared :
+                                    gain != bgain ? gain < bgain : f < bflops;
+                if (better) {
+                    bi = i; bj = j; bkept = kept;
+                    bshared = shared; bfits = fits; bgain = gain; bflops = f;
+                }
+            }
+        }
+
+        path.steps.emplace_back(ids[bi],ids[bj]);
+        path.flops += bflops;
+        if (!last) path.peak = std::max(path.peak, product(bkept));
+        path.within_limit = path.within_limit && bfits;
+        for (size_t id=0; id<nidx; ++id) {
+            counts[id] -= ((masks[bi] >> id) & 1) + ((masks[bj] >> id) & 1);
+            counts[id] += (bkept >> id) & 1;
+        }
+        masks.erase(masks.begin()+bj);
+        ids.erase(ids.begin()+bj);
+        masks[bi] = bkept;
+        ids[bi] = operands.size() + path.steps.size() - 1;
+    }
+    return path;
+}
+
+/* Order of a network known at runtime, exact up to opmin_dp_max_operands operands */
+FASTOR_HINT_INLINE opmin_path opmin_contraction_path(const std::vector<uint64_t> &operands, uint64_t output,
+    const double *dims, size_t nidx, double max_intermediate,
+    int objective = FASTOR_OPMIN_OBJECTIVE, double weight = FASTOR_OPMIN_MEMORY_WEIGHT) {
+    if (operands.size() > opmin_dp_max_operands) {
+        return opmin_greedy_path(operands, output, dims, nidx, max_intermediate, objective);
+    }
+    std::unique_ptr<opmin_dp_path<opmin_dp_max_operands>> dp(new opmin_dp_path<opmin_dp_max_operands>);
+    dp->solve(operands.data(), operands.size(), output, dims, nidx, max_intermediate, objective, weight);
+    opmin_path path;
+    const size_t full = (size_t(1) << operands.size()) - 1;
+    path.flops = dp->flops[full];
+    path.peak = dp->peak[full];
+    path.within_limit = dp->within_limit;
+    opmin_emit_steps(*dp, full, path);
+    return path;
+}
+//------------------------------------------------------------------------------------------------------------//
+
+} // internal
+
+} // end of namespace Fastor
+
+#endif // OPMIN_PATH_META_H
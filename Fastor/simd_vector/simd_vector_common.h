@@ -339,6 +339,32 @@ FASTOR_INLINE void vector_setter(SIMDVector<T,ABI> &vec, const T *data, const st
 //----------------------------------------------------------------------------------------------------------------
 //----------------------------------------------------------------------------------------------------------------
 
+// Hardware gathers for float and double - these are picked over the generic ones above
+// as they are not templates
+#ifdef FASTOR_AVX2_IMPL
+FASTOR_INLINE void vector_setter(SIMDVector<float,simd_abi::sse> &vec, const float *data, const std::array<int,4> a) {
+    vec.value = _mm_i32gather_ps(data,_mm_loadu_si128(reinterpret_cast<const __m128i*>(a.data())),4);
+}
+FASTOR_INLINE void vector_setter(SIMDVector<float,simd_abi::avx> &vec, const float *data, const std::array<int,8> a) {
+    vec.value = _mm256_i32gather_ps(data,_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a.data())),4);
+}
+FASTOR_INLINE void vector_setter(SIMDVector<double,simd_abi::sse> &vec, const double *data, const std::array<int,2> &a) {
+    vec.value = _mm_i32gather_pd(data,_mm_loadl_epi64(reinterpret_cast<const __m128i*>(a.data())),8);
+}
+FASTOR_INLINE void vector_setter(SIMDVector<double,simd_abi::avx> &vec, const double *data, const std::array<int,4> a) {
+    vec.value = _mm256_i32gather_pd(data,_mm_loadu_si128(reinterpret_cast<const __m128i*>(a.data())),8);
+}
+#endif
+#ifdef FASTOR_AVX512F_IMPL
+FASTOR_INLINE void vector_setter(SIMDVector<float,simd_abi::avx512> &vec, const float *data, const std::array<int,16> a) {
+    vec.value = _mm512_i32gather_ps(_mm512_loadu_si512(a.data()),data,4);
+}
+FASTOR_INLINE void vector_setter(SIMDVector<double,simd_abi::avx512> &vec, const double *data, const std::array<int,8> a) {
+    vec.value = _mm512_i32gather_pd(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a.data())),data,8);
+}
+#endif
+//----------------------------------------------------------------------------------------------------------------
+
 
 
 
@@ -462,6 +488,72 @@ FASTOR_INLINE void data_setter(T *FASTOR_RESTRICT data, const SIMDVector<T,ABI>
 //----------------------------------------------------------------------------------------------------------------
 
 
+// [Scatter operations], when strides are not constant (i.e totally random). When an index
+// appears more than once the lane that comes last is written, like the hardware scatters do
+//----------------------------------------------------------------------------------------------------------------
+template<typename T, typename ABI, size_t N>
+FASTOR_INLINE void data_setter(T *FASTOR_RESTRICT data, const SIMDVector<T,ABI> &vec, const std::array<int,N> &a) {
+    static_assert(N==SIMDVector<T,ABI>::Size, "SIZE OF INDEX ARRAY AND SIMD VECTOR DO NOT MATCH");
+    T tmp[N];
+    vec.store(tmp,false);
+    for (FASTOR_INDEX j=0; j<N; ++j) {
+        data[a[j]] = tmp[j];
+    }
+}
+#ifdef FASTOR_AVX512F_IMPL
+FASTOR_INLINE void data_setter(float *FASTOR_RESTRICT data, const SIMDVector<float,simd_abi::avx512> &vec, const std::array<int,16> &a) {
+    _mm512_i32scatter_ps(data,_mm512_loadu_si512(a.data()),vec.value,4);
+}
+FASTOR_INLINE void data_setter(double *FASTOR_RESTRICT data, const SIMDVector<double,simd_abi::avx512> &vec, const std::array<int,8> &a) {
+    _mm512_i32scatter_pd(data,_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a.data())),vec.value,8);
+}
+#endif
+#if defined(FASTOR_AVX512F_IMPL) && defined(FASTOR_AVX512VL_IMPL)
+FASTOR_INLINE void data_setter(float *FASTOR_RESTRICT data, const SIMDVector<float,simd_abi::avx> &vec, const std::array<int,8> &a) {
+    _mm256_i32scatter_ps(data,_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a.data())),vec.value,4);
+}
+FASTOR_INLINE void data_setter(double *FASTOR_RESTRICT data, const SIMDVector<double,simd_abi::avx> &vec, const std::array<int,4> &a) {
+    _mm256_i32scatter_pd(data,_mm_loadu_si128(reinterpret_cast<const __m128i*>(a.data())),vec.value,8);
+}
+FASTOR_INLINE void data_setter(float *FASTOR_RESTRICT data, const SIMDVector<float,simd_abi::sse> &vec, const std::array<int,4> &a) {
+    _mm_i32scatter_ps(data,_mm_loadu_si128(reinterpret_cast<const __m128i*>(a.data())),vec.value,4);
+}
+FASTOR_INLINE void data_setter(double *FASTOR_RESTRICT data, const SIMDVector<double,simd_abi::sse> &vec, const std::array<int,2> &a) {
+    _mm_i32scatter_pd(data,_mm_loadl_epi64(reinterpret_cast<const __m128i*>(a.data())),vec.value,8);
+}
+#endif
+
+/* Returns true if any index appears more than once. A gather, update and scatter of such
+   indices loses all but one of the updates to the same element
+*/
+template<size_t N>
+FASTOR_INLINE bool has_index_conflict(const std::array<int,N> &a) {
+    for (FASTOR_INDEX j=1; j<N; ++j) {
+        for (FASTOR_INDEX k=0; k<j; ++k) {
+            if (a[j]==a[k]) return true;
+        }
+    }
+    return false;
+}
+#ifdef FASTOR_AVX512CD_IMPL
+FASTOR_INLINE bool has_index_conflict(const std::array<int,16> &a) {
+    const __m512i conflicts = _mm512_conflict_epi32(_mm512_loadu_si512(a.data()));
+    return _mm512_test_epi32_mask(conflicts,conflicts) != 0;
+}
+#endif
+#if defined(FASTOR_AVX512CD_IMPL) && defined(FASTOR_AVX512VL_IMPL)
+FASTOR_INLINE bool has_index_conflict(const std::array<int,8> &a) {
+    const __m256i conflicts = _mm256_conflict_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a.data())));
+    return _mm256_test_epi32_mask(conflicts,conflicts) != 0;
+}
+FASTOR_INLINE bool has_index_conflict(const std::array<int,4> &a) {
+    const __m128i conflicts = _mm_conflict_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a.data())));
+    return _mm_test_epi32_mask(conflicts,conflicts) != 0;
+}
+#endif
+//----------------------------------------------------------------------------------------------------------------
+
+
 
 
 
@@ -587,9 +679,11 @@ maskload<SIMDVector<int,simd_abi::sse>>(const int * FASTOR_RESTRICT a, const int
 template<typename V>
 FASTOR_INLINE
 void maskstore(typename V::scalar_value_type * FASTOR_RESTRICT a, const int (&maska)[V::Size], V& v) {
+    typename V::scalar_value_type tmp[V::Size];
+    v.store(tmp,false);
     for (FASTOR_INDEX i=0; i<V::Size; ++i) {
         if (maska[i] == -1) {
-            a[V::Size - i - 1] = v[V::Size - i - 1];
+            a[V::Size - i - 1] = tmp[V::Size - i - 1];
         }
     }
 }
@@ -687,6 +781,36 @@ void maskstore(int * FASTOR_RESTRICT a, const int (&maska)[4], SIMDVector<int,si
     _mm_maskstore_epi32(a,(__m128i) mask, v.value);
 }
 #endif // FASTOR_AVX2_IMPL
+#ifdef FASTOR_AVX512F_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::avx512>
+maskload<SIMDVector<float,simd_abi::avx512>>(const float * FASTOR_RESTRICT a, const int (&maska)[16]) {
+    __mmask16 mask = _mm512_cmpeq_epi32_mask(_mm512_set_epi32(maska[0],maska[1],maska[2],maska[3],maska[4],maska[5],maska[6],maska[7],
+        maska[8],maska[9],maska[10],maska[11],maska[12],maska[13],maska[14],maska[15]),_mm512_set1_epi32(-1));
+    return _mm512_maskz_loadu_ps(mask,a);
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::avx512>
+maskload<SIMDVector<double,simd_abi::avx512>>(const double * FASTOR_RESTRICT a, const int (&maska)[8]) {
+    __mmask8 mask = _mm512_cmpeq_epi64_mask(_mm512_set_epi64(maska[0],maska[1],maska[2],maska[3],maska[4],maska[5],maska[6],maska[7]),
+        _mm512_set1_epi64(-1));
+    return _mm512_maskz_loadu_pd(mask,a);
+}
+template<>
+FASTOR_INLINE
+void maskstore(float * FASTOR_RESTRICT a, const int (&maska)[16], SIMDVector<float,simd_abi::avx512> &v) {
+    __mmask16 mask = _mm512_cmpeq_epi32_mask(_mm512_set_epi32(maska[0],maska[1],maska[2],maska[3],maska[4],maska[5],maska[6],maska[7],
+        maska[8],maska[9],maska[10],maska[11],maska[12],maska[13],maska[14],maska[15]),_mm512_set1_epi32(-1));
+    _mm512_mask_storeu_ps(a,mask,v.value);
+}
+template<>
+FASTOR_INLINE
+void maskstore(double * FASTOR_RESTRICT a, const int (&maska)[8], SIMDVector<double,simd_abi::avx512> &v) {
+    __mmask8 mask = _mm512_cmpeq_epi64_mask(_mm512_set_epi64(maska[0],maska[1],maska[2],maska[3],maska[4],maska[5],maska[6],maska[7]),
+        _mm512_set1_epi64(-1));
+    _mm512_mask_storeu_pd(a,mask,v.value);
+}
+#endif // FASTOR_AVX512F_IMPL
 //----------------------------------------------------------------------------------------------------------------
 
 
@@ -1172,6 +1296,115 @@ FASTOR_MAKE_BINARY_CMP_SCALAR_SIMDVECTOR_OPS_(||)
 //----------------------------------------------------------------------------------------------------------------//
 
 
+// Blend/select on comparison masks - branch-free per lane choice of a where mask
+// is true and b elsewhere. The scalar overload allows writing kernels that are
+// generic over scalars and SIMDVectors. For float and double the lanes of the mask
+// are widened to a native mask and the vectors are blended in registers
+//----------------------------------------------------------------------------------------------------------------//
+template<typename T, typename ABI>
+FASTOR_INLINE SIMDVector<T,ABI> select(const SIMDVector<bool,simd_abi::fixed_size<SIMDVector<T,ABI>::Size>> &mask,
+    const SIMDVector<T,ABI> &a, const SIMDVector<T,ABI> &b) {
+    constexpr FASTOR_INDEX Size = SIMDVector<T,ABI>::Size;
+    FASTOR_ARCH_ALIGN T val_a[Size];
+    a.store(val_a);
+    FASTOR_ARCH_ALIGN T val_b[Size];
+    b.store(val_b);
+    FASTOR_ARCH_ALIGN bool val_mask[Size];
+    mask.store(val_mask);
+    for (FASTOR_INDEX i=0; i<Size; ++i) {
+        val_a[i] = val_mask[i] ? val_a[i] : val_b[i];
+    }
+    return SIMDVector<T,ABI>(val_a);
+}
+
+#ifdef FASTOR_SSE4_1_IMPL
+namespace internal {
+/* The lanes of a comparison mask as 0/1 bytes in the low N bytes of a register */
+template<size_t N>
+FASTOR_INLINE __m128i _mask_lanes_epi8(const SIMDVector<bool,simd_abi::fixed_size<N>> &mask) {
+    bool val_mask[16] = {};
+    mask.store(val_mask);
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(val_mask));
+}
+} // internal
+
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::sse> select<float,simd_abi::sse>(const SIMDVector<bool,simd_abi::fixed_size<4>> &mask,
+    const SIMDVector<float,simd_abi::sse> &a, const SIMDVector<float,simd_abi::sse> &b) {
+    // 0 - 1 sets all the bits of a lane
+    const __m128i m = _mm_sub_epi32(_mm_setzero_si128(),_mm_cvtepu8_epi32(internal::_mask_lanes_epi8(mask)));
+    SIMDVector<float,simd_abi::sse> out;
+    out.value = _mm_blendv_ps(b.value,a.value,_mm_castsi128_ps(m));
+    return out;
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::sse> select<double,simd_abi::sse>(const SIMDVector<bool,simd_abi::fixed_size<2>> &mask,
+    const SIMDVector<double,simd_abi::sse> &a, const SIMDVector<double,simd_abi::sse> &b) {
+    const __m128i m = _mm_sub_epi64(_mm_setzero_si128(),_mm_cvtepu8_epi64(internal::_mask_lanes_epi8(mask)));
+    SIMDVector<double,simd_abi::sse> out;
+    out.value = _mm_blendv_pd(b.value,a.value,_mm_castsi128_pd(m));
+    return out;
+}
+#endif
+#ifdef FASTOR_AVX2_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::avx> select<float,simd_abi::avx>(const SIMDVector<bool,simd_abi::fixed_size<8>> &mask,
+    const SIMDVector<float,simd_abi::avx> &a, const SIMDVector<float,simd_abi::avx> &b) {
+    const __m256i m = _mm256_sub_epi32(_mm256_setzero_si256(),_mm256_cvtepu8_epi32(internal::_mask_lanes_epi8(mask)));
+    SIMDVector<float,simd_abi::avx> out;
+    out.value = _mm256_blendv_ps(b.value,a.value,_mm256_castsi256_ps(m));
+    return out;
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::avx> select<double,simd_abi::avx>(const SIMDVector<bool,simd_abi::fixed_size<4>> &mask,
+    const SIMDVector<double,simd_abi::avx> &a, const SIMDVector<double,simd_abi::avx> &b) {
+    const __m256i m = _mm256_sub_epi64(_mm256_setzero_si256(),_mm256_cvtepu8_epi64(internal::_mask_lanes_epi8(mask)));
+    SIMDVector<double,simd_abi::avx> out;
+    out.value = _mm256_blendv_pd(b.value,a.value,_mm256_castsi256_pd(m));
+    return out;
+}
+#endif
+#ifdef FASTOR_AVX512F_IMPL
+template<>
+FASTOR_INLINE SIMDVector<float,simd_abi::avx512> select<float,simd_abi::avx512>(const SIMDVector<bool,simd_abi::fixed_size<16>> &mask,
+    const SIMDVector<float,simd_abi::avx512> &a, const SIMDVector<float,simd_abi::avx512> &b) {
+    const __m512i lanes = _mm512_cvtepu8_epi32(internal::_mask_lanes_epi8(mask));
+    SIMDVector<float,simd_abi::avx512> out;
+    out.value = _mm512_mask_blend_ps(_mm512_test_epi32_mask(lanes,lanes),b.value,a.value);
+    return out;
+}
+template<>
+FASTOR_INLINE SIMDVector<double,simd_abi::avx512> select<double,simd_abi::avx512>(const SIMDVector<bool,simd_abi::fixed_size<8>> &mask,
+    const SIMDVector<double,simd_abi::avx512> &a, const SIMDVector<double,simd_abi::avx512> &b) {
+    const __m512i lanes = _mm512_cvtepu8_epi64(internal::_mask_lanes_epi8(mask));
+    SIMDVector<double,simd_abi::avx512> out;
+    out.value = _mm512_mask_blend_pd(_mm512_test_epi64_mask(lanes,lanes),b.value,a.value);
+    return out;
+}
+#endif
+
+template<typename T>
+FASTOR_INLINE T select(bool mask, const T &a, const T &b) {
+    return mask ? a : b;
+}
+
+/* Returns true if the mask is set for any of the lanes */
+template<size_t N>
+FASTOR_INLINE bool any_of(const SIMDVector<bool,simd_abi::fixed_size<N>> &mask) {
+    FASTOR_ARCH_ALIGN bool val_mask[N];
+    mask.store(val_mask);
+    bool out = false;
+    for (FASTOR_INDEX i=0; i<N; ++i) {
+        out |= val_mask[i];
+    }
+    return out;
+}
+FASTOR_INLINE bool any_of(bool mask) {
+    return mask;
+}
+//----------------------------------------------------------------------------------------------------------------//
+
+
 } // end of namespace Fastor
 
 #endif // SIMD_VECTOR_COMMON_H
@@ -21,6 +21,12 @@ struct BinaryDivOp;
 template<typename TLhs, typename TRhs, size_t DIM0>
 struct BinaryMatMulOp;
 
+template<class Index_I, class Index_J, typename TLhs, typename TRhs, size_t DIM0>
+struct BinaryEinsumOp;
+
+template<class Indices, class Operands, size_t DIM0>
+struct NetworkEinsumOp;
+
 
 template<typename Expr, size_t DIMS>
 struct UnaryAddOp;
@@ -0,0 +1,569 @@
+#ifndef STRUCTURED_TENSOR_H
+#define STRUCTURED_TENSOR_H
+
+#include "Fastor/config/config.h"
+#include "Fastor/backend/structured.h"
+#include "Fastor/tensor/Tensor.h"
+#include "Fastor/tensor/TensorIO.h"
+#include "Fastor/tensor/SymmetricTensor.h"
+#include <algorithm>
+#include <ostream>
+
+namespace Fastor {
+
+// Diagonal 2nd order tensor storing only the M diagonal entries, e.g. lumped mass
+// matrices and Jacobi preconditioners. Constructing from a general tensor keeps its
+// diagonal
+//----------------------------------------------------------------------------------------------------------//
+template<typename T, size_t M, size_t N>
+class DiagonalTensor {
+    static_assert(M==N, "DIAGONAL TENSOR HAS TO BE SQUARE");
+public:
+    using scalar_type = T;
+    using result_type = DiagonalTensor<T,M,N>;
+    using dense_type  = Tensor<T,M,N>;
+    static constexpr FASTOR_INLINE FASTOR_INDEX rank() {return 2;}
+    static constexpr FASTOR_INLINE FASTOR_INDEX size() {return M;}
+    static constexpr FASTOR_INLINE FASTOR_INDEX dimension(FASTOR_INDEX) {return M;}
+
+    // Constructors
+    //----------------------------------------------------------------------------------------------------------//
+    constexpr FASTOR_INLINE DiagonalTensor() = default;
+
+    template<typename U=T, enable_if_t_<is_primitive_v_<U>,bool> = false>
+    FASTOR_INLINE DiagonalTensor(U num) {
+        fill(num);
+    }
+
+    // From the diagonal entries
+    FASTOR_INLINE DiagonalTensor(const Tensor<T,M> &d) {
+        std::copy(d.data(),d.data()+M,_data);
+    }
+
+    FASTOR_INLINE DiagonalTensor(const Tensor<T,M,N> &a) {
+        for (size_t i=0; i<M; ++i) _data[i] = a.data()[i*M+i];
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Raw pointer providers
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE T* data() const { return const_cast<T*>(this->_data);}
+    FASTOR_INLINE T* data() {return this->_data;}
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Scalar indexing - (i) is the i-th diagonal entry, (i,j) is read only
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE T& operator()(size_t i) {
+#if FASTOR_BOUNDS_CHECK
+        FASTOR_ASSERT(i<M, "INDEX OUT OF BOUNDS");
+#endif
+        return _data[i];
+    }
+    FASTOR_INLINE const T& operator()(size_t i) const {
+#if FASTOR_BOUNDS_CHECK
+        FASTOR_ASSERT(i<M, "INDEX OUT OF BOUNDS");
+#endif
+        return _data[i];
+    }
+    FASTOR_INLINE T operator()(size_t i, size_t j) const {
+#if FASTOR_BOUNDS_CHECK
+        FASTOR_ASSERT(i<M && j<M, "INDEX OUT OF BOUNDS");
+#endif
+        return i==j ? _data[i] : T(0);
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Methods
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE void fill(T num) {
+        std::fill(_data,_data+size(),num);
+    }
+    FASTOR_INLINE void zeros() {
+        fill(T(0));
+    }
+    FASTOR_INLINE void eye2() {
+        fill(T(1));
+    }
+    FASTOR_INLINE void random() {
+        for (FASTOR_INDEX i=0; i<size(); ++i) {
+            _data[i] = (T)rand()/RAND_MAX;
+        }
+    }
+    FASTOR_INLINE Tensor<T,M,N> dense() const {
+        Tensor<T,M,N> out(0);
+        for (size_t i=0; i<M; ++i) out.data()[i*M+i] = _data[i];
+        return out;
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // In-place operators
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE DiagonalTensor<T,M,N>& operator+=(const DiagonalTensor<T,M,N> &b) {
+        for (FASTOR_INDEX i=0; i<size(); ++i) _data[i] += b.data()[i];
+        return *this;
+    }
+    FASTOR_INLINE DiagonalTensor<T,M,N>& operator-=(const DiagonalTensor<T,M,N> &b) {
+        for (FASTOR_INDEX i=0; i<size(); ++i) _data[i] -= b.data()[i];
+        return *this;
+    }
+    FASTOR_INLINE DiagonalTensor<T,M,N>& operator*=(T num) {
+        for (FASTOR_INDEX i=0; i<size(); ++i) _data[i] *= num;
+        return *this;
+    }
+    FASTOR_INLINE DiagonalTensor<T,M,N>& operator/=(T num) {
+        return *this *= T(1)/num;
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+private:
+#ifdef FASTOR_ZERO_INITIALISE
+    FASTOR_ALIGN T _data[M] = {};
+#else
+    FASTOR_ALIGN T _data[M];
+#endif
+};
+//----------------------------------------------------------------------------------------------------------//
+
+
+// Banded N x N 2nd order tensor with KL sub-diagonals and KU super-diagonals storing
+// the N*(KL+KU+1) entries of the band row by row. Constructing from a general tensor
+// drops the entries outside of the band
+//----------------------------------------------------------------------------------------------------------//
+template<typename T, size_t N, size_t KL, size_t KU>
+class BandedTensor {
+    static_assert(KL<N && KU<N, "BANDWIDTH OF BANDED TENSOR HAS TO BE SMALLER THAN ITS DIMENSION");
+    using B = internal::band_index<N,KL,KU>;
+public:
+    using scalar_type = T;
+    using result_type = BandedTensor<T,N,KL,KU>;
+    using dense_type  = Tensor<T,N,N>;
+    static constexpr size_t lower_bandwidth = KL;
+    static constexpr size_t upper_bandwidth = KU;
+    static constexpr FASTOR_INLINE FASTOR_INDEX rank() {return 2;}
+    static constexpr FASTOR_INLINE FASTOR_INDEX size() {return B::size;}
+    static constexpr FASTOR_INLINE FASTOR_INDEX dimension(FASTOR_INDEX) {return N;}
+
+    // Constructors
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE BandedTensor() {
+        // the padding slots take part in the in-place arithmetic
+        std::fill(_data,_data+size(),T(0));
+    }
+
+    template<typename U=T, enable_if_t_<is_primitive_v_<U>,bool> = false>
+    FASTOR_INLINE BandedTensor(U num) : BandedTensor() {
+        fill(num);
+    }
+
+    FASTOR_INLINE BandedTensor(const Tensor<T,N,N> &a) : BandedTensor() {
+        for (size_t i=0; i<N; ++i) {
+            for (size_t j=B::first(i); j<B::last(i); ++j) {
+                _data[B::idx(i,j)] = a.data()[i*N+j];
+            }
+        }
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Raw pointer providers
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE T* data() const { return const_cast<T*>(this->_data);}
+    FASTOR_INLINE T* data() {return this->_data;}
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Scalar indexing - only entries inside the band can be written to
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE T& operator()(size_t i, size_t j) {
+#if FASTOR_BOUNDS_CHECK
+        FASTOR_ASSERT(i<N && j<N, "INDEX OUT OF BOUNDS");
+        FASTOR_ASSERT(B::in_band(i,j), "INDEX OUTSIDE OF THE BAND");
+#endif
+        return _data[B::idx(i,j)];
+    }
+    FASTOR_INLINE T operator()(size_t i, size_t j) const {
+#if FASTOR_BOUNDS_CHECK
+        FASTOR_ASSERT(i<N && j<N, "INDEX OUT OF BOUNDS");
+#endif
+        return B::in_band(i,j) ? _data[B::idx(i,j)] : T(0);
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Methods
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE void fill(T num) {
+        for (size_t i=0; i<N; ++i) {
+            for (size_t j=B::first(i); j<B::last(i); ++j) {
+                _data[B::idx(i,j)] = num;
+            }
+        }
+    }
+    FASTOR_INLINE void zeros() {
+        std::fill(_data,_data+size(),T(0));
+    }
+    FASTOR_INLINE void eye2() {
+        zeros();
+        for (size_t i=0; i<N; ++i) _data[B::idx(i,i)] = T(1);
+    }
+    FASTOR_INLINE void random() {
+        for (size_t i=0; i<N; ++i) {
+            for (size_t j=B::first(i); j<B::last(i); ++j) {
+                _data[B::idx(i,j)] = (T)rand()/RAND_MAX;
+            }
+        }
+    }
+    FASTOR_INLINE Tensor<T,N,N> dense() const {
+        Tensor<T,N,N> out(0);
+        for (size_t i=0; i<N; ++i) {
+            for (size_t j=B::first(i); j<B::last(i); ++j) {
+                out.data()[i*N+j] = _data[B::idx(i,j)];
+            }
+        }
+        return out;
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // In-place operators
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE BandedTensor<T,N,KL,KU>& operator+=(const BandedTensor<T,N,KL,KU> &b) {
+        for (FASTOR_INDEX i=0; i<size(); ++i) _data[i] += b.data()[i];
+        return *this;
+    }
+    FASTOR_INLINE BandedTensor<T,N,KL,KU>& operator-=(const BandedTensor<T,N,KL,KU> &b) {
+        for (FASTOR_INDEX i=0; i<size(); ++i) _data[i] -= b.data()[i];
+        return *this;
+    }
+    FASTOR_INLINE BandedTensor<T,N,KL,KU>& operator*=(T num) {
+        for (FASTOR_INDEX i=0; i<size(); ++i) _data[i] *= num;
+        return *this;
+    }
+    FASTOR_INLINE BandedTensor<T,N,KL,KU>& operator/=(T num) {
+        return *this *= T(1)/num;
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+private:
+    FASTOR_ALIGN T _data[B::size];
+};
+
+template<typename T, size_t N>
+using TridiagonalTensor = BandedTensor<T,N,1,1>;
+//----------------------------------------------------------------------------------------------------------//
+
+
+// Block diagonal N x N 2nd order tensor of N/B dense B x B blocks on the diagonal,
+// stored one after the other. Constructing from a general tensor keeps the blocks
+//----------------------------------------------------------------------------------------------------------//
+template<typename T, size_t N, size_t B>
+class BlockDiagonalTensor {
+    static_assert(N % B == 0, "BLOCK SIZE HAS TO DIVIDE THE DIMENSION OF BLOCK DIAGONAL TENSOR");
+public:
+    using scalar_type = T;
+    using result_type = BlockDiagonalTensor<T,N,B>;
+    using dense_type  = Tensor<T,N,N>;
+    using block_type  = Tensor<T,B,B>;
+    static constexpr size_t num_blocks = N/B;
+    static constexpr FASTOR_INLINE FASTOR_INDEX rank() {return 2;}
+    static constexpr FASTOR_INLINE FASTOR_INDEX size() {return N*B;}
+    static constexpr FASTOR_INLINE FASTOR_INDEX dimension(FASTOR_INDEX) {return N;}
+
+    // Constructors
+    //----------------------------------------------------------------------------------------------------------//
+    constexpr FASTOR_INLINE BlockDiagonalTensor() = default;
+
+    template<typename U=T, enable_if_t_<is_primitive_v_<U>,bool> = false>
+    FASTOR_INLINE BlockDiagonalTensor(U num) {
+        fill(num);
+    }
+
+    FASTOR_INLINE BlockDiagonalTensor(const Tensor<T,N,N> &a) {
+        for (size_t k=0; k<num_blocks; ++k)
+            for (size_t i=0; i<B; ++i)
+                for (size_t j=0; j<B; ++j)
+                    _data[k*B*B+i*B+j] = a.data()[(k*B+i)*N+k*B+j];
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Raw pointer providers
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE T* data() const { return const_cast<T*>(this->_data);}
+    FASTOR_INLINE T* data() {return this->_data;}
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Block access
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE block_type block(size_t k) const {
+#if FASTOR_BOUNDS_CHECK
+        FASTOR_ASSERT(k<num_blocks, "INDEX OUT OF BOUNDS");
+#endif
+        return block_type(&_data[k*B*B]);
+    }
+    FASTOR_INLINE void block(size_t k, const block_type &a) {
+#if FASTOR_BOUNDS_CHECK
+        FASTOR_ASSERT(k<num_blocks, "INDEX OUT OF BOUNDS");
+#endif
+        std::copy(a.data(),a.data()+B*B,&_data[k*B*B]);
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Scalar indexing - only entries inside the blocks can be written to
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE T& operator()(size_t i, size_t j) {
+#if FASTOR_BOUNDS_CHECK
+        FASTOR_ASSERT(i<N && j<N, "INDEX OUT OF BOUNDS");
+        FASTOR_ASSERT(i/B==j/B, "INDEX OUTSIDE OF THE DIAGONAL BLOCKS");
+#endif
+        return _data[(i/B)*B*B + (i%B)*B + j%B];
+    }
+    FASTOR_INLINE T operator()(size_t i, size_t j) const {
+#if FASTOR_BOUNDS_CHECK
+        FASTOR_ASSERT(i<N && j<N, "INDEX OUT OF BOUNDS");
+#endif
+        return i/B==j/B ? _data[(i/B)*B*B + (i%B)*B + j%B] : T(0);
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Methods
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE void fill(T num) {
+        std::fill(_data,_data+size(),num);
+    }
+    FASTOR_INLINE void zeros() {
+        fill(T(0));
+    }
+    FASTOR_INLINE void eye2() {
+        zeros();
+        for (size_t k=0; k<num_blocks; ++k)
+            for (size_t i=0; i<B; ++i)
+                _data[k*B*B+i*B+i] = T(1);
+    }
+    FASTOR_INLINE void random() {
+        for (FASTOR_INDEX i=0; i<size(); ++i) {
+            _data[i] = (T)rand()/RAND_MAX;
+        }
+    }
+    FASTOR_INLINE Tensor<T,N,N> dense() const {
+        Tensor<T,N,N> out(0);
+        for (size_t k=0; k<num_blocks; ++k)
+            for (size_t i=0; i<B; ++i)
+                for (size_t j=0; j<B; ++j)
+                    out.data()[(k*B+i)*N+k*B+j] = _data[k*B*B+i*B+j];
+        return out;
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // In-place operators
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE BlockDiagonalTensor<T,N,B>& operator+=(const BlockDiagonalTensor<T,N,B> &b) {
+        for (FASTOR_INDEX i=0; i<size(); ++i) _data[i] += b.data()[i];
+        return *this;
+    }
+    FASTOR_INLINE BlockDiagonalTensor<T,N,B>& operator-=(const BlockDiagonalTensor<T,N,B> &b) {
+        for (FASTOR_INDEX i=0; i<size(); ++i) _data[i] -= b.data()[i];
+        return *this;
+    }
+    FASTOR_INLINE BlockDiagonalTensor<T,N,B>& operator*=(T num) {
+        for (FASTOR_INDEX i=0; i<size(); ++i) _data[i] *= num;
+        return *this;
+    }
+    FASTOR_INLINE BlockDiagonalTensor<T,N,B>& operator/=(T num) {
+        return *this *= T(1)/num;
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+private:
+#ifdef FASTOR_ZERO_INITIALISE
+    FASTOR_ALIGN T _data[N*B] = {};
+#else
+    FASTOR_ALIGN T _data[N*B];
+#endif
+};
+//----------------------------------------------------------------------------------------------------------//
+
+
+namespace internal {
+template<typename T, size_t M, size_t N>
+struct is_packed_tensor<DiagonalTensor<T,M,N>> : std::true_type {};
+template<typename T, size_t N, size_t KL, size_t KU>
+struct is_packed_tensor<BandedTensor<T,N,KL,KU>> : std::true_type {};
+template<typename T, size_t N, size_t B>
+struct is_packed_tensor<BlockDiagonalTensor<T,N,B>> : std::true_type {};
+
+template<typename T>
+struct is_structured_tensor : std::false_type {};
+template<typename T, size_t M, size_t N>
+struct is_structured_tensor<DiagonalTensor<T,M,N>> : std::true_type {};
+template<typename T, size_t N, size_t KL, size_t KU>
+struct is_structured_tensor<BandedTensor<T,N,KL,KU>> : std::true_type {};
+template<typename T, size_t N, size_t B>
+struct is_structured_tensor<BlockDiagonalTensor<T,N,B>> : std::true_type {};
+
+// out = a * b and out = a^{-1} * b for the N x P matrix b
+//----------------------------------------------------------------------------------------------------------//
+template<size_t P, typename T, size_t N>
+FASTOR_INLINE void structured_matmul(const DiagonalTensor<T,N,N> &a, const T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT out) {
+    _diag_matmul<T,N,P>(a.data(),b,out);
+}
+template<size_t P, typename T, size_t N, size_t KL, size_t KU>
+FASTOR_INLINE void structured_matmul(const BandedTensor<T,N,KL,KU> &a, const T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT out) {
+    _band_matmul<T,N,KL,KU,P>(a.data(),b,out);
+}
+template<size_t P, typename T, size_t N, size_t B>
+FASTOR_INLINE void structured_matmul(const BlockDiagonalTensor<T,N,B> &a, const T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT out) {
+    _blockdiag_matmul<T,N,B,P>(a.data(),b,out);
+}
+
+template<size_t P, typename T, size_t N>
+FASTOR_INLINE void structured_solve(const DiagonalTensor<T,N,N> &a, const T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT out) {
+    _diag_solve<T,N,P>(a.data(),b,out);
+}
+template<size_t P, typename T, size_t N, size_t KL, size_t KU>
+FASTOR_INLINE void structured_solve(const BandedTensor<T,N,KL,KU> &a, const T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT out) {
+    BandedTensor<T,N,KL,KU> lu(a);
+    _band_lufact<T,N,KL,KU>(lu.data());
+    std::copy(b,b+N*P,out);
+    _band_lusolve<T,N,KL,KU,P>(lu.data(),out);
+}
+template<size_t P, typename T, size_t N, size_t B>
+FASTOR_INLINE void structured_solve(const BlockDiagonalTensor<T,N,B> &a, const T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT out) {
+    _blockdiag_solve<T,N,B,P>(a.data(),b,out);
+}
+//----------------------------------------------------------------------------------------------------------//
+} // internal
+
+
+// Linear algebra - products and solves against dense tensors and expressions cost
+// O(N) per column for diagonal, O(N*bandwidth) for banded and O(N*B) for block
+// diagonal tensors
+//----------------------------------------------------------------------------------------------------------//
+template<typename TT, typename T, size_t N,
+    enable_if_t_<internal::is_structured_tensor<TT>::value && TT::dimension(0)==N,bool> = false>
+FASTOR_INLINE Tensor<T,N> matmul(const TT &a, const Tensor<T,N> &b) {
+    Tensor<T,N> out;
+    internal::structured_matmul<1>(a,b.data(),out.data());
+    return out;
+}
+template<typename TT, typename T, size_t N, size_t P,
+    enable_if_t_<internal::is_structured_tensor<TT>::value && TT::dimension(0)==N,bool> = false>
+FASTOR_INLINE Tensor<T,N,P> matmul(const TT &a, const Tensor<T,N,P> &b) {
+    Tensor<T,N,P> out;
+    internal::structured_matmul<P>(a,b.data(),out.data());
+    return out;
+}
+template<typename TT, typename Derived, size_t DIM,
+    enable_if_t_<internal::is_structured_tensor<TT>::value && !is_tensor_v<Derived>,bool> = false>
+FASTOR_INLINE typename Derived::result_type matmul(const TT &a, const AbstractTensor<Derived,DIM> &b) {
+    const typename Derived::result_type tmp(b.self());
+    return matmul(a,tmp);
+}
+template<typename TT, typename Derived, size_t DIM,
+    enable_if_t_<internal::is_structured_tensor<TT>::value,bool> = false>
+FASTOR_INLINE auto operator%(const TT &a, const AbstractTensor<Derived,DIM> &b)
+-> decltype(matmul(a,b.self())) {
+    return matmul(a,b.self());
+}
+
+// Diagonal scaling from the right and products of diagonal tensors
+template<typename T, size_t M, size_t N>
+FASTOR_INLINE Tensor<T,M,N> matmul(const Tensor<T,M,N> &a, const DiagonalTensor<T,N,N> &d) {
+    Tensor<T,M,N> out;
+    _matmul_diag<T,M,N>(a.data(),d.data(),out.data());
+    return out;
+}
+template<typename Derived, size_t DIM, typename T, size_t N,
+    enable_if_t_<!is_tensor_v<Derived>,bool> = false>
+FASTOR_INLINE typename Derived::result_type matmul(const AbstractTensor<Derived,DIM> &a, const DiagonalTensor<T,N,N> &d) {
+    const typename Derived::result_type tmp(a.self());
+    return matmul(tmp,d);
+}
+template<typename Derived, size_t DIM, typename T, size_t N>
+FASTOR_INLINE auto operator%(const AbstractTensor<Derived,DIM> &a, const DiagonalTensor<T,N,N> &d)
+-> decltype(matmul(a.self(),d)) {
+    return matmul(a.self(),d);
+}
+template<typename T, size_t N>
+FASTOR_INLINE DiagonalTensor<T,N,N> matmul(const DiagonalTensor<T,N,N> &a, const DiagonalTensor<T,N,N> &b) {
+    DiagonalTensor<T,N,N> out;
+    for (size_t i=0; i<N; ++i) out.data()[i] = a.data()[i]*b.data()[i];
+    return out;
+}
+template<typename T, size_t N>
+FASTOR_INLINE DiagonalTensor<T,N,N> operator%(const DiagonalTensor<T,N,N> &a, const DiagonalTensor<T,N,N> &b) {
+    return matmul(a,b);
+}
+
+template<typename TT, typename T, size_t N,
+    enable_if_t_<internal::is_structured_tensor<TT>::value && TT::dimension(0)==N,bool> = false>
+FASTOR_INLINE Tensor<T,N> solve(const TT &a, const Tensor<T,N> &b) {
+    Tensor<T,N> out;
+    internal::structured_solve<1>(a,b.data(),out.data());
+    return out;
+}
+template<typename TT, typename T, size_t N, size_t P,
+    enable_if_t_<internal::is_structured_tensor<TT>::value && TT::dimension(0)==N,bool> = false>
+FASTOR_INLINE Tensor<T,N,P> solve(const TT &a, const Tensor<T,N,P> &b) {
+    Tensor<T,N,P> out;
+    internal::structured_solve<P>(a,b.data(),out.data());
+    return out;
+}
+template<typename TT, typename Derived, size_t DIM,
+    enable_if_t_<internal::is_structured_tensor<TT>::value && !is_tensor_v<Derived>,bool> = false>
+FASTOR_INLINE typename Derived::result_type solve(const TT &a, const AbstractTensor<Derived,DIM> &b) {
+    const typename Derived::result_type tmp(b.self());
+    return solve(a,tmp);
+}
+
+template<typename T, size_t N>
+FASTOR_INLINE DiagonalTensor<T,N,N> inverse(const DiagonalTensor<T,N,N> &a) {
+    DiagonalTensor<T,N,N> out;
+    for (size_t i=0; i<N; ++i) out.data()[i] = T(1)/a.data()[i];
+    return out;
+}
+// The inverse of a banded tensor is dense in general, prefer solve
+template<typename T, size_t N, size_t KL, size_t KU>
+FASTOR_INLINE Tensor<T,N,N> inverse(const BandedTensor<T,N,KL,KU> &a) {
+    Tensor<T,N,N> I; I.eye2();
+    return solve(a,I);
+}
+template<typename T, size_t N, size_t B>
+FASTOR_INLINE BlockDiagonalTensor<T,N,B> inverse(const BlockDiagonalTensor<T,N,B> &a) {
+    BlockDiagonalTensor<T,N,B> out;
+    _blockdiag_inverse<T,N,B>(a.data(),out.data());
+    return out;
+}
+
+template<typename T, size_t N>
+FASTOR_INLINE T determinant(const DiagonalTensor<T,N,N> &a) {
+    T out = 1;
+    for (size_t i=0; i<N; ++i) out *= a.data()[i];
+    return out;
+}
+template<typename T, size_t N, size_t KL, size_t KU>
+FASTOR_INLINE T determinant(const BandedTensor<T,N,KL,KU> &a) {
+    BandedTensor<T,N,KL,KU> lu(a);
+    _band_lufact<T,N,KL,KU>(lu.data());
+    T out = 1;
+    for (size_t i=0; i<N; ++i) out *= lu(i,i);
+    return out;
+}
+template<typename T, size_t N, size_t B>
+FASTOR_INLINE T determinant(const BlockDiagonalTensor<T,N,B> &a) {
+    return _blockdiag_determinant<T,N,B>(a.data());
+}
+
+template<typename TT, enable_if_t_<internal::is_structured_tensor<TT>::value,bool> = false>
+FASTOR_INLINE typename TT::scalar_type trace(const TT &a) {
+    typename TT::scalar_type out = 0;
+    for (size_t i=0; i<TT::dimension(0); ++i) out += a(i,i);
+    return out;
+}
+//----------------------------------------------------------------------------------------------------------//
+
+
+template<typename TT, enable_if_t_<internal::is_structured_tensor<TT>::value,bool> = false>
+inline std::ostream& operator<<(std::ostream &os, const TT &a) {
+    return os << a.dense();
+}
+
+} // end of namespace Fastor
+
+
+#endif // STRUCTURED_TENSOR_H
@@ -0,0 +1,399 @@
+#ifndef SYMMETRIC_TENSOR_H
+#define SYMMETRIC_TENSOR_H
+
+#include "Fastor/config/config.h"
+#include "Fastor/backend/symmetric.h"
+#include "Fastor/tensor/Tensor.h"
+#include "Fastor/tensor/TensorIO.h"
+#include <algorithm>
+#include <ostream>
+
+namespace Fastor {
+
+// Symmetric 2nd order tensor A_ij = A_ji storing only the M(M+1)/2 distinct components
+// in Voigt order [11, 22, 33, 12, 13, 23 for M = 3]. Constructing from a general tensor
+// or expression takes its symmetric part
+//----------------------------------------------------------------------------------------------------------//
+template<typename T, size_t M, size_t N>
+class SymmetricTensor {
+    static_assert(M==N, "SYMMETRIC TENSOR HAS TO BE SQUARE");
+    using S = internal::sym_index<M>;
+public:
+    using scalar_type = T;
+    using result_type = SymmetricTensor<T,M,N>;
+    using dense_type  = Tensor<T,M,N>;
+    static constexpr FASTOR_INLINE FASTOR_INDEX rank() {return 2;}
+    static constexpr FASTOR_INLINE FASTOR_INDEX size() {return S::size;}
+    static constexpr FASTOR_INLINE FASTOR_INDEX dimension(FASTOR_INDEX) {return M;}
+
+    // Constructors
+    //----------------------------------------------------------------------------------------------------------//
+    constexpr FASTOR_INLINE SymmetricTensor() = default;
+
+    template<typename U=T, enable_if_t_<is_primitive_v_<U>,bool> = false>
+    FASTOR_INLINE SymmetricTensor(U num) {
+        fill(num);
+    }
+
+    FASTOR_INLINE SymmetricTensor(const Tensor<T,M,N> &a) {
+        const T *a_data = a.data();
+        for (size_t i=0; i<M; ++i) {
+            _data[i] = a_data[i*M+i];
+            for (size_t j=i+1; j<M; ++j) {
+                _data[S::idx(i,j)] = T(0.5)*(a_data[i*M+j] + a_data[j*M+i]);
+            }
+        }
+    }
+
+    template<typename Derived, enable_if_t_<!is_tensor_v<Derived>,bool> = false>
+    FASTOR_INLINE SymmetricTensor(const AbstractTensor<Derived,2> &src)
+        : SymmetricTensor(Tensor<T,M,N>(src.self())) {}
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Raw pointer providers
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE T* data() const { return const_cast<T*>(this->_data);}
+    FASTOR_INLINE T* data() {return this->_data;}
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Scalar indexing - both (i,j) and (j,i) refer to the same stored component
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE T& operator()(size_t i, size_t j) {
+#if FASTOR_BOUNDS_CHECK
+        FASTOR_ASSERT(i<M && j<M, "INDEX OUT OF BOUNDS");
+#endif
+        return _data[S::idx(i,j)];
+    }
+    FASTOR_INLINE const T& operator()(size_t i, size_t j) const {
+#if FASTOR_BOUNDS_CHECK
+        FASTOR_ASSERT(i<M && j<M, "INDEX OUT OF BOUNDS");
+#endif
+        return _data[S::idx(i,j)];
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Methods
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE void fill(T num) {
+        std::fill(_data,_data+size(),num);
+    }
+    FASTOR_INLINE void zeros() {
+        fill(T(0));
+    }
+    FASTOR_INLINE void eye2() {
+        std::fill(_data,_data+M,T(1));
+        std::fill(_data+M,_data+size(),T(0));
+    }
+    FASTOR_INLINE void random() {
+        for (FASTOR_INDEX i=0; i<size(); ++i) {
+            _data[i] = (T)rand()/RAND_MAX;
+        }
+    }
+    FASTOR_INLINE Tensor<T,M,N> dense() const {
+        Tensor<T,M,N> out;
+        T *out_data = out.data();
+        for (size_t i=0; i<M; ++i) {
+            for (size_t j=0; j<M; ++j) {
+                out_data[i*M+j] = _data[S::idx(i,j)];
+            }
+        }
+        return out;
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // In-place operators
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE SymmetricTensor<T,M,N>& operator+=(const SymmetricTensor<T,M,N> &b) {
+        for (FASTOR_INDEX i=0; i<size(); ++i) _data[i] += b.data()[i];
+        return *this;
+    }
+    FASTOR_INLINE SymmetricTensor<T,M,N>& operator-=(const SymmetricTensor<T,M,N> &b) {
+        for (FASTOR_INDEX i=0; i<size(); ++i) _data[i] -= b.data()[i];
+        return *this;
+    }
+    FASTOR_INLINE SymmetricTensor<T,M,N>& operator*=(T num) {
+        for (FASTOR_INDEX i=0; i<size(); ++i) _data[i] *= num;
+        return *this;
+    }
+    FASTOR_INLINE SymmetricTensor<T,M,N>& operator/=(T num) {
+        return *this *= T(1)/num;
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+private:
+#ifdef FASTOR_ZERO_INITIALISE
+    FASTOR_ALIGN T _data[S::size] = {};
+#else
+    FASTOR_ALIGN T _data[S::size];
+#endif
+};
+//----------------------------------------------------------------------------------------------------------//
+
+
+// Minor symmetric 4th order tensor C_ijkl = C_jikl = C_ijlk stored as its N x N Voigt
+// matrix, N = M(M+1)/2. With MajorSym the additional symmetry C_ijkl = C_klij is
+// exploited and only the upper triangle of the Voigt matrix is stored [21 components
+// instead of 36 for M = 3]. Constructing from a general tensor takes its symmetric part
+//----------------------------------------------------------------------------------------------------------//
+template<typename T, size_t M, bool MajorSym = false>
+class MinorSymmetricTensor4 {
+    using S = internal::sym_index<M>;
+    using C = internal::msym_index<M,MajorSym>;
+public:
+    using scalar_type = T;
+    using result_type = MinorSymmetricTensor4<T,M,MajorSym>;
+    using dense_type  = Tensor<T,M,M,M,M>;
+    using voigt_type  = Tensor<T,S::size,S::size>;
+    static constexpr bool is_major_symmetric = MajorSym;
+    static constexpr FASTOR_INLINE FASTOR_INDEX rank() {return 4;}
+    static constexpr FASTOR_INLINE FASTOR_INDEX size() {return C::size;}
+    static constexpr FASTOR_INLINE FASTOR_INDEX dimension(FASTOR_INDEX) {return M;}
+
+    // Constructors
+    //----------------------------------------------------------------------------------------------------------//
+    constexpr FASTOR_INLINE MinorSymmetricTensor4() = default;
+
+    template<typename U=T, enable_if_t_<is_primitive_v_<U>,bool> = false>
+    FASTOR_INLINE MinorSymmetricTensor4(U num) {
+        fill(num);
+    }
+
+    FASTOR_INLINE MinorSymmetricTensor4(const Tensor<T,M,M,M,M> &a) {
+        voigt_type v;
+        for (size_t i=0; i<M; ++i)
+            for (size_t j=i; j<M; ++j)
+                for (size_t k=0; k<M; ++k)
+                    for (size_t l=k; l<M; ++l)
+                        v(S::idx(i,j),S::idx(k,l)) = T(0.25)*(a(i,j,k,l) + a(j,i,k,l) + a(i,j,l,k) + a(j,i,l,k));
+        from_voigt(v);
+    }
+
+    // From the Voigt matrix
+    FASTOR_INLINE MinorSymmetricTensor4(const voigt_type &v) {
+        from_voigt(v);
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Raw pointer providers
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE T* data() const { return const_cast<T*>(this->_data);}
+    FASTOR_INLINE T* data() {return this->_data;}
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Scalar indexing - all symmetric permutations of the indices refer to the same stored component
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE T& operator()(size_t i, size_t j, size_t k, size_t l) {
+#if FASTOR_BOUNDS_CHECK
+        FASTOR_ASSERT(i<M && j<M && k<M && l<M, "INDEX OUT OF BOUNDS");
+#endif
+        return _data[C::idx(S::idx(i,j),S::idx(k,l))];
+    }
+    FASTOR_INLINE const T& operator()(size_t i, size_t j, size_t k, size_t l) const {
+#if FASTOR_BOUNDS_CHECK
+        FASTOR_ASSERT(i<M && j<M && k<M && l<M, "INDEX OUT OF BOUNDS");
+#endif
+        return _data[C::idx(S::idx(i,j),S::idx(k,l))];
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // Methods
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE void fill(T num) {
+        std::fill(_data,_data+size(),num);
+    }
+    FASTOR_INLINE void zeros() {
+        fill(T(0));
+    }
+    FASTOR_INLINE void random() {
+        for (FASTOR_INDEX i=0; i<size(); ++i) {
+            _data[i] = (T)rand()/RAND_MAX;
+        }
+    }
+    FASTOR_INLINE voigt_type voigt() const {
+        voigt_type v;
+        for (size_t I=0; I<S::size; ++I)
+            for (size_t J=0; J<S::size; ++J)
+                v(I,J) = _data[C::idx(I,J)];
+        return v;
+    }
+    FASTOR_INLINE Tensor<T,M,M,M,M> dense() const {
+        Tensor<T,M,M,M,M> out;
+        for (size_t i=0; i<M; ++i)
+            for (size_t j=0; j<M; ++j)
+                for (size_t k=0; k<M; ++k)
+                    for (size_t l=0; l<M; ++l)
+                        out(i,j,k,l) = (*this)(i,j,k,l);
+        return out;
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+    // In-place operators
+    //----------------------------------------------------------------------------------------------------------//
+    FASTOR_INLINE MinorSymmetricTensor4<T,M,MajorSym>& operator+=(const MinorSymmetricTensor4<T,M,MajorSym> &b) {
+        for (FASTOR_INDEX i=0; i<size(); ++i) _data[i] += b.data()[i];
+        return *this;
+    }
+    FASTOR_INLINE MinorSymmetricTensor4<T,M,MajorSym>& operator-=(const MinorSymmetricTensor4<T,M,MajorSym> &b) {
+        for (FASTOR_INDEX i=0; i<size(); ++i) _data[i] -= b.data()[i];
+        return *this;
+    }
+    FASTOR_INLINE MinorSymmetricTensor4<T,M,MajorSym>& operator*=(T num) {
+        for (FASTOR_INDEX i=0; i<size(); ++i) _data[i] *= num;
+        return *this;
+    }
+    FASTOR_INLINE MinorSymmetricTensor4<T,M,MajorSym>& operator/=(T num) {
+        return *this *= T(1)/num;
+    }
+    //----------------------------------------------------------------------------------------------------------//
+
+private:
+    FASTOR_INLINE void from_voigt(const voigt_type &v) {
+        for (size_t I=0; I<S::size; ++I) {
+            for (size_t J=MajorSym ? I : 0; J<S::size; ++J) {
+                _data[C::idx(I,J)] = MajorSym ? T(0.5)*(v(I,J) + v(J,I)) : v(I,J);
+            }
+        }
+    }
+
+#ifdef FASTOR_ZERO_INITIALISE
+    FASTOR_ALIGN T _data[C::size] = {};
+#else
+    FASTOR_ALIGN T _data[C::size];
+#endif
+};
+//----------------------------------------------------------------------------------------------------------//
+
+
+// Arithmetic on the stored components
+//----------------------------------------------------------------------------------------------------------//
+namespace internal {
+template<typename T>
+struct is_packed_tensor : std::false_type {};
+template<typename T, size_t M, size_t N>
+struct is_packed_tensor<SymmetricTensor<T,M,N>> : std::true_type {};
+template<typename T, size_t M, bool MajorSym>
+struct is_packed_tensor<MinorSymmetricTensor4<T,M,MajorSym>> : std::true_type {};
+} // internal
+
+template<typename TT, enable_if_t_<internal::is_packed_tensor<TT>::value,bool> = false>
+FASTOR_INLINE TT operator+(const TT &a, const TT &b) {
+    TT out(a); out += b; return out;
+}
+template<typename TT, enable_if_t_<internal::is_packed_tensor<TT>::value,bool> = false>
+FASTOR_INLINE TT operator-(const TT &a, const TT &b) {
+    TT out(a); out -= b; return out;
+}
+template<typename TT, enable_if_t_<internal::is_packed_tensor<TT>::value,bool> = false>
+FASTOR_INLINE TT operator-(const TT &a) {
+    TT out(a); out *= typename TT::scalar_type(-1); return out;
+}
+template<typename TT, typename U, enable_if_t_<internal::is_packed_tensor<TT>::value && is_primitive_v_<U>,bool> = false>
+FASTOR_INLINE TT operator*(const TT &a, U num) {
+    TT out(a); out *= typename TT::scalar_type(num); return out;
+}
+template<typename TT, typename U, enable_if_t_<internal::is_packed_tensor<TT>::value && is_primitive_v_<U>,bool> = false>
+FASTOR_INLINE TT operator*(U num, const TT &a) {
+    TT out(a); out *= typename TT::scalar_type(num); return out;
+}
+template<typename TT, typename U, enable_if_t_<internal::is_packed_tensor<TT>::value && is_primitive_v_<U>,bool> = false>
+FASTOR_INLINE TT operator/(const TT &a, U num) {
+    TT out(a); out /= typename TT::scalar_type(num); return out;
+}
+//----------------------------------------------------------------------------------------------------------//
+
+
+// Linear algebra
+//----------------------------------------------------------------------------------------------------------//
+template<typename T, size_t M>
+FASTOR_INLINE T doublecontract(const SymmetricTensor<T,M,M> &a, const SymmetricTensor<T,M,M> &b) {
+    return _sym_doublecontract<T,M>(a.data(),b.data());
+}
+template<typename T, size_t M>
+FASTOR_INLINE T trace(const SymmetricTensor<T,M,M> &a) {
+    T out = 0;
+    for (size_t i=0; i<M; ++i) out += a.data()[i];
+    return out;
+}
+template<typename T, size_t M>
+FASTOR_INLINE T determinant(const SymmetricTensor<T,M,M> &a) {
+    return _sym_determinant<T,M>(a.data());
+}
+template<typename T, size_t M>
+FASTOR_INLINE SymmetricTensor<T,M,M> inverse(const SymmetricTensor<T,M,M> &a) {
+    SymmetricTensor<T,M,M> out;
+    _sym_inverse<T,M>(a.data(),out.data());
+    return out;
+}
+template<typename T, size_t M>
+FASTOR_INLINE Tensor<T,M,M> matmul(const SymmetricTensor<T,M,M> &a, const SymmetricTensor<T,M,M> &b) {
+    Tensor<T,M,M> out;
+    _sym_matmul<T,M>(a.data(),b.data(),out.data());
+    return out;
+}
+template<typename T, size_t M, size_t K>
+FASTOR_INLINE Tensor<T,M,K> matmul(const SymmetricTensor<T,M,M> &a, const Tensor<T,M,K> &b) {
+    Tensor<T,M,K> out;
+    _sym_matmul_general<T,M,K>(a.data(),b.data(),out.data());
+    return out;
+}
+template<typename T, size_t M>
+FASTOR_INLINE Tensor<T,M> matmul(const SymmetricTensor<T,M,M> &a, const Tensor<T,M> &b) {
+    Tensor<T,M> out;
+    _sym_matmul_general<T,M,1>(a.data(),b.data(),out.data());
+    return out;
+}
+
+// C : S
+template<typename T, size_t M, bool MajorSym>
+FASTOR_INLINE SymmetricTensor<T,M,M> doublecontract(const MinorSymmetricTensor4<T,M,MajorSym> &c, const SymmetricTensor<T,M,M> &s) {
+    SymmetricTensor<T,M,M> out;
+    _msym_doublecontract_sym<T,M,MajorSym>(c.data(),s.data(),out.data());
+    return out;
+}
+// S : C
+template<typename T, size_t M, bool MajorSym>
+FASTOR_INLINE SymmetricTensor<T,M,M> doublecontract(const SymmetricTensor<T,M,M> &s, const MinorSymmetricTensor4<T,M,MajorSym> &c) {
+    SymmetricTensor<T,M,M> out;
+    _sym_doublecontract_msym<T,M,MajorSym>(s.data(),c.data(),out.data());
+    return out;
+}
+// A : B
+template<typename T, size_t M, bool MajorSymA, bool MajorSymB>
+FASTOR_INLINE MinorSymmetricTensor4<T,M> doublecontract(const MinorSymmetricTensor4<T,M,MajorSymA> &a, const MinorSymmetricTensor4<T,M,MajorSymB> &b) {
+    MinorSymmetricTensor4<T,M> out;
+    _msym_doublecontract<T,M,MajorSymA,MajorSymB>(a.data(),b.data(),out.data());
+    return out;
+}
+// Inverse with respect to the symmetric 4th order identity, C : inverse(C) = I^sym
+template<typename T, size_t M, bool MajorSym>
+FASTOR_INLINE MinorSymmetricTensor4<T,M,MajorSym> inverse(const MinorSymmetricTensor4<T,M,MajorSym> &c) {
+    MinorSymmetricTensor4<T,M,MajorSym> out;
+    _msym_inverse<T,M,MajorSym>(c.data(),out.data());
+    return out;
+}
+
+// Voigt forms without the manual packing
+template<typename T, size_t M>
+FASTOR_INLINE Tensor<T,internal::sym_index<M>::size> voigt(const SymmetricTensor<T,M,M> &a) {
+    return Tensor<T,internal::sym_index<M>::size>(a.data());
+}
+template<typename T, size_t M, bool MajorSym>
+FASTOR_INLINE typename MinorSymmetricTensor4<T,M,MajorSym>::voigt_type voigt(const MinorSymmetricTensor4<T,M,MajorSym> &c) {
+    return c.voigt();
+}
+//----------------------------------------------------------------------------------------------------------//
+
+
+template<typename T, size_t M, size_t N>
+inline std::ostream& operator<<(std::ostream &os, const SymmetricTensor<T,M,N> &a) {
+    return os << a.dense();
+}
+template<typename T, size_t M, bool MajorSym>
+inline std::ostream& operator<<(std::ostream &os, const MinorSymmetricTensor4<T,M,MajorSym> &c) {
+    return os << c.voigt();
+}
+
+} // end of namespace Fastor
+
+
+#endif // SYMMETRIC_TENSOR_H
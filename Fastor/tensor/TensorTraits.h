@@ -189,6 +189,11 @@ struct concat_tensor<Derived0<T,Rest0...>,Derived1<T,Rest1...>,Derived2<T,Rest2.
     using type = Tensor<T,Rest0...,Rest1...,Rest2...,Rest3...>;
 };
 
+template<class X, class Y, class Z, class W, class V, class ... U>
+struct concat_tensor<X,Y,Z,W,V,U...> {
+    using type = typename concat_tensor<typename concat_tensor<X,Y>::type,Z,W,V,U...>::type;
+};
+
 template <class X, class Y, class ... Z>
 using concatenated_tensor_t = typename concat_tensor<X,Y,Z...>::type;
 //--------------------------------------------------------------------------------------------------------------------//
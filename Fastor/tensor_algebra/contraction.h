@@ -4,6 +4,7 @@
 #include "Fastor/backend/dyadic.h"
 #include "Fastor/tensor/Tensor.h"
 #include "Fastor/tensor_algebra/indicial.h"
+#include "Fastor/tensor_algebra/nested_loop_contraction.h"
 
 
 namespace Fastor {
@@ -297,43 +298,13 @@ struct extractor_contract_2<Index<Idx0...>, Index<Idx1...>,
 
           static_assert(!_is_reduction,"THIS VARIANT OF EINSUM CANNOT DEAL WITH REDUCTION CASES");
 
-          constexpr int total = no_of_loops_to_set<Index<Idx0...>,Index<Idx1...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>,
-                  typename std_ext::make_index_sequence<no_of_unique<Idx0...,Idx1...>::value>::type>::value;
-
-          using index_generator = contract_meta_engine<Index<Idx0...>,Index<Idx1...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>,
-              typename std_ext::make_index_sequence<total>::type>;
-
-          using OutTensor = typename index_generator::OutTensor;
-
-          constexpr auto& index_a = index_generator::index_a;
-          constexpr auto& index_b = index_generator::index_b;
-          constexpr auto& index_out = index_generator::index_out;
-
-          OutTensor out;
+          // The fully unrolled index tables of contract_meta_engine grow with the total loop
+          // count, the nested loop generator resolves the same addresses from compile-time strides
+          using resulting_index  = typename _contraction_impl::indices;
+          resulting_tensor out;
           out.zeros();
-          const T *a_data = a.data();
-          const T *b_data = b.data();
-          T *out_data = out.data();
-
-#ifndef FASTOR_DONT_VECTORISE
-          using vectorisability = is_vectorisable<Index<Idx0...>,Index<Idx1...>,Tensor<T,Rest1...>>;
-          constexpr int stride = vectorisability::stride;
-          using V = typename vectorisability::type;
-#else
-          constexpr int stride = 1;
-          using V = SIMDVector<T,sizeof(T)*8>;
-#endif
-
-          V _vec_a;
-          for (int i = 0; i < total; i+=stride) {
-              // out_data[index_out[i]] += a_data[index_a[i]]*b_data[index_b[i]];
-              _vec_a.set(*(a_data+index_a[i]));
-              V _vec_out = _vec_a*V(b_data+index_b[i]) +  V(out_data+index_out[i]);
-              // _vec_out.store(out_data+index_out[i]);
-              _vec_out.aligned_store(out_data+index_out[i]);
-          }
-
-        return out;
+          nested_loop_contract<Index<Idx0...>,Index<Idx1...>,resulting_index>(a,b,out);
+          return out;
     }
 
 #elif CONTRACT_OPT==-2
@@ -688,26 +659,11 @@ struct extractor_contract_2<Index<Idx0...>, Index<Idx1...>,
           }
 #else
 
+              // Loops with compile-time strides [see nested_loop_contraction.h]
+              using resulting_index  = typename _contraction_impl::indices;
               resulting_tensor out;
               out.zeros();
-              const T *a_data = a.data();
-              const T *b_data = b.data();
-              T *out_data = out.data();
-
-              constexpr int out_dim =  no_of_unique<Idx0...,Idx1...>::value;
-
-              std::array<int,out_dim> as = {};
-              std::array<int,out_dim> idx = {};
-
-              using nloops = loop_setter<
-                        Index<Idx0...,Idx1...>,
-                        Tensor<T,Rest0...,Rest1...>,
-                        typename std_ext::make_index_sequence<out_dim>::type>;
-              using dims_type = typename nloops::dims_type;
-
-              RecursiveCartesianDispatcher<Index<Idx0...>,Index<Idx1...>,
-                Tensor<T,Rest0...>,Tensor<T,Rest1...>,dims_type>::Do(a_data,b_data,out_data,as,idx);
-
+              nested_loop_contract<Index<Idx0...>,Index<Idx1...>,resulting_index>(a,b,out);
               return out;
           }
 #endif
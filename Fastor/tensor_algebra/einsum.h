@@ -6,6 +6,7 @@
 #include "Fastor/meta/einsum_meta.h"
 #include "Fastor/tensor_algebra/indicial.h"
 #include "Fastor/backend/voigt.h"
+#include "Fastor/backend/matmul/matmul_epilogue.h"
 
 #include "Fastor/tensor_algebra/permutation.h"
 #include "Fastor/tensor_algebra/permute.h"
@@ -14,6 +15,7 @@
 #include "Fastor/tensor_algebra/contraction.h"
 #include "Fastor/tensor_algebra/contraction_single.h"
 #include "Fastor/tensor_algebra/strided_contraction.h"
+#include "Fastor/tensor_algebra/ttgt.h"
 
 namespace Fastor {
 
@@ -50,7 +52,8 @@ template<class Index_I, class Index_J,
          typename std::enable_if<!is_pair_reduction<Index_I,Index_J>::value &&
          !internal::is_generalised_matrix_vector<Index_I,Index_J>::value &&
          !internal::is_generalised_vector_matrix<Index_I,Index_J>::value &&
-         !internal::is_generalised_matrix_matrix<Index_I,Index_J>::value
+         !internal::is_generalised_matrix_matrix<Index_I,Index_J>::value &&
+         !internal::ttgt_planner<Index_I,Index_J,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::value
          ,bool>::type=0>
 FASTOR_INLINE
 auto einsum(const Tensor<T,Rest0...> &a, const Tensor<T,Rest1...> &b)
@@ -72,6 +75,115 @@ auto einsum(const Tensor<T,Rest0...> &a, const Tensor<T,Rest1...> &b)
     return extractor_contract_2<Index_I,Index_J>::contract_impl(a,b);
 }
 
+// All other by-pair contractions are permuted into a single GEMM [TTGT]
+template<class Index_I, class Index_J,
+         typename T, size_t ... Rest0, size_t ... Rest1,
+         typename std::enable_if<!is_pair_reduction<Index_I,Index_J>::value &&
+         !internal::is_generalised_matrix_vector<Index_I,Index_J>::value &&
+         !internal::is_generalised_vector_matrix<Index_I,Index_J>::value &&
+         !internal::is_generalised_matrix_matrix<Index_I,Index_J>::value &&
+         internal::ttgt_planner<Index_I,Index_J,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::value
+         ,bool>::type=0>
+FASTOR_INLINE
+auto einsum(const Tensor<T,Rest0...> &a, const Tensor<T,Rest1...> &b)
+-> decltype(extractor_contract_2<Index_I,Index_J>::contract_impl(a,b)) {
+
+    static_assert(einsum_index_checker<typename concat_<Index_I,Index_J>::type>::value,
+                  "INDICES FOR EINSUM FUNCTION CANNOT APPEAR MORE THAN TWICE. USE INNER INSTEAD");
+
+    using planner = internal::ttgt_planner<Index_I,Index_J,Tensor<T,Rest0...>,Tensor<T,Rest1...>>;
+    using OutTensor = decltype(extractor_contract_2<Index_I,Index_J>::contract_impl(a,b));
+    return internal::ttgt_contract<planner,OutTensor>(a,b);
+}
+
+// Batched contractions - indices shared by both operands that are kept in the output
+// index are batch indices and the contraction becomes a loop of GEMMs [see ttgt.h]
+template<class Index_I, class Index_J, class Index_O,
+         typename T, size_t ... Rest0, size_t ... Rest1,
+         typename std::enable_if<
+         internal::batched_contraction_planner<Index_I,Index_J,Index_O,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::value
+         ,bool>::type=0>
+FASTOR_INLINE
+typename internal::batched_contraction_planner<Index_I,Index_J,Index_O,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::out_tensor
+einsum(const Tensor<T,Rest0...> &a, const Tensor<T,Rest1...> &b) {
+    using planner = internal::batched_contraction_planner<Index_I,Index_J,Index_O,Tensor<T,Rest0...>,Tensor<T,Rest1...>>;
+    return internal::batched_contract<planner>(a,b);
+}
+
+// Outer products and by-pair contractions that are not GEMMs are evaluated by the nested loop
+// generator, which writes the output in any index order at the same cost. With an explicit
+// output index the result is written straight into that order instead of being permuted
+// afterwards. Contractions that go through TTGT are still permuted after the GEMM
+namespace internal {
+template<class Idx0, class Idx1, class IdxO, class Tens0, class Tens1>
+struct fused_permute_planner {
+    static constexpr bool value = false;
+};
+
+template<size_t ... Idx0, size_t ... Idx1, size_t ... IdxO, typename T, size_t ... Rest0, size_t ... Rest1>
+struct fused_permute_planner<Index<Idx0...>,Index<Idx1...>,OIndex<IdxO...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>> {
+    using resulting_index = typename get_resuling_index<Index<Idx0...>,Index<Idx1...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::type;
+    static constexpr size_t idx0[sizeof...(Idx0)+1] = {Idx0...,0};
+    static constexpr size_t idx1[sizeof...(Idx1)+1] = {Idx1...,0};
+    static constexpr size_t idxo[sizeof...(IdxO)+1] = {IdxO...,0};
+    static constexpr size_t dims0[sizeof...(Rest0)+1] = {Rest0...,0};
+    static constexpr size_t dims1[sizeof...(Rest1)+1] = {Rest1...,0};
+
+    static constexpr size_t free_in(size_t label, size_t cur=0) {
+        return cur == resulting_index::Size ? 0 : size_t(resulting_index::values[cur] == label) + free_in(label, cur+1);
+    }
+    static constexpr bool all_free(size_t cur=0) {
+        return cur == sizeof...(IdxO) ? true : (free_in(idxo[cur]) == 1 && all_free(cur+1));
+    }
+    static constexpr size_t dim(size_t label) {
+        return ttgt_find(idx0, label) < sizeof...(Idx0) ? dims0[ttgt_find(idx0, label)] : dims1[ttgt_find(idx1, label)];
+    }
+
+    // The output index has to be a reordering of the free indices
+    static constexpr bool value = sizeof...(IdxO) > 0 &&
+                                  sizeof...(IdxO) == resulting_index::Size &&
+                                  no_of_unique<IdxO...>::value == sizeof...(IdxO) &&
+                                  all_free() &&
+                                  !batched_contraction_planner<Index<Idx0...>,Index<Idx1...>,OIndex<IdxO...>,
+                                                               Tensor<T,Rest0...>,Tensor<T,Rest1...>>::value &&
+                                  !is_pair_reduction<Index<Idx0...>,Index<Idx1...>>::value &&
+                                  !is_generalised_matrix_vector<Index<Idx0...>,Index<Idx1...>>::value &&
+                                  !is_generalised_vector_matrix<Index<Idx0...>,Index<Idx1...>>::value &&
+                                  !is_generalised_matrix_matrix<Index<Idx0...>,Index<Idx1...>>::value &&
+                                  (!ttgt_planner<Index<Idx0...>,Index<Idx1...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::value ||
+                                    ttgt_planner<Index<Idx0...>,Index<Idx1...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::ncontracted == 0);
+
+    using out_tensor = Tensor<T,dim(IdxO)...>;
+};
+
+template<size_t ... Idx0, size_t ... Idx1, size_t ... IdxO, typename T, size_t ... Rest0, size_t ... Rest1>
+constexpr size_t fused_permute_planner<Index<Idx0...>,Index<Idx1...>,OIndex<IdxO...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::idx0[sizeof...(Idx0)+1];
+template<size_t ... Idx0, size_t ... Idx1, size_t ... IdxO, typename T, size_t ... Rest0, size_t ... Rest1>
+constexpr size_t fused_permute_planner<Index<Idx0...>,Index<Idx1...>,OIndex<IdxO...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::idx1[sizeof...(Idx1)+1];
+template<size_t ... Idx0, size_t ... Idx1, size_t ... IdxO, typename T, size_t ... Rest0, size_t ... Rest1>
+constexpr size_t fused_permute_planner<Index<Idx0...>,Index<Idx1...>,OIndex<IdxO...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::idxo[sizeof...(IdxO)+1];
+template<size_t ... Idx0, size_t ... Idx1, size_t ... IdxO, typename T, size_t ... Rest0, size_t ... Rest1>
+constexpr size_t fused_permute_planner<Index<Idx0...>,Index<Idx1...>,OIndex<IdxO...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::dims0[sizeof...(Rest0)+1];
+template<size_t ... Idx0, size_t ... Idx1, size_t ... IdxO, typename T, size_t ... Rest0, size_t ... Rest1>
+constexpr size_t fused_permute_planner<Index<Idx0...>,Index<Idx1...>,OIndex<IdxO...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::dims1[sizeof...(Rest1)+1];
+} // internal
+
+template<class Index_I, class Index_J, class Index_O,
+         typename T, size_t ... Rest0, size_t ... Rest1,
+         typename std::enable_if<
+         internal::fused_permute_planner<Index_I,Index_J,Index_O,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::value
+         ,bool>::type=0>
+FASTOR_INLINE
+typename internal::fused_permute_planner<Index_I,Index_J,Index_O,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::out_tensor
+einsum(const Tensor<T,Rest0...> &a, const Tensor<T,Rest1...> &b) {
+    static_assert(einsum_index_checker<typename concat_<Index_I,Index_J>::type>::value,
+                  "INDICES FOR EINSUM FUNCTION CANNOT APPEAR MORE THAN TWICE. USE INNER INSTEAD");
+    using planner = internal::fused_permute_planner<Index_I,Index_J,Index_O,Tensor<T,Rest0...>,Tensor<T,Rest1...>>;
+    typename planner::out_tensor out;
+    out.zeros();
+    nested_loop_contract<Index_I,Index_J,typename Index_O::parent_type>(a,b,out);
+    return out;
+}
 
 template<class Index_I, class Index_J,
          typename T, size_t ...Rest0, size_t ...Rest1,
@@ -142,6 +254,83 @@ einsum(const Tensor<T,Rest0...> &a, const Tensor<T,Rest1...> &b) //{
 //-----------------------------------------------------------------------------------------------------------------------//
 
 
+// By-pair contractions with an epilogue [see matmul_epilogue.h] applied to the result, out =
+// ep(einsum<Index_I,Index_J>(a,b)). Contractions that map to a single GEMM apply the epilogue
+// in registers before the result is stored, all others in one pass over the result. out
+// should not alias a or b
+//-----------------------------------------------------------------------------------------------------------------------//
+namespace internal {
+
+template<class Index_I, class Index_J,
+        typename T, size_t ...Rest0, size_t ...Rest1, typename Epilogue,
+        enable_if_t_<is_generalised_matrix_vector<Index_I,Index_J>::value,bool> = false>
+FASTOR_INLINE void einsum_epilogue_dispatcher(const Tensor<T,Rest0...> &a, const Tensor<T,Rest1...> &b, T *out, const Epilogue &ep) {
+    constexpr size_t which_one_is_vector = is_generalised_matrix_vector<Index_I,Index_J>::which_one_is_vector;
+    constexpr size_t matches_up_to = is_generalised_matrix_vector<Index_I,Index_J>::matches_up_to;
+    constexpr size_t rest0[sizeof...(Rest0)] = {Rest0...};
+    constexpr size_t rest1[sizeof...(Rest1)] = {Rest1...};
+    constexpr size_t product = which_one_is_vector == 1 ? partial_prod(rest0, matches_up_to) :  partial_prod(rest1, matches_up_to);
+    constexpr size_t vec_product = which_one_is_vector == 1 ? pack_prod<Rest1...>::value : pack_prod<Rest0...>::value;
+    which_one_is_vector == 1 ? _matmul_epilogue<T,product,vec_product,1>(a.data(),b.data(),out,ep) :
+      _matmul_epilogue<T,product,vec_product,1>(b.data(),a.data(),out,ep);
+}
+
+template<class Index_I, class Index_J,
+        typename T, size_t ...Rest0, size_t ...Rest1, typename Epilogue,
+        enable_if_t_<is_generalised_vector_matrix<Index_I,Index_J>::value,bool> = false>
+FASTOR_INLINE void einsum_epilogue_dispatcher(const Tensor<T,Rest0...> &a, const Tensor<T,Rest1...> &b, T *out, const Epilogue &ep) {
+    constexpr size_t which_one_is_vector = is_generalised_vector_matrix<Index_I,Index_J>::which_one_is_vector;
+    constexpr size_t matches_up_to = is_generalised_vector_matrix<Index_I,Index_J>::matches_up_to;
+    constexpr size_t rest0[sizeof...(Rest0)] = {Rest0...};
+    constexpr size_t rest1[sizeof...(Rest1)] = {Rest1...};
+    constexpr size_t product = which_one_is_vector == 1 ? partial_prod_reverse(rest0, matches_up_to) :  partial_prod_reverse(rest1, matches_up_to);
+    constexpr size_t vec_product = which_one_is_vector == 1 ? pack_prod<Rest1...>::value : pack_prod<Rest0...>::value;
+    which_one_is_vector == 1 ? _matmul_epilogue<T,1,vec_product,product>(b.data(),a.data(),out,ep) :
+      _matmul_epilogue<T,1,vec_product,product>(a.data(),b.data(),out,ep);
+}
+
+template<class Index_I, class Index_J,
+        typename T, size_t ...Rest0, size_t ...Rest1, typename Epilogue,
+        enable_if_t_<is_generalised_matrix_matrix<Index_I,Index_J>::value,bool> = false>
+FASTOR_INLINE void einsum_epilogue_dispatcher(const Tensor<T,Rest0...> &a, const Tensor<T,Rest1...> &b, T *out, const Epilogue &ep) {
+    constexpr size_t matches_up_to = is_generalised_matrix_matrix<Index_I,Index_J>::ncontracted;
+    constexpr size_t rest0[sizeof...(Rest0)] = {Rest0...};
+    constexpr size_t rest1[sizeof...(Rest1)] = {Rest1...};
+    constexpr size_t K_product = partial_prod(rest1, matches_up_to - 1);
+    constexpr size_t M = partial_prod(rest0, sizeof...(Rest0) - matches_up_to - 1);
+    constexpr size_t N = partial_prod(rest1, sizeof...(Rest1) - 1, matches_up_to);
+    _matmul_epilogue<T,M,K_product,N>(a.data(),b.data(),out,ep);
+}
+
+template<class Index_I, class Index_J,
+        typename T, size_t ...Rest0, size_t ...Rest1, typename Epilogue,
+        enable_if_t_<!is_generalised_matrix_vector<Index_I,Index_J>::value &&
+                     !is_generalised_vector_matrix<Index_I,Index_J>::value &&
+                     !is_generalised_matrix_matrix<Index_I,Index_J>::value,bool> = false>
+FASTOR_INLINE void einsum_epilogue_dispatcher(const Tensor<T,Rest0...> &a, const Tensor<T,Rest1...> &b, T *out, const Epilogue &ep) {
+    using OutTensor = decltype(einsum<Index_I,Index_J>(a,b));
+    const OutTensor tmp = einsum<Index_I,Index_J>(a,b);
+    _apply_epilogue<T,OutTensor::size()>(tmp.data(),out,ep);
+}
+
+} // internal
+
+// fun is an element-wise function, for instance an activation, called on SIMDVector and
+// scalar arguments
+template<class Index_I, class Index_J,
+        typename T, size_t ...Rest0, size_t ...Rest1, typename Fun,
+        enable_if_t_<!is_tensor_v<Fun>,bool> = false>
+FASTOR_INLINE
+auto
+einsum(const Tensor<T,Rest0...> &a, const Tensor<T,Rest1...> &b, const Fun &fun)
+-> decltype(einsum<Index_I,Index_J>(a,b)) {
+    decltype(einsum<Index_I,Index_J>(a,b)) out;
+    internal::einsum_epilogue_dispatcher<Index_I,Index_J>(a,b,out.data(),internal::matmul_epilogue_unary<Fun>{fun,{}});
+    return out;
+}
+//-----------------------------------------------------------------------------------------------------------------------//
+
+
 // matmul dispatcher for 2nd order tensors (matrix-matrix)
 // also includes matrix-vector and vector-matrix when vector is of size
 // nx1 or 1xn
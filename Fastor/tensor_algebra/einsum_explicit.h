@@ -38,7 +38,11 @@ einsum(const Tensor<T,Rest0...> &a) {
 // Two tensor (by-pair)
 //-----------------------------------------------------------------------------------------------------------------------//
 template<class Index_I, class Index_J, class Index_O,
-         typename T, size_t ... Rest0, size_t ... Rest1>
+         typename T, size_t ... Rest0, size_t ... Rest1,
+         typename std::enable_if<
+         !internal::batched_contraction_planner<Index_I,Index_J,Index_O,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::value &&
+         !internal::fused_permute_planner<Index_I,Index_J,Index_O,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::value
+         ,bool>::type=0>
 FASTOR_INLINE
 typename permute_helper<internal::permute_mapped_index_t<
     typename einsum_helper<Index_I,Index_J,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::resulting_index, typename Index_O::parent_type>,
@@ -0,0 +1,226 @@
+#ifndef NESTED_LOOP_CONTRACTION_H
+#define NESTED_LOOP_CONTRACTION_H
+
+#include "Fastor/tensor/Tensor.h"
+#include "Fastor/meta/einsum_meta.h"
+
+namespace Fastor {
+
+// Nested loop code generator for by-pair contractions. Every unique index becomes one
+// loop and the stride of that loop in a, b and the output is resolved at compile time,
+// so addresses are carried as induction variables and no index tables are generated.
+// The innermost loop is chosen so that it runs over contiguous memory where possible:
+//
+//  mode 1 - contiguous in b and the output, a is broadcast [out_i += a * b_i]
+//  mode 2 - contiguous in a and the output, b is broadcast [out_i += a_i * b]
+//  mode 3 - contiguous in a and b and summed [out += sum_i a_i * b_i]
+//  mode 0 - anything else, scalar
+//
+// The vectorised modes handle the remainder of the innermost loop with a scalar tail
+// so the fastest changing dimension does not need to be a multiple of the SIMD width
+//----------------------------------------------------------------------------------------------------------------//
+namespace internal {
+
+//! Product of dims[from..n)
+template<size_t N>
+constexpr size_t nl_product(const size_t (&dims)[N], size_t n, size_t from) {
+    return from >= n ? 1 : dims[from]*nl_product(dims, n, from+1);
+}
+
+//! Stride of loop index u in a row-major tensor with indices idx and dimensions dims.
+//! An index repeated in the same tensor [a trace] accumulates the strides of all its positions
+template<size_t N>
+constexpr size_t nl_stride(const size_t (&idx)[N], const size_t (&dims)[N], size_t n, size_t u, size_t cur=0) {
+    return cur >= n ? 0 : (idx[cur] == u ? nl_product(dims, n, cur+1) : 0) + nl_stride(idx, dims, n, u, cur+1);
+}
+
+//! Position of the first loop whose strides in a, b and the output are sa, sb and so [n if none]
+template<size_t N>
+constexpr size_t nl_find_loop(const size_t (&sa)[N], const size_t (&sb)[N], const size_t (&so)[N],
+    size_t a, size_t b, size_t o, size_t n, size_t cur=0) {
+    return cur >= n ? n : (sa[cur] == a && sb[cur] == b && so[cur] == o ? cur : nl_find_loop(sa, sb, so, a, b, o, n, cur+1));
+}
+
+//! Position of the first loop whose stride in the output is o [n if none]
+template<size_t N>
+constexpr size_t nl_find_loop(const size_t (&so)[N], size_t o, size_t n, size_t cur=0) {
+    return cur >= n ? n : (so[cur] == o ? cur : nl_find_loop(so, o, n, cur+1));
+}
+
+
+template<class Idx0, class Idx1, class IdxOut, class Tens0, class Tens1, class TensOut>
+struct nested_loop_contraction;
+
+template<size_t ... Idx0, size_t ... Idx1, size_t ... IdxO, typename T, size_t ... Rest0, size_t ... Rest1, size_t ... RestO>
+struct nested_loop_contraction<Index<Idx0...>,Index<Idx1...>,Index<IdxO...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,RestO...>> {
+
+    using _loop_setter = loop_setter<Index<Idx0...,Idx1...>,Tensor<T,Rest0...,Rest1...>,
+            typename std_ext::make_index_sequence<no_of_unique<Idx0...,Idx1...>::value>::type>;
+    using loop_indices = typename _loop_setter::indices;
+    using loop_dims    = typename _loop_setter::dims_type;
+    static constexpr size_t nloops = loop_indices::Size;
+
+    // The output can be a scalar, arrays are padded so that they are never empty
+    static constexpr size_t idx0[sizeof...(Idx0)+1] = {Idx0...,0};
+    static constexpr size_t idx1[sizeof...(Idx1)+1] = {Idx1...,0};
+    static constexpr size_t idxo[sizeof...(IdxO)+1] = {IdxO...,0};
+    static constexpr size_t dims0[sizeof...(Rest0)+1] = {Rest0...,0};
+    static constexpr size_t dims1[sizeof...(Rest1)+1] = {Rest1...,0};
+    static constexpr size_t dimso[sizeof...(RestO)+1] = {RestO...,0};
+
+    template<class Seq> struct strides_helper;
+    template<size_t ... ss> struct strides_helper<std_ext::index_sequence<ss...>> {
+        static constexpr size_t a[nloops]   = {nl_stride(idx0, dims0, sizeof...(Idx0), loop_indices::values[ss])...};
+        static constexpr size_t b[nloops]   = {nl_stride(idx1, dims1, sizeof...(Idx1), loop_indices::values[ss])...};
+        static constexpr size_t out[nloops] = {nl_stride(idxo, dimso, sizeof...(IdxO), loop_indices::values[ss])...};
+    };
+    using _strides = strides_helper<typename std_ext::make_index_sequence<nloops>::type>;
+
+    static constexpr size_t vec_b_loop = nl_find_loop(_strides::a, _strides::b, _strides::out, 0, 1, 1, nloops);
+    static constexpr size_t vec_a_loop = nl_find_loop(_strides::a, _strides::b, _strides::out, 1, 0, 1, nloops);
+    static constexpr size_t dot_loop   = nl_find_loop(_strides::a, _strides::b, _strides::out, 1, 1, 0, nloops);
+    static constexpr size_t out_loop   = nl_find_loop(_strides::out, 1, nloops);
+
+    static constexpr int mode  = vec_b_loop != nloops ? 1 : (vec_a_loop != nloops ? 2 : (dot_loop != nloops ? 3 : 0));
+    static constexpr size_t inner = mode == 1 ? vec_b_loop : (mode == 2 ? vec_a_loop : (mode == 3 ? dot_loop :
+                                    (out_loop != nloops ? out_loop : nloops-1)));
+
+    //! The loop run at a given nesting level - the remaining loops keep their order
+    static constexpr size_t loop_at(size_t level) {
+        return level == nloops-1 ? inner : (level < inner ? level : level+1);
+    }
+    static constexpr size_t dim(size_t level)      { return loop_dims::values[loop_at(level)]; }
+    static constexpr size_t stride_a(size_t level) { return _strides::a[loop_at(level)]; }
+    static constexpr size_t stride_b(size_t level) { return _strides::b[loop_at(level)]; }
+    static constexpr size_t stride_o(size_t level) { return _strides::out[loop_at(level)]; }
+};
+
+template<size_t ... Idx0, size_t ... Idx1, size_t ... IdxO, typename T, size_t ... Rest0, size_t ... Rest1, size_t ... RestO>
+template<size_t ... ss>
+constexpr size_t nested_loop_contraction<Index<Idx0...>,Index<Idx1...>,Index<IdxO...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,RestO...>>::
+strides_helper<std_ext::index_sequence<ss...>>::a[nloops];
+template<size_t ... Idx0, size_t ... Idx1, size_t ... IdxO, typename T, size_t ... Rest0, size_t ... Rest1, size_t ... RestO>
+template<size_t ... ss>
+constexpr size_t nested_loop_contraction<Index<Idx0...>,Index<Idx1...>,Index<IdxO...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,RestO...>>::
+strides_helper<std_ext::index_sequence<ss...>>::b[nloops];
+template<size_t ... Idx0, size_t ... Idx1, size_t ... IdxO, typename T, size_t ... Rest0, size_t ... Rest1, size_t ... RestO>
+template<size_t ... ss>
+constexpr size_t nested_loop_contraction<Index<Idx0...>,Index<Idx1...>,Index<IdxO...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,RestO...>>::
+strides_helper<std_ext::index_sequence<ss...>>::out[nloops];
+template<size_t ... Idx0, size_t ... Idx1, size_t ... IdxO, typename T, size_t ... Rest0, size_t ... Rest1, size_t ... RestO>
+constexpr size_t nested_loop_contraction<Index<Idx0...>,Index<Idx1...>,Index<IdxO...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,RestO...>>::idx0[sizeof...(Idx0)+1];
+template<size_t ... Idx0, size_t ... Idx1, size_t ... IdxO, typename T, size_t ... Rest0, size_t ... Rest1, size_t ... RestO>
+constexpr size_t nested_loop_contraction<Index<Idx0...>,Index<Idx1...>,Index<IdxO...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,RestO...>>::idx1[sizeof...(Idx1)+1];
+template<size_t ... Idx0, size_t ... Idx1, size_t ... IdxO, typename T, size_t ... Rest0, size_t ... Rest1, size_t ... RestO>
+constexpr size_t nested_loop_contraction<Index<Idx0...>,Index<Idx1...>,Index<IdxO...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,RestO...>>::idxo[sizeof...(IdxO)+1];
+template<size_t ... Idx0, size_t ... Idx1, size_t ... IdxO, typename T, size_t ... Rest0, size_t ... Rest1, size_t ... RestO>
+constexpr size_t nested_loop_contraction<Index<Idx0...>,Index<Idx1...>,Index<IdxO...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,RestO...>>::dims0[sizeof...(Rest0)+1];
+template<size_t ... Idx0, size_t ... Idx1, size_t ... IdxO, typename T, size_t ... Rest0, size_t ... Rest1, size_t ... RestO>
+constexpr size_t nested_loop_contraction<Index<Idx0...>,Index<Idx1...>,Index<IdxO...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,RestO...>>::dims1[sizeof...(Rest1)+1];
+template<size_t ... Idx0, size_t ... Idx1, size_t ... IdxO, typename T, size_t ... Rest0, size_t ... Rest1, size_t ... RestO>
+constexpr size_t nested_loop_contraction<Index<Idx0...>,Index<Idx1...>,Index<IdxO...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,RestO...>>::dimso[sizeof...(RestO)+1];
+
+
+// Innermost loop kernels
+template<typename T, int Mode, size_t Dim, size_t SA, size_t SB, size_t SO>
+struct nested_loop_kernel {
+    static FASTOR_INLINE void Do(const T *FASTOR_RESTRICT a, const T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT out) {
+        for (size_t i=0; i<Dim; ++i) {
+            out[i*SO] += a[i*SA]*b[i*SB];
+        }
+    }
+};
+
+template<typename T, size_t Dim>
+struct nested_loop_kernel<T,1,Dim,0,1,1> {
+    static FASTOR_INLINE void Do(const T *FASTOR_RESTRICT a, const T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT out) {
+        using V = SIMDVector<T,DEFAULT_ABI>;
+        constexpr size_t ROUND = ROUND_DOWN(Dim,V::Size);
+        const V _vec_a(a[0]);
+        size_t i=0;
+        for (; i<ROUND; i+=V::Size) {
+            fmadd(_vec_a,V(&b[i],false),V(&out[i],false)).store(&out[i],false);
+        }
+        for (; i<Dim; ++i) {
+            out[i] += a[0]*b[i];
+        }
+    }
+};
+
+template<typename T, size_t Dim>
+struct nested_loop_kernel<T,2,Dim,1,0,1> {
+    static FASTOR_INLINE void Do(const T *FASTOR_RESTRICT a, const T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT out) {
+        using V = SIMDVector<T,DEFAULT_ABI>;
+        constexpr size_t ROUND = ROUND_DOWN(Dim,V::Size);
+        const V _vec_b(b[0]);
+        size_t i=0;
+        for (; i<ROUND; i+=V::Size) {
+            fmadd(V(&a[i],false),_vec_b,V(&out[i],false)).store(&out[i],false);
+        }
+        for (; i<Dim; ++i) {
+            out[i] += a[i]*b[0];
+        }
+    }
+};
+
+template<typename T, size_t Dim>
+struct nested_loop_kernel<T,3,Dim,1,1,0> {
+    static FASTOR_INLINE void Do(const T *FASTOR_RESTRICT a, const T *FASTOR_RESTRICT b, T *FASTOR_RESTRICT out) {
+        using V = SIMDVector<T,DEFAULT_ABI>;
+        constexpr size_t ROUND = ROUND_DOWN(Dim,V::Size);
+        V _vec_out(T(0));
+        size_t i=0;
+        for (; i<ROUND; i+=V::Size) {
+            _vec_out = fmadd(V(&a[i],false),V(&b[i],false),_vec_out);
+        }
+        T sum = _vec_out.sum();
+        for (; i<Dim; ++i) {
+            sum += a[i]*b[i];
+        }
+        out[0] += sum;
+    }
+};
+
+
+// Recursive loop nest, the innermost level hands over to the kernel
+template<class Engine, typename T, size_t Level, bool IsInner = (Level+1 == Engine::nloops)>
+struct nested_loop;
+
+template<class Engine, typename T, size_t Level>
+struct nested_loop<Engine,T,Level,false> {
+    static FASTOR_INLINE void Do(const T *a, const T *b, T *out) {
+        constexpr size_t Dim = Engine::dim(Level);
+        constexpr size_t SA  = Engine::stride_a(Level);
+        constexpr size_t SB  = Engine::stride_b(Level);
+        constexpr size_t SO  = Engine::stride_o(Level);
+        for (size_t i=0; i<Dim; ++i) {
+            nested_loop<Engine,T,Level+1>::Do(a,b,out);
+            a += SA; b += SB; out += SO;
+        }
+    }
+};
+
+template<class Engine, typename T, size_t Level>
+struct nested_loop<Engine,T,Level,true> {
+    static FASTOR_INLINE void Do(const T *a, const T *b, T *out) {
+        nested_loop_kernel<T,Engine::mode,Engine::dim(Level),
+            Engine::stride_a(Level),Engine::stride_b(Level),Engine::stride_o(Level)>::Do(a,b,out);
+    }
+};
+
+} // internal
+
+
+/* Contract a and b into out [which must be zeroed] with the nested loop generator.
+   IdxOut and out are the resulting index and tensor of the contraction
+*/
+template<class Idx0, class Idx1, class IdxOut, typename T, size_t ... Rest0, size_t ... Rest1, size_t ... RestO>
+FASTOR_INLINE void nested_loop_contract(const Tensor<T,Rest0...> &a, const Tensor<T,Rest1...> &b, Tensor<T,RestO...> &out) {
+    using engine = internal::nested_loop_contraction<Idx0,Idx1,IdxOut,Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,RestO...>>;
+    internal::nested_loop<engine,T,0>::Do(a.data(),b.data(),out.data());
+}
+//----------------------------------------------------------------------------------------------------------------//
+
+} // end of namespace Fastor
+
+#endif // NESTED_LOOP_CONTRACTION_H
@@ -5,10 +5,134 @@
 
 #include "Fastor/tensor_algebra/einsum.h"
 #include "Fastor/meta/opmin_meta.h"
+#include "Fastor/meta/opmin_path_meta.h"
+#include <tuple>
 
 namespace Fastor {
 
 
+// Networks are contracted along the order of opmin_network_path. Every subset of operands in
+// the order is a node of a binary tree whose value is the by-pair einsum of its children.
+// The indices of the result follow the order of the tree and are permuted at the end to the
+// order of the left to right contraction, the order in which they appear in the operands
+//---------------------------------------------------------------------------------------------------------------------//
+template<class Path, class Indices, class Tensors, size_t Mask, bool IsLeaf = ((Mask & (Mask-1)) == 0)>
+struct network_tree;
+
+template<class Path, class Indices, class Tensors, size_t Mask>
+struct network_tree<Path,Indices,Tensors,Mask,true> {
+    static constexpr size_t operand = internal::opmin_lowest_operand(Mask);
+    using index_type  = typename std::tuple_element<operand,Indices>::type;
+    using tensor_type = typename std::tuple_element<operand,Tensors>::type;
+    using order = internal::opmin_operand<operand>;
+
+    template<class Operands>
+    static FASTOR_INLINE const tensor_type& eval(const Operands &ops) {
+        return std::get<operand>(ops);
+    }
+};
+
+template<class Path, class Indices, class Tensors, size_t Mask>
+struct network_tree<Path,Indices,Tensors,Mask,false> {
+    using left  = network_tree<Path,Indices,Tensors,Path::split(Mask)>;
+    using right = network_tree<Path,Indices,Tensors,Mask ^ Path::split(Mask)>;
+    using index_type  = typename get_resuling_index<typename left::index_type,typename right::index_type,
+                                    typename left::tensor_type,typename right::tensor_type>::type;
+    using tensor_type = typename get_resuling_tensor<typename left::index_type,typename right::index_type,
+                                    typename left::tensor_type,typename right::tensor_type>::type;
+    using order = internal::opmin_pair<typename left::order,typename right::order>;
+
+    template<class Operands>
+    static FASTOR_INLINE tensor_type eval(const Operands &ops) {
+        return einsum<typename left::index_type,typename right::index_type>(left::eval(ops),right::eval(ops));
+    }
+};
+
+
+template<class Result, class Expected, class Seq = typename std_ext::make_index_sequence<Result::Size>::type>
+struct network_result_permutation;
+
+template<size_t ... Res, size_t ... Exp, size_t ... ss>
+struct network_result_permutation<Index<Res...>,Index<Exp...>,std_ext::index_sequence<ss...>> {
+    static constexpr bool value = !std::is_same<Index<Res...>,Index<Exp...>>::value;
+    using type = Index<static_cast<size_t>(find_index(Index<Res...>::values, Exp))...>;
+};
+
+template<class Permutation, typename T, size_t ... Rest, enable_if_t_<!Permutation::value, bool> = false>
+FASTOR_INLINE Tensor<T,Rest...> network_permute_result(const Tensor<T,Rest...> &a) {
+    return a;
+}
+template<class Permutation, typename T, size_t ... Rest, enable_if_t_<Permutation::value, bool> = false>
+FASTOR_INLINE auto network_permute_result(const Tensor<T,Rest...> &a)
+-> decltype(permute<typename Permutation::type>(a)) {
+    return permute<typename Permutation::type>(a);
+}
+
+
+template<typename T, class Dims>
+struct network_concat_tensor;
+template<typename T, size_t ... Dims>
+struct network_concat_tensor<T,Index<Dims...>> {
+    using type = Tensor<T,Dims...>;
+};
+
+template<class Indices, class Tensors>
+struct network_path_contraction;
+
+template<class ... Indices, class ... Tensors>
+struct network_path_contraction<std::tuple<Indices...>,std::tuple<Tensors...>> {
+    using scalar_type = typename std::tuple_element<0,std::tuple<Tensors...>>::type::scalar_type;
+    using all_indices = typename concat_<Indices...>::type;
+    using all_dims    = typename concat_<typename put_dims_in_Index<Tensors>::type...>::type;
+
+    using path = internal::opmin_network_path<Index<Indices::Size...>, all_indices, all_dims,
+                                              FASTOR_OPMIN_MAX_INTERMEDIATE / sizeof(scalar_type)>;
+    using tree = network_tree<path,std::tuple<Indices...>,std::tuple<Tensors...>,path::root>;
+
+    using expected_index = typename contraction_impl<all_indices,
+        typename network_concat_tensor<scalar_type,all_dims>::type,
+        typename std_ext::make_index_sequence<all_indices::Size>::type>::indices;
+    using permutation = network_result_permutation<typename tree::index_type,expected_index>;
+
+    static constexpr size_t flops = static_cast<size_t>(path::plan.flops[path::root]);
+    static constexpr size_t peak_bytes = static_cast<size_t>(path::plan.peak[path::root])*sizeof(scalar_type);
+
+    static FASTOR_INLINE auto contract(const Tensors & ... ops)
+    -> decltype(network_permute_result<permutation>(tree::eval(std::tie(ops...)))) {
+#ifdef FASTOR_OPMIN_REPORT
+        internal::opmin_report<typename tree::order,flops,peak_bytes>();
+#endif
+        return network_permute_result<permutation>(tree::eval(std::tie(ops...)));
+    }
+
+    // out = ep(contract(ops...)) [see matmul_epilogue.h]. The epilogue is applied by the last
+    // by-pair contraction unless its result still has to be permuted
+    template<class Epilogue, bool Permute = permutation::value, enable_if_t_<!Permute,bool> = false>
+    static FASTOR_INLINE void contract_epilogue(scalar_type *out, const Epilogue &ep, const Tensors & ... ops) {
+#ifdef FASTOR_OPMIN_REPORT
+        internal::opmin_report<typename tree::order,flops,peak_bytes>();
+#endif
+        using left  = typename tree::left;
+        using right = typename tree::right;
+        internal::einsum_epilogue_dispatcher<typename left::index_type,typename right::index_type>(
+            left::eval(std::tie(ops...)),right::eval(std::tie(ops...)),out,ep);
+    }
+    template<class Epilogue, bool Permute = permutation::value, enable_if_t_<Permute,bool> = false>
+    static FASTOR_INLINE void contract_epilogue(scalar_type *out, const Epilogue &ep, const Tensors & ... ops) {
+        using result_type = decltype(contract(ops...));
+        const result_type res = contract(ops...);
+        internal::_apply_epilogue<scalar_type,result_type::size()>(res.data(),out,ep);
+    }
+};
+
+template<class ... Indices, class ... Tensors>
+constexpr size_t network_path_contraction<std::tuple<Indices...>,std::tuple<Tensors...>>::flops;
+template<class ... Indices, class ... Tensors>
+constexpr size_t network_path_contraction<std::tuple<Indices...>,std::tuple<Tensors...>>::peak_bytes;
+//---------------------------------------------------------------------------------------------------------------------//
+
+
+
 // Three tensor network
 //---------------------------------------------------------------------------------------------------------------------//
 template<class T, class U, class V>
@@ -24,32 +148,15 @@ struct extractor_contract_3<Index<Idx0...>, Index<Idx1...>, Index<Idx2...> > {
     FASTOR_INLINE
     contract_impl(const Tensor<T,Rest0...> &a, const Tensor<T,Rest1...> &b, const Tensor<T,Rest2...> &c) {
 
-        using cost_model = triplet_flop_cost<Index<Idx0...>,Index<Idx1...>,Index<Idx2...>,
-            Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,Rest2...>>;
-
-        using resulting_index_0 = typename cost_model::resulting_index_0;
-        using resulting_index_1 = typename cost_model::resulting_index_1;
-        using resulting_index_2 = typename cost_model::resulting_index_2;
-
 #ifndef FASTOR_KEEP_DP_FIXED
 
-        constexpr int which_variant = cost_model::which_variant;
-
-        FASTOR_IF_CONSTEXPR (which_variant == 0) {
-            auto tmp = einsum<Index<Idx0...>,Index<Idx1...>>(a,b);
-            return einsum<resulting_index_0,Index<Idx2...>>(tmp,c);
-        }
-        else FASTOR_IF_CONSTEXPR (which_variant == 1) {
-            auto tmp = einsum<Index<Idx0...>,Index<Idx2...>>(a,c);
-            return einsum<Index<Idx1...>,resulting_index_1>(b,tmp);
-        }
-        else {
-            auto tmp = einsum<Index<Idx1...>,Index<Idx2...>>(b,c);
-            return einsum<Index<Idx0...>,resulting_index_2>(a,tmp);
-        }
+        return network_path_contraction<std::tuple<Index<Idx0...>,Index<Idx1...>,Index<Idx2...>>,
+            std::tuple<Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,Rest2...>>>::contract(a,b,c);
 
 #else
         // for benchmarks
+        using resulting_index_2 = typename get_resuling_index<Index<Idx1...>,Index<Idx2...>,
+                                        Tensor<T,Rest1...>,Tensor<T,Rest2...>>::type;
         auto tmp = einsum<Index<Idx1...>,Index<Idx2...>>(b,c);
         return einsum<Index<Idx0...>,resulting_index_2>(a,tmp);
 #endif
@@ -89,32 +196,8 @@ struct extractor_contract_4<Index<Idx0...>, Index<Idx1...>, Index<Idx2...>, Inde
 
 #ifndef FASTOR_KEEP_DP_FIXED
 
-        using cost_model = quartet_flop_cost<Index<Idx0...>,Index<Idx1...>,Index<Idx2...>,Index<Idx3...>,
-            Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,Rest2...>,Tensor<T,Rest3...>>;
-
-        using resulting_index_0 = typename cost_model::resulting_index_0;
-        using resulting_index_1 = typename cost_model::resulting_index_1;
-        using resulting_index_2 = typename cost_model::resulting_index_2;
-        using resulting_index_3 = typename cost_model::resulting_index_3;
-
-        constexpr int which_variant = cost_model::which_variant;
-
-        FASTOR_IF_CONSTEXPR (which_variant==0) {
-            auto tmp = einsum<Index<Idx0...>,Index<Idx1...>,Index<Idx2...>>(a,b,c);
-            return einsum<resulting_index_0,Index<Idx3...>>(tmp,d);
-        }
-        else FASTOR_IF_CONSTEXPR (which_variant==1) {
-            auto tmp = einsum<Index<Idx0...>,Index<Idx1...>,Index<Idx3...>>(a,b,d);
-            return einsum<Index<Idx2...>,resulting_index_1>(c,tmp);
-        }
-        else FASTOR_IF_CONSTEXPR (which_variant==2) {
-            auto tmp = einsum<Index<Idx0...>,Index<Idx2...>,Index<Idx3...>>(a,c,d);
-            return einsum<Index<Idx1...>,resulting_index_2>(b,tmp);
-        }
-        else {
-            auto tmp = einsum<Index<Idx1...>,Index<Idx2...>,Index<Idx3...>>(b,c,d);
-            return einsum<Index<Idx0...>,resulting_index_3>(a,tmp);
-        }
+        return network_path_contraction<std::tuple<Index<Idx0...>,Index<Idx1...>,Index<Idx2...>,Index<Idx3...>>,
+            std::tuple<Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,Rest2...>,Tensor<T,Rest3...>>>::contract(a,b,c,d);
 
 #else
         // for benchmarks
@@ -167,38 +250,9 @@ struct extractor_contract_5<Index<Idx0...>, Index<Idx1...>, Index<Idx2...>, Inde
                   const Tensor<T,Rest2...> &c, const Tensor<T,Rest3...> &d,
                   const Tensor<T,Rest4...> &e) {
 
-        using cost_model = quintet_flop_cost<
-            Index<Idx0...>,Index<Idx1...>,Index<Idx2...>,Index<Idx3...>,Index<Idx4...>,
-            Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,Rest2...>,Tensor<T,Rest3...>,Tensor<T,Rest4...>>;
-
-        using resulting_index_0 = typename cost_model::resulting_index_0;
-        using resulting_index_1 = typename cost_model::resulting_index_1;
-        using resulting_index_2 = typename cost_model::resulting_index_2;
-        using resulting_index_3 = typename cost_model::resulting_index_3;
-        using resulting_index_4 = typename cost_model::resulting_index_4;
-
-        constexpr int which_variant = cost_model::which_variant;
-
-        FASTOR_IF_CONSTEXPR (which_variant==0) {
-            auto tmp = einsum<Index<Idx0...>,Index<Idx1...>,Index<Idx2...>,Index<Idx3...>>(a,b,c,d);
-            return einsum<resulting_index_0,Index<Idx4...>>(tmp,e);
-        }
-        else FASTOR_IF_CONSTEXPR (which_variant==1) {
-            auto tmp = einsum<Index<Idx0...>,Index<Idx1...>,Index<Idx2...>,Index<Idx4...>>(a,b,c,e);
-            return einsum<Index<Idx3...>,resulting_index_1>(d,tmp);
-        }
-        else FASTOR_IF_CONSTEXPR (which_variant==2) {
-            auto tmp = einsum<Index<Idx0...>,Index<Idx1...>,Index<Idx3...>,Index<Idx4...>>(a,b,d,e);
-            return einsum<Index<Idx2...>,resulting_index_2>(c,tmp);
-        }
-        else FASTOR_IF_CONSTEXPR (which_variant==3) {
-            auto tmp = einsum<Index<Idx0...>,Index<Idx2...>,Index<Idx3...>,Index<Idx4...>>(a,c,d,e);
-            return einsum<Index<Idx1...>,resulting_index_3>(b,tmp);
-        }
-        else {
-            auto tmp = einsum<Index<Idx1...>,Index<Idx2...>,Index<Idx3...>,Index<Idx4...>>(b,c,d,e);
-            return einsum<Index<Idx0...>,resulting_index_4>(a,tmp);
-        }
+        return network_path_contraction<
+            std::tuple<Index<Idx0...>,Index<Idx1...>,Index<Idx2...>,Index<Idx3...>,Index<Idx4...>>,
+            std::tuple<Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,Rest2...>,Tensor<T,Rest3...>,Tensor<T,Rest4...>>>::contract(a,b,c,d,e);
 
     }
 };
@@ -235,43 +289,10 @@ struct extractor_contract_6<Index<Idx0...>, Index<Idx1...>, Index<Idx2...>, Inde
                   const Tensor<T,Rest4...> &e, const Tensor<T,Rest5...> &f) {
 
 
-        using cost_model = sixtet_flop_cost<Index<Idx0...>,
-            Index<Idx1...>,Index<Idx2...>,Index<Idx3...>,Index<Idx4...>,Index<Idx5...>,
-            Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,Rest2...>,Tensor<T,Rest3...>,Tensor<T,Rest4...>,Tensor<T,Rest5...>>;
-
-        using resulting_index_0 = typename cost_model::resulting_index_0;
-        using resulting_index_1 = typename cost_model::resulting_index_1;
-        using resulting_index_2 = typename cost_model::resulting_index_2;
-        using resulting_index_3 = typename cost_model::resulting_index_3;
-        using resulting_index_4 = typename cost_model::resulting_index_4;
-        using resulting_index_5 = typename cost_model::resulting_index_5;
-
-        constexpr int which_variant = cost_model::which_variant;
-
-        FASTOR_IF_CONSTEXPR (which_variant==0) {
-            auto tmp = einsum<Index<Idx0...>,Index<Idx1...>,Index<Idx2...>,Index<Idx3...>,Index<Idx4...>>(a,b,c,d,e);
-            return einsum<resulting_index_0,Index<Idx5...>>(tmp,f);
-        }
-        else FASTOR_IF_CONSTEXPR (which_variant==1) {
-            auto tmp = einsum<Index<Idx0...>,Index<Idx1...>,Index<Idx2...>,Index<Idx3...>,Index<Idx5...>>(a,b,c,d,f);
-            return einsum<Index<Idx4...>,resulting_index_1>(e,tmp);
-        }
-        else FASTOR_IF_CONSTEXPR (which_variant==2) {
-            auto tmp = einsum<Index<Idx0...>,Index<Idx1...>,Index<Idx2...>,Index<Idx4...>,Index<Idx5...>>(a,b,c,e,f);
-            return einsum<Index<Idx3...>,resulting_index_2>(d,tmp);
-        }
-        else FASTOR_IF_CONSTEXPR (which_variant==3) {
-            auto tmp = einsum<Index<Idx0...>,Index<Idx1...>,Index<Idx3...>,Index<Idx4...>,Index<Idx5...>>(a,b,d,e,f);
-            return einsum<Index<Idx2...>,resulting_index_3>(c,tmp);
-        }
-        else FASTOR_IF_CONSTEXPR (which_variant==4) {
-            auto tmp = einsum<Index<Idx0...>,Index<Idx2...>,Index<Idx3...>,Index<Idx4...>,Index<Idx5...>>(a,c,d,e,f);
-            return einsum<Index<Idx1...>,resulting_index_4>(b,tmp);
-        }
-        else {
-            auto tmp = einsum<Index<Idx1...>,Index<Idx2...>,Index<Idx3...>,Index<Idx4...>,Index<Idx5...>>(b,c,d,e,f);
-            return einsum<Index<Idx0...>,resulting_index_5>(a,tmp);
-        }
+        return network_path_contraction<
+            std::tuple<Index<Idx0...>,Index<Idx1...>,Index<Idx2...>,Index<Idx3...>,Index<Idx4...>,Index<Idx5...>>,
+            std::tuple<Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,Rest2...>,
+                       Tensor<T,Rest3...>,Tensor<T,Rest4...>,Tensor<T,Rest5...>>>::contract(a,b,c,d,e,f);
 
     }
 
@@ -313,37 +334,10 @@ struct extractor_contract_7<Index<Idx0...>, Index<Idx1...>, Index<Idx2...>,
                   const Tensor<T,Rest4...> &e, const Tensor<T,Rest5...> &f,
                   const Tensor<T,Rest6...> &g) {
 
-        using resulting_tensor_0 =  typename get_resuling_tensor<Index<Idx0...>,Index<Idx1...>,
-                                        Tensor<T,Rest0...>,Tensor<T,Rest1...>>::type;
-        using resulting_index_0 =  typename get_resuling_index<Index<Idx0...>,Index<Idx1...>,
-                                        Tensor<T,Rest0...>,Tensor<T,Rest1...>>::type;
-        using resulting_tensor_1 =  typename get_resuling_tensor<resulting_index_0,Index<Idx2...>,
-                                        resulting_tensor_0,Tensor<T,Rest2...>>::type;
-        using resulting_index_1 =  typename get_resuling_index<resulting_index_0,Index<Idx2...>,
-                                        resulting_tensor_0,Tensor<T,Rest2...>>::type;
-        using resulting_tensor_2 =  typename get_resuling_tensor<resulting_index_1,Index<Idx3...>,
-                                        resulting_tensor_1,Tensor<T,Rest3...>>::type;
-        using resulting_index_2 =  typename get_resuling_index<resulting_index_1,Index<Idx3...>,
-                                        resulting_tensor_1,Tensor<T,Rest3...>>::type;
-        using resulting_tensor_3 =  typename get_resuling_tensor<resulting_index_2,Index<Idx4...>,
-                                        resulting_tensor_2,Tensor<T,Rest4...>>::type;
-        using resulting_index_3 =  typename get_resuling_index<resulting_index_2,Index<Idx4...>,
-                                        resulting_tensor_2,Tensor<T,Rest4...>>::type;
-        using resulting_tensor_4 =  typename get_resuling_tensor<resulting_index_3,Index<Idx5...>,
-                                        resulting_tensor_3,Tensor<T,Rest5...>>::type;
-        using resulting_index_4 =  typename get_resuling_index<resulting_index_3,Index<Idx5...>,
-                                        resulting_tensor_3,Tensor<T,Rest5...>>::type;
-
-
-        resulting_tensor_0 tmp0 = einsum<Index<Idx0...>,Index<Idx1...>>(a,b);
-        resulting_tensor_1 tmp1 = einsum<resulting_index_0,Index<Idx2...>>(tmp0,c);
-        resulting_tensor_2 tmp2 = einsum<resulting_index_1,Index<Idx3...>>(tmp1,d);
-        resulting_tensor_3 tmp3 = einsum<resulting_index_2,Index<Idx4...>>(tmp2,e);
-        resulting_tensor_4 tmp4 = einsum<resulting_index_3,Index<Idx5...>>(tmp3,f);
-        auto tmp5 = einsum<resulting_index_4,Index<Idx6...>>(tmp4,g);
-
-        return tmp5;
-
+        return network_path_contraction<
+            std::tuple<Index<Idx0...>,Index<Idx1...>,Index<Idx2...>,Index<Idx3...>,Index<Idx4...>,Index<Idx5...>,Index<Idx6...>>,
+            std::tuple<Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,Rest2...>,Tensor<T,Rest3...>,
+                       Tensor<T,Rest4...>,Tensor<T,Rest5...>,Tensor<T,Rest6...>>>::contract(a,b,c,d,e,f,g);
     }
 };
 
@@ -376,7 +370,7 @@ struct extractor_contract_8<Index<Idx0...>, Index<Idx1...>, Index<Idx2...>,
   template<typename T, size_t ... Rest0, size_t ... Rest1, size_t ... Rest2,
            size_t ... Rest3, size_t ... Rest4, size_t ... Rest5, size_t ... Rest6, size_t ... Rest7>
     static
-    typename contraction_impl<Index<Idx0...,Idx1...,Idx2...,Idx3...,Idx4...,Idx5...,Idx6...>,
+    typename contraction_impl<Index<Idx0...,Idx1...,Idx2...,Idx3...,Idx4...,Idx5...,Idx6...,Idx7...>,
         Tensor<T,Rest0...,Rest1...,Rest2...,Rest3...,Rest4...,Rest5...,Rest6...,Rest7...>,
                               typename std_ext::make_index_sequence<sizeof...(Rest0)+sizeof...(Rest1)+\
                                 sizeof...(Rest2)+sizeof...(Rest3)+sizeof...(Rest4)+sizeof...(Rest5)+\
@@ -386,43 +380,11 @@ struct extractor_contract_8<Index<Idx0...>, Index<Idx1...>, Index<Idx2...>,
                   const Tensor<T,Rest4...> &e, const Tensor<T,Rest5...> &f,
                   const Tensor<T,Rest6...> &g, const Tensor<T,Rest7...> &h) {
 
-
-        using resulting_tensor_0 =  typename get_resuling_tensor<Index<Idx0...>,Index<Idx1...>,
-                                        Tensor<T,Rest0...>,Tensor<T,Rest1...>>::type;
-        using resulting_index_0 =  typename get_resuling_index<Index<Idx0...>,Index<Idx1...>,
-                                        Tensor<T,Rest0...>,Tensor<T,Rest1...>>::type;
-        using resulting_tensor_1 =  typename get_resuling_tensor<resulting_index_0,Index<Idx2...>,
-                                        resulting_tensor_0,Tensor<T,Rest2...>>::type;
-        using resulting_index_1 =  typename get_resuling_index<resulting_index_0,Index<Idx2...>,
-                                        resulting_tensor_0,Tensor<T,Rest2...>>::type;
-        using resulting_tensor_2 =  typename get_resuling_tensor<resulting_index_1,Index<Idx3...>,
-                                        resulting_tensor_1,Tensor<T,Rest3...>>::type;
-        using resulting_index_2 =  typename get_resuling_index<resulting_index_1,Index<Idx3...>,
-                                        resulting_tensor_1,Tensor<T,Rest3...>>::type;
-        using resulting_tensor_3 =  typename get_resuling_tensor<resulting_index_2,Index<Idx4...>,
-                                        resulting_tensor_2,Tensor<T,Rest4...>>::type;
-        using resulting_index_3 =  typename get_resuling_index<resulting_index_2,Index<Idx4...>,
-                                        resulting_tensor_2,Tensor<T,Rest4...>>::type;
-        using resulting_tensor_4 =  typename get_resuling_tensor<resulting_index_3,Index<Idx5...>,
-                                        resulting_tensor_3,Tensor<T,Rest5...>>::type;
-        using resulting_index_4 =  typename get_resuling_index<resulting_index_3,Index<Idx5...>,
-                                        resulting_tensor_3,Tensor<T,Rest5...>>::type;
-        using resulting_tensor_5 =  typename get_resuling_tensor<resulting_index_4,Index<Idx6...>,
-                                        resulting_tensor_4,Tensor<T,Rest6...>>::type;
-        using resulting_index_5 =  typename get_resuling_index<resulting_index_4,Index<Idx6...>,
-                                        resulting_tensor_4,Tensor<T,Rest6...>>::type;
-
-
-        resulting_tensor_0 tmp0 = einsum<Index<Idx0...>,Index<Idx1...>>(a,b);
-        resulting_tensor_1 tmp1 = einsum<resulting_index_0,Index<Idx2...>>(tmp0,c);
-        resulting_tensor_2 tmp2 = einsum<resulting_index_1,Index<Idx3...>>(tmp1,d);
-        resulting_tensor_3 tmp3 = einsum<resulting_index_2,Index<Idx4...>>(tmp2,e);
-        resulting_tensor_4 tmp4 = einsum<resulting_index_3,Index<Idx5...>>(tmp3,f);
-        resulting_tensor_5 tmp5 = einsum<resulting_index_4,Index<Idx6...>>(tmp4,g);
-        auto tmp6 = einsum<resulting_index_5,Index<Idx7...>>(tmp5,h);
-
-        return tmp6;
-
+        return network_path_contraction<
+            std::tuple<Index<Idx0...>,Index<Idx1...>,Index<Idx2...>,Index<Idx3...>,
+                       Index<Idx4...>,Index<Idx5...>,Index<Idx6...>,Index<Idx7...>>,
+            std::tuple<Tensor<T,Rest0...>,Tensor<T,Rest1...>,Tensor<T,Rest2...>,Tensor<T,Rest3...>,
+                       Tensor<T,Rest4...>,Tensor<T,Rest5...>,Tensor<T,Rest6...>,Tensor<T,Rest7...>>>::contract(a,b,c,d,e,f,g,h);
     }
 };
 
@@ -4,6 +4,8 @@
 #include "Fastor/backend/dyadic.h"
 #include "Fastor/tensor/Tensor.h"
 #include "Fastor/tensor/TensorTraits.h"
+#include "Fastor/meta/einsum_meta.h"
+#include "Fastor/tensor_algebra/nested_loop_contraction.h"
 
 
 namespace Fastor {
@@ -40,6 +42,57 @@ outer(const Tensor<T> &a, const Tensor<T> &b) {
 //---------------------------------------------------------------------------------------------------
 
 
+// Outer product written straight into a permuted order, the same as permute<Index_O>(outer(a,b))
+// without the intermediate tensor. The axes of a and b are numbered 0,1,... in the order of
+// outer(a,b) and Index_O picks the axis of it that goes to every position of the result
+/*
+    example:
+        Tensor<double,3,3> I; I.eye2();
+        auto II_ikjl = outer<Index<0,2,1,3>>(I,I);  // = permute<Index<0,2,1,3>>(outer(I,I))
+*/
+//---------------------------------------------------------------------------------------------------
+namespace internal {
+template<size_t Offset, class Seq>
+struct outer_axes;
+template<size_t Offset, size_t ... ss>
+struct outer_axes<Offset,std_ext::index_sequence<ss...>> {
+    using type = Index<(Offset+ss)...>;
+};
+} // internal
+
+template<class Index_O, typename T, size_t ...Rest0, size_t ...Rest1,
+    enable_if_t_<requires_permute_v<Index_O,Tensor<T,Rest0...,Rest1...>>,bool> = false >
+FASTOR_INLINE typename permute_helper<Index_O,Tensor<T,Rest0...,Rest1...>>::resulting_tensor
+outer(const Tensor<T,Rest0...> &a, const Tensor<T,Rest1...> &b) {
+    static_assert(Index_O::Size == sizeof...(Rest0)+sizeof...(Rest1), "INDICES FOR PERMUTED OUTER PRODUCT DO NOT MATCH THE RANK OF THE RESULT");
+    using _permute_helper = permute_helper<Index_O,Tensor<T,Rest0...,Rest1...>>;
+    using axes_a = typename internal::outer_axes<0,typename std_ext::make_index_sequence<sizeof...(Rest0)>::type>::type;
+    using axes_b = typename internal::outer_axes<sizeof...(Rest0),typename std_ext::make_index_sequence<sizeof...(Rest1)>::type>::type;
+    typename _permute_helper::resulting_tensor out;
+    out.zeros();
+    nested_loop_contract<axes_a,axes_b,typename _permute_helper::resulting_index>(a,b,out);
+    return out;
+}
+template<class Index_O, typename T, size_t ...Rest0, size_t ...Rest1,
+    enable_if_t_<!requires_permute_v<Index_O,Tensor<T,Rest0...,Rest1...>>,bool> = false >
+FASTOR_INLINE Tensor<T,Rest0...,Rest1...>
+outer(const Tensor<T,Rest0...> &a, const Tensor<T,Rest1...> &b) {
+    static_assert(Index_O::Size == sizeof...(Rest0)+sizeof...(Rest1), "INDICES FOR PERMUTED OUTER PRODUCT DO NOT MATCH THE RANK OF THE RESULT");
+    return outer(a,b);
+}
+
+template<class Index_O, typename Derived0, size_t DIM0, typename Derived1, size_t DIM1,
+    enable_if_t_<!is_tensor_v<Derived0> || !is_tensor_v<Derived1>,bool> = false >
+FASTOR_INLINE
+typename permute_helper<Index_O,concatenated_tensor_t<typename Derived0::result_type,typename Derived1::result_type>>::resulting_tensor
+outer(const AbstractTensor<Derived0,DIM0> &a, const AbstractTensor<Derived1,DIM1> &b) {
+    const typename Derived0::result_type lhs(a);
+    const typename Derived1::result_type rhs(b);
+    return outer<Index_O>(lhs,rhs);
+}
+//---------------------------------------------------------------------------------------------------
+
+
 // Expressions
 //---------------------------------------------------------------------------------------------------
 template<typename Derived0, size_t DIM0, typename Derived1, size_t DIM1,
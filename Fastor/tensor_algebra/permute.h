@@ -6,6 +6,8 @@
 #include "Fastor/meta/einsum_meta.h"
 #include "Fastor/tensor_algebra/indicial.h"
 #include "Fastor/expressions/linalg_ops/linalg_traits.h"
+#include "Fastor/backend/transpose/transpose.h"
+#include "Fastor/tensor_algebra/nested_loop_contraction.h"
 
 namespace Fastor {
 
@@ -116,6 +118,76 @@ struct NewRecursiveCartesianPermDispatcher<Index<Idx...>, Tensor<T,Rest...>, Ind
 
 
 
+// Blocked permutation engine. The output is written in order; the output axis that is
+// contiguous in the input [col] and the fastest output axis [row] form a 2D transpose
+// done in tiles with the in-register kernels of backend/transpose, the remaining axes
+// are streamed as plain loops with compile-time strides. If the last axis is not
+// moved the innermost loop is a contiguous copy. The index labels need not be 0..n-1,
+// as in new_permute_impl output axis k takes the input axis of the rank of its label
+template<class Idx, class Tens, class Seq = typename std_ext::make_index_sequence<Idx::Size>::type>
+struct blocked_permute_engine;
+
+template<size_t ... Idx, typename T, size_t ... Rest, size_t ... ss>
+struct blocked_permute_engine<Index<Idx...>,Tensor<T,Rest...>,std_ext::index_sequence<ss...>> {
+    static constexpr size_t ndim = sizeof...(Rest);
+    static constexpr size_t dims_in[ndim] = {Rest...};
+    static constexpr size_t labels[ndim] = {Idx...};
+    static constexpr size_t perm[ndim] = {count_less(labels, labels[ss])...};
+    static constexpr size_t dims_out[ndim] = {dims_in[perm[ss]]...};
+
+    static constexpr size_t col = find_index(perm, ndim-1);
+    static constexpr size_t row = ndim-1;
+    static constexpr bool is_copy = col == row;
+    static constexpr size_t nouter = is_copy ? ndim-1 : ndim-2;
+
+    static constexpr size_t stride_in(size_t k)  { return nl_product(dims_in, ndim, perm[k]+1); }
+    static constexpr size_t stride_out(size_t k) { return nl_product(dims_out, ndim, k+1); }
+    //! Output axis streamed at a given outer level
+    static constexpr size_t axis_at(size_t level) {
+        return is_copy || level < col ? level : level+1;
+    }
+};
+
+template<size_t ... Idx, typename T, size_t ... Rest, size_t ... ss>
+constexpr size_t blocked_permute_engine<Index<Idx...>,Tensor<T,Rest...>,std_ext::index_sequence<ss...>>::dims_in[ndim];
+template<size_t ... Idx, typename T, size_t ... Rest, size_t ... ss>
+constexpr size_t blocked_permute_engine<Index<Idx...>,Tensor<T,Rest...>,std_ext::index_sequence<ss...>>::labels[ndim];
+template<size_t ... Idx, typename T, size_t ... Rest, size_t ... ss>
+constexpr size_t blocked_permute_engine<Index<Idx...>,Tensor<T,Rest...>,std_ext::index_sequence<ss...>>::perm[ndim];
+template<size_t ... Idx, typename T, size_t ... Rest, size_t ... ss>
+constexpr size_t blocked_permute_engine<Index<Idx...>,Tensor<T,Rest...>,std_ext::index_sequence<ss...>>::dims_out[ndim];
+
+template<class Engine, typename T, size_t Level, bool IsInner = (Level == Engine::nouter)>
+struct blocked_permute_loop;
+
+template<class Engine, typename T, size_t Level>
+struct blocked_permute_loop<Engine,T,Level,false> {
+    static FASTOR_INLINE void Do(const T *a, T *out) {
+        constexpr size_t axis = Engine::axis_at(Level);
+        constexpr size_t SA = Engine::stride_in(axis);
+        constexpr size_t SO = Engine::stride_out(axis);
+        for (size_t i=0; i<Engine::dims_out[axis]; ++i) {
+            blocked_permute_loop<Engine,T,Level+1>::Do(a,out);
+            a += SA; out += SO;
+        }
+    }
+};
+
+template<class Engine, typename T, size_t Level>
+struct blocked_permute_loop<Engine,T,Level,true> {
+    template<class E=Engine, enable_if_t_<E::is_copy, bool> = false>
+    static FASTOR_INLINE void Do(const T *a, T *out) {
+        std::copy(a,a+Engine::dims_out[Engine::row],out);
+    }
+    template<class E=Engine, enable_if_t_<!E::is_copy, bool> = false>
+    static FASTOR_INLINE void Do(const T *a, T *out) {
+        _transpose_strided<T,Engine::dims_out[Engine::row],Engine::dims_out[Engine::col],
+            Engine::stride_in(Engine::row),Engine::stride_out(Engine::col)>(a,out);
+    }
+};
+
+
+
 template<class T>
 struct new_extractor_perm {};
 
@@ -220,35 +292,7 @@ struct new_extractor_perm<Index<Idx...> > {
 #endif
 #else
         resulting_tensor out;
-
-        const T *a_data = a.data();
-        T *out_data     = out.data();
-
-        constexpr size_t a_dim   =  sizeof...(Rest);
-        constexpr size_t out_dim =  sizeof...(Rest);
-
-        std::array<size_t,out_dim> as  = {};
-        std::array<size_t,out_dim> idx = {};
-
-#if FASTOR_CXX_VERSION >= 2017
-        using reverse_map = internal::permute_mapped_index_t<Index<Idx...>,make_index_t<a_dim>>;
-        using nloops = loop_setter<
-                reverse_map,
-                resulting_tensor,
-                typename std_ext::make_index_sequence<out_dim>::type>;
-        using dims_type = typename nloops::dims_type;
-
-        NewRecursiveCartesianPermDispatcher<Index<Idx...>,Tensor<T,Rest...>,dims_type>::Do(a_data,out_data,as,idx);
-#else
-        using nloops = loop_setter<
-                Index<Idx...>,
-                Tensor<T,Rest...>,
-                typename std_ext::make_index_sequence<out_dim>::type>;
-        using dims_type = typename nloops::dims_type;
-
-        NewRecursiveCartesianPermDispatcher<Index<Idx...>,Tensor<T,Rest...>,dims_type>::Do(a_data,out_data,as,idx);
-#endif
-
+        blocked_permute_loop<blocked_permute_engine<Index<Idx...>,Tensor<T,Rest...>>,T,0>::Do(a.data(),out.data());
 #endif
         return out;
 
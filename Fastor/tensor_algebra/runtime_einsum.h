@@ -0,0 +1,524 @@
+#ifndef RUNTIME_EINSUM_H
+#define RUNTIME_EINSUM_H
+
+#include "Fastor/tensor/Tensor.h"
+#include "Fastor/meta/opmin_path_meta.h"
+#include "Fastor/backend/matmul/matmul_dynamic.h"
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Fastor {
+
+// Runtime einsum. The subscripts and the shapes of the operands are only known at runtime
+//
+//      einsum("ijk,jkl->il", a, shape_a, b, shape_b, out);
+//
+// Indices are single letters. An index shared by both operands is summed unless it also
+// appears in the output, in which case it is a batch index. Without "->" the output holds
+// the indices that appear once, in alphabetical order [numpy convention].
+// The first call for a given subscript string and pair of shapes builds a plan - the
+// permutations that bring both operands to a batched GEMM, the GEMM sizes and the
+// temporaries - that is cached per thread. Later calls replay the plan without allocating.
+// A thread holds at most FASTOR_RUNTIME_EINSUM_CACHE_SIZE plans of every kind, once full the
+// cache is emptied before the next plan is added. runtime_einsum_clear_cache empties it
+// Networks of more than two operands
+//
+//      einsum("ij,jk,kl,lm->im", {a,b,c,d}, {shape_a,shape_b,shape_c,shape_d}, out);
+//
+// are contracted by pairs in the order found by opmin_contraction_path [exact up to twelve
+// operands, greedy beyond]. An index may then appear in more than two operands
+//----------------------------------------------------------------------------------------------------------------//
+namespace internal {
+
+constexpr size_t runtime_einsum_max_rank = 32;
+
+/* out = permutation of a with out axis k of size dims_out[k] read at stride strides_in[k]
+   of a. The output is written in order and the offsets into a are carried incrementally
+*/
+template<typename T>
+FASTOR_HINT_INLINE void _permute_dynamic(const T * FASTOR_RESTRICT a, T * FASTOR_RESTRICT out,
+    const size_t *dims_out, const size_t *strides_in, size_t rank) {
+    if (rank == 0) {
+        out[0] = a[0];
+        return;
+    }
+    size_t counter[runtime_einsum_max_rank] = {};
+    const size_t inner = dims_out[rank-1];
+    const size_t inner_stride = strides_in[rank-1];
+    size_t offset = 0;
+    while (true) {
+        const T *a_row = a + offset;
+        for (size_t i=0; i<inner; ++i) out[i] = a_row[i*inner_stride];
+        out += inner;
+
+        size_t k = rank-1;
+        while (k-- > 0) {
+            offset += strides_in[k];
+            if (++counter[k] < dims_out[k]) break;
+            offset -= counter[k]*strides_in[k];
+            counter[k] = 0;
+        }
+        if (k == size_t(-1)) break;
+    }
+}
+
+
+struct runtime_einsum_plan {
+    std::string subscripts;
+    std::vector<size_t> shape0, shape1, shape_out;
+    // Permuted layouts [dims and strides in the source of every axis of the permuted tensor]
+    std::vector<size_t> dims0, strides0, dims1, strides1, dims_out, strides_out;
+    bool requires_permutation0, requires_permutation1, requires_out_permutation;
+    // Batch count and GEMM sizes of every batch
+    size_t P, M, K, N;
+    size_t size0, size1, size_out;
+};
+
+FASTOR_HINT_INLINE size_t runtime_product(const std::vector<size_t> &dims) {
+    size_t prod = 1;
+    for (size_t d : dims) prod *= d;
+    return prod;
+}
+
+FASTOR_HINT_INLINE std::vector<size_t> runtime_strides(const std::vector<size_t> &dims) {
+    std::vector<size_t> strides(dims.size(),1);
+    for (size_t k=dims.size(); k-- > 1;) strides[k-1] = strides[k]*dims[k];
+    return strides;
+}
+
+/* Axis of each index of sub in idx */
+FASTOR_HINT_INLINE std::vector<size_t> runtime_axes(const std::string &idx, const std::string &sub) {
+    std::vector<size_t> axes;
+    for (char c : sub) axes.push_back(idx.find(c));
+    return axes;
+}
+
+FASTOR_HINT_INLINE bool runtime_is_identity(const std::vector<size_t> &perm) {
+    for (size_t k=0; k<perm.size(); ++k) if (perm[k] != k) return false;
+    return true;
+}
+
+FASTOR_HINT_INLINE runtime_einsum_plan make_runtime_einsum_plan(const char *subscripts,
+    const size_t *shape0, size_t rank0, const size_t *shape1, size_t rank1) {
+
+    runtime_einsum_plan plan;
+    plan.subscripts = subscripts;
+    plan.shape0.assign(shape0,shape0+rank0);
+    plan.shape1.assign(shape1,shape1+rank1);
+
+    // parse
+    std::string idx0, idx1, idxo;
+    bool explicit_output = false;
+    int part = 0;
+    for (const char *c = subscripts; *c; ++c) {
+        if (*c == ' ') continue;
+        else if (*c == ',') { FASTOR_EXIT_ASSERT(part == 0, "EINSUM SUBSCRIPTS FOR MORE THAN TWO OPERANDS"); part = 1; }
+        else if (*c == '-' && *(c+1) == '>') { FASTOR_EXIT_ASSERT(part == 1, "EINSUM SUBSCRIPTS REQUIRE TWO OPERANDS"); part = 2; explicit_output = true; ++c; }
+        else {
+            FASTOR_EXIT_ASSERT((*c >= 'a' && *c <= 'z') || (*c >= 'A' && *c <= 'Z'), "EINSUM SUBSCRIPTS MUST BE LETTERS");
+            (part == 0 ? idx0 : (part == 1 ? idx1 : idxo)) += *c;
+        }
+    }
+    FASTOR_EXIT_ASSERT(part >= 1, "EINSUM SUBSCRIPTS REQUIRE TWO OPERANDS");
+    FASTOR_EXIT_ASSERT(idx0.size() == rank0 && idx1.size() == rank1, "EINSUM SUBSCRIPTS DO NOT MATCH THE RANK OF THE OPERANDS");
+    FASTOR_EXIT_ASSERT(rank0 <= runtime_einsum_max_rank && rank1 <= runtime_einsum_max_rank, "EINSUM RANK TOO LARGE");
+    FASTOR_EXIT_ASSERT(std::find(shape0,shape0+rank0,0) == shape0+rank0 &&
+                       std::find(shape1,shape1+rank1,0) == shape1+rank1, "EINSUM DIMENSIONS MUST BE NON-ZERO");
+    for (size_t i=0; i<rank0; ++i) {
+        FASTOR_EXIT_ASSERT(idx0.find(idx0[i]) == i, "REPEATED INDICES WITHIN AN OPERAND ARE NOT SUPPORTED BY RUNTIME EINSUM");
+        const size_t j = idx1.find(idx0[i]);
+        FASTOR_EXIT_ASSERT(j == std::string::npos || shape0[i] == shape1[j], "EINSUM DIMENSIONS OF A SHARED INDEX DO NOT MATCH");
+    }
+    for (size_t j=0; j<rank1; ++j) {
+        FASTOR_EXIT_ASSERT(idx1.find(idx1[j]) == j, "REPEATED INDICES WITHIN AN OPERAND ARE NOT SUPPORTED BY RUNTIME EINSUM");
+    }
+    if (!explicit_output) {
+        for (char c : idx0) if (idx1.find(c) == std::string::npos) idxo += c;
+        for (char c : idx1) if (idx0.find(c) == std::string::npos) idxo += c;
+        std::sort(idxo.begin(),idxo.end());
+    }
+    for (size_t k=0; k<idxo.size(); ++k) {
+        FASTOR_EXIT_ASSERT(idxo.find(idxo[k]) == k, "REPEATED INDICES IN EINSUM OUTPUT");
+        FASTOR_EXIT_ASSERT(idx0.find(idxo[k]) != std::string::npos || idx1.find(idxo[k]) != std::string::npos,
+            "EINSUM OUTPUT INDEX DOES NOT APPEAR IN THE OPERANDS");
+    }
+
+    // classify
+    std::string batch, free0, free1, contracted0, contracted1;
+    for (char c : idxo) if (idx0.find(c) != std::string::npos && idx1.find(c) != std::string::npos) batch += c;
+    for (char c : idx0) {
+        const bool in1 = idx1.find(c) != std::string::npos, ino = idxo.find(c) != std::string::npos;
+        FASTOR_EXIT_ASSERT(in1 || ino, "SUMMING AN INDEX OF A SINGLE OPERAND IS NOT SUPPORTED BY RUNTIME EINSUM");
+        if (!in1) free0 += c;
+        else if (!ino) contracted0 += c;
+    }
+    for (char c : idx1) {
+        const bool in0 = idx0.find(c) != std::string::npos, ino = idxo.find(c) != std::string::npos;
+        FASTOR_EXIT_ASSERT(in0 || ino, "SUMMING AN INDEX OF A SINGLE OPERAND IS NOT SUPPORTED BY RUNTIME EINSUM");
+        if (!in0) free1 += c;
+        else if (!ino) contracted1 += c;
+    }
+
+    // a -> [batch, free0, contracted], b -> [batch, contracted, free1]. The contracted indices
+    // follow a or b, whichever moves fewer bytes [the same choice as the TTGT planner]
+    plan.size0 = runtime_product(plan.shape0);
+    plan.size1 = runtime_product(plan.shape1);
+    std::vector<size_t> perm0, perm1;
+    size_t best_bytes = size_t(-1);
+    for (const std::string *contracted : {&contracted0, &contracted1}) {
+        const std::vector<size_t> p0 = runtime_axes(idx0, batch + free0 + *contracted);
+        const std::vector<size_t> p1 = runtime_axes(idx1, batch + *contracted + free1);
+        const size_t bytes = (runtime_is_identity(p0) ? 0 : plan.size0) + (runtime_is_identity(p1) ? 0 : plan.size1);
+        if (bytes < best_bytes) {
+            best_bytes = bytes;
+            perm0 = p0;
+            perm1 = p1;
+        }
+    }
+
+    const std::vector<size_t> src_strides0 = runtime_strides(plan.shape0);
+    const std::vector<size_t> src_strides1 = runtime_strides(plan.shape1);
+    for (size_t k : perm0) { plan.dims0.push_back(plan.shape0[k]); plan.strides0.push_back(src_strides0[k]); }
+    for (size_t k : perm1) { plan.dims1.push_back(plan.shape1[k]); plan.strides1.push_back(src_strides1[k]); }
+    plan.requires_permutation0 = !runtime_is_identity(perm0);
+    plan.requires_permutation1 = !runtime_is_identity(perm1);
+
+    plan.P = plan.M = plan.K = plan.N = 1;
+    for (size_t k=0; k<batch.size(); ++k) plan.P *= plan.dims0[k];
+    for (size_t k=0; k<free0.size(); ++k) plan.M *= plan.dims0[batch.size()+k];
+    for (size_t k=0; k<contracted0.size(); ++k) plan.K *= plan.dims0[batch.size()+free0.size()+k];
+    for (size_t k=0; k<free1.size(); ++k) plan.N *= plan.dims1[batch.size()+contracted0.size()+k];
+
+    // the GEMMs produce [batch, free0, free1] which is permuted to the requested output
+    const std::string natural = batch + free0 + free1;
+    std::vector<size_t> natural_dims;
+    for (char c : natural) {
+        const size_t i = idx0.find(c);
+        natural_dims.push_back(i != std::string::npos ? shape0[i] : shape1[idx1.find(c)]);
+    }
+    const std::vector<size_t> natural_strides = runtime_strides(natural_dims);
+    const std::vector<size_t> out_perm = runtime_axes(natural, idxo);
+    for (size_t k : out_perm) {
+        plan.shape_out.push_back(natural_dims[k]);
+        plan.dims_out.push_back(natural_dims[k]);
+        plan.strides_out.push_back(natural_strides[k]);
+    }
+    plan.requires_out_permutation = !runtime_is_identity(out_perm);
+    plan.size_out = runtime_product(plan.shape_out);
+    return plan;
+}
+
+
+template<typename T>
+struct runtime_einsum_cache {
+
+    struct entry {
+        runtime_einsum_plan plan;
+        std::vector<T> work0, work1, work_out;
+    };
+
+    static FASTOR_HINT_INLINE size_t hash(const char *subscripts, const size_t *shape0, size_t rank0, const size_t *shape1, size_t rank1) {
+        size_t h = 14695981039346656037ULL;
+        auto mix = [&h](size_t v) { h = (h ^ v) * 1099511628211ULL; };
+        for (const char *c = subscripts; *c; ++c) mix(size_t(*c));
+        mix(rank0); for (size_t i=0; i<rank0; ++i) mix(shape0[i]);
+        mix(rank1); for (size_t i=0; i<rank1; ++i) mix(shape1[i]);
+        return h;
+    }
+
+    static FASTOR_HINT_INLINE bool matches(const runtime_einsum_plan &plan, const char *subscripts,
+        const size_t *shape0, size_t rank0, const size_t *shape1, size_t rank1) {
+        return plan.subscripts == subscripts &&
+               plan.shape0.size() == rank0 && std::equal(shape0,shape0+rank0,plan.shape0.begin()) &&
+               plan.shape1.size() == rank1 && std::equal(shape1,shape1+rank1,plan.shape1.begin());
+    }
+
+    static FASTOR_HINT_INLINE std::unique_ptr<entry> make_entry(const char *subscripts,
+        const size_t *shape0, size_t rank0, const size_t *shape1, size_t rank1) {
+        std::unique_ptr<entry> e(new entry);
+        e->plan = make_runtime_einsum_plan(subscripts,shape0,rank0,shape1,rank1);
+        if (e->plan.requires_permutation0)    e->work0.resize(e->plan.size0);
+        if (e->plan.requires_permutation1)    e->work1.resize(e->plan.size1);
+        if (e->plan.requires_out_permutation) e->work_out.resize(e->plan.size_out);
+        return e;
+    }
+
+    FASTOR_HINT_INLINE entry& get(const char *subscripts, const size_t *shape0, size_t rank0, const size_t *shape1, size_t rank1) {
+        const size_t h = hash(subscripts,shape0,rank0,shape1,rank1);
+        auto range = entries.equal_range(h);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (matches(it->second->plan,subscripts,shape0,rank0,shape1,rank1)) return *it->second;
+        }
+        if (entries.size() >= FASTOR_RUNTIME_EINSUM_CACHE_SIZE) entries.clear();
+        return *entries.emplace(h,make_entry(subscripts,shape0,rank0,shape1,rank1))->second;
+    }
+
+    static FASTOR_HINT_INLINE runtime_einsum_cache& instance() {
+        static thread_local runtime_einsum_cache cache;
+        return cache;
+    }
+
+    std::unordered_multimap<size_t,std::unique_ptr<entry>> entries;
+};
+
+template<typename T>
+FASTOR_HINT_INLINE void runtime_einsum_execute(typename runtime_einsum_cache<T>::entry &e, const T *a, const T *b, T *out) {
+    const runtime_einsum_plan &plan = e.plan;
+    if (plan.requires_permutation0) {
+        _permute_dynamic(a,e.work0.data(),plan.dims0.data(),plan.strides0.data(),plan.dims0.size());
+        a = e.work0.data();
+    }
+    if (plan.requires_permutation1) {
+        _permute_dynamic(b,e.work1.data(),plan.dims1.data(),plan.strides1.data(),plan.dims1.size());
+        b = e.work1.data();
+    }
+    T *gemm_out = plan.requires_out_permutation ? e.work_out.data() : out;
+    for (size_t p=0; p<plan.P; ++p) {
+        _matmul_dynamic(plan.M,plan.K,plan.N,a+p*plan.M*plan.K,b+p*plan.K*plan.N,gemm_out+p*plan.M*plan.N);
+    }
+    if (plan.requires_out_permutation) {
+        _permute_dynamic(gemm_out,out,plan.dims_out.data(),plan.strides_out.data(),plan.dims_out.size());
+    }
+}
+
+
+/* Plan of a network of operands. Every step of the contraction order is a by-pair runtime
+   einsum between two operands or intermediates, its intermediate keeps the indices that are
+   still needed by the rest of the network
+*/
+struct runtime_network_plan {
+    std::string subscripts;
+    std::vector<std::vector<size_t>> shapes;
+    opmin_path path;
+    std::vector<std::string> step_subscripts;
+    std::vector<std::vector<size_t>> step_shapes;
+    std::vector<size_t> shape_out;
+};
+
+FASTOR_HINT_INLINE runtime_network_plan make_runtime_network_plan(const char *subscripts,
+    const std::vector<std::vector<size_t>> &shapes, double max_intermediate) {
+
+    runtime_network_plan plan;
+    plan.subscripts = subscripts;
+    plan.shapes = shapes;
+
+    // parse
+    std::vector<std::string> inputs(1);
+    std::string idxo;
+    bool explicit_output = false;
+    for (const char *c = subscripts; *c; ++c) {
+        if (*c == ' ') continue;
+        else if (*c == ',') { FASTOR_EXIT_ASSERT(!explicit_output, "EINSUM OUTPUT MUST COME LAST"); inputs.emplace_back(); }
+        else if (*c == '-' && *(c+1) == '>') { FASTOR_EXIT_ASSERT(!explicit_output, "EINSUM OUTPUT MUST COME LAST"); explicit_output = true; ++c; }
+        else {
+            FASTOR_EXIT_ASSERT((*c >= 'a' && *c <= 'z') || (*c >= 'A' && *c <= 'Z'), "EINSUM SUBSCRIPTS MUST BE LETTERS");
+            (explicit_output ? idxo : inputs.back()) += *c;
+        }
+    }
+    const size_t n = inputs.size();
+    FASTOR_EXIT_ASSERT(n >= 2, "EINSUM SUBSCRIPTS REQUIRE TWO OPERANDS");
+    FASTOR_EXIT_ASSERT(n == shapes.size(), "EINSUM SUBSCRIPTS DO NOT MATCH THE NUMBER OF OPERANDS");
+
+    size_t dims[128] = {};
+    size_t counts[128] = {};
+    for (size_t k=0; k<n; ++k) {
+        FASTOR_EXIT_ASSERT(inputs[k].size() == shapes[k].size(), "EINSUM SUBSCRIPTS DO NOT MATCH THE RANK OF THE OPERANDS");
+        FASTOR_EXIT_ASSERT(inputs[k].size() <= runtime_einsum_max_rank, "EINSUM RANK TOO LARGE");
+        for (size_t i=0; i<inputs[k].size(); ++i) {
+            const char c = inputs[k][i];
+            FASTOR_EXIT_ASSERT(inputs[k].find(c) == i, "REPEATED INDICES WITHIN AN OPERAND ARE NOT SUPPORTED BY RUNTIME EINSUM");
+            FASTOR_EXIT_ASSERT(shapes[k][i] != 0, "EINSUM DIMENSIONS MUST BE NON-ZERO");
+            FASTOR_EXIT_ASSERT(dims[size_t(c)] == 0 || dims[size_t(c)] == shapes[k][i], "EINSUM DIMENSIONS OF A SHARED INDEX DO NOT MATCH");
+            dims[size_t(c)] = shapes[k][i];
+            ++counts[size_t(c)];
+        }
+    }
+    if (!explicit_output) {
+        for (size_t c=0; c<128; ++c) if (counts[c] == 1) idxo += char(c);
+    }
+    for (size_t k=0; k<idxo.size(); ++k) {
+        FASTOR_EXIT_ASSERT(idxo.find(idxo[k]) == k, "REPEATED INDICES IN EINSUM OUTPUT");
+        FASTOR_EXIT_ASSERT(counts[size_t(idxo[k])] != 0, "EINSUM OUTPUT INDEX DOES NOT APPEAR IN THE OPERANDS");
+    }
+    for (size_t c=0; c<128; ++c) {
+        FASTOR_EXIT_ASSERT(counts[c] != 1 || idxo.find(char(c)) != std::string::npos,
+            "SUMMING AN INDEX OF A SINGLE OPERAND IS NOT SUPPORTED BY RUNTIME EINSUM");
+    }
+
+    // order
+    size_t ids[128] = {};
+    double id_dims[opmin_max_indices] = {};
+    size_t nidx = 0;
+    for (size_t c=0; c<128; ++c) {
+        if (counts[c] == 0) continue;
+        ids[c] = nidx;
+        id_dims[nidx++] = double(dims[c]);
+    }
+    std::vector<uint64_t> operands(n,0);
+    for (size_t k=0; k<n; ++k) {
+        for (char c : inputs[k]) operands[k] |= uint64_t(1) << ids[size_t(c)];
+    }
+    uint64_t output = 0;
+    for (char c : idxo) output |= uint64_t(1) << ids[size_t(c)];
+    plan.path = opmin_contraction_path(operands, output, id_dims, nidx, max_intermediate);
+
+    // steps
+    std::vector<std::string> labels(inputs);
+    std::vector<std::vector<size_t>> step_shapes(shapes);
+    for (char c : idxo) ++counts[size_t(c)];
+    for (size_t k=0; k<plan.path.steps.size(); ++k) {
+        const std::string &l = labels[plan.path.steps[k].first];
+        const std::string &r = labels[plan.path.steps[k].second];
+        std::string res;
+        if (k+1 == plan.path.steps.size()) {
+            res = idxo;
+        }
+        else {
+            const std::string joint = l + r;
+            for (size_t i=0; i<joint.size(); ++i) {
+                const char c = joint[i];
+                const size_t here = (l.find(c) != std::string::npos) + (r.find(c) != std::string::npos);
+                if (joint.find(c) == i && counts[size_t(c)] > here) res += c;
+            }
+        }
+        for (char c : l) --counts[size_t(c)];
+        for (char c : r) --counts[size_t(c)];
+        for (char c : res) ++counts[size_t(c)];
+
+        std::vector<size_t> shape;
+        for (char c : res) shape.push_back(dims[size_t(c)]);
+        plan.step_subscripts.push_back(l + "," + r + "->" + res);
+        plan.step_shapes.push_back(shape);
+        labels.push_back(res);
+        step_shapes.push_back(shape);
+    }
+    plan.shape_out = plan.step_shapes.back();
+    return plan;
+}
+
+
+template<typename T>
+struct runtime_network_cache {
+
+    struct entry {
+        runtime_network_plan plan;
+        // Owned rather than shared with runtime_einsum_cache, which may be emptied at any call
+        std::vector<std::unique_ptr<typename runtime_einsum_cache<T>::entry>> steps;
+        std::vector<std::vector<T>> work;
+    };
+
+    static FASTOR_HINT_INLINE size_t hash(const char *subscripts, const std::vector<std::vector<size_t>> &shapes) {
+        size_t h = 14695981039346656037ULL;
+        auto mix = [&h](size_t v) { h = (h ^ v) * 1099511628211ULL; };
+        for (const char *c = subscripts; *c; ++c) mix(size_t(*c));
+        for (const auto &shape : shapes) {
+            mix(shape.size());
+            for (size_t d : shape) mix(d);
+        }
+        return h;
+    }
+
+    FASTOR_HINT_INLINE entry& get(const char *subscripts, const std::vector<std::vector<size_t>> &shapes) {
+        const size_t h = hash(subscripts,shapes);
+        auto range = entries.equal_range(h);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second->plan.subscripts == subscripts && it->second->plan.shapes == shapes) return *it->second;
+        }
+        if (entries.size() >= FASTOR_RUNTIME_EINSUM_CACHE_SIZE) entries.clear();
+        std::unique_ptr<entry> e(new entry);
+        e->plan = make_runtime_network_plan(subscripts,shapes,double(FASTOR_OPMIN_MAX_INTERMEDIATE/sizeof(T)));
+        const runtime_network_plan &plan = e->plan;
+        const size_t n = plan.shapes.size();
+        for (size_t k=0; k<plan.path.steps.size(); ++k) {
+            const size_t l = plan.path.steps[k].first, r = plan.path.steps[k].second;
+            const std::vector<size_t> &shape_l = l < n ? plan.shapes[l] : plan.step_shapes[l-n];
+            const std::vector<size_t> &shape_r = r < n ? plan.shapes[r] : plan.step_shapes[r-n];
+            e->steps.push_back(runtime_einsum_cache<T>::make_entry(plan.step_subscripts[k].c_str(),
+                shape_l.data(),shape_l.size(),shape_r.data(),shape_r.size()));
+            if (k+1 < plan.path.steps.size()) e->work.emplace_back(runtime_product(plan.step_shapes[k]));
+        }
+        return *entries.emplace(h,std::move(e))->second;
+    }
+
+    static FASTOR_HINT_INLINE runtime_network_cache& instance() {
+        static thread_local runtime_network_cache cache;
+        return cache;
+    }
+
+    std::unordered_multimap<size_t,std::unique_ptr<entry>> entries;
+};
+
+template<typename T>
+FASTOR_HINT_INLINE void runtime_network_execute(typename runtime_network_cache<T>::entry &e, const std::vector<const T*> &operands, T *out) {
+    const size_t n = operands.size();
+    const size_t nsteps = e.plan.path.steps.size();
+    for (size_t k=0; k<nsteps; ++k) {
+        const size_t l = e.plan.path.steps[k].first, r = e.plan.path.steps[k].second;
+        const T *a = l < n ? operands[l] : e.work[l-n].data();
+        const T *b = r < n ? operands[r] : e.work[r-n].data();
+        runtime_einsum_execute<T>(*e.steps[k],a,b,k+1 == nsteps ? out : e.work[k].data());
+    }
+}
+
+} // internal
+
+
+/* Contract the buffers a and b of runtime shapes shape_a and shape_b into out, which
+   must hold as many elements as the shape returned by einsum_shape
+*/
+template<typename T>
+FASTOR_HINT_INLINE void einsum(const char *subscripts,
+    const T *a, const std::vector<size_t> &shape_a, const T *b, const std::vector<size_t> &shape_b, T *out) {
+    auto &e = internal::runtime_einsum_cache<T>::instance().get(subscripts,
+        shape_a.data(),shape_a.size(),shape_b.data(),shape_b.size());
+    internal::runtime_einsum_execute<T>(e,a,b,out);
+}
+
+/* Shape of the result of a runtime einsum */
+FASTOR_HINT_INLINE std::vector<size_t> einsum_shape(const char *subscripts,
+    const std::vector<size_t> &shape_a, const std::vector<size_t> &shape_b) {
+    return internal::make_runtime_einsum_plan(subscripts,shape_a.data(),shape_a.size(),shape_b.data(),shape_b.size()).shape_out;
+}
+
+/* Runtime subscripts on Fastor tensors, the shape of out is checked against the plan */
+template<typename T, size_t ... Rest0, size_t ... Rest1, size_t ... RestO>
+FASTOR_HINT_INLINE void einsum(const char *subscripts, const Tensor<T,Rest0...> &a, const Tensor<T,Rest1...> &b, Tensor<T,RestO...> &out) {
+    constexpr size_t shape_a[sizeof...(Rest0)+1] = {Rest0...,0};
+    constexpr size_t shape_b[sizeof...(Rest1)+1] = {Rest1...,0};
+    constexpr size_t shape_o[sizeof...(RestO)+1] = {RestO...,0};
+    auto &e = internal::runtime_einsum_cache<T>::instance().get(subscripts,shape_a,sizeof...(Rest0),shape_b,sizeof...(Rest1));
+    FASTOR_EXIT_ASSERT(e.plan.shape_out.size() == sizeof...(RestO) &&
+        std::equal(shape_o,shape_o+sizeof...(RestO),e.plan.shape_out.begin()), "EINSUM OUTPUT TENSOR HAS THE WRONG SHAPE");
+    internal::runtime_einsum_execute<T>(e,a.data(),b.data(),out.data());
+}
+
+/* Contract a network of buffers of runtime shapes into out, which must hold as many elements
+   as the shape returned by einsum_shape
+*/
+template<typename T>
+FASTOR_HINT_INLINE void einsum(const char *subscripts,
+    const std::vector<const T*> &operands, const std::vector<std::vector<size_t>> &shapes, T *out) {
+    FASTOR_EXIT_ASSERT(operands.size() == shapes.size(), "EINSUM REQUIRES A SHAPE FOR EVERY OPERAND");
+    auto &e = internal::runtime_network_cache<T>::instance().get(subscripts,shapes);
+    internal::runtime_network_execute<T>(e,operands,out);
+}
+
+/* Shape of the result of a runtime einsum over a network */
+FASTOR_HINT_INLINE std::vector<size_t> einsum_shape(const char *subscripts, const std::vector<std::vector<size_t>> &shapes) {
+    return internal::make_runtime_network_plan(subscripts,shapes,0).shape_out;
+}
+
+/* Release the plans and temporaries of runtime einsums of type T cached by the calling thread */
+template<typename T>
+FASTOR_HINT_INLINE void runtime_einsum_clear_cache() {
+    internal::runtime_network_cache<T>::instance().entries.clear();
+    internal::runtime_einsum_cache<T>::instance().entries.clear();
+}
+//----------------------------------------------------------------------------------------------------------------//
+
+} // end of namespace Fastor
+
+#endif // RUNTIME_EINSUM_H
@@ -0,0 +1,366 @@
+#ifndef TTGT_H
+#define TTGT_H
+
+#include "Fastor/backend/matmul/matmul.h"
+#include "Fastor/tensor/Tensor.h"
+#include "Fastor/meta/einsum_meta.h"
+#include "Fastor/tensor_algebra/indicial.h"
+#include "Fastor/tensor_algebra/permute.h"
+
+
+namespace Fastor {
+
+// Transpose-transpose-GEMM-transpose [TTGT] evaluation of by-pair contractions.
+// Any contraction of two tensors with distinct indices in each operand is a matrix
+// product once the operands are permuted so that the contracted indices are
+// contiguous - a as [free_a, contracted] and b as [contracted, free_b] gives the
+// result [free_a, free_b] directly through a single _matmul. Alternatively the
+// transposed product [free_b, free_a] = [free_b, contracted] * [contracted, free_a]
+// is formed and permuted back. The contracted indices can be ordered as they appear
+// in a or as in b. Out of these four layouts the planner picks the one that moves
+// the fewest bytes, operands already in the right layout are not copied
+
+namespace internal {
+
+//! Position of v in seq or N if seq does not contain v
+template<size_t N>
+constexpr size_t ttgt_find(const size_t (&seq)[N], size_t v, size_t cur=0) {
+    return cur == N ? N : (seq[cur] == v ? cur : ttgt_find(seq, v, cur+1));
+}
+
+//! Number of indices of self that also appear in other
+template<size_t N0, size_t N1>
+constexpr size_t ttgt_count_contracted(const size_t (&self)[N0], const size_t (&other)[N1], size_t cur=0) {
+    return cur == N0 ? 0 : size_t(ttgt_find(other, self[cur]) != N1) + ttgt_count_contracted(self, other, cur+1);
+}
+
+//! Position in self of the k-th contracted [contracted = true] or k-th free index
+template<size_t N0, size_t N1>
+constexpr size_t ttgt_kth(const size_t (&self)[N0], const size_t (&other)[N1], bool contracted, size_t k, size_t cur=0) {
+    return cur == N0 ? N0 :
+        ((ttgt_find(other, self[cur]) != N1) == contracted ?
+            (k == 0 ? cur : ttgt_kth(self, other, contracted, k-1, cur+1)) :
+            ttgt_kth(self, other, contracted, k, cur+1));
+}
+
+//! Position in self of the j-th contracted index when the contracted indices are
+//! ordered as in self [own_order = true] or as in other
+template<size_t N0, size_t N1>
+constexpr size_t ttgt_contracted_axis(const size_t (&self)[N0], const size_t (&other)[N1], bool own_order, size_t j) {
+    return own_order ? ttgt_kth(self, other, true, j) : ttgt_find(self, other[ttgt_kth(other, self, true, j)]);
+}
+
+//! k-th axis of the permuted operand, free indices first [free_first = true] or last
+template<size_t N0, size_t N1>
+constexpr size_t ttgt_axis(const size_t (&self)[N0], const size_t (&other)[N1], bool free_first, bool own_order, size_t k) {
+    return free_first ?
+        (k < N0 - ttgt_count_contracted(self, other) ? ttgt_kth(self, other, false, k) :
+            ttgt_contracted_axis(self, other, own_order, k - (N0 - ttgt_count_contracted(self, other)))) :
+        (k < ttgt_count_contracted(self, other) ? ttgt_contracted_axis(self, other, own_order, k) :
+            ttgt_kth(self, other, false, k - ttgt_count_contracted(self, other)));
+}
+
+template<size_t N0, size_t N1>
+constexpr bool ttgt_is_identity(const size_t (&self)[N0], const size_t (&other)[N1], bool free_first, bool own_order, size_t k=0) {
+    return k == N0 ? true : (ttgt_axis(self, other, free_first, own_order, k) == k &&
+        ttgt_is_identity(self, other, free_first, own_order, k+1));
+}
+
+//! Product of the dimensions of the contracted [contracted = true] or free indices
+template<size_t N0, size_t N1>
+constexpr size_t ttgt_product(const size_t (&self)[N0], const size_t (&other)[N1], const size_t (&dims)[N0], bool contracted, size_t cur=0) {
+    return cur == N0 ? 1 : ((ttgt_find(other, self[cur]) != N1) == contracted ? dims[cur] : 1) *
+        ttgt_product(self, other, dims, contracted, cur+1);
+}
+
+template<class Idx0, class Idx1, class Tens0, class Tens1>
+struct ttgt_planner;
+
+template<size_t ... Idx0, size_t ... Idx1, typename T, size_t ... Rest0, size_t ... Rest1>
+struct ttgt_planner<Index<Idx0...>,Index<Idx1...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>> {
+    static constexpr size_t idx0[sizeof...(Idx0)] = {Idx0...};
+    static constexpr size_t idx1[sizeof...(Idx1)] = {Idx1...};
+    static constexpr size_t dims0[sizeof...(Rest0)] = {Rest0...};
+    static constexpr size_t dims1[sizeof...(Rest1)] = {Rest1...};
+
+    static constexpr size_t ncontracted = ttgt_count_contracted(idx0, idx1);
+    static constexpr size_t nfree0 = sizeof...(Idx0) - ncontracted;
+    static constexpr size_t nfree1 = sizeof...(Idx1) - ncontracted;
+
+    // Applicable when no index repeats within an operand and something is left over
+    static constexpr bool value = no_of_unique<Idx0...>::value == sizeof...(Idx0) &&
+                                  no_of_unique<Idx1...>::value == sizeof...(Idx1) &&
+                                  sizeof...(Idx0) == sizeof...(Rest0) &&
+                                  sizeof...(Idx1) == sizeof...(Rest1) &&
+                                  nfree0 + nfree1 > 0;
+
+    // GEMM sizes of the untransposed product
+    static constexpr size_t M = ttgt_product(idx0, idx1, dims0, false);
+    static constexpr size_t K = ttgt_product(idx0, idx1, dims0, true);
+    static constexpr size_t N = ttgt_product(idx1, idx0, dims1, false);
+
+    // Bytes moved by the permutations for a given layout
+    static constexpr size_t cost(bool transposed, bool order0) {
+        return sizeof(T)*(
+            (ttgt_is_identity(idx0, idx1, !transposed,  order0) ? 0 : M*K) +
+            (ttgt_is_identity(idx1, idx0,  transposed, !order0) ? 0 : K*N) +
+            (transposed && nfree0 != 0 && nfree1 != 0 ? M*N : 0));
+    }
+    static constexpr size_t cost0 = cost(false, true);
+    static constexpr size_t cost1 = cost(false, false);
+    static constexpr size_t cost2 = cost(true,  true);
+    static constexpr size_t cost3 = cost(true,  false);
+    static constexpr size_t best  = cost0 <= cost1 && cost0 <= cost2 && cost0 <= cost3 ? 0 :
+                                    cost1 <= cost2 && cost1 <= cost3 ? 1 :
+                                    cost2 <= cost3 ? 2 : 3;
+
+    // The contracted indices ordered as in a [order0] and the transposed product
+    static constexpr bool order0 = best == 0 || best == 2;
+    static constexpr bool transposed = best >= 2;
+    static constexpr size_t bytes = best == 0 ? cost0 : best == 1 ? cost1 : best == 2 ? cost2 : cost3;
+
+    template<class Seq> struct perm0_helper;
+    template<size_t ... ss> struct perm0_helper<std_ext::index_sequence<ss...>> {
+        using type = Index<ttgt_axis(idx0, idx1, !transposed, order0, ss)...>;
+    };
+    template<class Seq> struct perm1_helper;
+    template<size_t ... ss> struct perm1_helper<std_ext::index_sequence<ss...>> {
+        using type = Index<ttgt_axis(idx1, idx0, transposed, !order0, ss)...>;
+    };
+    // [free_b, free_a] back to [free_a, free_b]
+    template<class Seq> struct out_perm_helper;
+    template<size_t ... ss> struct out_perm_helper<std_ext::index_sequence<ss...>> {
+        using type = Index<(ss < nfree0 ? nfree1 + ss : ss - nfree0)...>;
+    };
+
+    template<class Seq> struct transposed_out_helper;
+    template<size_t ... ss> struct transposed_out_helper<std_ext::index_sequence<ss...>> {
+        using type = Tensor<T,(ss < nfree1 ? dims1[ttgt_kth(idx1, idx0, false, ss)] :
+                                             dims0[ttgt_kth(idx0, idx1, false, ss - nfree1)])...>;
+    };
+
+    using perm0 = typename perm0_helper<typename std_ext::make_index_sequence<sizeof...(Idx0)>::type>::type;
+    using perm1 = typename perm1_helper<typename std_ext::make_index_sequence<sizeof...(Idx1)>::type>::type;
+    using out_perm = typename out_perm_helper<typename std_ext::make_index_sequence<nfree0+nfree1>::type>::type;
+    using transposed_out_tensor = typename transposed_out_helper<typename std_ext::make_index_sequence<nfree0+nfree1>::type>::type;
+    static constexpr bool requires_permutation0 = !ttgt_is_identity(idx0, idx1, !transposed,  order0);
+    static constexpr bool requires_permutation1 = !ttgt_is_identity(idx1, idx0,  transposed, !order0);
+    static constexpr bool requires_out_permutation = transposed && nfree0 != 0 && nfree1 != 0;
+};
+
+template<size_t ... Idx0, size_t ... Idx1, typename T, size_t ... Rest0, size_t ... Rest1>
+constexpr size_t ttgt_planner<Index<Idx0...>,Index<Idx1...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::idx0[sizeof...(Idx0)];
+template<size_t ... Idx0, size_t ... Idx1, typename T, size_t ... Rest0, size_t ... Rest1>
+constexpr size_t ttgt_planner<Index<Idx0...>,Index<Idx1...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::idx1[sizeof...(Idx1)];
+template<size_t ... Idx0, size_t ... Idx1, typename T, size_t ... Rest0, size_t ... Rest1>
+constexpr size_t ttgt_planner<Index<Idx0...>,Index<Idx1...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::dims0[sizeof...(Rest0)];
+template<size_t ... Idx0, size_t ... Idx1, typename T, size_t ... Rest0, size_t ... Rest1>
+constexpr size_t ttgt_planner<Index<Idx0...>,Index<Idx1...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::dims1[sizeof...(Rest1)];
+
+
+// Operands that are already in the planned layout are used in place
+template<class Perm, bool Required, typename T, size_t ... Rest, enable_if_t_<!Required,bool> = false>
+FASTOR_INLINE const Tensor<T,Rest...>& ttgt_permute(const Tensor<T,Rest...> &a) {
+    return a;
+}
+template<class Perm, bool Required, typename T, size_t ... Rest, enable_if_t_<Required,bool> = false>
+FASTOR_INLINE auto ttgt_permute(const Tensor<T,Rest...> &a) -> decltype(permute<Perm>(a)) {
+    return permute<Perm>(a);
+}
+
+template<class Planner, class OutTensor, typename T, size_t ... Rest0, size_t ... Rest1,
+    enable_if_t_<!Planner::transposed,bool> = false>
+FASTOR_INLINE OutTensor ttgt_contract(const Tensor<T,Rest0...> &a, const Tensor<T,Rest1...> &b) {
+    const auto &pa = ttgt_permute<typename Planner::perm0,Planner::requires_permutation0>(a);
+    const auto &pb = ttgt_permute<typename Planner::perm1,Planner::requires_permutation1>(b);
+    OutTensor out;
+    _matmul<T,Planner::M,Planner::K,Planner::N>(pa.data(),pb.data(),out.data());
+    return out;
+}
+
+template<class Planner, class OutTensor, typename T, size_t ... Rest0, size_t ... Rest1,
+    enable_if_t_<Planner::transposed,bool> = false>
+FASTOR_INLINE OutTensor ttgt_contract(const Tensor<T,Rest0...> &a, const Tensor<T,Rest1...> &b) {
+    const auto &pa = ttgt_permute<typename Planner::perm0,Planner::requires_permutation0>(a);
+    const auto &pb = ttgt_permute<typename Planner::perm1,Planner::requires_permutation1>(b);
+    typename Planner::transposed_out_tensor out;
+    _matmul<T,Planner::N,Planner::K,Planner::M>(pb.data(),pa.data(),out.data());
+    return ttgt_permute<typename Planner::out_perm,Planner::requires_out_permutation>(out);
+}
+
+
+
+
+// Batched contractions. With an explicit output index an index that appears in both
+// operands and in the output is a batch [Hadamard] index rather than a contracted one,
+// e.g. einsum<Index<b,i,k>,Index<b,k,j>,OIndex<b,i,j>> is a batch of matrix products.
+// The operands are permuted to [batch, free_a, contracted] and [batch, contracted, free_b]
+// so that the batch is a loop over _matmul on matrices at a fixed stride. The result
+// comes out as [batch, free_a, free_b] and is permuted to the requested output order
+
+//! Position in seq of the k-th index whose membership in s0 and s1 is in0 and in1
+template<size_t N, size_t N0, size_t N1>
+constexpr size_t ttgt_kth_in(const size_t (&seq)[N], const size_t (&s0)[N0], bool in0,
+    const size_t (&s1)[N1], bool in1, size_t k, size_t cur=0) {
+    return cur == N ? N :
+        ((ttgt_find(s0, seq[cur]) != N0) == in0 && (ttgt_find(s1, seq[cur]) != N1) == in1 ?
+            (k == 0 ? cur : ttgt_kth_in(seq, s0, in0, s1, in1, k-1, cur+1)) :
+            ttgt_kth_in(seq, s0, in0, s1, in1, k, cur+1));
+}
+
+//! Number of indices of seq before position up_to whose membership in s0 and s1 is in0 and in1
+template<size_t N, size_t N0, size_t N1>
+constexpr size_t ttgt_count_in(const size_t (&seq)[N], const size_t (&s0)[N0], bool in0,
+    const size_t (&s1)[N1], bool in1, size_t up_to=N, size_t cur=0) {
+    return cur == up_to ? 0 :
+        size_t((ttgt_find(s0, seq[cur]) != N0) == in0 && (ttgt_find(s1, seq[cur]) != N1) == in1) +
+        ttgt_count_in(seq, s0, in0, s1, in1, up_to, cur+1);
+}
+
+//! k-th axis of an operand permuted to [batch, free, contracted] [free_first = true]
+//! or [batch, contracted, free]. Batch indices follow the output, contracted indices
+//! are ordered as in self [own_order = true] or as in other
+template<size_t N0, size_t N1, size_t NO>
+constexpr size_t ttgt_batch_axis(const size_t (&self)[N0], const size_t (&other)[N1], const size_t (&out)[NO],
+    bool free_first, bool own_order, size_t k) {
+    return k < ttgt_count_in(out, self, true, other, true) ?
+                ttgt_find(self, out[ttgt_kth_in(out, self, true, other, true, k)]) :
+           (free_first ? k - ttgt_count_in(out, self, true, other, true) < ttgt_count_in(self, other, false, out, true) :
+                         k - ttgt_count_in(out, self, true, other, true) >= ttgt_count_in(self, other, true, out, false)) ?
+                ttgt_kth_in(self, other, false, out, true, k - ttgt_count_in(out, self, true, other, true) -
+                    (free_first ? 0 : ttgt_count_in(self, other, true, out, false))) :
+           own_order ?
+                ttgt_kth_in(self, other, true, out, false, k - ttgt_count_in(out, self, true, other, true) -
+                    (free_first ? ttgt_count_in(self, other, false, out, true) : 0)) :
+                ttgt_find(self, other[ttgt_kth_in(other, self, true, out, false, k - ttgt_count_in(out, self, true, other, true) -
+                    (free_first ? ttgt_count_in(self, other, false, out, true) : 0))]);
+}
+
+template<size_t N0, size_t N1, size_t NO>
+constexpr bool ttgt_batch_is_identity(const size_t (&self)[N0], const size_t (&other)[N1], const size_t (&out)[NO],
+    bool free_first, bool own_order, size_t k=0) {
+    return k == N0 ? true : (ttgt_batch_axis(self, other, out, free_first, own_order, k) == k &&
+        ttgt_batch_is_identity(self, other, out, free_first, own_order, k+1));
+}
+
+//! Product of the dimensions of the indices of self whose membership in s0 and s1 is in0 and in1
+template<size_t N, size_t N0, size_t N1>
+constexpr size_t ttgt_product_in(const size_t (&self)[N], const size_t (&dims)[N], const size_t (&s0)[N0], bool in0,
+    const size_t (&s1)[N1], bool in1, size_t cur=0) {
+    return cur == N ? 1 : ((ttgt_find(s0, self[cur]) != N0) == in0 && (ttgt_find(s1, self[cur]) != N1) == in1 ? dims[cur] : 1) *
+        ttgt_product_in(self, dims, s0, in0, s1, in1, cur+1);
+}
+
+template<class Idx0, class Idx1, class IdxO, class Tens0, class Tens1>
+struct batched_contraction_planner {
+    static constexpr bool value = false;
+};
+
+template<size_t ... Idx0, size_t ... Idx1, size_t ... IdxO, typename T, size_t ... Rest0, size_t ... Rest1>
+struct batched_contraction_planner<Index<Idx0...>,Index<Idx1...>,OIndex<IdxO...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>> {
+    static constexpr size_t idx0[sizeof...(Idx0)] = {Idx0...};
+    static constexpr size_t idx1[sizeof...(Idx1)] = {Idx1...};
+    static constexpr size_t idxo[sizeof...(IdxO)] = {IdxO...};
+    static constexpr size_t dims0[sizeof...(Rest0)] = {Rest0...};
+    static constexpr size_t dims1[sizeof...(Rest1)] = {Rest1...};
+
+    static constexpr size_t nbatch = ttgt_count_in(idxo, idx0, true, idx1, true);
+    static constexpr size_t nfree0 = ttgt_count_in(idx0, idx1, false, idxo, true);
+    static constexpr size_t nfree1 = ttgt_count_in(idx1, idx0, false, idxo, true);
+
+    // Applicable when there is a batch index, no index repeats within an operand or the
+    // output and every index that is not shared by the operands is kept in the output
+    static constexpr bool value = nbatch > 0 &&
+                                  no_of_unique<Idx0...>::value == sizeof...(Idx0) &&
+                                  no_of_unique<Idx1...>::value == sizeof...(Idx1) &&
+                                  no_of_unique<IdxO...>::value == sizeof...(IdxO) &&
+                                  sizeof...(Idx0) == sizeof...(Rest0) &&
+                                  sizeof...(Idx1) == sizeof...(Rest1) &&
+                                  ttgt_count_in(idx0, idx1, false, idxo, false) == 0 &&
+                                  ttgt_count_in(idx1, idx0, false, idxo, false) == 0 &&
+                                  nbatch + nfree0 + nfree1 == sizeof...(IdxO);
+
+    // Batch count and GEMM sizes of every batch
+    static constexpr size_t P = ttgt_product_in(idx0, dims0, idx1, true,  idxo, true);
+    static constexpr size_t M = ttgt_product_in(idx0, dims0, idx1, false, idxo, true);
+    static constexpr size_t K = ttgt_product_in(idx0, dims0, idx1, true,  idxo, false);
+    static constexpr size_t N = ttgt_product_in(idx1, dims1, idx0, false, idxo, true);
+
+    static constexpr size_t cost(bool order0) {
+        return sizeof(T)*(
+            (ttgt_batch_is_identity(idx0, idx1, idxo, true,   order0) ? 0 : P*M*K) +
+            (ttgt_batch_is_identity(idx1, idx0, idxo, false, !order0) ? 0 : P*K*N));
+    }
+    static constexpr bool order0 = cost(true) <= cost(false);
+
+    template<class Seq> struct perm0_helper;
+    template<size_t ... ss> struct perm0_helper<std_ext::index_sequence<ss...>> {
+        using type = Index<ttgt_batch_axis(idx0, idx1, idxo, true, order0, ss)...>;
+    };
+    template<class Seq> struct perm1_helper;
+    template<size_t ... ss> struct perm1_helper<std_ext::index_sequence<ss...>> {
+        using type = Index<ttgt_batch_axis(idx1, idx0, idxo, false, !order0, ss)...>;
+    };
+    // Axis of [batch, free_a, free_b] holding the s-th output index
+    static constexpr size_t natural_axis(size_t s) {
+        return ttgt_find(idx1, idxo[s]) != sizeof...(Idx1) && ttgt_find(idx0, idxo[s]) != sizeof...(Idx0) ?
+                    ttgt_count_in(idxo, idx0, true, idx1, true, s) :
+               ttgt_find(idx0, idxo[s]) != sizeof...(Idx0) ?
+                    nbatch + ttgt_count_in(idx0, idx1, false, idxo, true, ttgt_find(idx0, idxo[s])) :
+                    nbatch + nfree0 + ttgt_count_in(idx1, idx0, false, idxo, true, ttgt_find(idx1, idxo[s]));
+    }
+    static constexpr size_t natural_dim(size_t k) {
+        return k < nbatch ? dims0[ttgt_find(idx0, idxo[ttgt_kth_in(idxo, idx0, true, idx1, true, k)])] :
+               k < nbatch + nfree0 ? dims0[ttgt_kth_in(idx0, idx1, false, idxo, true, k - nbatch)] :
+                                     dims1[ttgt_kth_in(idx1, idx0, false, idxo, true, k - nbatch - nfree0)];
+    }
+    template<class Seq> struct out_helper;
+    template<size_t ... ss> struct out_helper<std_ext::index_sequence<ss...>> {
+        using out_perm = Index<natural_axis(ss)...>;
+        using natural_tensor = Tensor<T,natural_dim(ss)...>;
+        using out_tensor = Tensor<T,natural_dim(natural_axis(ss))...>;
+        static constexpr bool requires_out_permutation = !is_sequential(out_perm::values);
+    };
+    using _out_helper = out_helper<typename std_ext::make_index_sequence<sizeof...(IdxO)>::type>;
+
+    using perm0 = typename perm0_helper<typename std_ext::make_index_sequence<sizeof...(Idx0)>::type>::type;
+    using perm1 = typename perm1_helper<typename std_ext::make_index_sequence<sizeof...(Idx1)>::type>::type;
+    using out_perm = typename _out_helper::out_perm;
+    using natural_tensor = typename _out_helper::natural_tensor;
+    using out_tensor = typename _out_helper::out_tensor;
+    static constexpr bool requires_permutation0 = !ttgt_batch_is_identity(idx0, idx1, idxo, true,   order0);
+    static constexpr bool requires_permutation1 = !ttgt_batch_is_identity(idx1, idx0, idxo, false, !order0);
+    static constexpr bool requires_out_permutation = _out_helper::requires_out_permutation;
+};
+
+template<size_t ... Idx0, size_t ... Idx1, size_t ... IdxO, typename T, size_t ... Rest0, size_t ... Rest1>
+constexpr size_t batched_contraction_planner<Index<Idx0...>,Index<Idx1...>,OIndex<IdxO...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::idx0[sizeof...(Idx0)];
+template<size_t ... Idx0, size_t ... Idx1, size_t ... IdxO, typename T, size_t ... Rest0, size_t ... Rest1>
+constexpr size_t batched_contraction_planner<Index<Idx0...>,Index<Idx1...>,OIndex<IdxO...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::idx1[sizeof...(Idx1)];
+template<size_t ... Idx0, size_t ... Idx1, size_t ... IdxO, typename T, size_t ... Rest0, size_t ... Rest1>
+constexpr size_t batched_contraction_planner<Index<Idx0...>,Index<Idx1...>,OIndex<IdxO...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::idxo[sizeof...(IdxO)];
+template<size_t ... Idx0, size_t ... Idx1, size_t ... IdxO, typename T, size_t ... Rest0, size_t ... Rest1>
+constexpr size_t batched_contraction_planner<Index<Idx0...>,Index<Idx1...>,OIndex<IdxO...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::dims0[sizeof...(Rest0)];
+template<size_t ... Idx0, size_t ... Idx1, size_t ... IdxO, typename T, size_t ... Rest0, size_t ... Rest1>
+constexpr size_t batched_contraction_planner<Index<Idx0...>,Index<Idx1...>,OIndex<IdxO...>,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::dims1[sizeof...(Rest1)];
+
+template<class Planner, typename T, size_t ... Rest0, size_t ... Rest1>
+FASTOR_INLINE typename Planner::out_tensor batched_contract(const Tensor<T,Rest0...> &a, const Tensor<T,Rest1...> &b) {
+    constexpr size_t M = Planner::M, K = Planner::K, N = Planner::N;
+    const auto &pa = ttgt_permute<typename Planner::perm0,Planner::requires_permutation0>(a);
+    const auto &pb = ttgt_permute<typename Planner::perm1,Planner::requires_permutation1>(b);
+    typename Planner::natural_tensor out;
+    const T *a_data = pa.data();
+    const T *b_data = pb.data();
+    T *out_data = out.data();
+    for (size_t p=0; p<Planner::P; ++p) {
+        _matmul<T,M,K,N>(a_data+p*M*K,b_data+p*K*N,out_data+p*M*N);
+    }
+    return ttgt_permute<typename Planner::out_perm,Planner::requires_out_permutation>(out);
+}
+
+} // internal
+
+} // end of namespace Fastor
+
+#endif // TTGT_H
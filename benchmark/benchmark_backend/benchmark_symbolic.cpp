@@ -0,0 +1,95 @@
+#include <Fastor/Fastor.h>
+
+using namespace Fastor;
+
+#define NITER 1000000UL
+
+enum {i,j,k,l};
+
+
+// einsum with the dense Levi-Civita tensor / identity
+template<typename T>
+void iterate_over_dense(const Tensor<T,3,3> &a, Tensor<T,3> &out) {
+    const Tensor<T,3,3,3> E = LeviCivita<3>().template dense<T>();
+    for (size_t iter=0; iter<NITER; ++iter) {
+        out += einsum<Index<i,j,k>,Index<j,k>>(E,a);
+        unused(a); unused(out);
+    }
+}
+
+template<typename T, size_t N>
+void iterate_over_dense_delta(const Tensor<T,N,N> &a, Tensor<T,N,N> &out) {
+    const Tensor<T,N,N> I = Delta<N>().template dense<T>();
+    for (size_t iter=0; iter<NITER; ++iter) {
+        out += einsum<Index<i,j>,Index<j,k>>(I,a);
+        unused(a); unused(out);
+    }
+}
+
+// einsum with the symbolic tensors - only the non-zero entries are visited
+template<typename T>
+void iterate_over_symbolic(const Tensor<T,3,3> &a, Tensor<T,3> &out) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        out += einsum<Index<i,j,k>,Index<j,k>>(LeviCivita<3>(),a);
+        unused(a); unused(out);
+    }
+}
+
+template<typename T, size_t N>
+void iterate_over_symbolic_delta(const Tensor<T,N,N> &a, Tensor<T,N,N> &out) {
+    for (size_t iter=0; iter<NITER; ++iter) {
+        out += einsum<Index<i,j>,Index<j,k>>(Delta<N>(),a);
+        unused(a); unused(out);
+    }
+}
+
+
+template<typename T>
+void run_levi_civita() {
+
+    Tensor<T,3,3> a; a.iota(1);
+    Tensor<T,3> out; out.zeros();
+
+    double time_dense, time_symbolic;
+    uint64_t cycles_dense, cycles_symbolic;
+
+    std::tie(time_dense, cycles_dense) = rtimeit(static_cast<void (*)(const Tensor<T,3,3>&, Tensor<T,3>&)>
+        (&iterate_over_dense<T>),a,out);
+    std::tie(time_symbolic, cycles_symbolic) = rtimeit(static_cast<void (*)(const Tensor<T,3,3>&, Tensor<T,3>&)>
+        (&iterate_over_symbolic<T>),a,out);
+    println(FGRN(BOLD("LeviCivita<3> speed-up over dense einsum [elapsed time]")), time_dense/time_symbolic);
+    print();
+}
+
+template<typename T, size_t N>
+void run_delta() {
+
+    Tensor<T,N,N> a; a.iota(1);
+    Tensor<T,N,N> out; out.zeros();
+
+    double time_dense, time_symbolic;
+    uint64_t cycles_dense, cycles_symbolic;
+
+    std::tie(time_dense, cycles_dense) = rtimeit(static_cast<void (*)(const Tensor<T,N,N>&, Tensor<T,N,N>&)>
+        (&iterate_over_dense_delta<T,N>),a,out);
+    std::tie(time_symbolic, cycles_symbolic) = rtimeit(static_cast<void (*)(const Tensor<T,N,N>&, Tensor<T,N,N>&)>
+        (&iterate_over_symbolic_delta<T,N>),a,out);
+    println(FGRN(BOLD("Delta speed-up over dense einsum [N, elapsed time]")), N, time_dense/time_symbolic);
+    print();
+}
+
+
+int main() {
+
+    print(FBLU(BOLD("Running symbolic tensor benchmarks [einsum over the non-zero entries only]")));
+    print(FBLU(BOLD("Single precision:")));
+    run_levi_civita<float>();
+    run_delta<float,3>();
+    run_delta<float,8>();
+    print(FBLU(BOLD("Double precision:")));
+    run_levi_civita<double>();
+    run_delta<double,3>();
+    run_delta<double,8>();
+
+    return 0;
+}
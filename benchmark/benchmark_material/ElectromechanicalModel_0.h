@@ -55,15 +55,15 @@ public:
 
         // FIND ELASTICITY TENSOR
         auto II_ijkl = outer(I,I);
-        auto II_ikjl = permutation<Index<i,k,j,l>>(II_ijkl);
-        auto II_iljk = permutation<Index<i,l,j,k>>(II_ijkl);
+        auto II_ikjl = einsum<Index<i,j>,Index<k,l>,OIndex<i,k,j,l>>(I,I);
+        auto II_iljk = einsum<Index<i,j>,Index<k,l>,OIndex<i,k,l,j>>(I,I);
 
         Tensor<T,ndim,ndim,ndim,ndim> elasticity = lamb*(2.*J-1.)*II_ijkl + (mu/J - lamb*(J-1))*(II_ikjl+II_iljk);
 
         // FIND COUPLING TENSOR
         auto ID_ijk = outer(I,D);
-        auto ID_ikj = permutation<Index<i,k,j>>(ID_ijk);
-        auto ID_jki = permutation<Index<j,k,i>>(ID_ijk);
+        auto ID_ikj = einsum<Index<i,j>,Index<k>,OIndex<i,k,j>>(I,D);
+        auto ID_jki = einsum<Index<i,j>,Index<k>,OIndex<k,i,j>>(I,D);
 
         Tensor<T,ndim,ndim,ndim> coupling =  J/eps_1*(ID_ikj + ID_jki);
 
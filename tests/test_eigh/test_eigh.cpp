@@ -0,0 +1,197 @@
+#include <Fastor/Fastor.h>
+
+using namespace Fastor;
+
+
+#define Tol 1e-12
+#define BigTol 1e-5
+#define HugeTol 1e-2
+
+
+template<typename T, size_t M>
+bool check_eigh(const Tensor<T,M,M> &A, const Tensor<T,M> &w, const Tensor<T,M,M> &V, T tol) {
+    Tensor<T,M,M> D; D.zeros();
+    for (size_t i=0; i<M; ++i) D(i,i) = w(i);
+    Tensor<T,M,M> I; I.eye2();
+    T scale = std::max(T(1),norm(A));
+    bool ok = norm(A - matmul(V,matmul(D,transpose(V)))) < tol*scale;
+    ok = ok && norm(matmul(transpose(V),V) - I) < tol;
+    for (size_t i=1; i<M; ++i) ok = ok && w(i-1) <= w(i);
+    return ok;
+}
+
+template<EigCompType EigType, typename T, size_t M>
+void test_eigh_random() {
+    for (size_t n=0; n<10; ++n) {
+        Tensor<T,M,M> B; B.random();
+        Tensor<T,M,M> A = B + transpose(B);
+        Tensor<T,M> w; Tensor<T,M,M> V;
+        eigh<EigType>(A, w, V);
+        FASTOR_EXIT_ASSERT(check_eigh(A,w,V,T(BigTol)));
+    }
+}
+
+template<typename T>
+void test_eigh() {
+
+    // 2x2
+    {
+        Tensor<T,2,2> A = {{2,1},{1,2}};
+        Tensor<T,2> w; Tensor<T,2,2> V;
+        eigh(A, w, V);
+        FASTOR_EXIT_ASSERT(std::abs(w(0) - 1) < BigTol);
+        FASTOR_EXIT_ASSERT(std::abs(w(1) - 3) < BigTol);
+        FASTOR_EXIT_ASSERT(check_eigh(A,w,V,T(BigTol)));
+
+        Tensor<T,2,2> B = {{5,0},{0,-1}};
+        eigh(B, w, V);
+        FASTOR_EXIT_ASSERT(std::abs(w(0) + 1) < BigTol);
+        FASTOR_EXIT_ASSERT(std::abs(w(1) - 5) < BigTol);
+        FASTOR_EXIT_ASSERT(check_eigh(B,w,V,T(BigTol)));
+
+        eigh(A+B, w, V);
+        FASTOR_EXIT_ASSERT(check_eigh(Tensor<T,2,2>(A+B),w,V,T(BigTol)));
+
+        test_eigh_random<EigCompType::Simple,T,2>();
+        test_eigh_random<EigCompType::Jacobi,T,2>();
+        test_eigh_random<EigCompType::HHQL,T,2>();
+    }
+
+    // 3x3
+    {
+        Tensor<T,3,3> A = {{2,-1,0},{-1,2,-1},{0,-1,2}};
+        Tensor<T,3> w; Tensor<T,3,3> V;
+        eigh(A, w, V);
+        FASTOR_EXIT_ASSERT(std::abs(w(0) - (2-std::sqrt(T(2)))) < BigTol);
+        FASTOR_EXIT_ASSERT(std::abs(w(1) - 2) < BigTol);
+        FASTOR_EXIT_ASSERT(std::abs(w(2) - (2+std::sqrt(T(2)))) < BigTol);
+        FASTOR_EXIT_ASSERT(check_eigh(A,w,V,T(BigTol)));
+
+        eigh(A*2, w, V);
+        FASTOR_EXIT_ASSERT(check_eigh(Tensor<T,3,3>(A*2),w,V,T(BigTol)));
+
+        // diagonal
+        Tensor<T,3,3> D = {{3,0,0},{0,1,0},{0,0,2}};
+        eigh(D, w, V);
+        FASTOR_EXIT_ASSERT(std::abs(w(0) - 1) < BigTol);
+        FASTOR_EXIT_ASSERT(std::abs(w(1) - 2) < BigTol);
+        FASTOR_EXIT_ASSERT(std::abs(w(2) - 3) < BigTol);
+        FASTOR_EXIT_ASSERT(check_eigh(D,w,V,T(BigTol)));
+
+        // multiple of identity
+        Tensor<T,3,3> I; I.eye2();
+        eigh(I*5, w, V);
+        FASTOR_EXIT_ASSERT(std::abs(w(0) - 5) < BigTol && std::abs(w(2) - 5) < BigTol);
+        FASTOR_EXIT_ASSERT(check_eigh(Tensor<T,3,3>(I*5),w,V,T(BigTol)));
+
+        // repeated eigenvalues
+        Tensor<T,3,3> R = {{2,1,1},{1,2,1},{1,1,2}};
+        eigh(R, w, V);
+        FASTOR_EXIT_ASSERT(std::abs(w(0) - 1) < BigTol);
+        FASTOR_EXIT_ASSERT(std::abs(w(1) - 1) < BigTol);
+        FASTOR_EXIT_ASSERT(std::abs(w(2) - 4) < BigTol);
+        FASTOR_EXIT_ASSERT(check_eigh(R,w,V,T(BigTol)));
+
+        // nearly repeated eigenvalues
+        Tensor<T,3,3> N = {{1,0,0},{0,1,0},{0,0,2}}; N(0,1) = N(1,0) = T(1e-7);
+        eigh(N, w, V);
+        FASTOR_EXIT_ASSERT(check_eigh(N,w,V,T(BigTol)));
+
+        // zero
+        Tensor<T,3,3> Z; Z.zeros();
+        eigh(Z, w, V);
+        FASTOR_EXIT_ASSERT(std::abs(w(0)) < Tol && std::abs(w(2)) < Tol);
+        FASTOR_EXIT_ASSERT(check_eigh(Z,w,V,T(BigTol)));
+
+        test_eigh_random<EigCompType::Simple,T,3>();
+        test_eigh_random<EigCompType::Jacobi,T,3>();
+        test_eigh_random<EigCompType::HHQL,T,3>();
+    }
+
+    // NxN
+    {
+        Tensor<T,4,4> A = {{4,1,-2,2},{1,2,0,1},{-2,0,3,-2},{2,1,-2,-1}};
+        Tensor<T,4> w; Tensor<T,4,4> V;
+        eigh(A, w, V);
+        FASTOR_EXIT_ASSERT(check_eigh(A,w,V,T(BigTol)));
+        eigh<EigCompType::Jacobi>(A, w, V);
+        FASTOR_EXIT_ASSERT(check_eigh(A,w,V,T(BigTol)));
+        FASTOR_EXIT_ASSERT(std::abs(sum(w) - trace(A)) < BigTol);
+
+        Tensor<T,6,6> I; I.eye2();
+        Tensor<T,6> w6; Tensor<T,6,6> V6;
+        eigh(I, w6, V6);
+        FASTOR_EXIT_ASSERT(check_eigh(I,w6,V6,T(BigTol)));
+
+        test_eigh_random<EigCompType::Simple,T,4>();
+        test_eigh_random<EigCompType::Jacobi,T,5>();
+        test_eigh_random<EigCompType::HHQL,T,6>();
+        test_eigh_random<EigCompType::Jacobi,T,8>();
+        test_eigh_random<EigCompType::HHQL,T,8>();
+    }
+
+    // batch
+    {
+        Tensor<T,7,3,3> A;
+        for (size_t i=0; i<7; ++i) {
+            Tensor<T,3,3> B; B.random();
+            A(i,all,all) = B + transpose(B);
+        }
+        // degenerate lanes
+        A(2,all,all) = 0;
+        A(3,all,all) = 0; A(3,0,0) = 1; A(3,1,1) = 1; A(3,2,2) = 1;
+
+        Tensor<T,7,3> w; Tensor<T,7,3,3> V;
+        eigh(A, w, V);
+        for (size_t i=0; i<7; ++i) {
+            Tensor<T,3,3> Ai = A(i,all,all);
+            Tensor<T,3> wi = w(i,all);
+            Tensor<T,3,3> Vi = V(i,all,all);
+            FASTOR_EXIT_ASSERT(check_eigh(Ai,wi,Vi,T(BigTol)));
+        }
+
+        Tensor<T,2,3,2,2> A2;
+        A2.random();
+        for (size_t i=0; i<2; ++i)
+            for (size_t j=0; j<3; ++j)
+                A2(i,j,0,1) = A2(i,j,1,0);
+        Tensor<T,2,3,2> w2; Tensor<T,2,3,2,2> V2;
+        eigh(A2, w2, V2);
+        for (size_t i=0; i<2; ++i) {
+            for (size_t j=0; j<3; ++j) {
+                Tensor<T,2,2> Ai = A2(i,j,all,all);
+                Tensor<T,2> wi = w2(i,j,all);
+                Tensor<T,2,2> Vi = V2(i,j,all,all);
+                FASTOR_EXIT_ASSERT(check_eigh(Ai,wi,Vi,T(BigTol)));
+            }
+        }
+
+        Tensor<T,3,5,5> A5;
+        A5.random();
+        for (size_t i=0; i<3; ++i)
+            for (size_t j=0; j<5; ++j)
+                for (size_t k=0; k<j; ++k)
+                    A5(i,j,k) = A5(i,k,j);
+        Tensor<T,3,5> w5; Tensor<T,3,5,5> V5;
+        eigh<EigCompType::HHQL>(A5, w5, V5);
+        for (size_t i=0; i<3; ++i) {
+            Tensor<T,5,5> Ai = A5(i,all,all);
+            Tensor<T,5> wi = w5(i,all);
+            Tensor<T,5,5> Vi = V5(i,all,all);
+            FASTOR_EXIT_ASSERT(check_eigh(Ai,wi,Vi,T(BigTol)));
+        }
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+
+}
+
+int main() {
+
+    print(FBLU(BOLD("Testing symmetric eigen-decomposition: single precision")));
+    test_eigh<float>();
+    print(FBLU(BOLD("Testing symmetric eigen-decomposition: double precision")));
+    test_eigh<double>();
+
+    return 0;
+}
@@ -0,0 +1,111 @@
+#include <Fastor/Fastor.h>
+
+using namespace Fastor;
+
+
+#define Tol 1e-12
+#define BigTol 1e-5
+
+
+template<typename T>
+void test_permuted_outer(T tol) {
+
+    enum {i,j,k,l,m};
+
+    // outer products written in permuted order
+    {
+        Tensor<T,3,3> I; I.random();
+        Tensor<T,3> D; D.random();
+
+        Tensor<T,3,3,3,3> II = outer(I,I);
+        Tensor<T,3,3,3,3> II_ikjl = outer<Index<0,2,1,3>>(I,I);
+        Tensor<T,3,3,3,3> II_ikjl_ref = permute<Index<0,2,1,3>>(II);
+        FASTOR_EXIT_ASSERT(norm(II_ikjl - II_ikjl_ref) < tol*norm(II));
+        Tensor<T,3,3,3,3> II_iljk = outer<Index<0,2,3,1>>(I,I);
+        Tensor<T,3,3,3,3> II_iljk_ref = permutation<Index<i,l,j,k>>(II);
+        FASTOR_EXIT_ASSERT(norm(II_iljk - II_iljk_ref) < tol*norm(II));
+
+        Tensor<T,3,3,3> ID = outer(I,D);
+        Tensor<T,3,3,3> ID_ikj = outer<Index<0,2,1>>(I,D);
+        Tensor<T,3,3,3> ID_ikj_ref = permutation<Index<i,k,j>>(ID);
+        FASTOR_EXIT_ASSERT(norm(ID_ikj - ID_ikj_ref) < tol*norm(ID));
+        Tensor<T,3,3,3> ID_jki = outer<Index<2,0,1>>(I,D);
+        Tensor<T,3,3,3> ID_jki_ref = permutation<Index<j,k,i>>(ID);
+        FASTOR_EXIT_ASSERT(norm(ID_jki - ID_jki_ref) < tol*norm(ID));
+
+        // no permutation
+        Tensor<T,3,3,3> ID_ijk = outer<Index<0,1,2>>(I,D);
+        FASTOR_EXIT_ASSERT(norm(ID_ijk - ID) < tol*norm(ID));
+    }
+
+    // non-square operands and expressions
+    {
+        Tensor<T,2,3> a; a.random();
+        Tensor<T,4,5> b; b.random();
+        Tensor<T,5,2,3,4> c = outer<Index<3,0,1,2>>(a,b);
+        Tensor<T,5,2,3,4> c_ref = permute<Index<3,0,1,2>>(outer(a,b));
+        FASTOR_EXIT_ASSERT(norm(c - c_ref) < tol*norm(c_ref));
+
+        Tensor<T,3,4,2,5> d = outer<Index<1,2,0,3>>(T(2)*a,b+b);
+        Tensor<T,3,4,2,5> d_ref = permute<Index<1,2,0,3>>(outer(a,b));
+        FASTOR_EXIT_ASSERT(norm(d - T(4)*d_ref) < tol*norm(d));
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+
+template<typename T>
+void test_fused_einsum(T tol) {
+
+    enum {i,j,k,l,m};
+
+    // explicit output index for outer products
+    {
+        Tensor<T,3,3> I; I.random();
+        Tensor<T,3> D; D.random();
+        Tensor<T,4,2> a; a.random();
+
+        Tensor<T,3,3,3,3> II_ikjl = einsum<Index<i,j>,Index<k,l>,OIndex<i,k,j,l>>(I,I);
+        Tensor<T,3,3,3,3> II_ikjl_ref = permutation<Index<i,k,j,l>>(outer(I,I));
+        FASTOR_EXIT_ASSERT(norm(II_ikjl - II_ikjl_ref) < tol*norm(II_ikjl_ref));
+        Tensor<T,3,3,3,3> II_iljk = einsum<Index<i,j>,Index<k,l>,OIndex<i,k,l,j>>(I,I);
+        Tensor<T,3,3,3,3> II_iljk_ref = permutation<Index<i,l,j,k>>(outer(I,I));
+        FASTOR_EXIT_ASSERT(norm(II_iljk - II_iljk_ref) < tol*norm(II_iljk_ref));
+
+        Tensor<T,3,3,3> ID_jki = einsum<Index<i,j>,Index<k>,OIndex<k,i,j>>(I,D);
+        Tensor<T,3,3,3> ID_jki_ref = permutation<Index<j,k,i>>(outer(I,D));
+        FASTOR_EXIT_ASSERT(norm(ID_jki - ID_jki_ref) < tol*norm(ID_jki_ref));
+
+        auto aD = einsum<Index<i,j>,Index<k>,OIndex<j,k,i>>(a,D);
+        static_assert(std::is_same<decltype(aD),Tensor<T,2,3,4>>::value, "");
+        Tensor<T,2,3,4> aD_ref = permute<Index<1,2,0>>(outer(a,D));
+        FASTOR_EXIT_ASSERT(norm(aD - aD_ref) < tol*norm(aD_ref));
+    }
+
+#if FASTOR_CXX_VERSION >= 2017
+    // contractions with a permuted output are unaffected
+    {
+        Tensor<T,3,4,5> a; a.random();
+        Tensor<T,4,2> b; b.random();
+        Tensor<T,2,5,3> c = einsum<Index<i,j,k>,Index<j,l>,OIndex<l,k,i>>(a,b);
+        Tensor<T,2,5,3> c_ref = permute<Index<2,1,0>>(einsum<Index<i,j,k>,Index<j,l>>(a,b));
+        FASTOR_EXIT_ASSERT(norm(c - c_ref) < tol*norm(c_ref));
+    }
+#endif
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+
+int main() {
+
+    print(FBLU(BOLD("Testing permuted outer products: single precision")));
+    test_permuted_outer<float>(BigTol);
+    test_fused_einsum<float>(BigTol);
+    print(FBLU(BOLD("Testing permuted outer products: double precision")));
+    test_permuted_outer<double>(Tol);
+    test_fused_einsum<double>(Tol);
+
+    return 0;
+}
@@ -0,0 +1,201 @@
+#include <Fastor/Fastor.h>
+
+using namespace Fastor;
+
+
+#define Tol 1e-12
+#define BigTol 1e-5
+
+
+template<typename T>
+void test_lazy_einsum_pair(T tol) {
+
+    enum {i,j,k,l,m};
+
+    // single GEMM
+    {
+        Tensor<T,3,4,5> a; a.random();
+        Tensor<T,5,7> b; b.random();
+        using expr_type = decltype(lazy_einsum<Index<i,j,k>,Index<k,l>>(a,b));
+        static_assert(is_einsum_op_v<expr_type>, "");
+        static_assert(requires_evaluation_v<expr_type>, "");
+
+        const Tensor<T,3,4,7> ab = einsum<Index<i,j,k>,Index<k,l>>(a,b);
+        Tensor<T,3,4,7> c; c.random();
+        const Tensor<T,3,4,7> c0 = c;
+
+        Tensor<T,3,4,7> d = lazy_einsum<Index<i,j,k>,Index<k,l>>(a,b);
+        FASTOR_EXIT_ASSERT(norm(d - ab) < tol*norm(ab));
+
+        c += lazy_einsum<Index<i,j,k>,Index<k,l>>(a,b);
+        FASTOR_EXIT_ASSERT(norm(c - (c0 + ab)) < tol*norm(ab));
+        c = c0;
+        c -= lazy_einsum<Index<i,j,k>,Index<k,l>>(a,b);
+        FASTOR_EXIT_ASSERT(norm(c - (c0 - ab)) < tol*norm(ab));
+        c = c0;
+        c *= lazy_einsum<Index<i,j,k>,Index<k,l>>(a,b);
+        FASTOR_EXIT_ASSERT(norm(c - c0*ab) < tol*norm(ab));
+        c = c0;
+        c /= lazy_einsum<Index<i,j,k>,Index<k,l>>(a,b);
+        FASTOR_EXIT_ASSERT(norm(c - c0/ab) < tol*norm(c));
+
+        // evaluated in the epilogue of the contraction
+        c = T(2)*lazy_einsum<Index<i,j,k>,Index<k,l>>(a,b) - T(0.5)*c0;
+        FASTOR_EXIT_ASSERT(norm(c - (T(2)*ab - T(0.5)*c0)) < tol*norm(ab));
+        d = tanh(lazy_einsum<Index<i,j,k>,Index<k,l>>(a,b));
+        FASTOR_EXIT_ASSERT(norm(d - tanh(ab)) < tol*norm(ab));
+
+        // two contractions, the second one accumulated into the first
+        d = lazy_einsum<Index<i,j,k>,Index<k,l>>(a,b) + lazy_einsum<Index<i,j,k>,Index<k,l>>(a,b);
+        FASTOR_EXIT_ASSERT(norm(d - T(2)*ab) < tol*norm(ab));
+        // and anything else element-wise
+        d = sqrt(abs(lazy_einsum<Index<i,j,k>,Index<k,l>>(a,b))) + c0;
+        FASTOR_EXIT_ASSERT(norm(d - (sqrt(abs(ab)) + c0)) < tol*norm(ab));
+    }
+
+    // matrix-vector, vector-matrix and permuted contractions
+    {
+        Tensor<T,3,4,5> a; a.random();
+        Tensor<T,5> v; v.random();
+        Tensor<T,3> w; w.random();
+        Tensor<T,4,6> b; b.random();
+
+        Tensor<T,3,4> av = lazy_einsum<Index<i,j,k>,Index<k>>(a,v);
+        Tensor<T,3,4> av_ref = einsum<Index<i,j,k>,Index<k>>(a,v);
+        FASTOR_EXIT_ASSERT(norm(av - av_ref) < tol*norm(av_ref));
+
+        Tensor<T,4,5> wa = lazy_einsum<Index<i>,Index<i,j,k>>(w,a);
+        Tensor<T,4,5> wa_ref = einsum<Index<i>,Index<i,j,k>>(w,a);
+        FASTOR_EXIT_ASSERT(norm(wa - wa_ref) < tol*norm(wa_ref));
+
+        Tensor<T,3,5,6> ab = lazy_einsum<Index<i,j,k>,Index<j,l>>(a,b);
+        Tensor<T,3,5,6> ab_ref = einsum<Index<i,j,k>,Index<j,l>>(a,b);
+        FASTOR_EXIT_ASSERT(norm(ab - ab_ref) < tol*norm(ab_ref));
+        ab += lazy_einsum<Index<i,j,k>,Index<j,l>>(a,b);
+        FASTOR_EXIT_ASSERT(norm(ab - T(2)*ab_ref) < tol*norm(ab_ref));
+    }
+
+    // operands that are expressions or the tensor assigned to
+    {
+        Tensor<T,6,6> a; a.random();
+        Tensor<T,6,6> b; b.random();
+        const Tensor<T,6,6> a0 = a;
+        const Tensor<T,6,6> ref = einsum<Index<i,j>,Index<j,k>>(Tensor<T,6,6>(transpose(a0)),b);
+
+        Tensor<T,6,6> d = lazy_einsum<Index<i,j>,Index<j,k>>(transpose(a),b);
+        FASTOR_EXIT_ASSERT(norm(d - ref) < tol*norm(ref));
+
+        a = lazy_einsum<Index<i,j>,Index<j,k>>(a,b);
+        FASTOR_EXIT_ASSERT(norm(a - einsum<Index<i,j>,Index<j,k>>(a0,b)) < tol*norm(a));
+        a = a0;
+        a += lazy_einsum<Index<i,j>,Index<j,k>>(b,a);
+        FASTOR_EXIT_ASSERT(norm(a - (a0 + einsum<Index<i,j>,Index<j,k>>(b,a0))) < tol*norm(a));
+    }
+
+    // assigned to a view
+    {
+        Tensor<T,4,4> a; a.random();
+        Tensor<T,4,4> b; b.random();
+        Tensor<T,8,8> d; d.zeros();
+        d(fseq<0,4>(),fseq<4,8>()) = lazy_einsum<Index<i,j>,Index<j,k>>(a,b);
+        Tensor<T,4,4> block = d(fseq<0,4>(),fseq<4,8>());
+        Tensor<T,4,4> ref = einsum<Index<i,j>,Index<j,k>>(a,b);
+        FASTOR_EXIT_ASSERT(norm(block - ref) < tol*norm(ref));
+    }
+}
+
+template<typename T>
+void test_lazy_einsum_network(T tol) {
+
+    enum {i,j,k,l,m,n};
+
+    // networks of three and four tensors
+    {
+        Tensor<T,3,4> a; a.random();
+        Tensor<T,4,5> b; b.random();
+        Tensor<T,5,8> c; c.random();
+        Tensor<T,8,2> e; e.random();
+        using expr_type = decltype(lazy_einsum<Index<i,j>,Index<j,k>,Index<k,l>>(a,b,c));
+        static_assert(is_einsum_op_v<expr_type>, "");
+
+        const Tensor<T,3,8> abc = einsum<Index<i,j>,Index<j,k>,Index<k,l>>(a,b,c);
+        Tensor<T,3,8> d = lazy_einsum<Index<i,j>,Index<j,k>,Index<k,l>>(a,b,c);
+        FASTOR_EXIT_ASSERT(norm(d - abc) < tol*norm(abc));
+        d -= lazy_einsum<Index<i,j>,Index<j,k>,Index<k,l>>(a,b,c);
+        FASTOR_EXIT_ASSERT(norm(d) < tol*norm(abc));
+        d = T(3)*lazy_einsum<Index<i,j>,Index<j,k>,Index<k,l>>(a,b,c) + abc;
+        FASTOR_EXIT_ASSERT(norm(d - T(4)*abc) < tol*norm(abc));
+
+        Tensor<T,3,2> d4 = lazy_einsum<Index<i,j>,Index<j,k>,Index<k,l>,Index<l,m>>(a,b,c,e);
+        Tensor<T,3,2> d4_ref = einsum<Index<i,j>,Index<j,k>,Index<k,l>,Index<l,m>>(a,b,c,e);
+        FASTOR_EXIT_ASSERT(norm(d4 - d4_ref) < tol*norm(d4_ref));
+    }
+
+    // chained by-pair einsums are spliced into one network, also when the indices the
+    // inner einsums are given differ from the ones they use themselves
+    {
+        Tensor<T,3,4> a; a.random();
+        Tensor<T,4,5> b; b.random();
+        Tensor<T,5,8> c; c.random();
+        Tensor<T,8,2> e; e.random();
+
+        auto ab = lazy_einsum<Index<i,j>,Index<j,k>>(a,b);
+        auto chain = lazy_einsum<Index<m,n>,Index<n,l>>(ab,c);
+        static_assert(std::is_same<decltype(chain),
+            NetworkEinsumOp<std::tuple<Index<m,7>,Index<7,n>,Index<n,l>>,
+                            std::tuple<Tensor<T,3,4>,Tensor<T,4,5>,Tensor<T,5,8>>,2>>::value, "");
+
+        const Tensor<T,3,8> abc = einsum<Index<i,j>,Index<j,k>,Index<k,l>>(a,b,c);
+        Tensor<T,3,8> d = chain;
+        FASTOR_EXIT_ASSERT(norm(d - abc) < tol*norm(abc));
+
+        // ((ab)c)e and (ab)(ce)
+        Tensor<T,3,2> d4 = lazy_einsum<Index<i,k>,Index<k,m>>(lazy_einsum<Index<i,k>,Index<k,l>>(ab,c),e);
+        Tensor<T,3,2> d4_ref = einsum<Index<i,j>,Index<j,k>,Index<k,l>,Index<l,m>>(a,b,c,e);
+        FASTOR_EXIT_ASSERT(norm(d4 - d4_ref) < tol*norm(d4_ref));
+        d4 = lazy_einsum<Index<i,k>,Index<k,m>>(ab,lazy_einsum<Index<i,j>,Index<j,k>>(c,e));
+        FASTOR_EXIT_ASSERT(norm(d4 - d4_ref) < tol*norm(d4_ref));
+
+        // the result of the inner einsum contracted along its first index
+        Tensor<T,3,8> x; x.random();
+        Tensor<T,5,8> abx = lazy_einsum<Index<n,m>,Index<n,l>>(ab,x);
+        Tensor<T,5,8> abx_ref = einsum<Index<n,m>,Index<n,l>>(Tensor<T,3,5>(einsum<Index<i,j>,Index<j,k>>(a,b)),x);
+        FASTOR_EXIT_ASSERT(norm(abx - abx_ref) < tol*norm(abx_ref));
+    }
+
+    // a network whose result is permuted at the end and a network with the result as operand
+    {
+        Tensor<T,3,4> a; a.random();
+        Tensor<T,4,5,2> b; b.random();
+        Tensor<T,2,6> c; c.random();
+        Tensor<T,3,5,6> d = lazy_einsum<Index<i,j>,Index<j,k,l>,Index<l,m>>(a,b,c);
+        Tensor<T,3,5,6> d_ref = einsum<Index<i,j>,Index<j,k,l>,Index<l,m>>(a,b,c);
+        FASTOR_EXIT_ASSERT(norm(d - d_ref) < tol*norm(d_ref));
+
+        Tensor<T,4,4> s; s.random();
+        Tensor<T,4,4> t; t.random();
+        Tensor<T,4,4> u; u.random();
+        const Tensor<T,4,4> s0 = s;
+        s = lazy_einsum<Index<i,j>,Index<j,k>,Index<k,l>>(t,s,u);
+        Tensor<T,4,4> s_ref = einsum<Index<i,j>,Index<j,k>,Index<k,l>>(t,s0,u);
+        FASTOR_EXIT_ASSERT(norm(s - s_ref) < tol*norm(s_ref));
+    }
+}
+
+
+template<typename T>
+void run(T tol) {
+    test_lazy_einsum_pair<T>(tol);
+    test_lazy_einsum_network<T>(tol);
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+int main() {
+
+    print(FBLU(BOLD("Testing lazy einsum: single precision")));
+    run<float>(BigTol);
+    print(FBLU(BOLD("Testing lazy einsum: double precision")));
+    run<double>(Tol);
+
+    return 0;
+}
@@ -0,0 +1,99 @@
+#include <Fastor/Fastor.h>
+
+using namespace Fastor;
+
+
+#define Tol 1e-12
+#define BigTol 1e-5
+#define HugeTol 1e-2
+
+
+template<typename T>
+void test_nested_loop() {
+
+    enum {i,j,k,l,m};
+
+    // innermost loop selection
+    {
+        // <ijk,kl> - l is contiguous in b and the output
+        using e0 = internal::nested_loop_contraction<Index<i,j,k>,Index<k,l>,Index<i,j,l>,
+            Tensor<T,2,3,4>,Tensor<T,4,5>,Tensor<T,2,3,5>>;
+        static_assert(e0::mode == 1 && e0::loop_at(e0::nloops-1) == 3, "INCORRECT INNERMOST LOOP");
+        // <ij,i> - j is contiguous in a and the output
+        using e1 = internal::nested_loop_contraction<Index<i,j>,Index<i>,Index<j>,
+            Tensor<T,3,4>,Tensor<T,3>,Tensor<T,4>>;
+        static_assert(e1::mode == 2, "INCORRECT INNERMOST LOOP");
+        // <ij,j> - j is contiguous in a and b and summed
+        using e2 = internal::nested_loop_contraction<Index<i,j>,Index<j>,Index<i>,
+            Tensor<T,3,4>,Tensor<T,4>,Tensor<T,3>>;
+        static_assert(e2::mode == 3, "INCORRECT INNERMOST LOOP");
+        // <iij,jk> - the trace accumulates the strides of both positions of i
+        using e3 = internal::nested_loop_contraction<Index<i,i,j>,Index<j,k>,Index<k>,
+            Tensor<T,3,3,2>,Tensor<T,2,5>,Tensor<T,5>>;
+        static_assert(e3::_strides::a[0] == 8, "INCORRECT STRIDES");
+    }
+
+    // dimensions that are not a multiple of the SIMD width
+    {
+        Tensor<T,3,5,7> A; A.random();
+        Tensor<T,7,5,6> B; B.random();
+        auto C = extractor_contract_2<Index<i,j,k>,Index<k,j,l>>::contract_impl(A,B);
+        for (size_t p=0; p<3; ++p)
+            for (size_t q=0; q<6; ++q) {
+                T ref = 0;
+                for (size_t s=0; s<5; ++s)
+                    for (size_t t=0; t<7; ++t) ref += A(p,s,t)*B(t,s,q);
+                FASTOR_EXIT_ASSERT(std::abs(C(p,q) - ref) < BigTol);
+            }
+    }
+
+    // matrix-vector, vector-matrix and full reduction
+    {
+        Tensor<T,3,13> A; A.random();
+        Tensor<T,13> b; b.random();
+        Tensor<T,3> c; c.random();
+        auto Ab = extractor_contract_2<Index<i,j>,Index<j>>::contract_impl(A,b);
+        auto cA = extractor_contract_2<Index<i>,Index<i,j>>::contract_impl(c,A);
+        auto AA = extractor_contract_2<Index<i,j>,Index<i,j>>::contract_impl(A,A);
+        T ref_AA = 0;
+        for (size_t p=0; p<3; ++p) {
+            T ref = 0;
+            for (size_t s=0; s<13; ++s) {
+                ref += A(p,s)*b(s);
+                ref_AA += A(p,s)*A(p,s);
+            }
+            FASTOR_EXIT_ASSERT(std::abs(Ab(p) - ref) < BigTol);
+        }
+        for (size_t s=0; s<13; ++s) {
+            T ref = 0;
+            for (size_t p=0; p<3; ++p) ref += c(p)*A(p,s);
+            FASTOR_EXIT_ASSERT(std::abs(cA(s) - ref) < BigTol);
+        }
+        FASTOR_EXIT_ASSERT(std::abs(AA.toscalar() - ref_AA) < HugeTol);
+    }
+
+    // trace within an operand
+    {
+        Tensor<T,5,5,3> A; A.random();
+        Tensor<T,3,11> B; B.random();
+        auto C = extractor_contract_2<Index<i,i,j>,Index<j,k>>::contract_impl(A,B);
+        for (size_t q=0; q<11; ++q) {
+            T ref = 0;
+            for (size_t s=0; s<5; ++s)
+                for (size_t t=0; t<3; ++t) ref += A(s,s,t)*B(t,q);
+            FASTOR_EXIT_ASSERT(std::abs(C(q) - ref) < BigTol);
+        }
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+int main() {
+
+    print(FBLU(BOLD("Testing nested loop contractions: single precision")));
+    test_nested_loop<float>();
+    print(FBLU(BOLD("Testing nested loop contractions: double precision")));
+    test_nested_loop<double>();
+
+    return 0;
+}
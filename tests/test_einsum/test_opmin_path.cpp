@@ -0,0 +1,258 @@
+#include <Fastor/Fastor.h>
+
+using namespace Fastor;
+
+
+#define Tol 1e-12
+#define BigTol 1e-5
+#define HugeTol 1e-2
+
+
+/* chain of matrices A_0 ... A_{n-1} with A_k of size dims[k] x dims[k+1] */
+static internal::opmin_path chain_path(const std::vector<size_t> &dims, double max_intermediate) {
+    const size_t n = dims.size()-1;
+    std::vector<uint64_t> operands(n);
+    std::vector<double> id_dims(dims.begin(),dims.end());
+    for (size_t k=0; k<n; ++k) operands[k] = (uint64_t(1) << k) | (uint64_t(1) << (k+1));
+    const uint64_t output = (uint64_t(1) << 0) | (uint64_t(1) << n);
+    return internal::opmin_contraction_path(operands,output,id_dims.data(),dims.size(),max_intermediate);
+}
+
+void test_paths() {
+
+    // matrix chain [10x30][30x5][5x60]: (AB)C costs 1500+3000, A(BC) costs 9000+18000
+    {
+        auto path = chain_path({10,30,5,60},0);
+        FASTOR_EXIT_ASSERT(path.steps.size() == 2);
+        FASTOR_EXIT_ASSERT(path.steps[0].first == 0 && path.steps[0].second == 1);
+        FASTOR_EXIT_ASSERT(path.steps[1].first == 3 && path.steps[1].second == 2);
+        FASTOR_EXIT_ASSERT(std::abs(path.flops - 4500) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(path.peak - 50) < Tol);
+    }
+
+    // the exact order is never worse than the greedy one
+    {
+        const std::vector<size_t> dims = {30,35,15,5,10,20,25,7,40,3,12};
+        auto exact = chain_path(dims,0);
+        std::vector<uint64_t> operands(dims.size()-1);
+        std::vector<double> id_dims(dims.begin(),dims.end());
+        for (size_t k=0; k<operands.size(); ++k) operands[k] = (uint64_t(1) << k) | (uint64_t(1) << (k+1));
+        auto greedy = internal::opmin_greedy_path(operands,(uint64_t(1) << 0) | (uint64_t(1) << operands.size()),
+            id_dims.data(),dims.size(),0);
+        FASTOR_EXIT_ASSERT(exact.steps.size() == operands.size()-1 && greedy.steps.size() == operands.size()-1);
+        FASTOR_EXIT_ASSERT(exact.flops <= greedy.flops);
+    }
+
+    // an intermediate limit trades flops for memory
+    {
+        // [4x100][100x100][100x4]: contracting the middle matrix first is never cheaper but
+        // both orders go through a 4x100 intermediate
+        auto free_path = chain_path({4,100,100,4},0);
+        auto limited = chain_path({4,100,100,4},400);
+        FASTOR_EXIT_ASSERT(limited.within_limit && limited.peak <= 400);
+        FASTOR_EXIT_ASSERT(std::abs(free_path.flops - limited.flops) < Tol);
+
+        // [2x50][50x2][2x50][50x2] is cheapest as (AB)(CD) whose intermediates are 2x2, the
+        // limit rules out ((AB)C)D and its 2x50 intermediate
+        auto tight = chain_path({2,50,2,50,2},4);
+        FASTOR_EXIT_ASSERT(tight.within_limit && tight.peak <= 4);
+        // no order fits a limit below the smallest intermediate, the unconstrained one is returned
+        auto impossible = chain_path({2,50,2,50,2},1);
+        FASTOR_EXIT_ASSERT(!impossible.within_limit && std::abs(impossible.flops - tight.flops) < Tol);
+    }
+
+    // compile time order of a static network
+    {
+        enum {i,j,k,l};
+        using path = internal::opmin_network_path<Index<2,2,2>,Index<i,j,j,k,k,l>,Index<10,30,30,5,5,60>>;
+        static_assert(path::split(path::root) == 3, "(AB)C EXPECTED");
+        FASTOR_EXIT_ASSERT(std::abs(path::plan.flops[path::root] - 4500) < Tol);
+    }
+
+    // objectives on [3x2][2x5][5x3][3x5]: A((BC)D) needs 90 flops and a 2x5 intermediate,
+    // (A(BC))D needs 93 flops but no intermediate above 3x3
+    {
+        enum {i,j,k,l,m};
+        using labels = Index<i,j,j,k,k,l,l,m>;
+        using dims = Index<3,2,2,5,5,3,3,5>;
+        using by_flops    = internal::opmin_network_path<Index<2,2,2,2>,labels,dims,0,FASTOR_OPMIN_FLOPS>;
+        using by_memory   = internal::opmin_network_path<Index<2,2,2,2>,labels,dims,0,FASTOR_OPMIN_MEMORY>;
+        using by_weighted = internal::opmin_network_path<Index<2,2,2,2>,labels,dims,0,FASTOR_OPMIN_WEIGHTED>;
+        FASTOR_EXIT_ASSERT(std::abs(by_flops::plan.flops[by_flops::root] - 90) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(by_flops::plan.peak[by_flops::root] - 10) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(by_memory::plan.flops[by_memory::root] - 93) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(by_memory::plan.peak[by_memory::root] - 9) < Tol);
+        constexpr size_t root = by_weighted::root;
+        const double weighted = by_weighted::plan.flops[root] + FASTOR_OPMIN_MEMORY_WEIGHT*by_weighted::plan.written[root];
+        FASTOR_EXIT_ASSERT(weighted <= by_flops::plan.flops[root] + FASTOR_OPMIN_MEMORY_WEIGHT*by_flops::plan.written[root]);
+        FASTOR_EXIT_ASSERT(weighted <= by_memory::plan.flops[root] + FASTOR_OPMIN_MEMORY_WEIGHT*by_memory::plan.written[root]);
+
+        // the same choice at runtime
+        const std::vector<uint64_t> operands = {0b00011,0b00110,0b01100,0b11000};
+        const double id_dims[5] = {3,2,5,3,5};
+        auto runtime = internal::opmin_contraction_path(operands,0b10001,id_dims,5,0,FASTOR_OPMIN_MEMORY);
+        FASTOR_EXIT_ASSERT(std::abs(runtime.flops - 93) < Tol && std::abs(runtime.peak - 9) < Tol);
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+
+template<typename T>
+void test_networks() {
+
+    enum {a,b,c,d,e,f,g,h,i,j};
+
+    // seven tensor chain against a left to right contraction
+    {
+        Tensor<T,2,3> A; A.random();
+        Tensor<T,3,40> B; B.random();
+        Tensor<T,40,5> C; C.random();
+        Tensor<T,5,2> D; D.random();
+        Tensor<T,2,30> E; E.random();
+        Tensor<T,30,4> F; F.random();
+        Tensor<T,4,6> G; G.random();
+
+        auto res = einsum<Index<a,b>,Index<b,c>,Index<c,d>,Index<d,e>,Index<e,f>,Index<f,g>,Index<g,h>>(A,B,C,D,E,F,G);
+        auto ref = matmul(matmul(matmul(matmul(matmul(matmul(A,B),C),D),E),F),G);
+        FASTOR_EXIT_ASSERT(norm(res - ref) < BigTol*norm(ref));
+    }
+
+    // eight tensor tree whose free indices come out of order
+    {
+        Tensor<T,2,4> X; X.random();
+        Tensor<T,4,5,6> Y; Y.random();
+        Tensor<T,6,7> Z; Z.random();
+        Tensor<T,7,2> W; W.random();
+        Tensor<T,2,8> U; U.random();
+        Tensor<T,8,3> V; V.random();
+        Tensor<T,5,9> Q; Q.random();
+        Tensor<T,9,4> R; R.random();
+
+        auto res = einsum<Index<a,b>,Index<b,c,d>,Index<d,e>,Index<e,f>,Index<f,g>,Index<g,h>,Index<c,i>,Index<i,j>>(X,Y,Z,W,U,V,Q,R);
+        FASTOR_EXIT_ASSERT(res.dimension(0) == 2 && res.dimension(1) == 3 && res.dimension(2) == 4);
+
+        auto XY = einsum<Index<a,b>,Index<b,c,d>>(X,Y);
+        auto ZWUV = matmul(matmul(matmul(Z,W),U),V);
+        auto QR = matmul(Q,R);
+        auto left = einsum<Index<a,c,d>,Index<d,h>>(XY,ZWUV);
+        auto ref = einsum<Index<a,c,h>,Index<c,j>>(left,QR);
+        FASTOR_EXIT_ASSERT(norm(res - ref) < BigTol*norm(ref));
+    }
+
+    // four tensors whose cheapest order does not keep the free indices in place
+    {
+        Tensor<T,3,4> A; A.random();
+        Tensor<T,4,5,6> B; B.random();
+        Tensor<T,6,7> C; C.random();
+        Tensor<T,5,2> D; D.random();
+        auto res = einsum<Index<a,b>,Index<b,c,d>,Index<d,e>,Index<c,f>>(A,B,C,D);
+        auto AB = einsum<Index<a,b>,Index<b,c,d>>(A,B);
+        auto ABC = einsum<Index<a,c,d>,Index<d,e>>(AB,C);
+        auto ref = einsum<Index<a,c,e>,Index<c,f>>(ABC,D);
+        FASTOR_EXIT_ASSERT(norm(res - ref) < BigTol*norm(ref));
+
+        using network = network_path_contraction<std::tuple<Index<a,b>,Index<b,c,d>,Index<d,e>,Index<c,f>>,
+            std::tuple<Tensor<T,3,4>,Tensor<T,4,5,6>,Tensor<T,6,7>,Tensor<T,5,2>>>;
+        FASTOR_EXIT_ASSERT(network::flops == size_t(network::path::plan.flops[network::path::root]));
+        FASTOR_EXIT_ASSERT(network::peak_bytes == size_t(network::path::plan.peak[network::path::root])*sizeof(T));
+    }
+
+    // runtime networks
+    {
+        Tensor<T,3,4> A; A.random();
+        Tensor<T,4,5,6> B; B.random();
+        Tensor<T,6,7> C; C.random();
+        Tensor<T,5,2> D; D.random();
+        auto ref = einsum<Index<a,b>,Index<b,c,d>,Index<d,e>,Index<c,f>>(A,B,C,D);
+
+        const std::vector<std::vector<size_t>> shapes = {{3,4},{4,5,6},{6,7},{5,2}};
+        const std::vector<size_t> shape_out = einsum_shape("ab,bcd,de,cf->aef",shapes);
+        FASTOR_EXIT_ASSERT(shape_out.size() == 3 && shape_out[0] == 3 && shape_out[1] == 7 && shape_out[2] == 2);
+
+        const size_t cached = internal::runtime_network_cache<T>::instance().entries.size();
+        Tensor<T,3,7,2> out;
+        for (int r=0; r<2; ++r) {
+            out.zeros();
+            einsum("ab,bcd,de,cf->aef",{A.data(),B.data(),C.data(),D.data()},shapes,out.data());
+            FASTOR_EXIT_ASSERT(norm(out - ref) < BigTol*norm(ref));
+        }
+        FASTOR_EXIT_ASSERT(internal::runtime_network_cache<T>::instance().entries.size() == cached+1);
+
+        // an index shared by three operands
+        Tensor<T,3,4> A2; A2.random();
+        Tensor<T,4,5> E; E.random();
+        Tensor<T,3,5> out2;
+        einsum("ij,ij,jk->ik",{A.data(),A2.data(),E.data()},{{3,4},{3,4},{4,5}},out2.data());
+        Tensor<T,3,4> AA = A*A2;
+        auto ref2 = matmul(AA,E);
+        FASTOR_EXIT_ASSERT(norm(out2 - ref2) < BigTol*norm(ref2));
+    }
+
+    // a chain longer than the exact solver handles goes through the greedy order
+    {
+        constexpr size_t n = 14;
+        const size_t dims[n+1] = {3,5,2,7,4,3,6,2,5,3,4,2,6,3,4};
+        std::vector<std::vector<T>> mats(n);
+        std::vector<std::vector<size_t>> shapes(n);
+        std::vector<const T*> operands(n);
+        std::string subscripts;
+        for (size_t k=0; k<n; ++k) {
+            shapes[k] = {dims[k],dims[k+1]};
+            mats[k].resize(dims[k]*dims[k+1]);
+            for (auto &v : mats[k]) v = T(std::rand() % 7) / T(7) - T(0.4);
+            operands[k] = mats[k].data();
+            subscripts += k ? "," : "";
+            subscripts += char('a'+k);
+            subscripts += char('a'+k+1);
+        }
+        subscripts += std::string("->") + 'a' + char('a'+n);
+
+        std::vector<T> ref(mats[0]);
+        size_t cols = dims[1];
+        for (size_t k=1; k<n; ++k) {
+            std::vector<T> next(dims[0]*dims[k+1],0);
+            for (size_t r=0; r<dims[0]; ++r)
+                for (size_t p=0; p<cols; ++p)
+                    for (size_t q=0; q<dims[k+1]; ++q)
+                        next[r*dims[k+1]+q] += ref[r*cols+p]*mats[k][p*dims[k+1]+q];
+            ref = next;
+            cols = dims[k+1];
+        }
+
+        std::vector<T> out(dims[0]*dims[n]);
+        einsum(subscripts.c_str(),operands,shapes,out.data());
+        T err = 0, scale = 0;
+        for (size_t p=0; p<out.size(); ++p) {
+            err += (out[p]-ref[p])*(out[p]-ref[p]);
+            scale += ref[p]*ref[p];
+        }
+        FASTOR_EXIT_ASSERT(std::sqrt(err) < BigTol*std::sqrt(scale) + BigTol);
+    }
+
+    // errors
+    {
+        Tensor<T,3,4> A; A.random();
+        Tensor<T,4,5> B; B.random();
+        Tensor<T,5,6> C; C.random();
+        Tensor<T,3,6> out;
+        bool thrown = false;
+        try { einsum("ij,jk,lm->im",{A.data(),B.data(),C.data()},{{3,4},{4,5},{5,6}},out.data()); }
+        catch (std::runtime_error&) { thrown = true; }
+        FASTOR_EXIT_ASSERT(thrown);
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+int main() {
+
+    print(FBLU(BOLD("Testing contraction ordering")));
+    test_paths();
+    print(FBLU(BOLD("Testing tensor networks: single precision")));
+    test_networks<float>();
+    print(FBLU(BOLD("Testing tensor networks: double precision")));
+    test_networks<double>();
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+#include <Fastor/Fastor.h>
+
+using namespace Fastor;
+
+
+#define Tol 1e-12
+#define BigTol 1e-5
+#define HugeTol 1e-2
+
+
+template<typename T>
+void test_runtime_einsum() {
+
+    enum {b,i,j,k,l};
+
+    // against compile-time einsum
+    {
+        Tensor<T,3,4,5> A; A.random();
+        Tensor<T,4,5,6> B; B.random();
+        auto ref = einsum<Index<i,j,k>,Index<j,k,l>>(A,B);
+
+        Tensor<T,3,6> C;
+        einsum("ijk,jkl->il",A,B,C);
+        FASTOR_EXIT_ASSERT(norm(C - ref) < BigTol);
+        // implicit output
+        einsum("ijk,jkl",A,B,C);
+        FASTOR_EXIT_ASSERT(norm(C - ref) < BigTol);
+        // permuted output
+        Tensor<T,6,3> Ct;
+        einsum("ijk, jkl -> li",A,B,Ct);
+        FASTOR_EXIT_ASSERT(norm(Ct - transpose(ref)) < BigTol);
+        // contracted indices in a different order in each operand
+        Tensor<T,5,4,6> Bp = permute<Index<1,0,2>>(B);
+        einsum("ijk,kjl->il",A,Bp,C);
+        FASTOR_EXIT_ASSERT(norm(C - ref) < BigTol);
+    }
+
+    // batch indices
+    {
+        Tensor<T,5,3,6> A; A.random();
+        Tensor<T,4,6,5> B; B.random();
+        Tensor<T,4,3,5> C;
+        einsum("bij,kjb->kib",A,B,C);
+        auto ref = einsum<Index<b,i,j>,Index<k,j,b>,OIndex<k,i,b>>(A,B);
+        FASTOR_EXIT_ASSERT(norm(C - ref) < BigTol);
+    }
+
+    // raw buffers with runtime shapes, the plan is built once and replayed
+    {
+        Tensor<T,7,9> A; A.random();
+        Tensor<T,9,11> B; B.random();
+        auto ref = matmul(A,B);
+        const std::vector<size_t> shape_a = {7,9}, shape_b = {9,11};
+        const std::vector<size_t> shape_c = einsum_shape("ij,jk->ik",shape_a,shape_b);
+        FASTOR_EXIT_ASSERT(shape_c.size() == 2 && shape_c[0] == 7 && shape_c[1] == 11);
+
+        const size_t cached = internal::runtime_einsum_cache<T>::instance().entries.size();
+        std::vector<T> c(7*11);
+        for (int r=0; r<3; ++r) {
+            einsum("ij,jk->ik",A.data(),shape_a,B.data(),shape_b,c.data());
+            for (size_t p=0; p<7*11; ++p) FASTOR_EXIT_ASSERT(std::abs(c[p] - ref.data()[p]) < BigTol);
+        }
+        FASTOR_EXIT_ASSERT(internal::runtime_einsum_cache<T>::instance().entries.size() == cached+1);
+    }
+
+    // GEMM sizes above the K and N panels of _matmul_dynamic, with tails in both
+    {
+        const size_t M = 3, K = 2*internal::matmul_dynamic_kblock+37, N = internal::matmul_dynamic_nblock+45;
+        std::vector<T> x(M*K), y(K*N), z(M*N);
+        for (size_t p=0; p<x.size(); ++p) x[p] = T(p % 7) / T(7);
+        for (size_t p=0; p<y.size(); ++p) y[p] = T(p % 11) / T(11);
+        einsum("ij,jk->ik",x.data(),{M,K},y.data(),{K,N},z.data());
+        for (size_t r=0; r<M; ++r) {
+            for (size_t c=0; c<N; ++c) {
+                double ref = 0;
+                for (size_t p=0; p<K; ++p) ref += double(x[r*K+p])*double(y[p*N+c]);
+                FASTOR_EXIT_ASSERT(std::abs(z[r*N+c] - ref) < BigTol*K);
+            }
+        }
+    }
+
+    // the caches are bounded and can be emptied, networks do not depend on the pair cache
+    {
+        Tensor<T,2,3> A; A.random();
+        Tensor<T,3,4> B; B.random();
+        Tensor<T,4,5> C; C.random();
+        auto ref = matmul(matmul(A,B),C);
+        const std::vector<const T*> operands = {A.data(),B.data(),C.data()};
+        const std::vector<std::vector<size_t>> shapes = {{2,3},{3,4},{4,5}};
+        Tensor<T,2,5> D;
+        einsum("ij,jk,kl->il",operands,shapes,D.data());
+        FASTOR_EXIT_ASSERT(norm(D - ref) < BigTol);
+        internal::runtime_einsum_cache<T>::instance().entries.clear();
+        D.zeros();
+        einsum("ij,jk,kl->il",operands,shapes,D.data());
+        FASTOR_EXIT_ASSERT(norm(D - ref) < BigTol);
+
+        std::vector<T> x(FASTOR_RUNTIME_EINSUM_CACHE_SIZE+9, T(1)), y(x.size(), T(2)), z(x.size());
+        for (size_t n=1; n<=x.size(); ++n) {
+            einsum("i,i->i",x.data(),{n},y.data(),{n},z.data());
+            FASTOR_EXIT_ASSERT(std::abs(z[n-1] - T(2)) < Tol);
+            FASTOR_EXIT_ASSERT(internal::runtime_einsum_cache<T>::instance().entries.size() <= FASTOR_RUNTIME_EINSUM_CACHE_SIZE);
+        }
+
+        runtime_einsum_clear_cache<T>();
+        FASTOR_EXIT_ASSERT(internal::runtime_einsum_cache<T>::instance().entries.empty());
+        FASTOR_EXIT_ASSERT(internal::runtime_network_cache<T>::instance().entries.empty());
+        D.zeros();
+        einsum("ij,jk,kl->il",operands,shapes,D.data());
+        FASTOR_EXIT_ASSERT(norm(D - ref) < BigTol);
+    }
+
+    // errors
+    {
+        Tensor<T,3,4> A; A.random();
+        Tensor<T,5,6> B; B.random();
+        Tensor<T,3,6> C;
+        bool thrown = false;
+        try { einsum("ij,jk->ik",A,B,C); } catch (std::runtime_error&) { thrown = true; }
+        FASTOR_EXIT_ASSERT(thrown);
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+int main() {
+
+    print(FBLU(BOLD("Testing runtime einsum: single precision")));
+    test_runtime_einsum<float>();
+    print(FBLU(BOLD("Testing runtime einsum: double precision")));
+    test_runtime_einsum<double>();
+
+    return 0;
+}
@@ -0,0 +1,143 @@
+#include <Fastor/Fastor.h>
+
+using namespace Fastor;
+
+
+#define Tol 1e-12
+#define BigTol 1e-5
+
+
+template<typename T>
+void test_delta(T tol) {
+
+    enum {i,j,k,l,m};
+    const Tensor<T,3,3> I = Delta<3>().template dense<T>();
+    FASTOR_EXIT_ASSERT(std::abs(sum(I) - T(3)) < tol);
+
+    // substitution
+    {
+        Tensor<T,3,4> a; a.random();
+        Tensor<T,4,3> b; b.random();
+        Tensor<T,3,4> c1 = einsum<Index<i,j>,Index<j,k>>(Delta<3>(),a);
+        FASTOR_EXIT_ASSERT(norm(c1 - a) < tol*norm(a));
+        Tensor<T,4,3> c2 = einsum<Index<i,j>,Index<j,k>>(b,Delta<3>());
+        FASTOR_EXIT_ASSERT(norm(c2 - b) < tol*norm(b));
+        Tensor<T,4,3> c3 = einsum<Index<i,j>,Index<k,i>>(Delta<3>(),b);
+        FASTOR_EXIT_ASSERT(norm(c3 - einsum<Index<i,j>,Index<k,i>>(I,b)) < tol*norm(b));
+    }
+
+    // trace, partial trace and transpose
+    {
+        Tensor<T,3,3> a; a.random();
+        Tensor<T> tr = einsum<Index<i,j>,Index<i,j>>(Delta<3>(),a);
+        FASTOR_EXIT_ASSERT(std::abs(tr.toscalar() - trace(a)) < tol*norm(a));
+        Tensor<T> trt = einsum<Index<i,j>,Index<j,i>>(a,Delta<3>());
+        FASTOR_EXIT_ASSERT(std::abs(trt.toscalar() - trace(a)) < tol*norm(a));
+
+        Tensor<T,3,3,4> b; b.random();
+        Tensor<T,4> pt = einsum<Index<i,j>,Index<i,j,k>>(Delta<3>(),b);
+        Tensor<T,4> pt_ref = einsum<Index<i,j>,Index<i,j,k>>(I,b);
+        FASTOR_EXIT_ASSERT(norm(pt - pt_ref) < tol*norm(pt_ref));
+
+        Tensor<T,3,3,4> bt = einsum<Index<i,l>,Index<j,l,k>>(Delta<3>(),b);
+        Tensor<T,3,3,4> bt_ref = einsum<Index<i,l>,Index<j,l,k>>(I,b);
+        FASTOR_EXIT_ASSERT(norm(bt - bt_ref) < tol*norm(bt_ref));
+    }
+
+    // no index in common and an expression operand
+    {
+        Tensor<T,3,3> a; a.random();
+        Tensor<T,3,3> b; b.random();
+        Tensor<T,3,3,3,3> c = einsum<Index<i,k>,Index<j,l>>(Delta<3>(),a);
+        Tensor<T,3,3,3,3> c_ref = einsum<Index<i,k>,Index<j,l>>(I,a);
+        FASTOR_EXIT_ASSERT(norm(c - c_ref) < tol*norm(c_ref));
+
+        Tensor<T,3,3> d = einsum<Index<i,j>,Index<j,k>>(a+b,Delta<3>());
+        FASTOR_EXIT_ASSERT(norm(d - (a+b)) < tol*norm(d));
+    }
+
+    // other dimensions
+    {
+        Tensor<T,5,2,5> a; a.random();
+        Tensor<T,2> c = einsum<Index<i,j>,Index<i,k,j>>(Delta<5>(),a);
+        Tensor<T,2> c_ref = einsum<Index<i,j>,Index<i,k,j>>(Tensor<T,5,5>(Delta<5>().template dense<T>()),a);
+        FASTOR_EXIT_ASSERT(norm(c - c_ref) < tol*norm(c_ref));
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+
+template<typename T>
+void test_levi_civita(T tol) {
+
+    enum {i,j,k,l,m};
+    const Tensor<T,3,3,3> E = LeviCivita<3>().template dense<T>();
+    FASTOR_EXIT_ASSERT(std::abs(E(0,1,2) - T(1)) < tol && std::abs(E(2,1,0) + T(1)) < tol);
+    FASTOR_EXIT_ASSERT(std::abs(E(1,2,0) - T(1)) < tol && std::abs(E(0,0,1)) < tol);
+    FASTOR_EXIT_ASSERT(std::abs(norm(E) - std::sqrt(T(6))) < tol);
+    static_assert(LeviCivita<4>::nnz() == 24, "");
+    static_assert(LeviCivita<4>::value(1) == -1, "");
+
+    // axial vector, skew matrix and cross product
+    {
+        Tensor<T,3,3> a; a.random();
+        Tensor<T,3> v; v.random();
+        Tensor<T,3> w; w.random();
+
+        Tensor<T,3> ax = einsum<Index<i,j,k>,Index<j,k>>(LeviCivita<3>(),a);
+        Tensor<T,3> ax_ref = einsum<Index<i,j,k>,Index<j,k>>(E,a);
+        FASTOR_EXIT_ASSERT(norm(ax - ax_ref) < tol*norm(ax_ref));
+
+        Tensor<T,3,3> sk = einsum<Index<i,j,k>,Index<k>>(LeviCivita<3>(),v);
+        Tensor<T,3,3> sk_ref = einsum<Index<i,j,k>,Index<k>>(E,v);
+        FASTOR_EXIT_ASSERT(norm(sk - sk_ref) < tol*norm(sk_ref));
+
+        Tensor<T,3> vw = einsum<Index<i,k>,Index<k>>(einsum<Index<j>,Index<i,j,k>>(v,LeviCivita<3>()),w);
+        Tensor<T,3> vw_ref = {v(1)*w(2)-v(2)*w(1), v(2)*w(0)-v(0)*w(2), v(0)*w(1)-v(1)*w(0)};
+        FASTOR_EXIT_ASSERT(norm(vw - vw_ref) < tol*norm(vw_ref));
+    }
+
+    // higher order operands and full contraction
+    {
+        Tensor<T,3,4,3> a; a.random();
+        Tensor<T,3,3,4,3> c = einsum<Index<i,j,k>,Index<k,l,m>>(LeviCivita<3>(),a);
+        Tensor<T,3,3,4,3> c_ref = einsum<Index<i,j,k>,Index<k,l,m>>(E,a);
+        FASTOR_EXIT_ASSERT(norm(c - c_ref) < tol*norm(c_ref));
+
+        Tensor<T,4,3> d2 = einsum<Index<l,m,i>,Index<l,j,i>>(a,LeviCivita<3>());
+        FASTOR_EXIT_ASSERT(norm(d2 - einsum<Index<l,m,i>,Index<l,j,i>>(a,E)) < tol*norm(d2));
+
+        Tensor<T,3,3,3> b; b.random();
+        Tensor<T> s = einsum<Index<i,j,k>,Index<i,j,k>>(LeviCivita<3>(),b);
+        Tensor<T> s_ref = einsum<Index<i,j,k>,Index<i,j,k>>(E,b);
+        FASTOR_EXIT_ASSERT(std::abs(s.toscalar() - s_ref.toscalar()) < tol*norm(b));
+    }
+
+    // two and four dimensions
+    {
+        Tensor<T,2> v; v.random();
+        Tensor<T,2> r = einsum<Index<i,j>,Index<j>>(LeviCivita<2>(),v);
+        FASTOR_EXIT_ASSERT(std::abs(r(0) - v(1)) < tol && std::abs(r(1) + v(0)) < tol);
+
+        Tensor<T,4,4> a; a.random();
+        Tensor<T,4,4> c = einsum<Index<i,j,k,l>,Index<k,l>>(LeviCivita<4>(),a);
+        Tensor<T,4,4> c_ref = einsum<Index<i,j,k,l>,Index<k,l>>(LeviCivita<4>().template dense<T>(),a);
+        FASTOR_EXIT_ASSERT(norm(c - c_ref) < tol*norm(c_ref));
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+
+int main() {
+
+    print(FBLU(BOLD("Testing symbolic einsum: single precision")));
+    test_delta<float>(BigTol);
+    test_levi_civita<float>(BigTol);
+    print(FBLU(BOLD("Testing symbolic einsum: double precision")));
+    test_delta<double>(Tol);
+    test_levi_civita<double>(Tol);
+
+    return 0;
+}
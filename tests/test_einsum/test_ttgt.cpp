@@ -0,0 +1,178 @@
+#include <Fastor/Fastor.h>
+
+using namespace Fastor;
+
+
+#define Tol 1e-12
+#define BigTol 1e-5
+#define HugeTol 1e-2
+
+
+// TTGT against the index-by-index contraction engine
+template<class Ind0, class Ind1, typename T, size_t ... Rest0, size_t ... Rest1>
+void check_ttgt(const Tensor<T,Rest0...> &a, const Tensor<T,Rest1...> &b) {
+    static_assert(internal::ttgt_planner<Ind0,Ind1,Tensor<T,Rest0...>,Tensor<T,Rest1...>>::value, "NOT A TTGT CONTRACTION");
+    auto out = einsum<Ind0,Ind1>(a,b);
+    auto ref = extractor_contract_2<Ind0,Ind1>::contract_impl(a,b);
+    FASTOR_EXIT_ASSERT(norm(out - ref) < BigTol*norm(ref));
+}
+
+template<typename T>
+void test_ttgt() {
+
+    enum {a,b,c,d,e,f,g};
+
+    // planner - layouts that need no copies are recognised
+    {
+        // <ijk,jkl> is already a GEMM
+        using p0 = internal::ttgt_planner<Index<a,b,c>,Index<b,c,d>,Tensor<T,2,3,4>,Tensor<T,3,4,5>>;
+        static_assert(p0::bytes == 0 && !p0::transposed, "INCORRECT TTGT PLAN");
+        static_assert(p0::M == 2 && p0::K == 12 && p0::N == 5, "INCORRECT TTGT PLAN");
+        // <jki,ljk> is the transposed product with b first
+        using p1 = internal::ttgt_planner<Index<b,c,a>,Index<d,b,c>,Tensor<T,3,4,2>,Tensor<T,5,3,4>>;
+        static_assert(p1::transposed && p1::bytes == 2*5*sizeof(T), "INCORRECT TTGT PLAN");
+        // <ij,kj> only b is permuted
+        using p2 = internal::ttgt_planner<Index<a,b>,Index<c,b>,Tensor<T,8,2>,Tensor<T,3,2>>;
+        static_assert(!p2::transposed && p2::bytes == 3*2*sizeof(T), "INCORRECT TTGT PLAN");
+        // <ikj,kl> the contracted index is ordered so that only a is permuted
+        using p3 = internal::ttgt_planner<Index<a,c,b>,Index<c,d>,Tensor<T,2,3,4>,Tensor<T,3,5>>;
+        static_assert(!p3::transposed && p3::bytes == 2*3*4*sizeof(T), "INCORRECT TTGT PLAN");
+        // <ijkl,lkm> contracting in the order of b avoids permuting b
+        using p4 = internal::ttgt_planner<Index<a,b,c,d>,Index<d,c,e>,Tensor<T,2,3,4,5>,Tensor<T,5,4,6>>;
+        static_assert(p4::bytes == 2*3*4*5*sizeof(T), "INCORRECT TTGT PLAN");
+        // repeated indices in one operand are left to the contraction engine
+        using p5 = internal::ttgt_planner<Index<a,a,b>,Index<b,c>,Tensor<T,2,2,3>,Tensor<T,3,4>>;
+        static_assert(!p5::value, "INCORRECT TTGT PLAN");
+    }
+
+    // contractions
+    {
+        Tensor<T,3,4> A; A.random();
+        Tensor<T,5,4> B; B.random();
+        Tensor<T,4,3> C; C.random();
+        Tensor<T,4,5> E; E.random();
+        check_ttgt<Index<a,b>,Index<c,b>>(A,B);
+        check_ttgt<Index<b,a>,Index<b,c>>(C,E);
+        check_ttgt<Index<a,b>,Index<c,d>>(A,E);
+    }
+    {
+        Tensor<T,2,3,4> A; A.random();
+        Tensor<T,4,3,5> B; B.random();
+        Tensor<T,5,2,3> C; C.random();
+        Tensor<T,3,5> D; D.random();
+        check_ttgt<Index<a,b,c>,Index<c,b,d>>(A,B);
+        check_ttgt<Index<a,b,c>,Index<d,a,b>>(A,C);
+        check_ttgt<Index<a,b,c>,Index<b,d>>(A,D);
+        check_ttgt<Index<c,a,b>,Index<b,d>>(C,D);
+        check_ttgt<Index<a,b,c>,Index<d,e,f>>(A,C);
+        check_ttgt<Index<b,e>,Index<a,b,c>>(D,A);
+    }
+    {
+        Tensor<T,2,3,4,5> A; A.random();
+        Tensor<T,5,4,6> B; B.random();
+        Tensor<T,6,3,2,4> C; C.random();
+        Tensor<T,3,5,7,2> D; D.random();
+        check_ttgt<Index<a,b,c,d>,Index<d,c,e>>(A,B);
+        check_ttgt<Index<a,b,c,d>,Index<e,b,a,c>>(A,C);
+        check_ttgt<Index<a,b,c,d>,Index<b,d,e,a>>(A,D);
+        check_ttgt<Index<d,b,c,a>,Index<b,a,e,d>>(A,D);
+        Tensor<T,4,2,7> F; F.random();
+        check_ttgt<Index<e,c,f,a>,Index<a,f,g>>(C,F);
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+
+// Batch [Hadamard] indices kept in an explicit output index
+template<typename T>
+void test_batched() {
+
+    enum {b,e,i,j,k,l,m};
+
+    // planner
+    {
+        using p0 = internal::batched_contraction_planner<Index<b,i,k>,Index<b,k,j>,OIndex<b,i,j>,Tensor<T,5,2,3>,Tensor<T,5,3,4>>;
+        static_assert(p0::value && p0::P == 5 && p0::M == 2 && p0::K == 3 && p0::N == 4, "INCORRECT BATCHED PLAN");
+        static_assert(!p0::requires_permutation0 && !p0::requires_permutation1 && !p0::requires_out_permutation, "INCORRECT BATCHED PLAN");
+        using p1 = internal::batched_contraction_planner<Index<i,b,k>,Index<k,j,b>,OIndex<j,b,i>,Tensor<T,2,5,3>,Tensor<T,3,4,5>>;
+        static_assert(p1::value && p1::requires_permutation0 && p1::requires_permutation1 && p1::requires_out_permutation, "INCORRECT BATCHED PLAN");
+        // without a batch index this is an ordinary contraction
+        using p2 = internal::batched_contraction_planner<Index<i,k>,Index<k,j>,OIndex<i,j>,Tensor<T,2,3>,Tensor<T,3,4>>;
+        static_assert(!p2::value, "INCORRECT BATCHED PLAN");
+    }
+
+    // batch of matrix products
+    {
+        Tensor<T,5,2,3> A; A.random();
+        Tensor<T,5,3,4> B; B.random();
+        Tensor<T,5,2,4> out = einsum<Index<b,i,k>,Index<b,k,j>,OIndex<b,i,j>>(A,B);
+        for (size_t p=0; p<5; ++p)
+            for (size_t q=0; q<2; ++q)
+                for (size_t r=0; r<4; ++r) {
+                    T ref = 0;
+                    for (size_t s=0; s<3; ++s) ref += A(p,q,s)*B(p,s,r);
+                    FASTOR_EXIT_ASSERT(std::abs(out(p,q,r) - ref) < BigTol);
+                }
+    }
+
+    // batch index not leading and a permuted output
+    {
+        Tensor<T,2,5,3> A; A.random();
+        Tensor<T,3,4,5> B; B.random();
+        Tensor<T,4,5,2> out = einsum<Index<i,b,k>,Index<k,j,b>,OIndex<j,b,i>>(A,B);
+        for (size_t p=0; p<5; ++p)
+            for (size_t q=0; q<2; ++q)
+                for (size_t r=0; r<4; ++r) {
+                    T ref = 0;
+                    for (size_t s=0; s<3; ++s) ref += A(q,p,s)*B(s,r,p);
+                    FASTOR_EXIT_ASSERT(std::abs(out(r,p,q) - ref) < BigTol);
+                }
+    }
+
+    // per element B^T D B
+    {
+        Tensor<T,7,3,6> Bm; Bm.random();
+        Tensor<T,7,3,3> D; D.random();
+        auto DB = einsum<Index<e,k,m>,Index<e,m,l>,OIndex<e,k,l>>(D,Bm);
+        Tensor<T,7,6,6> K = einsum<Index<e,k,i>,Index<e,k,l>,OIndex<e,i,l>>(Bm,DB);
+        for (size_t p=0; p<7; ++p)
+            for (size_t q=0; q<6; ++q)
+                for (size_t r=0; r<6; ++r) {
+                    T ref = 0;
+                    for (size_t s=0; s<3; ++s)
+                        for (size_t t=0; t<3; ++t) ref += Bm(p,s,q)*D(p,s,t)*Bm(p,t,r);
+                    FASTOR_EXIT_ASSERT(std::abs(K(p,q,r) - ref) < BigTol);
+                }
+    }
+
+    // Hadamard product and scaling by a vector
+    {
+        Tensor<T,4,3> A; A.random();
+        Tensor<T,4,3> B; B.random();
+        Tensor<T,4> v; v.random();
+        Tensor<T,4,3> H = einsum<Index<i,j>,Index<i,j>,OIndex<i,j>>(A,B);
+        FASTOR_EXIT_ASSERT(norm(H - A*B) < BigTol);
+        Tensor<T,3,4> S = einsum<Index<i,j>,Index<i>,OIndex<j,i>>(A,v);
+        for (size_t p=0; p<4; ++p)
+            for (size_t q=0; q<3; ++q)
+                FASTOR_EXIT_ASSERT(std::abs(S(q,p) - A(p,q)*v(p)) < BigTol);
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+int main() {
+
+    print(FBLU(BOLD("Testing TTGT tensor contractions: single precision")));
+    test_ttgt<float>();
+    print(FBLU(BOLD("Testing TTGT tensor contractions: double precision")));
+    test_ttgt<double>();
+
+    print(FBLU(BOLD("Testing batched tensor contractions: single precision")));
+    test_batched<float>();
+    print(FBLU(BOLD("Testing batched tensor contractions: double precision")));
+    test_batched<double>();
+
+    return 0;
+}
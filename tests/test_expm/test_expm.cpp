@@ -0,0 +1,125 @@
+#include <Fastor/Fastor.h>
+
+using namespace Fastor;
+
+
+#define Tol 1e-12
+#define BigTol 1e-5
+#define HugeTol 1e-2
+
+
+template<typename T, size_t M>
+void test_expm_random(T scale) {
+    Tensor<T,M,M> A; A.random();
+    A = scale*(A - T(0.5));
+    Tensor<T,M,M> I; I.eye2();
+
+    // exp(A) * exp(-A) = I
+    Tensor<T,M,M> E  = expm(A);
+    Tensor<T,M,M> Ei = expm(-A);
+    FASTOR_EXIT_ASSERT(norm(matmul(E,Ei) - I) < BigTol*norm(E)*norm(Ei));
+
+    // exp(2A) = exp(A)^2
+    Tensor<T,M,M> A2 = 2*A;
+    FASTOR_EXIT_ASSERT(norm(expm(A2) - matmul(E,E)) < BigTol*norm(matmul(E,E)));
+
+    // symmetric matrices agree with the eigen-decomposition
+    Tensor<T,M,M> S = A + transpose(A);
+    Tensor<T,M,M> ES = expm<MatFuncCompType::Sym>(S);
+    FASTOR_EXIT_ASSERT(norm(expm(S) - ES) < BigTol*norm(ES));
+    FASTOR_EXIT_ASSERT(norm(logm(ES) - S) < HugeTol*norm(S));
+
+    // expressions
+    FASTOR_EXIT_ASSERT(norm(expm(A+0) - E) < BigTol*norm(E));
+    FASTOR_EXIT_ASSERT(norm(logm(ES+0) - logm(ES)) < BigTol*norm(S));
+}
+
+template<typename T>
+void test_expm() {
+
+    // fixed values
+    {
+        Tensor<T,2,2> Z; Z.zeros();
+        Tensor<T,2,2> I; I.eye2();
+        FASTOR_EXIT_ASSERT(norm(expm(Z) - I) < Tol);
+
+        // nilpotent
+        Tensor<T,2,2> N = {{0,1},{0,0}};
+        Tensor<T,2,2> EN = {{1,1},{0,1}};
+        FASTOR_EXIT_ASSERT(norm(expm(N) - EN) < BigTol);
+
+        // rotation generator - also needs scaling and squaring
+        const T t = T(7.5);
+        Tensor<T,2,2> W = {{T(0),-t},{t,T(0)}};
+        Tensor<T,2,2> R = {{std::cos(t),-std::sin(t)},{std::sin(t),std::cos(t)}};
+        FASTOR_EXIT_ASSERT(norm(expm(W) - R) < BigTol);
+
+        Tensor<T,3,3> D = {{1,0,0},{0,-2,0},{0,0,3}};
+        Tensor<T,3,3> ED = expm(D);
+        FASTOR_EXIT_ASSERT(std::abs(ED(0,0) - std::exp(T(1)))  < BigTol);
+        FASTOR_EXIT_ASSERT(std::abs(ED(1,1) - std::exp(T(-2))) < BigTol);
+        FASTOR_EXIT_ASSERT(std::abs(ED(2,2) - std::exp(T(3)))  < BigTol*std::exp(T(3)));
+        FASTOR_EXIT_ASSERT(std::abs(ED(0,1)) < BigTol);
+        FASTOR_EXIT_ASSERT(norm(logm(ED) - D) < BigTol);
+
+        // Hencky strain of a stretch
+        Tensor<T,3,3> C = {{T(4),T(0),T(0)},{T(0),T(1),T(0)},{T(0),T(0),T(0.25)}};
+        Tensor<T,3,3> H = T(0.5)*logm(C);
+        FASTOR_EXIT_ASSERT(std::abs(H(0,0) - std::log(T(2))) < BigTol);
+        FASTOR_EXIT_ASSERT(std::abs(H(1,1)) < BigTol);
+        FASTOR_EXIT_ASSERT(std::abs(H(2,2) + std::log(T(2))) < BigTol);
+    }
+
+    // batches
+    {
+        Tensor<T,5,3,3> A; A.random();
+        Tensor<T,5,3,3> S;
+        for (size_t k=0; k<5; ++k) {
+            Tensor<T,3,3> Ak = A(k,all,all);
+            Tensor<T,3,3> Sk = Ak + transpose(Ak);
+            S(k,all,all) = Sk;
+        }
+        Tensor<T,5,3,3> E   = expm(A);
+        Tensor<T,5,3,3> ES  = expm<MatFuncCompType::Sym>(S);
+        Tensor<T,5,3,3> LES = logm(ES);
+        for (size_t k=0; k<5; ++k) {
+            Tensor<T,3,3> Ak = A(k,all,all);
+            Tensor<T,3,3> Sk = S(k,all,all);
+            Tensor<T,3,3> Ek = E(k,all,all);
+            Tensor<T,3,3> ESk = ES(k,all,all);
+            Tensor<T,3,3> LESk = LES(k,all,all);
+            FASTOR_EXIT_ASSERT(norm(Ek - expm(Ak)) < BigTol*norm(Ek));
+            FASTOR_EXIT_ASSERT(norm(ESk - expm(Sk)) < BigTol*norm(ESk));
+            FASTOR_EXIT_ASSERT(norm(LESk - Sk) < HugeTol*norm(Sk));
+        }
+
+        Tensor<T,2,3,5,5> B; B.random();
+        Tensor<T,2,3,5,5> EB = expm(B);
+        Tensor<T,5,5> B12 = B(1,2,all,all);
+        Tensor<T,5,5> EB12 = EB(1,2,all,all);
+        FASTOR_EXIT_ASSERT(norm(EB12 - expm(B12)) < BigTol*norm(EB12));
+    }
+
+    test_expm_random<T,1>(T(1));
+    test_expm_random<T,2>(T(0.01));
+    test_expm_random<T,2>(T(4));
+    test_expm_random<T,3>(T(0.1));
+    test_expm_random<T,3>(T(1));
+    test_expm_random<T,3>(T(6));
+    test_expm_random<T,4>(T(2));
+    test_expm_random<T,6>(T(1));
+    test_expm_random<T,9>(T(3));
+
+    print(FGRN(BOLD("All tests passed successfully")));
+
+}
+
+int main() {
+
+    print(FBLU(BOLD("Testing matrix exponential and logarithm: single precision")));
+    test_expm<float>();
+    print(FBLU(BOLD("Testing matrix exponential and logarithm: double precision")));
+    test_expm<double>();
+
+    return 0;
+}
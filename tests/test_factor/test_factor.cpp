@@ -0,0 +1,251 @@
+#include <Fastor/Fastor.h>
+
+using namespace Fastor;
+
+
+#define Tol 1e-12
+#define BigTol 1e-5
+#define HugeTol 1e-2
+
+
+template<typename T, size_t M>
+T exact_rcond(const Tensor<T,M,M> &A) {
+    Tensor<T,M,M> invA = inverse<InvCompType::SimpleLUPiv>(A);
+    return T(1) / (internal::matrix_norm1(A) * internal::matrix_norm1(invA));
+}
+
+template<typename T, size_t M>
+void test_lu_factor() {
+    Tensor<T,M,M> A; A.random();
+    for (size_t i=0; i<M; ++i) A(i,i) = T(0);
+    A(0,M-1) += T(2);
+
+    auto F = lu_factor(A);
+    FASTOR_EXIT_ASSERT(F.info() == 0);
+
+    // reuse the factors for many right hand sides
+    for (size_t n=0; n<3; ++n) {
+        Tensor<T,M> b; b.random();
+        Tensor<T,M> x = F.solve(b);
+        FASTOR_EXIT_ASSERT(norm(matmul(A,x) - b) < BigTol);
+        F.solve_inplace(b);
+        FASTOR_EXIT_ASSERT(norm(b - x) < Tol);
+
+        Tensor<T,M> c; c.random();
+        Tensor<T,M> y(c);
+        F.solve_transpose_inplace(y);
+        FASTOR_EXIT_ASSERT(norm(matmul(transpose(A),y) - c) < BigTol);
+    }
+    Tensor<T,M,5> B; B.random();
+    Tensor<T,M,5> X = F.solve(B);
+    FASTOR_EXIT_ASSERT(norm(matmul(A,X) - B) < BigTol);
+    FASTOR_EXIT_ASSERT(norm(F.solve(B+0) - X) < BigTol);
+    F.solve_inplace(B);
+    FASTOR_EXIT_ASSERT(norm(B - X) < BigTol);
+
+    // factors and pivots reconstruct A
+    Tensor<T,M,M> L, U;
+    L.zeros(); U.zeros();
+    for (size_t i=0; i<M; ++i) {
+        for (size_t j=0; j<M; ++j) {
+            if (j < i) L(i,j) = F.factors()(i,j);
+            else U(i,j) = F.factors()(i,j);
+        }
+        L(i,i) = T(1);
+    }
+    FASTOR_EXIT_ASSERT(norm(A - reconstruct(L,U,F.pivots())) < BigTol);
+
+    // determinant agrees with LU based determinant
+    const T det = determinant<DetCompType::LU>(A);
+    FASTOR_EXIT_ASSERT(std::abs(F.determinant() - det) < BigTol*std::max(T(1),std::abs(det)));
+
+    // rcond is an estimate - it is never below the exact value and rarely far above it
+    const T rc = F.rcond();
+    const T rc_exact = exact_rcond(A);
+    FASTOR_EXIT_ASSERT(rc >= rc_exact*(1-BigTol) && rc <= 10*rc_exact);
+
+    // estimate from the outputs of lu
+    Tensor<size_t,M> p;
+    lu<LUCompType::BlockLUPiv>(A, L, U, p);
+    FASTOR_EXIT_ASSERT(std::abs(rcond(A,L,U,p) - rc) < BigTol*rc);
+    FASTOR_EXIT_ASSERT(std::abs(rcond(A) - rc) < BigTol*rc);
+    FASTOR_EXIT_ASSERT(std::abs(rcond(A+0) - rc) < BigTol*rc);
+
+    // mixed precision solve with refinement is accurate to working precision
+    {
+        Tensor<T,M> b; b.random();
+        Tensor<T,M> x = solve<SolveCompType::Refined>(A,b);
+        FASTOR_EXIT_ASSERT(norm(x - F.solve(b)) < BigTol*norm(x));
+        FASTOR_EXIT_ASSERT(norm(matmul(A,x) - b) < BigTol);
+        Tensor<T,M,3> B; B.random();
+        Tensor<T,M,3> X = solve<SolveCompType::Refined>(A,B);
+        FASTOR_EXIT_ASSERT(norm(X - F.solve(B)) < BigTol*norm(X));
+    }
+
+    // refactorise
+    F.factorise(A+transpose(A));
+    Tensor<T,M> b; b.random();
+    FASTOR_EXIT_ASSERT(norm(matmul(A+transpose(A),F.solve(b)) - b) < BigTol);
+}
+
+template<typename T, size_t M>
+void test_cholesky_factor() {
+    Tensor<T,M,M> B; B.random();
+    Tensor<T,M,M> I; I.eye2();
+    Tensor<T,M,M> A = matmul(transpose(B),B) + I;
+
+    auto F = cholesky_factor(A);
+    FASTOR_EXIT_ASSERT(F.info() == 0);
+
+    Tensor<T,M> b; b.random();
+    Tensor<T,M> x = F.solve(b);
+    FASTOR_EXIT_ASSERT(norm(matmul(A,x) - b) < BigTol);
+    FASTOR_EXIT_ASSERT(norm(solve<SolveCompType::Chol>(A,b) - x) < BigTol);
+    FASTOR_EXIT_ASSERT(norm(solve<SolveCompType::Chol>(A+0,b) - x) < BigTol);
+
+    Tensor<T,M,4> C; C.random();
+    Tensor<T,M,4> X = F.solve(C);
+    FASTOR_EXIT_ASSERT(norm(matmul(A,X) - C) < BigTol);
+    F.solve_inplace(C);
+    FASTOR_EXIT_ASSERT(norm(C - X) < BigTol);
+
+    // L * L^T = A
+    Tensor<T,M,M> L; L.zeros();
+    for (size_t i=0; i<M; ++i)
+        for (size_t j=0; j<=i; ++j)
+            L(i,j) = F.factors()(i,j);
+    FASTOR_EXIT_ASSERT(norm(matmul(L,transpose(L)) - A) < BigTol);
+
+    const T det = determinant<DetCompType::LU>(A);
+    FASTOR_EXIT_ASSERT(std::abs(F.determinant() - det) < BigTol*std::max(T(1),std::abs(det)));
+
+    const T rc = F.rcond();
+    const T rc_exact = exact_rcond(A);
+    FASTOR_EXIT_ASSERT(rc >= rc_exact*(1-BigTol) && rc <= 10*rc_exact);
+}
+
+template<typename T>
+void test_factor() {
+
+    // fixed values
+    {
+        Tensor<T,3,3> A = {{4,12,-16},{12,37,-43},{-16,-43,98}};
+        auto F = cholesky_factor(A);
+        FASTOR_EXIT_ASSERT(std::abs(F.factors()(0,0) - 2) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(F.factors()(1,0) - 6) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(F.factors()(2,0) + 8) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(F.factors()(1,1) - 1) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(F.factors()(2,1) - 5) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(F.factors()(2,2) - 3) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(F.determinant() - 36) < BigTol);
+
+        auto G = lu_factor(A);
+        FASTOR_EXIT_ASSERT(std::abs(G.determinant() - 36) < BigTol);
+
+        // rcond of identity is one
+        Tensor<T,3,3> I; I.eye2();
+        FASTOR_EXIT_ASSERT(std::abs(lu_factor(I).rcond() - 1) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(cholesky_factor(I).rcond() - 1) < Tol);
+
+        // singular
+        Tensor<T,3,3> S = {{1,2,3},{2,4,6},{1,1,1}};
+        auto H = lu_factor(S);
+        FASTOR_EXIT_ASSERT(H.info() != 0);
+        FASTOR_EXIT_ASSERT(H.rcond() == 0);
+        FASTOR_EXIT_ASSERT(std::abs(H.determinant()) < Tol);
+        FASTOR_EXIT_ASSERT(rcond(S) == 0);
+
+        // symmetric but not positive definite
+        Tensor<T,3,3> N = {{4,2,1},{2,1,3},{1,3,5}};
+        auto K = cholesky_factor(N);
+        FASTOR_EXIT_ASSERT(K.info() == 2);
+        FASTOR_EXIT_ASSERT(K.rcond() == 0);
+        K.factorise(A);
+        FASTOR_EXIT_ASSERT(K.info() == 0);
+        FASTOR_EXIT_ASSERT(std::abs(K.determinant() - 36) < BigTol);
+    }
+
+    // ill-conditioned - Hilbert matrices
+    {
+        Tensor<T,6,6> H;
+        for (size_t i=0; i<6; ++i)
+            for (size_t j=0; j<6; ++j)
+                H(i,j) = T(1) / T(i+j+1);
+        // exact 1-norm condition number of the 6x6 Hilbert matrix is 2.9070279e+07
+        const T rc = rcond(H);
+        FASTOR_EXIT_ASSERT(rc >= T(1)/T(2.907028e+07) && rc < T(3)/T(2.907028e+07));
+
+        // refinement converges for moderate condition numbers
+        Tensor<T,6> b(1);
+        Tensor<T,6> x = solve<SolveCompType::Refined>(H,b);
+        FASTOR_EXIT_ASSERT(norm(x - lu_factor(H).solve(b)) < HugeTol*BigTol*norm(x));
+
+        // and falls back to working precision for when it does not
+        Tensor<T,11,11> H11;
+        for (size_t i=0; i<11; ++i)
+            for (size_t j=0; j<11; ++j)
+                H11(i,j) = T(1) / T(i+j+1);
+        Tensor<T,11> b11(1);
+        Tensor<T,11> x11 = solve<SolveCompType::Refined>(H11,b11);
+        FASTOR_EXIT_ASSERT(norm(x11 - lu_factor(H11).solve(b11)) < BigTol*norm(x11));
+        FASTOR_EXIT_ASSERT(rcond(H11) < T(1e-12));
+    }
+
+    // refinement falls back to working precision when A or b overflow the lower precision
+    {
+        Tensor<T,5,5> A; A.random();
+        for (size_t i=0; i<5; ++i) A(i,i) += T(5);
+        Tensor<T,5> b; b.random();
+        const Tensor<T,5,5> As = T(1e300)*A;
+        const Tensor<T,5> bs = T(1e300)*b;
+
+        const Tensor<T,5> x = lu_factor(A).solve(b);
+        FASTOR_EXIT_ASSERT(norm(solve<SolveCompType::Refined>(As,bs) - x) < BigTol*norm(x));
+        // compare scaled back solutions as norm would overflow/underflow
+        FASTOR_EXIT_ASSERT(norm(solve<SolveCompType::Refined>(A,bs)/T(1e300) - x) < BigTol*norm(x));
+        FASTOR_EXIT_ASSERT(norm(T(1e300)*solve<SolveCompType::Refined>(As,b) - x) < BigTol*norm(x));
+    }
+
+    // rcond of complex matrices
+    {
+        using C = std::complex<T>;
+        Tensor<C,4,4> I; I.eye2();
+        FASTOR_EXIT_ASSERT(std::abs(lu_factor(I).rcond() - 1) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(rcond(I) - 1) < Tol);
+
+        Tensor<C,7,7> A;
+        for (size_t i=0; i<7; ++i)
+            for (size_t j=0; j<7; ++j)
+                A(i,j) = C(std::sin(T(3*i+j+1)),std::cos(T(i*j+2)));
+        Tensor<C,7,7> E; E.eye2();
+        const Tensor<C,7,7> invA = lu_factor(A).solve(E);
+        const T rc_exact = T(1) / (internal::matrix_norm1(A) * internal::matrix_norm1(invA));
+        const T rc = rcond(A);
+        FASTOR_EXIT_ASSERT(rc >= rc_exact*(1-BigTol) && rc <= 10*rc_exact);
+    }
+
+    test_lu_factor<T,2>();
+    test_lu_factor<T,3>();
+    test_lu_factor<T,4>();
+    test_lu_factor<T,7>();
+    test_lu_factor<T,12>();
+    test_lu_factor<T,20>();
+    test_lu_factor<T,35>();
+
+    test_cholesky_factor<T,2>();
+    test_cholesky_factor<T,3>();
+    test_cholesky_factor<T,6>();
+    test_cholesky_factor<T,16>();
+    test_cholesky_factor<T,21>();
+
+    print(FGRN(BOLD("All tests passed successfully")));
+
+}
+
+int main() {
+
+    print(FBLU(BOLD("Testing factorisation objects: double precision")));
+    test_factor<double>();
+
+    return 0;
+}
@@ -268,8 +268,8 @@ void test_factorisation() {
             FASTOR_EXIT_ASSERT(std::abs(sum(A - L % U)) < BigTol);
         }
 
-        // LU 33x33 - this is just to check for compilation as size 33
-        // is when we switch over to block recursive algorithm
+        // LU 33x33 - this is just to check for compilation of the blocked
+        // algorithm with a partial last panel
         {
             constexpr size_t M = 33;
             Tensor<size_t,M> p;
@@ -312,6 +312,59 @@ void test_factorisation() {
             FASTOR_EXIT_ASSERT(std::abs(sum(A - reconstruct(L, U, P))) < BigTol);
         }
 
+        // LU 20x20 and 64x64 - blocked right-looking algorithm with matrices
+        // that require row interchanges
+        {
+            constexpr size_t M = 20;
+            Tensor<size_t,M> p;
+            Tensor<T,M,M> L, U, P;
+
+            Tensor<T,M,M> A; A.random();
+            for (size_t i=0; i<M; ++i) {
+                A(i,i) = T(1e-3);
+            }
+
+            lu<LUCompType::BlockLUPiv>(A, L, U, p);
+            FASTOR_EXIT_ASSERT(norm(A - reconstruct(L, U, p)) < BigTol);
+            for (size_t i=0; i<M; ++i) {
+                for (size_t j=0; j<i; ++j) {
+                    FASTOR_EXIT_ASSERT(std::abs(L(i,j)) <= T(1) + Tol);
+                }
+            }
+
+            lu<LUCompType::BlockLUPiv>(A, L, U, P);
+            FASTOR_EXIT_ASSERT(norm(A - reconstruct(L, U, P)) < BigTol);
+
+            lu<LUCompType::SimpleLUPiv>(A, L, U, p);
+            FASTOR_EXIT_ASSERT(norm(A - reconstruct(L, U, p)) < BigTol);
+
+            // swapping two rows flips the sign of the determinant
+            T det0 = determinant<DetCompType::LU>(A);
+            FASTOR_EXIT_ASSERT(std::abs(std::abs(det0) - std::abs(product(diag(U)))) < BigTol*std::max(T(1),std::abs(det0)));
+            Tensor<T,M,M> As = A;
+            for (size_t j=0; j<M; ++j) std::swap(As(0,j),As(M-1,j));
+            T det1 = determinant<DetCompType::LU>(As);
+            FASTOR_EXIT_ASSERT(std::abs(det0 + det1) < BigTol*std::max(T(1),std::abs(det0)));
+
+            Tensor<T,M,M> B = A;
+            for (size_t i=0; i<M; ++i) {
+                B(i,i) = T(2*M);
+            }
+            lu<LUCompType::BlockLU>(B, L, U);
+            FASTOR_EXIT_ASSERT(norm(B - matmul(L, U)) < BigTol);
+        }
+        {
+            constexpr size_t M = 64;
+            Tensor<size_t,M> p;
+            Tensor<T,M,M> L, U;
+
+            Tensor<T,M,M> A; A.random();
+            A(0,0) = 0;
+
+            lu<LUCompType::BlockLUPiv>(A, L, U, p);
+            FASTOR_EXIT_ASSERT(norm(A - reconstruct(L, U, p)) < BigTol);
+        }
+
         // LU 3x3 - std::complex LU
         {
             using TT = std::complex<double>;
@@ -0,0 +1,161 @@
+#include <Fastor/Fastor.h>
+
+using namespace Fastor;
+
+
+#define Tol 1e-12
+#define BigTol 1e-5
+
+
+template<typename T, size_t M, size_t K, size_t N>
+Tensor<T,M,N> matmul_ref(const Tensor<T,M,K> &a, const Tensor<T,K,N> &b) {
+    Tensor<T,M,N> out; out.zeros();
+    for (size_t i=0; i<M; ++i) {
+        for (size_t j=0; j<K; ++j) {
+            for (size_t k=0; k<N; ++k) {
+                out(i,k) += a(i,j)*b(j,k);
+            }
+        }
+    }
+    return out;
+}
+
+struct square_plus_one {
+    template<typename U>
+    U operator()(const U &x) const {return x*x + U(1);}
+};
+
+
+template<typename T, size_t M, size_t K, size_t N>
+void test_epilogues(T tol) {
+
+    Tensor<T,M,K> a; a.random();
+    Tensor<T,K,N> b; b.random();
+    Tensor<T,M,N> c; c.random();
+    const Tensor<T,M,N> c0 = c;
+    const Tensor<T,M,N> ab = matmul_ref(a,b);
+    const T alpha = 2, beta = -0.5;
+
+    // scaling
+    {
+        Tensor<T,M,N> d = alpha*(a%b);
+        Tensor<T,M,N> ref = alpha*ab;
+        FASTOR_EXIT_ASSERT(norm(d - ref) < tol*norm(ref));
+        d = (a%b)*alpha;
+        FASTOR_EXIT_ASSERT(norm(d - ref) < tol*norm(ref));
+    }
+
+    // axpby into the tensor that is assigned to and into another one
+    {
+        c = alpha*(a%b) + beta*c;
+        Tensor<T,M,N> ref = alpha*ab + beta*c0;
+        FASTOR_EXIT_ASSERT(norm(c - ref) < tol*norm(ref));
+
+        Tensor<T,M,N> d = c0*beta - (a%b);
+        ref = beta*c0 - ab;
+        FASTOR_EXIT_ASSERT(norm(d - ref) < tol*norm(ref));
+
+        d = (a%b) - c0;
+        ref = ab - c0;
+        FASTOR_EXIT_ASSERT(norm(d - ref) < tol*norm(ref));
+    }
+
+    // compound assignments
+    {
+        c = c0;
+        c += alpha*(a%b);
+        Tensor<T,M,N> ref = c0 + alpha*ab;
+        FASTOR_EXIT_ASSERT(norm(c - ref) < tol*norm(ref));
+
+        c = c0;
+        c -= a%b;
+        ref = c0 - ab;
+        FASTOR_EXIT_ASSERT(norm(c - ref) < tol*norm(ref));
+
+        c = c0;
+        c *= a%b;
+        ref = c0*ab;
+        FASTOR_EXIT_ASSERT(norm(c - ref) < tol*norm(ref));
+
+        c = c0;
+        c /= a%b;
+        ref = c0/ab;
+        FASTOR_EXIT_ASSERT(norm(c - ref) < tol*norm(ref));
+    }
+
+    // activations
+    {
+        Tensor<T,M,N> d = tanh(a%b);
+        Tensor<T,M,N> ref = tanh(ab);
+        FASTOR_EXIT_ASSERT(norm(d - ref) < tol*norm(ref));
+
+        d = exp(alpha*(a%b) + beta*c0);
+        ref = exp(alpha*ab + beta*c0);
+        FASTOR_EXIT_ASSERT(norm(d - ref) < tol*norm(ref));
+
+        d = matmul(a,b,square_plus_one());
+        ref = ab*ab + T(1);
+        FASTOR_EXIT_ASSERT(norm(d - ref) < tol*norm(ref));
+    }
+
+    // product operands that are expressions or alias the output
+    {
+        Tensor<T,K,K> s; s.random();
+        Tensor<T,K,K> s0 = s;
+        s = tanh(transpose(s)%s);
+        Tensor<T,K,K> ref = tanh(matmul_ref(Tensor<T,K,K>(transpose(s0)),s0));
+        FASTOR_EXIT_ASSERT(norm(s - ref) < tol*norm(ref));
+    }
+}
+
+template<typename T>
+void test_einsum_epilogues(T tol) {
+
+    enum {i,j,k,l};
+    // single GEMM
+    {
+        Tensor<T,3,4,5> a; a.random();
+        Tensor<T,5,7> b; b.random();
+        auto d = einsum<Index<i,j,k>,Index<k,l>>(a,b,square_plus_one());
+        auto ab = einsum<Index<i,j,k>,Index<k,l>>(a,b);
+        decltype(ab) ref = ab*ab + T(1);
+        FASTOR_EXIT_ASSERT(norm(d - ref) < tol*norm(ref));
+    }
+    // anything else
+    {
+        Tensor<T,3,4,5> a; a.random();
+        Tensor<T,4,6> b; b.random();
+        auto d = einsum<Index<i,j,k>,Index<j,l>>(a,b,square_plus_one());
+        auto ab = einsum<Index<i,j,k>,Index<j,l>>(a,b);
+        decltype(ab) ref = ab*ab + T(1);
+        FASTOR_EXIT_ASSERT(norm(d - ref) < tol*norm(ref));
+    }
+}
+
+
+template<typename T>
+void run(T tol) {
+    test_epilogues<T,2,2,2>(tol);
+    test_epilogues<T,4,4,4>(tol);
+    test_epilogues<T,3,9,2>(tol);
+    test_epilogues<T,7,5,13>(tol);
+    test_epilogues<T,16,16,16>(tol);
+    test_epilogues<T,33,17,19>(tol);
+    // products with a specialised _matmul kernel
+    test_epilogues<T,2,5,2>(tol);
+    test_epilogues<T,3,4,3>(tol);
+    test_epilogues<T,4,9,4>(tol);
+    test_epilogues<T,8,3,8>(tol);
+    test_einsum_epilogues<T>(tol);
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+int main() {
+
+    print(FBLU(BOLD("Testing matmul epilogues: single precision")));
+    run<float>(BigTol);
+    print(FBLU(BOLD("Testing matmul epilogues: double precision")));
+    run<double>(Tol);
+
+    return 0;
+}
@@ -191,6 +191,21 @@ void run_permute_3d() {
         }
     }
 
+    // index labels that are not 0..n-1 - only their order matters
+    {
+        enum {p=2,q=5,r=7};
+        Tensor<T,I,J,K> a; a.iota(13);
+
+        auto b0 = permute<Index<q,r,p>>(a);
+        FASTOR_EXIT_ASSERT( norm(b0 - permute<Index<j,k,i>>(a)) < Tol );
+        auto b1 = permute<Index<r,p,q>>(a);
+        FASTOR_EXIT_ASSERT( norm(b1 - permute<Index<k,i,j>>(a)) < Tol );
+        auto b2 = permute<Index<p,r,q>>(a+0);
+        FASTOR_EXIT_ASSERT( norm(b2 - permute<Index<i,k,j>>(a)) < Tol );
+        auto b3 = permute<Index<p,q,r>>(a);
+        FASTOR_EXIT_ASSERT( norm(b3 - a) < Tol );
+    }
+
     print(FGRN(BOLD("All tests passed successfully")));
 }
 
@@ -533,6 +548,8 @@ void run() {
     run_permute_3d<T,4,4,4>();
     // non-uniform
     run_permute_3d<T,3,5,11>();
+    // large enough for whole and partial transpose tiles
+    run_permute_3d<T,9,8,17>();
 
     // 4D
     // uniform
@@ -541,6 +558,8 @@ void run() {
     run_permute_4d<T,4,4,4,4>();
     // non-uniform
     run_permute_4d<T,2,3,4,5>();
+    // large enough for whole and partial transpose tiles
+    run_permute_4d<T,8,3,17,16>();
 
     // 5D
     // uniform
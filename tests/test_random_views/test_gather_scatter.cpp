@@ -0,0 +1,204 @@
+#include <Fastor/Fastor.h>
+using namespace Fastor;
+
+
+#define Tol 1e-12
+#define BigTol 1e-5
+
+template<typename T>
+void test_random_views(T tol) {
+
+    using std::abs;
+    // indices with repetitions - every update to the same element has to survive
+    {
+        Tensor<T,23> a; a.iota(1);
+        Tensor<T,37> b; b.random();
+        Tensor<int,37> it;
+        for (int i=0; i<37; ++i) it(i) = (7*i) % 11 + (i % 3 == 0 ? 0 : 5);
+
+        Tensor<T,23> ref = a;
+        for (int i=0; i<37; ++i) ref(it(i)) += b(i);
+        a(it) += b;
+        FASTOR_EXIT_ASSERT(norm(a - ref) < tol*norm(ref));
+
+        for (int i=0; i<37; ++i) ref(it(i)) -= T(2)*b(i);
+        a(it) -= T(2)*b;
+        FASTOR_EXIT_ASSERT(norm(a - ref) < tol*norm(ref));
+
+        for (int i=0; i<37; ++i) ref(it(i)) *= T(1) + b(i);
+        a(it) *= T(1) + b;
+        FASTOR_EXIT_ASSERT(norm(a - ref) < tol*norm(ref));
+
+        for (int i=0; i<37; ++i) ref(it(i)) /= T(2) + b(i);
+        a(it) /= T(2) + b;
+        FASTOR_EXIT_ASSERT(norm(a - ref) < tol*norm(ref));
+
+        for (int i=0; i<37; ++i) ref(it(i)) += T(3);
+        a(it) += 3;
+        FASTOR_EXIT_ASSERT(norm(a - ref) < tol*norm(ref));
+
+        // the last of the repeated indices wins
+        for (int i=0; i<37; ++i) ref(it(i)) = b(i);
+        a(it) = b;
+        FASTOR_EXIT_ASSERT(norm(a - ref) < tol*norm(ref));
+    }
+
+    // gathers and scatters without repetitions and negative indices
+    {
+        Tensor<T,40> a; a.random();
+        Tensor<T,40> c; c.zeros();
+        Tensor<int,40> it;
+        for (int i=0; i<40; ++i) it(i) = (13*i) % 40;
+
+        Tensor<T,40> g = a(it);
+        for (int i=0; i<40; ++i) FASTOR_EXIT_ASSERT(abs(g(i) - a(it(i))) < tol);
+        c(it) = a;
+        for (int i=0; i<40; ++i) FASTOR_EXIT_ASSERT(abs(c(it(i)) - a(i)) < tol);
+        c(it) += T(2)*a(it);
+        for (int i=0; i<40; ++i) FASTOR_EXIT_ASSERT(abs(c(it(i)) - a(i) - T(2)*a(it(i))) < tol);
+
+        Tensor<int,17> neg; neg.iota(-17);
+        Tensor<T,17> d; d.random();
+        Tensor<T,40> e = a;
+        e(neg) = d;
+        for (int i=0; i<17; ++i) FASTOR_EXIT_ASSERT(abs(e(23+i) - d(i)) < tol);
+        e(neg) += d;
+        for (int i=0; i<17; ++i) FASTOR_EXIT_ASSERT(abs(e(23+i) - T(2)*d(i)) < tol);
+    }
+
+    // multi-dimensional views assembling element matrices
+    {
+        Tensor<T,9,9> K; K.zeros();
+        Tensor<T,4,4> Ke; Ke.random();
+        Tensor<size_t,4> dofs = {1,4,5,8};
+        Tensor<size_t,4> dofs2 = {4,5,7,8};
+        Tensor<T,9,9> ref; ref.zeros();
+        for (int i=0; i<4; ++i) for (int j=0; j<4; ++j) {
+            ref(dofs(i),dofs(j)) += Ke(i,j);
+            ref(dofs2(i),dofs2(j)) += Ke(j,i);
+        }
+        K(dofs,dofs) += Ke;
+        K(dofs2,dofs2) += transpose(Ke);
+        FASTOR_EXIT_ASSERT(norm(K - ref) < tol*norm(ref));
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+
+template<typename T>
+void test_filter_views(T tol) {
+
+    using std::abs;
+    {
+        Tensor<T,5,7> a; a.random();
+        Tensor<T,5,7> b; b.random();
+        Tensor<bool,5,7> m = a > T(0.5);
+        const Tensor<T,5,7> a0 = a;
+
+        Tensor<T,5,7> f = a(m);
+        for (size_t i=0; i<a.size(); ++i) FASTOR_EXIT_ASSERT(abs(f.data()[i] - (m.data()[i] ? a0.data()[i] : T(0))) < tol);
+
+        a(m) = b;
+        for (size_t i=0; i<a.size(); ++i) FASTOR_EXIT_ASSERT(abs(a.data()[i] - (m.data()[i] ? b.data()[i] : a0.data()[i])) < tol);
+        a = a0;
+        a(m) += T(2)*b;
+        for (size_t i=0; i<a.size(); ++i) FASTOR_EXIT_ASSERT(abs(a.data()[i] - (m.data()[i] ? a0.data()[i] + T(2)*b.data()[i] : a0.data()[i])) < tol);
+        a = a0;
+        a(m) -= b;
+        for (size_t i=0; i<a.size(); ++i) FASTOR_EXIT_ASSERT(abs(a.data()[i] - (m.data()[i] ? a0.data()[i] - b.data()[i] : a0.data()[i])) < tol);
+        a = a0;
+        a(m) *= b;
+        for (size_t i=0; i<a.size(); ++i) FASTOR_EXIT_ASSERT(abs(a.data()[i] - (m.data()[i] ? a0.data()[i] * b.data()[i] : a0.data()[i])) < tol);
+        a = a0;
+        a(m) /= T(1) + b;
+        for (size_t i=0; i<a.size(); ++i) FASTOR_EXIT_ASSERT(abs(a.data()[i] - (m.data()[i] ? a0.data()[i] / (T(1) + b.data()[i]) : a0.data()[i])) < tol);
+        a = a0;
+        a(m) = 3;
+        a(m) *= 2;
+        a(m) -= 1;
+        for (size_t i=0; i<a.size(); ++i) FASTOR_EXIT_ASSERT(abs(a.data()[i] - (m.data()[i] ? T(5) : a0.data()[i])) < tol);
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+
+template<typename T>
+void test_integral_views() {
+
+    // scatters through the generic data_setter
+    {
+        using V = SIMDVector<T,simd_abi::native>;
+        T vals[V::Size];
+        for (size_t j=0; j<V::Size; ++j) vals[j] = T(3*j+1);
+        V vec; vec.load(vals,false);
+        std::array<int,V::Size> inds;
+        for (size_t j=0; j<V::Size; ++j) inds[j] = int(2*(V::Size-1-j)+1);
+        T out[2*V::Size+1] = {};
+        data_setter(out,vec,inds);
+        for (size_t j=0; j<V::Size; ++j) FASTOR_EXIT_ASSERT(out[inds[j]] == vals[j]);
+    }
+
+    // random views with repeated indices
+    {
+        Tensor<T,23> a; a.iota(1);
+        Tensor<T,37> b; b.iota(2);
+        Tensor<int,37> it;
+        for (int i=0; i<37; ++i) it(i) = (7*i) % 11 + (i % 3 == 0 ? 0 : 5);
+
+        Tensor<T,23> ref = a;
+        for (int i=0; i<37; ++i) ref(it(i)) += b(i);
+        a(it) += b;
+        for (int i=0; i<23; ++i) FASTOR_EXIT_ASSERT(a(i) == ref(i));
+        for (int i=0; i<37; ++i) ref(it(i)) *= 2;
+        a(it) *= 2;
+        for (int i=0; i<23; ++i) FASTOR_EXIT_ASSERT(a(i) == ref(i));
+        for (int i=0; i<37; ++i) ref(it(i)) = b(i);
+        a(it) = b;
+        for (int i=0; i<23; ++i) FASTOR_EXIT_ASSERT(a(i) == ref(i));
+    }
+
+    // filter views, dividing by zero only in lanes that are not selected
+    {
+        Tensor<T,5,7> a; a.iota(10);
+        Tensor<T,5,7> b; b.iota(1);
+        Tensor<bool,5,7> m;
+        for (size_t i=0; i<m.size(); ++i) m.data()[i] = i % 3 != 1;
+        for (size_t i=0; i<m.size(); ++i) if (!m.data()[i]) b.data()[i] = 0;
+        const Tensor<T,5,7> a0 = a;
+
+        a(m) = 7;
+        for (size_t i=0; i<a.size(); ++i) FASTOR_EXIT_ASSERT(a.data()[i] == (m.data()[i] ? T(7) : a0.data()[i]));
+        a = a0;
+        a(m) = b;
+        for (size_t i=0; i<a.size(); ++i) FASTOR_EXIT_ASSERT(a.data()[i] == (m.data()[i] ? b.data()[i] : a0.data()[i]));
+        a = a0;
+        a(m) += b;
+        for (size_t i=0; i<a.size(); ++i) FASTOR_EXIT_ASSERT(a.data()[i] == (m.data()[i] ? a0.data()[i] + b.data()[i] : a0.data()[i]));
+        a = a0;
+        a(m) /= b;
+        for (size_t i=0; i<a.size(); ++i) FASTOR_EXIT_ASSERT(a.data()[i] == (m.data()[i] ? a0.data()[i] / b.data()[i] : a0.data()[i]));
+        a = a0;
+        a(m) /= 3;
+        for (size_t i=0; i<a.size(); ++i) FASTOR_EXIT_ASSERT(a.data()[i] == (m.data()[i] ? a0.data()[i] / 3 : a0.data()[i]));
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+
+int main() {
+
+    print(FBLU(BOLD("Testing gathers and scatters through views: single precision")));
+    test_random_views<float>(BigTol);
+    test_filter_views<float>(BigTol);
+    print(FBLU(BOLD("Testing gathers and scatters through views: double precision")));
+    test_random_views<double>(Tol);
+    test_filter_views<double>(Tol);
+    print(FBLU(BOLD("Testing gathers and scatters through views: integers")));
+    test_integral_views<int>();
+    test_integral_views<Int64>();
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+#include <Fastor/Fastor.h>
+using namespace Fastor;
+
+
+#define Tol 1e-12
+#define BigTol 1e-5
+
+template<typename T>
+void test_scatter_add(T tol) {
+
+    // no repetitions, all indices the same and pairs of indices in every SIMD vector
+    {
+        Tensor<T,29> a; a.iota(1);
+        Tensor<T,53> b; b.random();
+        Tensor<int,53> it0, it1, it2;
+        for (int i=0; i<53; ++i) {
+            it0(i) = (3*i) % 29;
+            it1(i) = 11;
+            it2(i) = (i/2) % 29;
+        }
+
+        for (const Tensor<int,53> *it : {&it0, &it1, &it2}) {
+            Tensor<T,29> c = a;
+            Tensor<T,29> ref = a;
+            for (int i=0; i<53; ++i) ref((*it)(i)) += b(i);
+            scatter_add(c,*it,b);
+            FASTOR_EXIT_ASSERT(norm(c - ref) < tol*norm(ref));
+        }
+    }
+
+    // element assembly with dofs shared between elements and within an element
+    {
+        constexpr size_t nelem = 9, ndof = 6;
+        Tensor<T,20> F; F.zeros();
+        Tensor<size_t,nelem,ndof> dofs;
+        Tensor<T,nelem,ndof> Fe; Fe.random();
+        for (size_t e=0; e<nelem; ++e) {
+            for (size_t j=0; j<ndof; ++j) {
+                dofs(e,j) = (2*e + j + (j==5 ? 0 : 1)) % 20;
+            }
+        }
+
+        Tensor<T,20> ref; ref.zeros();
+        for (size_t e=0; e<nelem; ++e) {
+            for (size_t j=0; j<ndof; ++j) {
+                ref(dofs(e,j)) += Fe(e,j);
+            }
+        }
+        scatter_add(F,dofs,Fe);
+        FASTOR_EXIT_ASSERT(norm(F - ref) < tol*norm(ref));
+
+        // expressions as values
+        scatter_add(F,dofs,T(2)*Fe);
+        FASTOR_EXIT_ASSERT(norm(F - T(3)*ref) < tol*norm(ref));
+
+        // into a map of a global vector
+        T storage[20] = {};
+        TensorMap<T,20> Fm(storage);
+        scatter_add(Fm,dofs,Fe);
+        FASTOR_EXIT_ASSERT(norm(Fm - ref) < tol*norm(ref));
+    }
+
+    // random views accumulate repeated indices through the same kernel
+    {
+        Tensor<T,7> a; a.zeros();
+        Tensor<T,48> b; b.random();
+        Tensor<int,48> it;
+        for (int i=0; i<48; ++i) it(i) = i % 7;
+        Tensor<T,7> ref; ref.zeros();
+        for (int i=0; i<48; ++i) ref(it(i)) += b(i);
+        a(it) += b;
+        FASTOR_EXIT_ASSERT(norm(a - ref) < tol*norm(ref));
+        a(it) -= b;
+        FASTOR_EXIT_ASSERT(norm(a) < tol*norm(ref));
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+template<typename T>
+void test_coloured_scatter_add(T tol) {
+
+    // a chain of quadratic line elements sharing their end nodes with two dofs per node
+    constexpr size_t nelem = 64, ndof = 6;
+    constexpr size_t nnodes = 2*nelem + 1;
+    Tensor<int,nelem,ndof> dofs;
+    for (size_t e=0; e<nelem; ++e) {
+        for (size_t n=0; n<3; ++n) {
+            dofs(e,2*n)   = int(2*(2*e+n));
+            dofs(e,2*n+1) = int(2*(2*e+n)+1);
+        }
+    }
+    Tensor<T,nelem,ndof> Fe; Fe.random();
+
+    const auto colours = colour_elements(dofs);
+    FASTOR_EXIT_ASSERT(colours.size() == 2);
+    std::vector<int> seen(nelem,0);
+    for (const auto &colour : colours) {
+        std::vector<int> used(2*nnodes,0);
+        for (size_t e : colour) {
+            ++seen[e];
+            for (size_t j=0; j<ndof; ++j) {
+                FASTOR_EXIT_ASSERT(used[dofs(e,j)] == 0);
+                used[dofs(e,j)] = 1;
+            }
+        }
+    }
+    for (size_t e=0; e<nelem; ++e) FASTOR_EXIT_ASSERT(seen[e] == 1);
+
+    Tensor<T,2*nnodes> ref; ref.zeros();
+    scatter_add(ref,dofs,Fe);
+    for (size_t nthreads : {1, 2, 3, 8, 100}) {
+        Tensor<T,2*nnodes> F; F.zeros();
+        scatter_add(F,dofs,Fe,colours,nthreads);
+        FASTOR_EXIT_ASSERT(norm(F - ref) < tol*norm(ref));
+    }
+
+    // elements repeating a dof among their own dofs
+    Tensor<int,nelem,ndof> rdofs;
+    for (size_t e=0; e<nelem; ++e) {
+        for (size_t j=0; j<ndof; ++j) {
+            rdofs(e,j) = int((5*e + j/2) % 40);
+        }
+    }
+    const auto rcolours = colour_elements(rdofs);
+    Tensor<T,40> rref; rref.zeros();
+    for (size_t e=0; e<nelem; ++e) {
+        for (size_t j=0; j<ndof; ++j) {
+            rref(rdofs(e,j)) += Fe(e,j);
+        }
+    }
+    Tensor<T,40> R; R.zeros();
+    scatter_add(R,rdofs,Fe,rcolours,4);
+    FASTOR_EXIT_ASSERT(norm(R - rref) < tol*norm(rref));
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+int main() {
+
+    print(FBLU(BOLD("Testing scatter-add: single precision")));
+    test_scatter_add<float>(BigTol);
+    test_coloured_scatter_add<float>(BigTol);
+    print(FBLU(BOLD("Testing scatter-add: double precision")));
+    test_scatter_add<double>(Tol);
+    test_coloured_scatter_add<double>(Tol);
+
+    return 0;
+}
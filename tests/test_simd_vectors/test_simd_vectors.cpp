@@ -194,6 +194,16 @@ void test_simd_vectors() {
     auto n = t1.Size;
     FASTOR_EXIT_ASSERT((t1.dot(t1) - n*(2*n*n+3*n+1)/6)< Tol, "TEST FAILED");
 
+    // select on comparison masks
+    {
+        auto t5 = select(t1 > T(n/2), t1, t2);
+        T val_t5[SIMDVector<T,ABI>::Size];
+        t5.store(val_t5,false);
+        for (FASTOR_INDEX i=0; i<n; ++i) {
+            FASTOR_EXIT_ASSERT(val_t5[i] == (T(i+1) > T(n/2) ? T(i+1) : T(i+100)), "TEST FAILED");
+        }
+    }
+
 #if defined(FASTOR_AVX_IMPL) && !defined(FASTOR_AVX512_IMPL)
     FASTOR_EXIT_ASSERT(SIMDVector<double>::size()==4);
     FASTOR_EXIT_ASSERT(SIMDVector<double,simd_abi::avx>::size()==4);
@@ -241,7 +251,11 @@ int main() {
     print(FBLU(BOLD("Testing SIMDVector of single precision - 256")));
     test_simd_vectors<float,simd_abi::avx>();
     print(FBLU(BOLD("Testing SIMDVector of single precision - 512")));
+#ifdef FASTOR_AVX512F_IMPL
+    test_simd_vectors<float,simd_abi::avx512>();
+#else
     test_simd_vectors<float,simd_abi::fixed_size<16>>();
+#endif
 
     print(FBLU(BOLD("Testing SIMDVector of double precision - 64")));
     test_simd_vectors<double,simd_abi::scalar>();
@@ -250,7 +264,11 @@ int main() {
     print(FBLU(BOLD("Testing SIMDVector of double precision - 256")));
     test_simd_vectors<double,simd_abi::avx>();
     print(FBLU(BOLD("Testing SIMDVector of double precision - 512")));
+#ifdef FASTOR_AVX512F_IMPL
+    test_simd_vectors<double,simd_abi::avx512>();
+#else
     test_simd_vectors<double,simd_abi::fixed_size<8>>();
+#endif
 
     print(FBLU(BOLD("Testing SIMDVector of int - 32")));
     test_simd_vectors<int,simd_abi::scalar>();
@@ -267,6 +267,21 @@ void test_solve() {
         FASTOR_EXIT_ASSERT(std::abs(sum(solve<SolveCompType::BlockLUPiv> (A,b) - sol)) < BigTol);
         FASTOR_EXIT_ASSERT(std::abs(sum(solve<SolveCompType::SimpleLUPiv>(A,b) - sol)) < BigTol);
     }
+    {
+        // requires row interchanges
+        constexpr size_t M = 24;
+        Tensor<T,M,M> A; A.random();
+        for (size_t i=0; i<M; ++i) A(i,i) = T(0);
+        Tensor<T,M> b; b.random();
+        Tensor<T,M,3> B; B.random();
+
+        FASTOR_EXIT_ASSERT(norm(matmul(A,solve<SolveCompType::BlockLUPiv> (A,b)) - b) < BigTol);
+        FASTOR_EXIT_ASSERT(norm(matmul(A,solve<SolveCompType::SimpleLUPiv>(A,b)) - b) < BigTol);
+        FASTOR_EXIT_ASSERT(norm(matmul(A,solve<SolveCompType::BlockLUPiv> (A,B)) - B) < BigTol);
+        FASTOR_EXIT_ASSERT(norm(matmul(A,solve<SolveCompType::SimpleLUPiv>(A,B)) - B) < BigTol);
+        Tensor<T,M,M> I; I.eye2();
+        FASTOR_EXIT_ASSERT(norm(matmul(A,inverse<InvCompType::BlockLUPiv>(A)) - I) < BigTol);
+    }
 
     // complex valued solve - issue 110
     {
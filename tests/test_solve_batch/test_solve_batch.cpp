@@ -0,0 +1,101 @@
+#include <Fastor/Fastor.h>
+
+using namespace Fastor;
+
+
+#define Tol 1e-12
+#define BigTol 1e-5
+#define HugeTol 1e-2
+
+
+template<typename T, size_t B, size_t M>
+void test_solve_batch_random() {
+    Tensor<T,B,M,M> A; A.random();
+    Tensor<T,B,M> b; b.random();
+    // zero diagonals force every system to pivot
+    for (size_t k=0; k<B; ++k) {
+        for (size_t i=0; i<M; ++i) A(k,i,i) = T(0);
+        A(k,0,M-1) += T(2);
+    }
+
+    Tensor<T,B,M> x = solve(A,b);
+    for (size_t k=0; k<B; ++k) {
+        Tensor<T,M,M> Ak = A(k,all,all);
+        Tensor<T,M> bk = b(k,all);
+        Tensor<T,M> xk = x(k,all);
+        FASTOR_EXIT_ASSERT(norm(matmul(Ak,xk) - bk) < HugeTol);
+        FASTOR_EXIT_ASSERT(norm(xk - solve<SolveCompType::BlockLUPiv>(Ak,bk)) < HugeTol*norm(xk));
+    }
+}
+
+template<typename T>
+void test_solve_batch() {
+
+    // fixed values
+    {
+        Tensor<T,2,2,2> A = {{{0,1},{1,0}},{{2,0},{0,4}}};
+        Tensor<T,2,2> b = {{3,5},{2,8}};
+        Tensor<T,2,2> x = solve(A,b);
+        FASTOR_EXIT_ASSERT(std::abs(x(0,0) - 5) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(x(0,1) - 3) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(x(1,0) - 1) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(x(1,1) - 2) < Tol);
+    }
+
+    // tiny leading pivot - elimination without pivoting loses everything
+    {
+        Tensor<T,9,2,2> A;
+        Tensor<T,9,2> b;
+        for (size_t k=0; k<9; ++k) {
+            A(k,0,0) = T(1e-20); A(k,0,1) = T(1);
+            A(k,1,0) = T(1);     A(k,1,1) = T(1);
+            b(k,0) = T(1); b(k,1) = T(2);
+        }
+        Tensor<T,9,2> x = solve(A,b);
+        for (size_t k=0; k<9; ++k) {
+            FASTOR_EXIT_ASSERT(std::abs(x(k,0) - 1) < BigTol);
+            FASTOR_EXIT_ASSERT(std::abs(x(k,1) - 1) < BigTol);
+        }
+    }
+
+    // batch of higher order
+    {
+        Tensor<T,3,5,3,3> A; A.random();
+        Tensor<T,3,5,3> b; b.random();
+        for (size_t i=0; i<3; ++i)
+            for (size_t j=0; j<5; ++j)
+                for (size_t k=0; k<3; ++k)
+                    A(i,j,k,k) += T(3);
+        Tensor<T,3,5,3> x = solve(A,b);
+        for (size_t i=0; i<3; ++i) {
+            for (size_t j=0; j<5; ++j) {
+                Tensor<T,3,3> Aij = A(i,j,all,all);
+                Tensor<T,3> bij = b(i,j,all);
+                Tensor<T,3> xij = x(i,j,all);
+                FASTOR_EXIT_ASSERT(norm(matmul(Aij,xij) - bij) < BigTol);
+            }
+        }
+    }
+
+    test_solve_batch_random<T,1,3>();
+    test_solve_batch_random<T,7,2>();
+    test_solve_batch_random<T,17,3>();
+    test_solve_batch_random<T,19,4>();
+    test_solve_batch_random<T,33,5>();
+    test_solve_batch_random<T,21,8>();
+    test_solve_batch_random<T,13,12>();
+    test_solve_batch_random<T,11,16>();
+
+    print(FGRN(BOLD("All tests passed successfully")));
+
+}
+
+int main() {
+
+    print(FBLU(BOLD("Testing batched solve: single precision")));
+    test_solve_batch<float>();
+    print(FBLU(BOLD("Testing batched solve: double precision")));
+    test_solve_batch<double>();
+
+    return 0;
+}
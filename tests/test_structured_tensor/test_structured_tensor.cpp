@@ -0,0 +1,161 @@
+#include <Fastor/Fastor.h>
+
+using namespace Fastor;
+
+
+#define Tol 1e-12
+#define BigTol 1e-5
+
+
+// diagonally dominant so that the structured solves need no pivoting
+template<typename T, size_t N>
+Tensor<T,N,N> random_dominant() {
+    Tensor<T,N,N> A; A.random();
+    Tensor<T,N,N> I; I.eye2();
+    return A + T(2*N)*I;
+}
+
+template<typename T, size_t N>
+Tensor<T,N,N> identity() {
+    Tensor<T,N,N> I; I.eye2();
+    return I;
+}
+
+template<typename T, size_t N>
+void test_diagonal() {
+    Tensor<T,N,N> A = random_dominant<T,N>();
+    DiagonalTensor<T,N,N> d(A);
+    Tensor<T,N,N> D = d.dense();
+    for (size_t i=0; i<N; ++i) {
+        FASTOR_EXIT_ASSERT(std::abs(d(i) - A(i,i)) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(d(i,i) - A(i,i)) < Tol);
+        if (i>0) FASTOR_EXIT_ASSERT(std::abs(d(i,0)) < Tol);
+    }
+
+    Tensor<T,N,5> B; B.random();
+    Tensor<T,N> b; b.random();
+    FASTOR_EXIT_ASSERT(norm(matmul(d,B) - matmul(D,B)) < BigTol*norm(matmul(D,B)));
+    FASTOR_EXIT_ASSERT(norm((d % B) - matmul(D,B)) < BigTol*norm(matmul(D,B)));
+    FASTOR_EXIT_ASSERT(norm(matmul(d,b) - matmul(D,b)) < BigTol*norm(matmul(D,b)));
+    FASTOR_EXIT_ASSERT(norm((d % (B + 1)) - matmul(D,B+1)) < BigTol*norm(matmul(D,B+1)));
+    FASTOR_EXIT_ASSERT(norm(matmul(A,d) - matmul(A,D)) < BigTol*norm(matmul(A,D)));
+    FASTOR_EXIT_ASSERT(norm((A % d) - matmul(A,D)) < BigTol*norm(matmul(A,D)));
+    FASTOR_EXIT_ASSERT(norm(((2*A) % d) - matmul(2*A,D)) < BigTol*norm(matmul(2*A,D)));
+    FASTOR_EXIT_ASSERT(norm((d % d).dense() - matmul(D,D)) < BigTol*norm(matmul(D,D)));
+
+    FASTOR_EXIT_ASSERT(norm(matmul(D,solve(d,b)) - b) < BigTol*norm(b));
+    FASTOR_EXIT_ASSERT(norm(matmul(D,solve(d,B)) - B) < BigTol*norm(B));
+    FASTOR_EXIT_ASSERT(norm(matmul(D,solve(d,2*b)) - 2*b) < BigTol*norm(2*b));
+    FASTOR_EXIT_ASSERT(norm(matmul(inverse(d).dense(),D) - identity<T,N>()) < BigTol*norm(identity<T,N>()));
+    FASTOR_EXIT_ASSERT(std::abs(determinant(d) - product(diag(D))) < BigTol*std::abs(determinant(d)));
+    FASTOR_EXIT_ASSERT(std::abs(trace(d) - trace(D)) < BigTol*std::abs(trace(D)));
+
+    FASTOR_EXIT_ASSERT(norm((d + d - 3*d/2).dense() - D/2) < BigTol*norm(D/2));
+}
+
+template<typename T, size_t N, size_t KL, size_t KU>
+void test_banded() {
+    Tensor<T,N,N> A = random_dominant<T,N>();
+    const BandedTensor<T,N,KL,KU> a(A);
+    Tensor<T,N,N> D = a.dense();
+    for (size_t i=0; i<N; ++i) {
+        for (size_t j=0; j<N; ++j) {
+            const bool in_band = j + KL >= i && j <= i + KU;
+            FASTOR_EXIT_ASSERT(std::abs(a(i,j) - (in_band ? A(i,j) : T(0))) < Tol);
+        }
+    }
+
+    Tensor<T,N,3> B; B.random();
+    Tensor<T,N> b; b.random();
+    FASTOR_EXIT_ASSERT(norm(matmul(a,B) - matmul(D,B)) < BigTol*norm(matmul(D,B)));
+    FASTOR_EXIT_ASSERT(norm((a % b) - matmul(D,b)) < BigTol*norm(matmul(D,b)));
+    FASTOR_EXIT_ASSERT(norm(matmul(D,solve(a,b)) - b) < BigTol*norm(b));
+    FASTOR_EXIT_ASSERT(norm(matmul(D,solve(a,B)) - B) < BigTol*norm(B));
+    FASTOR_EXIT_ASSERT(norm(matmul(D,solve(a,B - 1)) - (B - 1)) < BigTol*norm(B - 1));
+    FASTOR_EXIT_ASSERT(norm(matmul(inverse(a),D) - identity<T,N>()) < BigTol*norm(identity<T,N>()));
+    const T detD = determinant(a);
+    FASTOR_EXIT_ASSERT(std::abs(detD - determinant<DetCompType::LU>(D)) < BigTol*std::abs(detD));
+    FASTOR_EXIT_ASSERT(std::abs(trace(a) - trace(D)) < BigTol*std::abs(trace(D)));
+
+    BandedTensor<T,N,KL,KU> c(a);
+    c += a; c -= 3*a;
+    FASTOR_EXIT_ASSERT(norm(c.dense() + D) < BigTol*norm(D));
+}
+
+template<typename T, size_t N, size_t B>
+void test_block_diagonal() {
+    Tensor<T,N,N> A = random_dominant<T,N>();
+    const BlockDiagonalTensor<T,N,B> a(A);
+    Tensor<T,N,N> D = a.dense();
+    FASTOR_EXIT_ASSERT(a.size() == N*B);
+    for (size_t i=0; i<N; ++i) {
+        for (size_t j=0; j<N; ++j) {
+            FASTOR_EXIT_ASSERT(std::abs(a(i,j) - (i/B==j/B ? A(i,j) : T(0))) < Tol);
+        }
+    }
+    FASTOR_EXIT_ASSERT(norm(a.block(1) - A(fseq<B,2*B>(),fseq<B,2*B>())) < Tol*norm(a.block(1)));
+
+    Tensor<T,N,4> C; C.random();
+    Tensor<T,N> c; c.random();
+    FASTOR_EXIT_ASSERT(norm(matmul(a,C) - matmul(D,C)) < BigTol*norm(matmul(D,C)));
+    FASTOR_EXIT_ASSERT(norm((a % c) - matmul(D,c)) < BigTol*norm(matmul(D,c)));
+    FASTOR_EXIT_ASSERT(norm(matmul(D,solve(a,c)) - c) < BigTol*norm(c));
+    FASTOR_EXIT_ASSERT(norm(matmul(D,solve(a,C)) - C) < BigTol*norm(C));
+    FASTOR_EXIT_ASSERT(norm(matmul(inverse(a).dense(),D) - identity<T,N>()) < BigTol*norm(identity<T,N>()));
+    const T detD = determinant(a);
+    FASTOR_EXIT_ASSERT(std::abs(detD - determinant<DetCompType::LU>(D)) < BigTol*std::abs(detD));
+}
+
+template<typename T>
+void test_structured_tensor() {
+
+    // lumped mass matrix and a tridiagonal stiffness matrix
+    {
+        Tensor<T,4> m = {2,4,4,2};
+        DiagonalTensor<T,4,4> Ml(m);
+        Tensor<T,4> f = {1,2,3,4};
+        Tensor<T,4> acc = solve(Ml,f);
+        FASTOR_EXIT_ASSERT(std::abs(acc(0) - 0.5) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(acc(1) - 0.5) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(acc(2) - 0.75) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(acc(3) - 2) < Tol);
+
+        TridiagonalTensor<T,4> K; K.zeros();
+        for (size_t i=0; i<4; ++i) {
+            K(i,i) = 2;
+            if (i>0) K(i,i-1) = -1;
+            if (i<3) K(i,i+1) = -1;
+        }
+        FASTOR_EXIT_ASSERT(std::abs(determinant(K) - 5) < BigTol*5);
+        Tensor<T,4> u = solve(K,f);
+        FASTOR_EXIT_ASSERT(norm(matmul(K,u) - f) < BigTol*norm(f));
+    }
+
+    test_diagonal<T,2>();
+    test_diagonal<T,3>();
+    test_diagonal<T,7>();
+
+    test_banded<T,4,1,1>();
+    test_banded<T,9,1,1>();
+    test_banded<T,8,2,1>();
+    test_banded<T,8,0,3>();
+    test_banded<T,10,3,2>();
+
+    test_block_diagonal<T,4,2>();
+    test_block_diagonal<T,9,3>();
+    test_block_diagonal<T,12,4>();
+    test_block_diagonal<T,12,6>();
+
+    print(FGRN(BOLD("All tests passed successfully")));
+
+}
+
+int main() {
+
+    print(FBLU(BOLD("Testing structured tensors: single precision")));
+    test_structured_tensor<float>();
+    print(FBLU(BOLD("Testing structured tensors: double precision")));
+    test_structured_tensor<double>();
+
+    return 0;
+}
@@ -0,0 +1,183 @@
+#include <Fastor/Fastor.h>
+
+using namespace Fastor;
+
+
+#define Tol 1e-12
+#define BigTol 1e-5
+#define HugeTol 1e-2
+
+
+template<typename T, size_t M, size_t N, size_t K>
+bool check_svd(const Tensor<T,M,N> &A, const Tensor<T,M,K> &U, const Tensor<T,K> &S, const Tensor<T,N,K> &V, T tol) {
+    Tensor<T,K,K> D; D.zeros();
+    for (size_t i=0; i<K; ++i) D(i,i) = S(i);
+    Tensor<T,K,K> I; I.eye2();
+    T scale = std::max(T(1),norm(A));
+    bool ok = norm(A - matmul(U,matmul(D,transpose(V)))) < tol*scale;
+    ok = ok && norm(matmul(transpose(U),U) - I) < tol;
+    ok = ok && norm(matmul(transpose(V),V) - I) < tol;
+    for (size_t i=0; i<K; ++i) ok = ok && S(i) >= 0;
+    for (size_t i=1; i<K; ++i) ok = ok && S(i-1) >= S(i);
+    return ok;
+}
+
+template<typename T, size_t M>
+bool check_polar(const Tensor<T,M,M> &A, const Tensor<T,M,M> &R, const Tensor<T,M,M> &H, T tol) {
+    Tensor<T,M,M> I; I.eye2();
+    T scale = std::max(T(1),norm(A));
+    bool ok = norm(A - matmul(R,H)) < tol*scale;
+    ok = ok && norm(matmul(transpose(R),R) - I) < tol;
+    ok = ok && norm(H - transpose(H)) < tol*scale;
+    return ok;
+}
+
+template<SVDCompType SVDType, typename T, size_t M, size_t N>
+void test_svd_random() {
+    constexpr size_t K = M < N ? M : N;
+    for (size_t n=0; n<10; ++n) {
+        Tensor<T,M,N> A; A.random();
+        Tensor<T,M,K> U; Tensor<T,K> S; Tensor<T,N,K> V;
+        svd<SVDType>(A, U, S, V);
+        FASTOR_EXIT_ASSERT(check_svd(A,U,S,V,T(BigTol)));
+    }
+}
+
+template<typename T>
+void test_svd() {
+
+    // 3x3
+    {
+        Tensor<T,3,3> A = {{2,-1,0},{-1,2,-1},{0,-1,2}};
+        Tensor<T,3,3> U, V; Tensor<T,3> S;
+        svd(A, U, S, V);
+        FASTOR_EXIT_ASSERT(std::abs(S(0) - (2+std::sqrt(T(2)))) < BigTol);
+        FASTOR_EXIT_ASSERT(std::abs(S(1) - 2) < BigTol);
+        FASTOR_EXIT_ASSERT(std::abs(S(2) - (2-std::sqrt(T(2)))) < BigTol);
+        FASTOR_EXIT_ASSERT(check_svd(A,U,S,V,T(BigTol)));
+
+        svd(A*2-1, U, S, V);
+        FASTOR_EXIT_ASSERT(check_svd(Tensor<T,3,3>(A*2-1),U,S,V,T(BigTol)));
+
+        svd<SVDCompType::Jacobi>(A, U, S, V);
+        FASTOR_EXIT_ASSERT(check_svd(A,U,S,V,T(BigTol)));
+
+        // negative determinant
+        Tensor<T,3,3> B = {{1,2,3},{4,5,6},{7,8,10}};
+        B(0,all) *= -1;
+        svd(B, U, S, V);
+        FASTOR_EXIT_ASSERT(check_svd(B,U,S,V,T(BigTol)));
+
+        // rank deficient
+        Tensor<T,3,3> C = {{1,2,3},{4,5,6},{7,8,9}};
+        svd(C, U, S, V);
+        FASTOR_EXIT_ASSERT(check_svd(C,U,S,V,T(BigTol)));
+        FASTOR_EXIT_ASSERT(std::abs(S(2)) < BigTol);
+        svd<SVDCompType::Jacobi>(C, U, S, V);
+        FASTOR_EXIT_ASSERT(check_svd(C,U,S,V,T(BigTol)));
+
+        // identity and zero
+        Tensor<T,3,3> I; I.eye2();
+        svd(I, U, S, V);
+        FASTOR_EXIT_ASSERT(check_svd(I,U,S,V,T(BigTol)));
+        Tensor<T,3,3> Z; Z.zeros();
+        svd(Z, U, S, V);
+        FASTOR_EXIT_ASSERT(check_svd(Z,U,S,V,T(BigTol)));
+        svd<SVDCompType::Jacobi>(Z, U, S, V);
+        FASTOR_EXIT_ASSERT(check_svd(Z,U,S,V,T(BigTol)));
+
+        test_svd_random<SVDCompType::Simple,T,3,3>();
+        test_svd_random<SVDCompType::Jacobi,T,3,3>();
+    }
+
+    // MxN
+    {
+        test_svd_random<SVDCompType::Simple,T,2,2>();
+        test_svd_random<SVDCompType::Simple,T,4,4>();
+        test_svd_random<SVDCompType::Simple,T,5,3>();
+        test_svd_random<SVDCompType::Simple,T,3,5>();
+        test_svd_random<SVDCompType::Jacobi,T,8,6>();
+        test_svd_random<SVDCompType::Jacobi,T,2,7>();
+
+        Tensor<T,4,2> A = {{1,2},{2,4},{3,6},{4,8}};
+        Tensor<T,4,2> U; Tensor<T,2> S; Tensor<T,2,2> V;
+        svd(A, U, S, V);
+        FASTOR_EXIT_ASSERT(check_svd(A,U,S,V,T(BigTol)));
+        FASTOR_EXIT_ASSERT(std::abs(S(1)) < BigTol);
+    }
+
+    // polar
+    {
+        Tensor<T,3,3> F = {{1.1,0.2,0.},{-0.1,0.9,0.3},{0.05,0.,1.2}};
+        Tensor<T,3,3> R, H;
+        polar(F, R, H);
+        FASTOR_EXIT_ASSERT(check_polar(F,R,H,T(BigTol)));
+        FASTOR_EXIT_ASSERT(std::abs(determinant(R) - 1) < BigTol);
+        // H is the right stretch tensor
+        FASTOR_EXIT_ASSERT(norm(matmul(H,H) - matmul(transpose(F),F)) < BigTol);
+
+        polar(F+0, R, H);
+        FASTOR_EXIT_ASSERT(check_polar(F,R,H,T(BigTol)));
+
+        // pure rotation
+        T theta = 0.3;
+        Tensor<T,3,3> Q = {{std::cos(theta),-std::sin(theta),T(0)},{std::sin(theta),std::cos(theta),T(0)},{T(0),T(0),T(1)}};
+        polar(Q, R, H);
+        FASTOR_EXIT_ASSERT(norm(R - Q) < BigTol);
+        Tensor<T,3,3> I; I.eye2();
+        FASTOR_EXIT_ASSERT(norm(H - I) < BigTol);
+
+        Tensor<T,4,4> G; G.random();
+        Tensor<T,4,4> R4, H4;
+        polar(G, R4, H4);
+        FASTOR_EXIT_ASSERT(check_polar(G,R4,H4,T(BigTol)));
+        polar<SVDCompType::Jacobi>(F, R, H);
+        FASTOR_EXIT_ASSERT(check_polar(F,R,H,T(BigTol)));
+    }
+
+    // batch
+    {
+        Tensor<T,3,3,3,3> A; A.random();
+        A(0,1,all,all) = 0;
+        A(1,1,all,all) = 0; A(1,1,0,0) = 2; A(1,1,1,1) = 2; A(1,1,2,2) = 2;
+        Tensor<T,3,3,3,3> U, V, R, H; Tensor<T,3,3,3> S;
+        svd(A, U, S, V);
+        polar(A, R, H);
+        for (size_t i=0; i<3; ++i) {
+            for (size_t j=0; j<3; ++j) {
+                Tensor<T,3,3> Ai = A(i,j,all,all);
+                Tensor<T,3,3> Ui = U(i,j,all,all);
+                Tensor<T,3> Si = S(i,j,all);
+                Tensor<T,3,3> Vi = V(i,j,all,all);
+                FASTOR_EXIT_ASSERT(check_svd(Ai,Ui,Si,Vi,T(BigTol)));
+                Tensor<T,3,3> Ri = R(i,j,all,all);
+                Tensor<T,3,3> Hi = H(i,j,all,all);
+                FASTOR_EXIT_ASSERT(check_polar(Ai,Ri,Hi,T(BigTol)));
+            }
+        }
+
+        Tensor<T,5,4,4> B; B.random();
+        Tensor<T,5,4,4> UB, VB; Tensor<T,5,4> SB;
+        svd(B, UB, SB, VB);
+        for (size_t i=0; i<5; ++i) {
+            Tensor<T,4,4> Bi = B(i,all,all);
+            Tensor<T,4,4> Ui = UB(i,all,all);
+            Tensor<T,4> Si = SB(i,all);
+            Tensor<T,4,4> Vi = VB(i,all,all);
+            FASTOR_EXIT_ASSERT(check_svd(Bi,Ui,Si,Vi,T(BigTol)));
+        }
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+
+}
+
+int main() {
+
+    print(FBLU(BOLD("Testing singular value and polar decomposition: single precision")));
+    test_svd<float>();
+    print(FBLU(BOLD("Testing singular value and polar decomposition: double precision")));
+    test_svd<double>();
+
+    return 0;
+}
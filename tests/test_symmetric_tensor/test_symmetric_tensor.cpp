@@ -0,0 +1,165 @@
+#include <Fastor/Fastor.h>
+
+using namespace Fastor;
+
+
+#define Tol 1e-12
+#define BigTol 1e-5
+#define HugeTol 1e-2
+
+
+template<typename T, size_t M>
+Tensor<T,M,M> random_symmetric() {
+    Tensor<T,M,M> A; A.random();
+    Tensor<T,M,M> I; I.eye2();
+    return A + transpose(A) + T(M)*I;
+}
+
+template<typename T, size_t M>
+Tensor<T,M,M,M,M> random_minor_symmetric(bool major) {
+    Tensor<T,M,M,M,M> C; C.random();
+    Tensor<T,M,M,M,M> D;
+    for (size_t i=0; i<M; ++i)
+        for (size_t j=0; j<M; ++j)
+            for (size_t k=0; k<M; ++k)
+                for (size_t l=0; l<M; ++l)
+                    D(i,j,k,l) = C(i,j,k,l) + C(j,i,k,l) + C(i,j,l,k) + C(j,i,l,k)
+                        + (major ? C(k,l,i,j) + C(l,k,i,j) + C(k,l,j,i) + C(l,k,j,i) : T(0));
+    // well conditioned on the symmetric tensors
+    for (size_t i=0; i<M; ++i)
+        for (size_t j=0; j<M; ++j) {
+            D(i,j,i,j) += T(2*M);
+            D(i,j,j,i) += T(2*M);
+        }
+    return D;
+}
+
+template<typename T, size_t M>
+void test_symmetric_tensor_2() {
+    Tensor<T,M,M> A = random_symmetric<T,M>();
+    Tensor<T,M,M> B = random_symmetric<T,M>();
+    SymmetricTensor<T,M,M> a(A), b(B);
+
+    FASTOR_EXIT_ASSERT(a.size() == M*(M+1)/2);
+    FASTOR_EXIT_ASSERT(norm(a.dense() - A) < Tol);
+    for (size_t i=0; i<M; ++i)
+        for (size_t j=0; j<M; ++j)
+            FASTOR_EXIT_ASSERT(std::abs(a(i,j) - A(i,j)) < Tol);
+
+    FASTOR_EXIT_ASSERT(norm((a + b).dense() - (A + B)) < BigTol);
+    FASTOR_EXIT_ASSERT(norm((a - b).dense() - (A - B)) < BigTol);
+    FASTOR_EXIT_ASSERT(norm((-a).dense() + A) < BigTol);
+    FASTOR_EXIT_ASSERT(norm((2*a).dense() - 2*A) < BigTol);
+    FASTOR_EXIT_ASSERT(norm((a*2).dense() - 2*A) < BigTol);
+    FASTOR_EXIT_ASSERT(norm((a/2).dense() - A/2) < BigTol);
+
+    FASTOR_EXIT_ASSERT(std::abs(doublecontract(a,b) - inner(A,B)) < BigTol*std::abs(inner(A,B)));
+    FASTOR_EXIT_ASSERT(std::abs(trace(a) - trace(A)) < BigTol);
+    FASTOR_EXIT_ASSERT(std::abs(determinant(a) - determinant<DetCompType::LU>(A)) < BigTol*std::abs(determinant<DetCompType::LU>(A)));
+    FASTOR_EXIT_ASSERT(norm(matmul(a,b) - matmul(A,B)) < BigTol);
+    Tensor<T,M,4> C; C.random();
+    FASTOR_EXIT_ASSERT(norm(matmul(a,C) - matmul(A,C)) < BigTol);
+    Tensor<T,M> c; c.random();
+    FASTOR_EXIT_ASSERT(norm(matmul(a,c) - matmul(A,c)) < BigTol);
+
+    Tensor<T,M,M> I; I.eye2();
+    FASTOR_EXIT_ASSERT(norm(matmul(inverse(a).dense(),A) - I) < BigTol);
+
+    // symmetric part of a general tensor or expression
+    Tensor<T,M,M> G; G.random();
+    SymmetricTensor<T,M,M> g(G), h(G + 0);
+    FASTOR_EXIT_ASSERT(norm(g.dense() - T(0.5)*(G + transpose(G))) < BigTol);
+    FASTOR_EXIT_ASSERT(norm(h.dense() - g.dense()) < Tol);
+}
+
+template<typename T, size_t M, bool MajorSym>
+void test_minor_symmetric_tensor_4() {
+    constexpr size_t N = M*(M+1)/2;
+    Tensor<T,M,M,M,M> D = random_minor_symmetric<T,M>(MajorSym);
+    Tensor<T,M,M,M,M> E = random_minor_symmetric<T,M>(MajorSym);
+    MinorSymmetricTensor4<T,M,MajorSym> d(D), e(E);
+    FASTOR_EXIT_ASSERT(d.size() == (MajorSym ? N*(N+1)/2 : N*N));
+    FASTOR_EXIT_ASSERT(norm(d.dense() - D) < BigTol);
+    FASTOR_EXIT_ASSERT(norm((d + e).dense() - (D + E)) < BigTol);
+    FASTOR_EXIT_ASSERT(norm((d - 2*e).dense() - (D - 2*E)) < BigTol);
+
+    Tensor<T,M,M> S = random_symmetric<T,M>();
+    SymmetricTensor<T,M,M> s(S);
+
+    // C : S, S : C and C : C against the dense contractions
+    Tensor<T,M,M> DS = einsum<Index<0,1,2,3>,Index<2,3>>(D,S);
+    Tensor<T,M,M> SD = einsum<Index<0,1>,Index<0,1,2,3>>(S,D);
+    Tensor<T,M,M,M,M> DE = einsum<Index<0,1,4,5>,Index<4,5,2,3>>(D,E);
+    FASTOR_EXIT_ASSERT(norm(doublecontract(d,s).dense() - DS) < BigTol*norm(DS));
+    FASTOR_EXIT_ASSERT(norm(doublecontract(s,d).dense() - SD) < BigTol*norm(SD));
+    FASTOR_EXIT_ASSERT(norm(doublecontract(d,e).dense() - DE) < BigTol*norm(DE));
+
+    // C : C^{-1} : S = S
+    auto dinv = inverse(d);
+    FASTOR_EXIT_ASSERT(norm(doublecontract(d,doublecontract(dinv,s)).dense() - S) < BigTol*norm(S));
+    FASTOR_EXIT_ASSERT(norm(doublecontract(doublecontract(s,dinv),d).dense() - S) < BigTol*norm(S));
+
+    // Voigt round trip
+    MinorSymmetricTensor4<T,M,MajorSym> f(voigt(d));
+    FASTOR_EXIT_ASSERT(norm(f.dense() - D) < BigTol);
+    FASTOR_EXIT_ASSERT(voigt(s)(0) == s(0,0));
+}
+
+template<typename T>
+void test_symmetric_tensor() {
+
+    // fixed values
+    {
+        Tensor<T,3,3> A = {{4,1,2},{1,5,3},{2,3,6}};
+        SymmetricTensor<T,3,3> a(A);
+        FASTOR_EXIT_ASSERT(std::abs(a.data()[0] - 4) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(a.data()[1] - 5) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(a.data()[2] - 6) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(a.data()[3] - 1) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(a.data()[4] - 2) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(a.data()[5] - 3) < Tol);
+        a(2,1) = 7;
+        FASTOR_EXIT_ASSERT(std::abs(a(1,2) - 7) < Tol);
+
+        // isotropic elasticity tensor lambda I x I + 2 mu I^sym
+        const T lambda = 2, mu = 3;
+        MinorSymmetricTensor4<T,3,true> Ce; Ce.zeros();
+        for (size_t i=0; i<3; ++i) {
+            for (size_t j=0; j<3; ++j) Ce(i,i,j,j) = lambda;
+            Ce(i,i,i,i) = lambda + 2*mu;
+        }
+        Ce(0,1,0,1) = mu; Ce(0,2,0,2) = mu; Ce(1,2,1,2) = mu;
+        FASTOR_EXIT_ASSERT(Ce.size() == 21);
+
+        SymmetricTensor<T,3,3> eps(A);
+        SymmetricTensor<T,3,3> sig = doublecontract(Ce,eps);
+        Tensor<T,3,3> I; I.eye2();
+        Tensor<T,3,3> sig_exact = lambda*trace(A)*I + 2*mu*A;
+        FASTOR_EXIT_ASSERT(norm(sig.dense() - sig_exact) < BigTol);
+        // compliance recovers the strain
+        FASTOR_EXIT_ASSERT(norm(doublecontract(inverse(Ce),sig).dense() - A) < BigTol);
+    }
+
+    test_symmetric_tensor_2<T,2>();
+    test_symmetric_tensor_2<T,3>();
+    test_symmetric_tensor_2<T,4>();
+    test_symmetric_tensor_2<T,6>();
+
+    test_minor_symmetric_tensor_4<T,2,false>();
+    test_minor_symmetric_tensor_4<T,2,true>();
+    test_minor_symmetric_tensor_4<T,3,false>();
+    test_minor_symmetric_tensor_4<T,3,true>();
+
+    print(FGRN(BOLD("All tests passed successfully")));
+
+}
+
+int main() {
+
+    print(FBLU(BOLD("Testing symmetric tensors: single precision")));
+    test_symmetric_tensor<float>();
+    print(FBLU(BOLD("Testing symmetric tensors: double precision")));
+    test_symmetric_tensor<double>();
+
+    return 0;
+}
@@ -0,0 +1,115 @@
+#include <Fastor/Fastor.h>
+
+using namespace Fastor;
+
+
+#define Tol 1e-12
+#define BigTol 1e-5
+#define HugeTol 1e-2
+
+
+template<typename T, size_t M>
+void make_triangular(Tensor<T,M,M> &L, Tensor<T,M,M> &U) {
+    Tensor<T,M,M> A; A.random();
+    L.zeros(); U.zeros();
+    for (size_t i=0; i<M; ++i) {
+        for (size_t j=0; j<i; ++j) {
+            L(i,j) = A(i,j) - T(0.5);
+            U(j,i) = A(j,i) - T(0.5);
+        }
+        L(i,i) = T(2) + A(i,i);
+        U(i,i) = T(2) + A(i,i);
+    }
+}
+
+template<typename T, size_t M, size_t N>
+void test_trsm_random() {
+    Tensor<T,M,M> L, U;
+    make_triangular(L,U);
+    Tensor<T,M,M> L1(L), U1(U);
+    for (size_t i=0; i<M; ++i) {
+        L1(i,i) = T(1);
+        U1(i,i) = T(1);
+    }
+
+    Tensor<T,M,N> B; B.random();
+    Tensor<T,M> b; b.random();
+
+    FASTOR_EXIT_ASSERT(norm(matmul(L , trsm<UpLoType::Lower>   (L,B)) - B) < BigTol);
+    FASTOR_EXIT_ASSERT(norm(matmul(U , trsm<UpLoType::Upper>   (U,B)) - B) < BigTol);
+    FASTOR_EXIT_ASSERT(norm(matmul(L1, trsm<UpLoType::UniLower>(L,B)) - B) < BigTol);
+    FASTOR_EXIT_ASSERT(norm(matmul(U1, trsm<UpLoType::UniUpper>(U,B)) - B) < BigTol);
+
+    FASTOR_EXIT_ASSERT(norm(matmul(L , trsv<UpLoType::Lower>   (L,b)) - b) < BigTol);
+    FASTOR_EXIT_ASSERT(norm(matmul(U , trsv<UpLoType::Upper>   (U,b)) - b) < BigTol);
+    FASTOR_EXIT_ASSERT(norm(matmul(L1, trsv<UpLoType::UniLower>(L,b)) - b) < BigTol);
+    FASTOR_EXIT_ASSERT(norm(matmul(U1, trsv<UpLoType::UniUpper>(U,b)) - b) < BigTol);
+
+    // only the triangular part is referenced
+    Tensor<T,M,M> LU = L + U;
+    for (size_t i=0; i<M; ++i) LU(i,i) = L(i,i);
+    FASTOR_EXIT_ASSERT(norm(trsm<UpLoType::Lower>(LU,B) - trsm<UpLoType::Lower>(L,B)) < BigTol);
+    FASTOR_EXIT_ASSERT(norm(trsm<UpLoType::Upper>(LU,B) - trsm<UpLoType::Upper>(U,B)) < BigTol);
+    FASTOR_EXIT_ASSERT(norm(trsv<UpLoType::UniLower>(LU,b) - trsv<UpLoType::UniLower>(L1,b)) < BigTol);
+}
+
+template<typename T>
+void test_trsm() {
+
+    // fixed values
+    {
+        Tensor<T,3,3> L = {{2,0,0},{1,1,0},{-1,2,4}};
+        Tensor<T,3> b = {2,3,11};
+        Tensor<T,3> x = trsv(L,b);
+        FASTOR_EXIT_ASSERT(std::abs(x(0) - 1) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(x(1) - 2) < Tol);
+        FASTOR_EXIT_ASSERT(std::abs(x(2) - 2) < Tol);
+
+        Tensor<T,3,3> U = transpose(L);
+        Tensor<T,3> y = trsv<UpLoType::Upper>(U,b);
+        FASTOR_EXIT_ASSERT(norm(matmul(U,y) - b) < BigTol);
+
+        Tensor<T,3,2> B;
+        B(all,0) = b;
+        B(all,1) = 2*b;
+        Tensor<T,3,2> X = trsm(L,B);
+        FASTOR_EXIT_ASSERT(norm(X(all,0) - x) < BigTol);
+        FASTOR_EXIT_ASSERT(norm(X(all,1) - 2*x) < BigTol);
+    }
+
+    // expressions
+    {
+        Tensor<T,4,4> L, U;
+        make_triangular(L,U);
+        Tensor<T,4,3> B; B.random();
+        Tensor<T,4,3> X = trsm<UpLoType::Upper>(U,B);
+        FASTOR_EXIT_ASSERT(norm(trsm<UpLoType::Upper>(U+0,B) - X) < BigTol);
+        FASTOR_EXIT_ASSERT(norm(trsm<UpLoType::Upper>(U,B+0) - X) < BigTol);
+        FASTOR_EXIT_ASSERT(norm(trsm<UpLoType::Upper>(U*1,B+0) - X) < BigTol);
+        Tensor<T,4> b = B(all,0);
+        FASTOR_EXIT_ASSERT(norm(trsv<UpLoType::Upper>(U,b+0) - X(all,0)) < BigTol);
+    }
+
+    test_trsm_random<T,1,1>();
+    test_trsm_random<T,2,5>();
+    test_trsm_random<T,3,3>();
+    test_trsm_random<T,4,1>();
+    test_trsm_random<T,5,8>();
+    test_trsm_random<T,8,4>();
+    test_trsm_random<T,13,17>();
+    test_trsm_random<T,20,20>();
+    test_trsm_random<T,33,7>();
+
+    print(FGRN(BOLD("All tests passed successfully")));
+
+}
+
+int main() {
+
+    print(FBLU(BOLD("Testing triangular solve: single precision")));
+    test_trsm<float>();
+    print(FBLU(BOLD("Testing triangular solve: double precision")));
+    test_trsm<double>();
+
+    return 0;
+}
@@ -125,6 +125,46 @@ void run() {
                 counter++;
             }
         }
+    }
+
+    {
+        // nine point stencil over shifted views with rows that do not fill whole SIMD vectors
+        constexpr int m = 21, n = 67;
+        Tensor<T,m,n> u; u.iota(1); u = sin(u);
+        Tensor<T,m,n> v; v.zeros();
+        Tensor<T,m,n> ref; ref.zeros();
+        for (int i=1; i<m-1; ++i) {
+            for (int j=1; j<n-1; ++j) {
+                ref(i,j) = ((u(i-1,j) + u(i+1,j) + u(i,j-1) + u(i,j+1))*T(4) +
+                    u(i-1,j-1) + u(i-1,j+1) + u(i+1,j-1) + u(i+1,j+1)) / T(20);
+            }
+        }
+
+        v(seq(1,last-1),seq(1,last-1)) =
+            ((  u(seq(0,last-2),seq(1,last-1)) + u(seq(2,last),seq(1,last-1)) +
+                u(seq(1,last-1),seq(0,last-2)) + u(seq(1,last-1),seq(2,last)) )*T(4) +
+                u(seq(0,last-2),seq(0,last-2)) + u(seq(0,last-2),seq(2,last)) +
+                u(seq(2,last),seq(0,last-2))   + u(seq(2,last),seq(2,last)) ) / T(20);
+        FASTOR_EXIT_ASSERT(norm(v - ref) < BigTol);
+
+        v(seq(1,last-1),seq(1,last-1)) -= u(seq(1,last-1),seq(1,last-1));
+        v(seq(1,last-1),seq(1,last-1)) += u(seq(1,last-1),seq(1,last-1));
+        FASTOR_EXIT_ASSERT(norm(v - ref) < BigTol);
+
+        // in place
+        u(seq(1,last-1),seq(1,last-1)).noalias() =
+            ((  u(seq(0,last-2),seq(1,last-1)) + u(seq(2,last),seq(1,last-1)) +
+                u(seq(1,last-1),seq(0,last-2)) + u(seq(1,last-1),seq(2,last)) )*T(4) +
+                u(seq(0,last-2),seq(0,last-2)) + u(seq(0,last-2),seq(2,last)) +
+                u(seq(2,last),seq(0,last-2))   + u(seq(2,last),seq(2,last)) ) / T(20);
+        FASTOR_EXIT_ASSERT(norm(u(seq(1,last-1),seq(1,last-1)) - ref(seq(1,last-1),seq(1,last-1))) < BigTol);
+
+        // every other column
+        v.zeros();
+        v(seq(1,last-1),seq(1,last-1,2)) = ref(seq(1,last-1),seq(1,last-1,2));
+        v(seq(1,last-1),seq(1,last-1,2)) *= T(2);
+        v(seq(1,last-1),seq(1,last-1,2)) /= T(2)*ref(seq(1,last-1),seq(1,last-1,2));
+        FASTOR_EXIT_ASSERT(std::abs(v.sum() - T((m-2)*(n-1)/2)) < BigTol);
 
         print(FGRN(BOLD("All tests passed successfully")));
     }
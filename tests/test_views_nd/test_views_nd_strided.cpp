@@ -0,0 +1,182 @@
+#include <Fastor/Fastor.h>
+using namespace Fastor;
+
+
+#define Tol 1e-12
+#define BigTol 1e-5
+
+
+// Reference update of the elements a(i0+s0*i,j0+s1*j,k0+s2*k) of a view of
+// extent n0 x n1 x n2, where the update gets the element and the index of the view
+template<typename T, size_t M, size_t N, size_t P, typename Op>
+void reference(Tensor<T,M,N,P> &a, int i0, int s0, int n0, int j0, int s1, int n1, int k0, int s2, int n2, Op op) {
+    for (int i=0; i<n0; ++i)
+        for (int j=0; j<n1; ++j)
+            for (int k=0; k<n2; ++k)
+                op(a(i0+s0*i,j0+s1*j,k0+s2*k),i,j,k);
+}
+
+
+template<typename T>
+void test_strided_views(T tol) {
+
+    Tensor<T,4,5,19> b; b.iota(3);
+
+    // contiguous rows with a remainder that does not fill a SIMD vector
+    {
+        Tensor<T,4,5,19> a; a.iota(1);
+        Tensor<T,4,5,19> ref = a;
+        auto src = [&](int i, int j, int k) {return b(i,2*j,k+2);};
+
+        a(seq(1,4),seq(0,5,2),seq(1,18)) = b(seq(0,3),seq(0,5,2),seq(2,19));
+        reference(ref,1,1,3,0,2,3,1,1,17,[&](T &x, int i, int j, int k) {x = src(i,j,k);});
+        FASTOR_EXIT_ASSERT(norm(a - ref) < tol*norm(ref));
+
+        a(seq(1,4),seq(0,5,2),seq(1,18)) += b(seq(0,3),seq(0,5,2),seq(2,19));
+        reference(ref,1,1,3,0,2,3,1,1,17,[&](T &x, int i, int j, int k) {x += src(i,j,k);});
+        FASTOR_EXIT_ASSERT(norm(a - ref) < tol*norm(ref));
+
+        a(seq(1,4),seq(0,5,2),seq(1,18)) -= 2*b(seq(0,3),seq(0,5,2),seq(2,19));
+        reference(ref,1,1,3,0,2,3,1,1,17,[&](T &x, int i, int j, int k) {x -= 2*src(i,j,k);});
+        FASTOR_EXIT_ASSERT(norm(a - ref) < tol*norm(ref));
+
+        a(seq(1,4),seq(0,5,2),seq(1,18)) *= b(seq(0,3),seq(0,5,2),seq(2,19));
+        reference(ref,1,1,3,0,2,3,1,1,17,[&](T &x, int i, int j, int k) {x *= src(i,j,k);});
+        FASTOR_EXIT_ASSERT(norm(a - ref) < tol*norm(ref));
+
+        a(seq(1,4),seq(0,5,2),seq(1,18)) /= b(seq(0,3),seq(0,5,2),seq(2,19));
+        reference(ref,1,1,3,0,2,3,1,1,17,[&](T &x, int i, int j, int k) {x /= src(i,j,k);});
+        FASTOR_EXIT_ASSERT(norm(a - ref) < tol*norm(ref));
+
+        a(seq(1,4),seq(0,5,2),seq(1,18)) += 7;
+        reference(ref,1,1,3,0,2,3,1,1,17,[&](T &x, int, int, int) {x += 7;});
+        FASTOR_EXIT_ASSERT(norm(a - ref) < tol*norm(ref));
+
+        a(seq(1,4),seq(0,5,2),seq(1,18)) *= 3;
+        reference(ref,1,1,3,0,2,3,1,1,17,[&](T &x, int, int, int) {x *= 3;});
+        FASTOR_EXIT_ASSERT(norm(a - ref) < tol*norm(ref));
+
+        a(seq(1,4),seq(0,5,2),seq(1,18)) = 5;
+        reference(ref,1,1,3,0,2,3,1,1,17,[&](T &x, int, int, int) {x = 5;});
+        FASTOR_EXIT_ASSERT(norm(a - ref) < tol*norm(ref));
+    }
+
+    // strided rows on both sides
+    {
+        Tensor<T,4,5,19> a; a.iota(1);
+        Tensor<T,4,5,19> ref = a;
+        auto src = [&](int i, int j, int k) {return b(i+1,j,3*k);};
+
+        a(seq(0,4,2),seq(1,5),seq(0,19,3)) = b(seq(1,4,2),seq(0,4),seq(0,19,3));
+        reference(ref,0,2,2,1,1,4,0,3,7,[&](T &x, int i, int j, int k) {x = src(2*i,j,k);});
+        FASTOR_EXIT_ASSERT(norm(a - ref) < tol*norm(ref));
+
+        a(seq(0,4,2),seq(1,5),seq(0,19,3)) += b(seq(1,4,2),seq(0,4),seq(0,19,3));
+        reference(ref,0,2,2,1,1,4,0,3,7,[&](T &x, int i, int j, int k) {x += src(2*i,j,k);});
+        FASTOR_EXIT_ASSERT(norm(a - ref) < tol*norm(ref));
+
+        a(seq(0,4,2),seq(1,5),seq(0,19,3)) /= 2;
+        reference(ref,0,2,2,1,1,4,0,3,7,[&](T &x, int, int, int) {x /= 2;});
+        FASTOR_EXIT_ASSERT(norm(a - ref) < tol*norm(ref));
+    }
+
+    // view to view copies and contiguous rows read from strided ones
+    {
+        Tensor<T,4,5,19> a; a.iota(1);
+        Tensor<T,4,5,19> ref = a;
+
+        a(seq(0,2),seq(0,5),seq(0,6)) = a(seq(2,4),seq(0,5),seq(0,18,3));
+        reference(ref,0,1,2,0,1,5,0,1,6,[&](T &x, int i, int j, int k) {x = ref(i+2,j,3*k);});
+        FASTOR_EXIT_ASSERT(norm(a - ref) < tol*norm(ref));
+
+        Tensor<T,3,3,17> c = b(seq(0,3),seq(0,5,2),seq(2,19));
+        a(seq(1,4),seq(0,5,2),seq(1,18)) = c;
+        Tensor<T,3,3,17> d = a(seq(1,4),seq(0,5,2),seq(1,18));
+        FASTOR_EXIT_ASSERT(norm(d - c) < tol*norm(c));
+    }
+
+    // fixed views
+    {
+        Tensor<T,4,5,19> a; a.iota(1);
+        Tensor<T,4,5,19> ref = a;
+
+        a(fseq<1,4>(),fseq<0,5,2>(),fseq<1,18>()) = b(fseq<0,3>(),fseq<0,5,2>(),fseq<2,19>());
+        reference(ref,1,1,3,0,2,3,1,1,17,[&](T &x, int i, int j, int k) {x = b(i,2*j,k+2);});
+        FASTOR_EXIT_ASSERT(norm(a - ref) < tol*norm(ref));
+
+        a(fseq<1,4>(),fseq<0,5,2>(),fseq<1,18>()) *= b(fseq<0,3>(),fseq<0,5,2>(),fseq<2,19>());
+        reference(ref,1,1,3,0,2,3,1,1,17,[&](T &x, int i, int j, int k) {x *= b(i,2*j,k+2);});
+        FASTOR_EXIT_ASSERT(norm(a - ref) < tol*norm(ref));
+
+        a(fseq<0,4,2>(),fseq<1,5>(),fseq<0,19,3>()) -= b(fseq<1,4,2>(),fseq<0,4>(),fseq<0,19,3>());
+        reference(ref,0,2,2,1,1,4,0,3,7,[&](T &x, int i, int j, int k) {x -= b(2*i+1,j,3*k);});
+        FASTOR_EXIT_ASSERT(norm(a - ref) < tol*norm(ref));
+
+        a(fseq<1,4>(),fseq<0,5,2>(),fseq<1,18>()) += 11;
+        reference(ref,1,1,3,0,2,3,1,1,17,[&](T &x, int, int, int) {x += 11;});
+        FASTOR_EXIT_ASSERT(norm(a - ref) < tol*norm(ref));
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+
+template<typename T>
+void test_integral_strided_views() {
+
+    Tensor<T,2,3,35> b; b.iota(3);
+    auto equal = [](const Tensor<T,2,3,35> &x, const Tensor<T,2,3,35> &y) {
+        for (size_t i=0; i<x.size(); ++i) if (x.data()[i] != y.data()[i]) return false;
+        return true;
+    };
+
+    // strided rows
+    {
+        Tensor<T,2,3,35> a; a.iota(1);
+        Tensor<T,2,3,35> ref = a;
+        a(seq(0,2),seq(0,3),seq(0,34,2)) = b(seq(0,2),seq(0,3),seq(1,35,2));
+        reference(ref,0,1,2,0,1,3,0,2,17,[&](T &x, int i, int j, int k) {x = b(i,j,2*k+1);});
+        FASTOR_EXIT_ASSERT(equal(a,ref));
+
+        a(seq(0,2),seq(0,3),seq(0,34,2)) += b(seq(0,2),seq(0,3),seq(1,35,2));
+        reference(ref,0,1,2,0,1,3,0,2,17,[&](T &x, int i, int j, int k) {x += b(i,j,2*k+1);});
+        FASTOR_EXIT_ASSERT(equal(a,ref));
+
+        a(seq(0,2),seq(0,3),seq(0,34,2)) *= 3;
+        reference(ref,0,1,2,0,1,3,0,2,17,[&](T &x, int, int, int) {x *= 3;});
+        FASTOR_EXIT_ASSERT(equal(a,ref));
+
+        a(fseq<0,2>(),fseq<0,3>(),fseq<1,35,3>()) -= b(fseq<0,2>(),fseq<0,3>(),fseq<0,34,3>());
+        reference(ref,0,1,2,0,1,3,1,3,12,[&](T &x, int i, int j, int k) {x -= b(i,j,3*k);});
+        FASTOR_EXIT_ASSERT(equal(a,ref));
+    }
+
+    // negative steps
+    {
+        Tensor<T,2,3,35> a; a.iota(1);
+        Tensor<T,2,3,35> ref = a;
+        a(seq(1,0,-1),seq(2,0,-1),seq(34,0,-1)) = b(seq(0,1),seq(0,2),seq(0,34));
+        reference(ref,1,-1,1,2,-1,2,34,-1,34,[&](T &x, int i, int j, int k) {x = b(i,j,k);});
+        FASTOR_EXIT_ASSERT(equal(a,ref));
+
+        a(seq(1,0,-1),seq(2,0,-1),seq(33,0,-2)) -= b(seq(0,1),seq(1,3),seq(0,17));
+        reference(ref,1,-1,1,2,-1,2,33,-2,17,[&](T &x, int i, int j, int k) {x -= b(i,j+1,k);});
+        FASTOR_EXIT_ASSERT(equal(a,ref));
+    }
+
+    print(FGRN(BOLD("All tests passed successfully")));
+}
+
+
+int main() {
+
+    print(FBLU(BOLD("Testing strided multi-dimensional tensor views: single precision")));
+    test_strided_views<float>(BigTol);
+    print(FBLU(BOLD("Testing strided multi-dimensional tensor views: double precision")));
+    test_strided_views<double>(Tol);
+    print(FBLU(BOLD("Testing strided multi-dimensional tensor views: integers")));
+    test_integral_strided_views<int>();
+    test_integral_strided_views<Int64>();
+
+    return 0;
+}